@@ -0,0 +1,5 @@
+option(USE_TRACING OFF)
+if( USE_TRACING )
+    message( STATUS "Enable tracing spans" )
+    add_compile_definitions(PPC_ENABLE_TRACING)
+endif( USE_TRACING )
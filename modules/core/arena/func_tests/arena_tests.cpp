@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "core/arena/include/arena.hpp"
+#include "core/task/func_tests/test_task.hpp"
+#include "core/task/include/task.hpp"
+
+TEST(arena_tests, check_alignment_of_allocations) {
+  ppc::core::Arena arena;
+  for (size_t bytes : {1, 3, 64, 100, 4096}) {
+    auto *ptr = arena.Allocate(bytes);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % ppc::core::kCacheLineSize, 0U);
+  }
+  auto *page = arena.Allocate(10, 4096);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(page) % 4096, 0U);
+  EXPECT_ANY_THROW(arena.Allocate(10, 3));
+}
+
+TEST(arena_tests, check_growth_and_reset_merge_blocks) {
+  ppc::core::Arena arena(ppc::core::ArenaOptions{.block_size = 1024, .huge_pages = false});
+  auto first = arena.AllocateArray<double>(100);
+  auto second = arena.AllocateArray<double>(1000);
+  first[99] = 1.0;
+  second[999] = 2.0;
+  EXPECT_GT(arena.NumBlocks(), 1U);
+  const size_t reserved = arena.BytesReserved();
+
+  arena.Reset();
+  EXPECT_EQ(arena.NumBlocks(), 1U);
+  EXPECT_EQ(arena.BytesReserved(), reserved);
+  EXPECT_EQ(arena.BytesUsed(), 0U);
+
+  // Same sequence fits into the merged block without new allocations
+  (void)arena.AllocateArray<double>(100);
+  (void)arena.AllocateArray<double>(1000);
+  EXPECT_EQ(arena.NumBlocks(), 1U);
+}
+
+TEST(arena_tests, check_scope_rewinds) {
+  ppc::core::Arena arena;
+  (void)arena.AllocateArray<int>(10);
+  const size_t used = arena.BytesUsed();
+  {
+    ppc::core::ArenaScope scope(arena);
+    (void)arena.AllocateArray<int>(1000);
+    EXPECT_GT(arena.BytesUsed(), used);
+  }
+  EXPECT_EQ(arena.BytesUsed(), used);
+}
+
+TEST(arena_tests, check_huge_page_block) {
+  ppc::core::Arena arena(ppc::core::ArenaOptions{.block_size = size_t{4} << 20, .huge_pages = true});
+  auto data = arena.AllocateArray<uint8_t>(size_t{3} << 20);
+  data.back() = 1;
+  data.front() = 1;
+  EXPECT_GE(arena.BytesReserved(), size_t{4} << 20);
+}
+
+TEST(arena_tests, check_std_vector_over_arena) {
+  ppc::core::Arena arena;
+  std::vector<int, ppc::core::ArenaAllocator<int>> values{ppc::core::ArenaAllocator<int>(arena)};
+  for (int i = 0; i < 1000; i++) {
+    values.push_back(i);
+  }
+  EXPECT_EQ(values[999], 999);
+  EXPECT_GE(arena.BytesUsed(), 1000 * sizeof(int));
+}
+
+TEST(arena_tests, check_thread_arena_is_reset_by_task_run) {
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  (void)ppc::core::ThreadArena().AllocateArray<double>(512);
+  EXPECT_GT(ppc::core::ThreadArena().BytesUsed(), 0U);
+
+  ppc::test::task::TestTask<int32_t> test_task(task_data);
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+
+  EXPECT_EQ(ppc::core::ThreadArena().BytesUsed(), 0U);
+
+  // Every thread owns its arena
+  size_t other_thread_used = 1;
+  std::thread([&] { other_thread_used = ppc::core::ThreadArena().BytesUsed(); }).join();
+  EXPECT_EQ(other_thread_used, 0U);
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace ppc::core {
+
+constexpr size_t kCacheLineSize = 64;
+
+struct ArenaOptions {
+  // size of the first block, later blocks grow geometrically
+  size_t block_size = size_t{1} << 20;
+  // back blocks of at least 2 MiB with transparent huge pages where the OS supports it
+  bool huge_pages = true;
+};
+
+// Bump allocator for scratch buffers of a task. Memory is never returned to the OS between runs:
+// Reset() rewinds the arena and merges its blocks, so after the first run the hot loop performs no
+// malloc at all. Allocations are uninitialized, the first write happens on the thread that uses the
+// memory, which places the pages on its NUMA node (first-touch policy).
+class Arena {
+ public:
+  explicit Arena(ArenaOptions options = {});
+  Arena(const Arena &) = delete;
+  Arena &operator=(const Arena &) = delete;
+  ~Arena();
+
+  void *Allocate(size_t bytes, size_t alignment = kCacheLineSize);
+
+  template <class T>
+  std::span<T> AllocateArray(size_t count) {
+    static_assert(std::is_trivially_destructible_v<T>, "Arena never runs destructors");
+    return std::span<T>(static_cast<T *>(Allocate(count * sizeof(T), std::max(alignof(T), kCacheLineSize))), count);
+  }
+
+  // Position of the arena, allocations made after Mark() are freed by Rewind()
+  struct Marker {
+    size_t block = 0;
+    size_t offset = 0;
+  };
+  [[nodiscard]] Marker Mark() const;
+  void Rewind(Marker marker);
+
+  // Free every allocation and merge blocks into a single one of the same total capacity
+  void Reset();
+
+  [[nodiscard]] size_t BytesUsed() const;
+  [[nodiscard]] size_t BytesReserved() const;
+  [[nodiscard]] size_t NumBlocks() const { return blocks_.size(); }
+
+ private:
+  struct Block {
+    std::byte *data = nullptr;
+    size_t size = 0;
+    size_t used = 0;
+    bool mapped = false;
+  };
+
+  Block AllocateBlock(size_t size) const;
+  static void FreeBlock(const Block &block);
+
+  ArenaOptions options_;
+  std::vector<Block> blocks_;
+  size_t current_ = 0;
+};
+
+// Rewinds the arena to the position it had at construction (stack-like scratch memory)
+class ArenaScope {
+ public:
+  explicit ArenaScope(Arena &arena) : arena_(arena), marker_(arena.Mark()) {}
+  ArenaScope(const ArenaScope &) = delete;
+  ArenaScope &operator=(const ArenaScope &) = delete;
+  ~ArenaScope() { arena_.Rewind(marker_); }
+
+ private:
+  Arena &arena_;
+  Arena::Marker marker_;
+};
+
+// Standard allocator over an arena, e.g. std::vector<double, ArenaAllocator<double>>.
+// Deallocation is a no-op, memory comes back on Rewind/Reset.
+template <class T>
+class ArenaAllocator {
+ public:
+  using value_type = T;
+
+  explicit ArenaAllocator(Arena &arena) : arena_(&arena) {}
+  template <class U>
+  explicit ArenaAllocator(const ArenaAllocator<U> &other) : arena_(other.GetArena()) {}
+
+  T *allocate(size_t count) {
+    return static_cast<T *>(arena_->Allocate(count * sizeof(T), std::max(alignof(T), kCacheLineSize)));
+  }
+  void deallocate(T * /*ptr*/, size_t /*count*/) {}
+
+  [[nodiscard]] Arena *GetArena() const { return arena_; }
+
+  template <class U>
+  bool operator==(const ArenaAllocator<U> &other) const {
+    return arena_ == other.GetArena();
+  }
+
+ private:
+  Arena *arena_;
+};
+
+// Arena of the calling thread. It is reset lazily at the first use after every Task::Run() start,
+// so memory taken from it is valid until the end of the current Run() only.
+Arena &ThreadArena();
+
+// Invalidate every thread arena, called by Task::Run() before RunImpl()
+void ResetThreadArenas();
+
+}  // namespace ppc::core
@@ -0,0 +1,163 @@
+#include "core/arena/include/arena.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include "core/task/include/alloc_counter.hpp"
+
+namespace {
+
+constexpr size_t kHugePageSize = size_t{2} << 20;
+
+std::atomic<uint64_t> arenas_epoch{0};
+
+size_t AlignUp(size_t value, size_t alignment) { return (value + alignment - 1) / alignment * alignment; }
+
+}  // namespace
+
+ppc::core::Arena::Arena(ArenaOptions options) : options_(options) {}
+
+ppc::core::Arena::~Arena() {
+  for (const auto &block : blocks_) {
+    FreeBlock(block);
+  }
+}
+
+ppc::core::Arena::Block ppc::core::Arena::AllocateBlock(size_t size) const {
+  Block block;
+#ifdef __linux__
+  if (options_.huge_pages && size >= kHugePageSize) {
+    // Map an extra huge page and trim both ends, so the block starts on a huge page boundary
+    size = AlignUp(size, kHugePageSize);
+    const size_t mapped_size = size + kHugePageSize;
+    void *raw = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw != MAP_FAILED) {
+      auto *begin = static_cast<std::byte *>(raw);
+      auto *aligned = reinterpret_cast<std::byte *>(AlignUp(reinterpret_cast<uintptr_t>(begin), kHugePageSize));
+      const auto head = static_cast<size_t>(aligned - begin);
+      if (head != 0) {
+        munmap(begin, head);
+      }
+      munmap(aligned + size, kHugePageSize - head);
+      madvise(aligned, size, MADV_HUGEPAGE);
+      block.data = aligned;
+      block.size = size;
+      block.mapped = true;
+      // Mapped memory bypasses operator new, report it to the allocation counters
+      CountAllocation(size);
+      return block;
+    }
+  }
+#endif
+  block.data = static_cast<std::byte *>(::operator new(size, std::align_val_t{kCacheLineSize}));
+  block.size = size;
+  return block;
+}
+
+void ppc::core::Arena::FreeBlock(const Block &block) {
+#ifdef __linux__
+  if (block.mapped) {
+    munmap(block.data, block.size);
+    return;
+  }
+#endif
+  ::operator delete(block.data, std::align_val_t{kCacheLineSize});
+}
+
+void *ppc::core::Arena::Allocate(size_t bytes, size_t alignment) {
+  if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+    throw std::invalid_argument("Arena: alignment must be a power of two");
+  }
+  bytes = std::max<size_t>(bytes, 1);
+
+  for (; current_ < blocks_.size(); current_++) {
+    auto &block = blocks_[current_];
+    const size_t begin = AlignUp(reinterpret_cast<uintptr_t>(block.data) + block.used, alignment) -
+                         reinterpret_cast<uintptr_t>(block.data);
+    if (begin + bytes <= block.size) {
+      block.used = begin + bytes;
+      return block.data + begin;
+    }
+  }
+
+  // Geometric growth keeps the number of blocks logarithmic in the peak usage
+  const size_t last_size = blocks_.empty() ? options_.block_size : blocks_.back().size * 2;
+  Block block = AllocateBlock(std::max(last_size, bytes + alignment));
+  const size_t begin = AlignUp(reinterpret_cast<uintptr_t>(block.data), alignment) -
+                       reinterpret_cast<uintptr_t>(block.data);
+  block.used = begin + bytes;
+  blocks_.push_back(block);
+  current_ = blocks_.size() - 1;
+  return block.data + begin;
+}
+
+ppc::core::Arena::Marker ppc::core::Arena::Mark() const {
+  if (blocks_.empty()) {
+    return {};
+  }
+  const size_t block = std::min(current_, blocks_.size() - 1);
+  return {.block = block, .offset = blocks_[block].used};
+}
+
+void ppc::core::Arena::Rewind(Marker marker) {
+  if (blocks_.empty()) {
+    return;
+  }
+  current_ = marker.block;
+  blocks_[current_].used = marker.offset;
+  for (size_t i = current_ + 1; i < blocks_.size(); i++) {
+    blocks_[i].used = 0;
+  }
+}
+
+void ppc::core::Arena::Reset() {
+  if (blocks_.size() > 1) {
+    const size_t total = BytesReserved();
+    for (const auto &block : blocks_) {
+      FreeBlock(block);
+    }
+    blocks_.clear();
+    blocks_.push_back(AllocateBlock(total));
+  }
+  for (auto &block : blocks_) {
+    block.used = 0;
+  }
+  current_ = 0;
+}
+
+size_t ppc::core::Arena::BytesUsed() const {
+  size_t used = 0;
+  for (const auto &block : blocks_) {
+    used += block.used;
+  }
+  return used;
+}
+
+size_t ppc::core::Arena::BytesReserved() const {
+  size_t reserved = 0;
+  for (const auto &block : blocks_) {
+    reserved += block.size;
+  }
+  return reserved;
+}
+
+ppc::core::Arena &ppc::core::ThreadArena() {
+  thread_local Arena arena;
+  thread_local uint64_t seen_epoch = arenas_epoch.load(std::memory_order_relaxed);
+  const uint64_t epoch = arenas_epoch.load(std::memory_order_relaxed);
+  if (epoch != seen_epoch) {
+    arena.Reset();
+    seen_epoch = epoch;
+  }
+  return arena;
+}
+
+void ppc::core::ResetThreadArenas() { arenas_epoch.fetch_add(1, std::memory_order_relaxed); }
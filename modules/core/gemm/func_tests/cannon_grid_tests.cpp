@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "core/gemm/include/cannon_grid.hpp"
+#include "core/gemm/include/gemm.hpp"
+
+TEST(cannon_grid_tests, block_major_tiles) {
+  constexpr size_t kN = 6;
+  std::vector<double> matrix(kN * kN);
+  std::iota(matrix.begin(), matrix.end(), 0.0);
+  std::vector<double> tiles(kN * kN);
+  ppc::core::ToBlockMajor(matrix, kN, 3, tiles);
+  // Tile 0 is block (0, 0), tile 5 block (1, 2)
+  EXPECT_EQ(std::vector<double>(tiles.begin(), tiles.begin() + 4), (std::vector<double>{0, 1, 6, 7}));
+  EXPECT_EQ(std::vector<double>(tiles.begin() + 20, tiles.begin() + 24), (std::vector<double>{16, 17, 22, 23}));
+}
+
+TEST(cannon_grid_tests, tables_follow_cannon_schedule) {
+  for (size_t q : {1, 2, 3, 5}) {
+    ppc::core::CannonGrid grid(q);
+    grid.InitialShift();
+    for (size_t step = 0; step < q; step++) {
+      for (size_t bi = 0; bi < q; bi++) {
+        for (size_t bj = 0; bj < q; bj++) {
+          const size_t k = (bi + bj + step) % q;
+          ASSERT_EQ(grid.ATile(bi, bj), (bi * q) + k);
+          ASSERT_EQ(grid.BTile(bi, bj), (k * q) + bj);
+        }
+      }
+      grid.Shift();
+    }
+    // q shifts bring every tile back to its skewed place
+    ppc::core::CannonGrid skewed(q);
+    skewed.InitialShift();
+    EXPECT_EQ(grid.ATile(q - 1, 0), skewed.ATile(q - 1, 0));
+  }
+}
+
+TEST(cannon_grid_tests, multiplies_through_the_tables) {
+  constexpr size_t kN = 12;
+  constexpr size_t kQ = 4;
+  constexpr size_t kB = kN / kQ;
+  std::vector<double> a(kN * kN);
+  std::vector<double> b(kN * kN);
+  for (size_t i = 0; i < a.size(); i++) {
+    a[i] = static_cast<double>(i % 7) - 3.0;
+    b[i] = static_cast<double>(i % 5) - 2.0;
+  }
+  std::vector<double> expected(kN * kN, 0.0);
+  ppc::core::Gemm(kN, kN, kN, a.data(), kN, b.data(), kN, expected.data(), kN);
+
+  std::vector<double> a_tiles(kN * kN);
+  std::vector<double> b_tiles(kN * kN);
+  ppc::core::ToBlockMajor(a, kN, kQ, a_tiles);
+  ppc::core::ToBlockMajor(b, kN, kQ, b_tiles);
+  std::vector<double> c(kN * kN, 0.0);
+  ppc::core::CannonGrid grid(kQ);
+  grid.InitialShift();
+  for (size_t step = 0; step < kQ; step++) {
+    for (size_t bi = 0; bi < kQ; bi++) {
+      for (size_t bj = 0; bj < kQ; bj++) {
+        ppc::core::Gemm(kB, kB, kB, &a_tiles[grid.ATile(bi, bj) * kB * kB], kB, &b_tiles[grid.BTile(bi, bj) * kB * kB],
+                        kB, &c[(bi * kB * kN) + (bj * kB)], kN);
+      }
+    }
+    grid.Shift();
+  }
+  EXPECT_EQ(c, expected);
+}
+
+TEST(cannon_grid_tests, rejects_bad_shapes) {
+  std::vector<double> matrix(25);
+  std::vector<double> tiles(25);
+  EXPECT_THROW(ppc::core::ToBlockMajor(matrix, 5, 2, tiles), std::invalid_argument);
+  EXPECT_THROW(ppc::core::ToBlockMajor(matrix, 5, 0, tiles), std::invalid_argument);
+  EXPECT_THROW(ppc::core::ToBlockMajor(matrix, 5, 5, std::span<double>(tiles).first(24)), std::invalid_argument);
+  EXPECT_THROW(ppc::core::CannonGrid(0), std::invalid_argument);
+}
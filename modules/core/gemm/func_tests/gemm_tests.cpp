@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "core/gemm/include/gemm.hpp"
+#include "core/util/include/simd_level.hpp"
+
+namespace {
+
+std::vector<double> RandomMatrix(size_t size, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> values(size);
+  for (auto &value : values) {
+    value = dist(gen);
+  }
+  return values;
+}
+
+std::vector<ppc::util::SimdLevel> Levels() {
+  std::vector<ppc::util::SimdLevel> levels = {ppc::util::SimdLevel::kScalar};
+  const auto widest = ppc::util::DetectSimdLevel();
+  if (widest >= ppc::util::SimdLevel::kAvx2) {
+    levels.push_back(ppc::util::SimdLevel::kAvx2);
+  }
+  if (widest >= ppc::util::SimdLevel::kAvx512) {
+    levels.push_back(ppc::util::SimdLevel::kAvx512);
+  }
+  return levels;
+}
+
+// Multiplies an m x k block of a by a k x n block of b into an m x n block of c, each cut out of a
+// matrix with `pad` extra columns, and checks the block and the untouched padding
+void CheckProduct(size_t m, size_t n, size_t k, size_t pad) {
+  const size_t lda = k + pad;
+  const size_t ldb = n + pad;
+  const size_t ldc = n + pad;
+  const auto a = RandomMatrix(m * lda, 1);
+  const auto b = RandomMatrix(k * ldb, 2);
+  auto c = RandomMatrix(m * ldc, 3);
+  auto expected = c;
+  for (size_t i = 0; i < m; i++) {
+    for (size_t p = 0; p < k; p++) {
+      for (size_t j = 0; j < n; j++) {
+        expected[(i * ldc) + j] += a[(i * lda) + p] * b[(p * ldb) + j];
+      }
+    }
+  }
+  ppc::core::Gemm(m, n, k, a.data(), lda, b.data(), ldb, c.data(), ldc);
+  for (size_t i = 0; i < c.size(); i++) {
+    ASSERT_NEAR(c[i], expected[i], 1e-10 * static_cast<double>(k + 1)) << m << "x" << n << "x" << k << " at " << i;
+  }
+}
+
+class GemmTest : public ::testing::Test {
+ protected:
+  void TearDown() override { ppc::util::SetSimdLevel(ppc::util::SimdLevel::kAvx512); }
+};
+
+}  // namespace
+
+TEST_F(GemmTest, matches_naive_product) {
+  for (auto level : Levels()) {
+    ppc::util::SetSimdLevel(level);
+    for (size_t m : {1, 5, 6, 7, 64, 97}) {
+      for (size_t n : {1, 8, 15, 16, 17, 100}) {
+        for (size_t k : {1, 3, 40, 129}) {
+          CheckProduct(m, n, k, 0);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(GemmTest, multiplies_blocks_in_place) {
+  for (auto level : Levels()) {
+    ppc::util::SetSimdLevel(level);
+    CheckProduct(50, 70, 60, 13);
+    CheckProduct(13, 9, 200, 3);
+  }
+}
+
+TEST_F(GemmTest, spans_several_cache_blocks) {
+  const auto blocking = ppc::core::HostGemmBlocking();
+  CheckProduct(blocking.mc + 7, 33, blocking.kc + 5, 1);
+  CheckProduct(20, blocking.nc + 3, 30, 0);
+}
+
+TEST_F(GemmTest, empty_product_leaves_c) {
+  std::vector<double> c = {1.0, 2.0};
+  ppc::core::Gemm(1, 2, 0, nullptr, 0, nullptr, 2, c.data(), 2);
+  ppc::core::Gemm(0, 2, 3, nullptr, 3, nullptr, 2, c.data(), 2);
+  EXPECT_EQ(c, (std::vector<double>{1.0, 2.0}));
+}
+
+TEST(gemm_tests, blocking_follows_kernel_and_caches) {
+  const ppc::core::GemmKernelShape shape{.mr = 6, .nr = 16};
+  const auto blocking = ppc::core::ComputeGemmBlocking(shape, size_t{48} << 10, size_t{2} << 20, size_t{4} << 20);
+  EXPECT_EQ(blocking.kc, 192U);
+  EXPECT_EQ(blocking.mc % shape.mr, 0U);
+  EXPECT_EQ(blocking.nc % shape.nr, 0U);
+  EXPECT_LE(blocking.mc * blocking.kc * sizeof(double), size_t{1} << 20);
+  EXPECT_LE(blocking.kc * blocking.nc * sizeof(double), size_t{2} << 20);
+
+  const auto tiny = ppc::core::ComputeGemmBlocking(shape, 1024, 1024, 1024);
+  EXPECT_EQ(tiny.kc, 16U);
+  EXPECT_EQ(tiny.mc, shape.mr);
+  EXPECT_EQ(tiny.nc, shape.nr);
+}
+
+TEST(gemm_tests, active_shape_follows_simd_level) {
+  ppc::util::SetSimdLevel(ppc::util::SimdLevel::kScalar);
+  EXPECT_EQ(ppc::core::ActiveGemmKernelShape().nr, 4U);
+  ppc::util::SetSimdLevel(ppc::util::SimdLevel::kAvx512);
+  if (ppc::util::DetectSimdLevel() == ppc::util::SimdLevel::kAvx512) {
+    EXPECT_EQ(ppc::core::ActiveGemmKernelShape().nr, 16U);
+  }
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "core/gemm/include/gemm.hpp"
+#include "core/gemm/include/strassen.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/for_each.hpp"
+
+namespace {
+
+std::vector<double> RandomMatrix(size_t size, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> values(size);
+  for (auto &value : values) {
+    value = dist(gen);
+  }
+  return values;
+}
+
+// Strassen product of m x k and k x n blocks cut out of matrices `pad` columns wider, against Gemm;
+// C starts with garbage since the product overwrites it
+template <class ForEach = ppc::util::SequentialForEach>
+void CheckProduct(size_t m, size_t n, size_t k, size_t crossover, size_t pad = 0, const ForEach &for_each = {}) {
+  const size_t lda = k + pad;
+  const size_t ldb = n + pad;
+  const size_t ldc = n + pad;
+  const auto a = RandomMatrix(m * lda, 1);
+  const auto b = RandomMatrix(k * ldb, 2);
+  auto c = RandomMatrix(m * ldc, 3);
+  auto expected = c;
+  for (size_t i = 0; i < m; i++) {
+    std::fill(expected.begin() + static_cast<std::ptrdiff_t>(i * ldc),
+              expected.begin() + static_cast<std::ptrdiff_t>((i * ldc) + n), 0.0);
+  }
+  ppc::core::Gemm(m, n, k, a.data(), lda, b.data(), ldb, expected.data(), ldc);
+
+  std::vector<double> workspace(ppc::core::StrassenWorkspaceSize(m, n, k, crossover));
+  ppc::core::StrassenMultiply(m, n, k, a.data(), lda, b.data(), ldb, c.data(), ldc, workspace, for_each, crossover);
+  for (size_t i = 0; i < c.size(); i++) {
+    ASSERT_NEAR(c[i], expected[i], 1e-9 * static_cast<double>(k + 1)) << m << "x" << n << "x" << k << " at " << i;
+  }
+}
+
+}  // namespace
+
+TEST(strassen_tests, matches_gemm_on_square_sizes) {
+  for (size_t n : {1, 2, 16, 17, 64, 100, 129}) {
+    CheckProduct(n, n, n, 8);
+  }
+}
+
+TEST(strassen_tests, peels_odd_and_rectangular_shapes) {
+  CheckProduct(33, 40, 51, 4);
+  CheckProduct(70, 19, 65, 8);
+  CheckProduct(9, 101, 30, 2);
+  CheckProduct(64, 64, 0, 8);
+}
+
+TEST(strassen_tests, works_on_strided_blocks) {
+  CheckProduct(48, 48, 48, 8, 5);
+  CheckProduct(37, 45, 29, 4, 3);
+}
+
+TEST(strassen_tests, parallel_backend_matches) {
+  CheckProduct(300, 300, 300, 64, 0, ppc::core::PoolForEach{});
+  CheckProduct(257, 131, 199, 32, 7, ppc::core::PoolForEach{});
+}
+
+TEST(strassen_tests, default_crossover_above_it) {
+  const size_t n = ppc::core::kStrassenCrossover + 3;
+  CheckProduct(n, n, n, ppc::core::kStrassenCrossover);
+}
+
+TEST(strassen_tests, workspace_is_two_thirds_of_square) {
+  EXPECT_EQ(ppc::core::StrassenWorkspaceSize(512, 512, 512, 512), 0U);
+  EXPECT_EQ(ppc::core::StrassenWorkspaceSize(1024, 1024, 1024, 512), 2U * 512 * 512);
+  const size_t n = 4096;
+  EXPECT_LE(ppc::core::StrassenWorkspaceSize(n, n, n, 1), 2 * n * n / 3);
+  EXPECT_GE(ppc::core::StrassenWorkspaceSize(n, n, n, 1), n * n / 2);
+}
+
+TEST(strassen_tests, rejects_small_workspace) {
+  std::vector<double> a(64 * 64);
+  std::vector<double> c(64 * 64);
+  std::vector<double> workspace(ppc::core::StrassenWorkspaceSize(64, 64, 64, 8) - 1);
+  EXPECT_THROW(ppc::core::StrassenMultiply(64, 64, 64, a.data(), 64, a.data(), 64, c.data(), 64, workspace,
+                                           ppc::util::SequentialForEach{}, 8),
+               std::invalid_argument);
+}
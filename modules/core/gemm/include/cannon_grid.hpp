@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace ppc::core {
+
+// Copies a row-major n x n matrix into q x q tiles of b = n / q: tile t = bi * q + bj holds block
+// (bi, bj) row after row at tiles[t * b * b]. Throws std::invalid_argument unless q divides n and
+// both spans hold n * n values.
+void ToBlockMajor(std::span<const double> matrix, size_t n, size_t q, std::span<double> tiles);
+
+// Cannon's rotations of a q x q grid of blocks done on tables of tile indices instead of the data.
+// Position (bi, bj) starts at tile bi * q + bj of A and of B, like a grid scattered from
+// ToBlockMajor; InitialShift() is the skew (row bi of A moves bi blocks left, column bj of B bj
+// blocks up) and Shift() the per-step move of A one block left and B one block up. Each call costs
+// O(q^2) index updates however large the blocks are.
+class CannonGrid {
+ public:
+  explicit CannonGrid(size_t q);
+
+  void InitialShift();
+  void Shift();
+
+  [[nodiscard]] size_t Size() const { return q_; }
+  // Tiles of A and B currently at grid position (bi, bj)
+  [[nodiscard]] size_t ATile(size_t bi, size_t bj) const { return a_[(bi * q_) + bj]; }
+  [[nodiscard]] size_t BTile(size_t bi, size_t bj) const { return b_[(bi * q_) + bj]; }
+
+ private:
+  // Position (bi, bj) takes A from (bi, bj + a_step(bi)) and B from (bi + b_step(bj), bj)
+  template <class AStep, class BStep>
+  void Rotate(const AStep &a_step, const BStep &b_step);
+
+  size_t q_;
+  std::vector<size_t> a_;
+  std::vector<size_t> b_;
+  std::vector<size_t> scratch_;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+
+// Like the sorting networks, the AVX2 and AVX-512 kernels carry their own target attributes and
+// the level is picked at run time
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define PPC_GEMM_X86 1
+#endif
+
+namespace ppc::core {
+
+// Rows and columns of C one micro-kernel call computes
+struct GemmKernelShape {
+  size_t mr = 0;
+  size_t nr = 0;
+};
+
+// Cache blocking of the packed GEMM in elements: a kc x nr sliver of B stays in L1 while the
+// micro-kernel streams through it, the packed mc x kc block of A in L2 and the packed
+// kc x nc panel of B in L3
+struct GemmBlocking {
+  size_t mc = 0;
+  size_t nc = 0;
+  size_t kc = 0;
+};
+
+// Micro-tile of the kernel Gemm dispatches to, which follows ppc::util::ActiveSimdLevel() (capped by PPC_SIMD
+// like the sorting networks): 6 x 16 with AVX-512, 6 x 8 with AVX2 and FMA, 4 x 4 in plain C++
+GemmKernelShape ActiveGemmKernelShape();
+
+// Blocking for a kernel shape and cache sizes in bytes: a kc x nr sliver of B takes half of L1,
+// the mc x kc block of A half of L2 and the kc x nc panel of B half of the L3 share of one core.
+// mc and nc are multiples of the shape.
+GemmBlocking ComputeGemmBlocking(GemmKernelShape shape, size_t l1_bytes, size_t l2_bytes, size_t l3_bytes);
+
+// ComputeGemmBlocking for the active kernel and the data caches of the host, from sysfs
+GemmBlocking HostGemmBlocking();
+
+// C += A * B for row-major double matrices: A is m x k, B is k x n and C is m x n, each row
+// ld* elements after the previous one, so blocks of a larger matrix are multiplied in place.
+// Blocks of A and B are packed into contiguous panels in the calling thread's arena and fed to a
+// register-blocked FMA micro-kernel. Products too small to repay the packing take a plain
+// row-streaming loop. Calls are single-threaded and independent: parallel callers give each
+// thread its own blocks of C.
+void Gemm(size_t m, size_t n, size_t k, const double *a, size_t lda, const double *b, size_t ldb, double *c,
+          size_t ldc);
+
+// Square n x n blocks cut out of matrices with row length ld
+inline void GemmBlock(size_t n, const double *a, const double *b, double *c, size_t ld) {
+  Gemm(n, n, n, a, ld, b, ld, c, ld);
+}
+
+namespace detail {
+
+constexpr GemmKernelShape kGemmShapeScalar{.mr = 4, .nr = 4};
+// 12 accumulator registers, two for the row of B and one for the broadcast of A
+constexpr GemmKernelShape kGemmShapeAvx2{.mr = 6, .nr = 8};
+constexpr GemmKernelShape kGemmShapeAvx512{.mr = 6, .nr = 16};
+
+// Micro-kernel: C[m x n] += A[mr x kc] * B[kc x nr] for a packed A sliver (mr values per step)
+// and a packed B sliver (nr values per step), m <= mr and n <= nr
+using GemmKernel = void (*)(size_t kc, const double *a, const double *b, double *c, size_t ldc, size_t m, size_t n);
+
+// Per-ISA kernels of gemm_avx2.cpp and gemm_avx512.cpp
+void GemmKernelAvx2(size_t kc, const double *a, const double *b, double *c, size_t ldc, size_t m, size_t n);
+void GemmKernelAvx512(size_t kc, const double *a, const double *b, double *c, size_t ldc, size_t m, size_t n);
+
+}  // namespace detail
+
+}  // namespace ppc::core
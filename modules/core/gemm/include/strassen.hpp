@@ -0,0 +1,200 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include "core/gemm/include/gemm.hpp"
+#include "core/util/include/for_each.hpp"
+
+namespace ppc::core {
+
+// Products with a dimension at or below this go straight to Gemm. Below it the 15 extra block
+// additions and the peeling of odd sizes cost more than the eighth of the multiply-adds a level
+// saves against the packed kernel; crossovers of 256 and less are slower than Gemm on odd sizes.
+constexpr size_t kStrassenCrossover = 768;
+
+// Doubles of workspace StrassenMultiply needs for an m x k by k x n product: two temporaries of a
+// quarter of the operands per level, about (2/3) n^2 for square matrices
+size_t StrassenWorkspaceSize(size_t m, size_t n, size_t k, size_t crossover = kStrassenCrossover);
+
+namespace detail {
+
+// Rows per task when the additions and leaf products run on a parallel backend
+constexpr size_t kStrassenStripRows = 64;
+
+struct StrassenView {
+  const double *data;
+  size_t ld;
+  [[nodiscard]] const double *Row(size_t i) const { return data + (i * ld); }
+  [[nodiscard]] StrassenView Sub(size_t i, size_t j) const { return {.data = Row(i) + j, .ld = ld}; }
+};
+
+struct StrassenSpan {
+  double *data;
+  size_t ld;
+  [[nodiscard]] double *Row(size_t i) const { return data + (i * ld); }
+  [[nodiscard]] StrassenSpan Sub(size_t i, size_t j) const { return {.data = Row(i) + j, .ld = ld}; }
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  operator StrassenView() const { return {.data = data, .ld = ld}; }
+};
+
+// Sequential callers take the block in one piece so Gemm packs each panel once
+template <class ForEach, class Body>
+void ForEachStrassenStrip(size_t rows, const ForEach &for_each, const Body &body) {
+  if constexpr (std::is_same_v<ForEach, ppc::util::SequentialForEach>) {
+    body(size_t{0}, rows);
+  } else {
+    for_each((rows + kStrassenStripRows - 1) / kStrassenStripRows, [&](size_t strip) {
+      const size_t begin = strip * kStrassenStripRows;
+      body(begin, std::min(rows, begin + kStrassenStripRows));
+    });
+  }
+}
+
+// z = x + y or x - y on rows x cols blocks; z may alias x or y
+template <bool kSubtract, class ForEach>
+void StrassenCombine(size_t rows, size_t cols, StrassenView x, StrassenView y, StrassenSpan z,
+                     const ForEach &for_each) {
+  ForEachStrassenStrip(rows, for_each, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      const double *x_row = x.Row(i);
+      const double *y_row = y.Row(i);
+      double *z_row = z.Row(i);
+      for (size_t j = 0; j < cols; j++) {
+        z_row[j] = kSubtract ? x_row[j] - y_row[j] : x_row[j] + y_row[j];
+      }
+    }
+  });
+}
+
+// c = a * b with the packed GEMM
+template <class ForEach>
+void StrassenLeaf(size_t m, size_t n, size_t k, StrassenView a, StrassenView b, StrassenSpan c,
+                  const ForEach &for_each) {
+  ForEachStrassenStrip(m, for_each, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      std::fill(c.Row(i), c.Row(i) + n, 0.0);
+    }
+    Gemm(end - begin, n, k, a.Row(begin), a.ld, b.data, b.ld, c.Row(begin), c.ld);
+  });
+}
+
+template <class ForEach>
+void StrassenRecurse(size_t m, size_t n, size_t k, StrassenView a, StrassenView b, StrassenSpan c, double *workspace,
+                     const ForEach &for_each, size_t crossover);
+
+// One Strassen-Winograd level on even m, n, k: 7 half-size products and 15 additions, scheduled so
+// that beside the quadrants of C only two temporaries are live (Boyer, Dumas, Pernet and Zhou)
+template <class ForEach>
+void StrassenWinogradStep(size_t m, size_t n, size_t k, StrassenView a, StrassenView b, StrassenSpan c,
+                          double *workspace, const ForEach &for_each, size_t crossover) {
+  const size_t hm = m / 2;
+  const size_t hn = n / 2;
+  const size_t hk = k / 2;
+  const StrassenView a11 = a;
+  const StrassenView a12 = a.Sub(0, hk);
+  const StrassenView a21 = a.Sub(hm, 0);
+  const StrassenView a22 = a.Sub(hm, hk);
+  const StrassenView b11 = b;
+  const StrassenView b12 = b.Sub(0, hn);
+  const StrassenView b21 = b.Sub(hk, 0);
+  const StrassenView b22 = b.Sub(hk, hn);
+  const StrassenSpan c11 = c;
+  const StrassenSpan c12 = c.Sub(0, hn);
+  const StrassenSpan c21 = c.Sub(hm, 0);
+  const StrassenSpan c22 = c.Sub(hm, hn);
+  // x holds sums of A blocks (hm x hk) and later the product A11 * B11 (hm x hn)
+  const StrassenSpan xa{.data = workspace, .ld = hk};
+  const StrassenSpan xc{.data = workspace, .ld = hn};
+  const StrassenSpan y{.data = workspace + std::max(hm * hk, hm * hn), .ld = hn};
+  double *deeper = y.data + (hk * hn);
+
+  const auto add = [&](size_t rows, size_t cols, StrassenView lhs, StrassenView rhs, StrassenSpan out) {
+    StrassenCombine<false>(rows, cols, lhs, rhs, out, for_each);
+  };
+  const auto sub = [&](size_t rows, size_t cols, StrassenView lhs, StrassenView rhs, StrassenSpan out) {
+    StrassenCombine<true>(rows, cols, lhs, rhs, out, for_each);
+  };
+  const auto mul = [&](StrassenView lhs, StrassenView rhs, StrassenSpan out) {
+    StrassenRecurse(hm, hn, hk, lhs, rhs, out, deeper, for_each, crossover);
+  };
+
+  sub(hm, hk, a11, a21, xa);   // S3
+  sub(hk, hn, b22, b12, y);    // T3
+  mul(xa, y, c21);             // P7 = S3 T3
+  add(hm, hk, a21, a22, xa);   // S1
+  sub(hk, hn, b12, b11, y);    // T1
+  mul(xa, y, c22);             // P5 = S1 T1
+  sub(hm, hk, xa, a11, xa);    // S2 = S1 - A11
+  sub(hk, hn, b22, y, y);      // T2 = B22 - T1
+  mul(xa, y, c12);             // P6 = S2 T2
+  sub(hm, hk, a12, xa, xa);    // S4 = A12 - S2
+  mul(xa, b22, c11);           // P3 = S4 B22
+  mul(a11, b11, xc);           // P1
+  add(hm, hn, xc, c12, c12);   // U2 = P1 + P6
+  add(hm, hn, c12, c21, c21);  // U3 = U2 + P7
+  add(hm, hn, c12, c22, c12);  // U4 = U2 + P5
+  add(hm, hn, c21, c22, c22);  // U7 = U3 + P5, final C22
+  add(hm, hn, c12, c11, c12);  // U5 = U4 + P3, final C12
+  sub(hk, hn, y, b21, y);      // T4 = T2 - B21
+  mul(a22, y, c11);            // P4 = A22 T4
+  sub(hm, hn, c21, c11, c21);  // U6 = U3 - P4, final C21
+  mul(a12, b21, c11);          // P2
+  add(hm, hn, xc, c11, c11);   // U1 = P1 + P2, final C11
+}
+
+template <class ForEach>
+void StrassenRecurse(size_t m, size_t n, size_t k, StrassenView a, StrassenView b, StrassenSpan c, double *workspace,
+                     const ForEach &for_each, size_t crossover) {
+  if (m <= crossover || n <= crossover || k <= crossover) {
+    StrassenLeaf(m, n, k, a, b, c, for_each);
+    return;
+  }
+  // Odd dimensions are peeled: the even leading part recurses and the last row, column or
+  // inner index is fixed up with thin products, so no operand is ever padded
+  const size_t me = m & ~size_t{1};
+  const size_t ne = n & ~size_t{1};
+  const size_t ke = k & ~size_t{1};
+  StrassenWinogradStep(me, ne, ke, a, b, c, workspace, for_each, crossover);
+  if (ke != k) {
+    Gemm(me, ne, 1, a.Row(0) + ke, a.ld, b.Row(ke), b.ld, c.data, c.ld);
+  }
+  if (ne != n) {
+    for (size_t i = 0; i < me; i++) {
+      c.Row(i)[ne] = 0.0;
+    }
+    Gemm(me, 1, k, a.data, a.ld, b.Row(0) + ne, b.ld, c.Row(0) + ne, c.ld);
+  }
+  if (me != m) {
+    std::fill(c.Row(me), c.Row(me) + n, 0.0);
+    Gemm(1, n, k, a.Row(me), a.ld, b.data, b.ld, c.Row(me), c.ld);
+  }
+}
+
+}  // namespace detail
+
+// C = A * B (overwriting C) for row-major A (m x k), B (k x n) and C (m x n) with row strides
+// lda, ldb and ldc, by Strassen-Winograd recursion down to the crossover and the packed Gemm below
+// it. Operands are used in place through strided views, never copied into quadrants; odd sizes
+// are peeled instead of padded. All temporaries live in `workspace`, which must hold
+// StrassenWorkspaceSize(m, n, k, crossover) doubles. The additions and leaf products are split
+// into row strips on `for_each`, so one call uses every worker while the schedule and memory stay
+// those of the sequential algorithm.
+template <class ForEach = ppc::util::SequentialForEach>
+void StrassenMultiply(size_t m, size_t n, size_t k, const double *a, size_t lda, const double *b, size_t ldb,
+                      double *c, size_t ldc, std::span<double> workspace, const ForEach &for_each = {},
+                      size_t crossover = kStrassenCrossover) {
+  if (workspace.size() < StrassenWorkspaceSize(m, n, k, crossover)) {
+    throw std::invalid_argument("StrassenMultiply: workspace too small");
+  }
+  if (m == 0 || n == 0) {
+    return;
+  }
+  detail::StrassenRecurse(m, n, k, {.data = a, .ld = lda}, {.data = b, .ld = ldb}, {.data = c, .ld = ldc},
+                          workspace.data(), for_each, std::max<size_t>(crossover, 1));
+}
+
+}  // namespace ppc::core
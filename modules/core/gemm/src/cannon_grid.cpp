@@ -0,0 +1,55 @@
+#include "core/gemm/include/cannon_grid.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+
+void ppc::core::ToBlockMajor(std::span<const double> matrix, size_t n, size_t q, std::span<double> tiles) {
+  if (q == 0 || n % q != 0 || matrix.size() != n * n || tiles.size() != n * n) {
+    throw std::invalid_argument("ToBlockMajor: expected two n x n matrices with q dividing n");
+  }
+  const size_t b = n / q;
+  double *out = tiles.data();
+  for (size_t bi = 0; bi < q; bi++) {
+    for (size_t bj = 0; bj < q; bj++) {
+      for (size_t i = 0; i < b; i++) {
+        const double *row = matrix.data() + (((bi * b) + i) * n) + (bj * b);
+        out = std::copy(row, row + b, out);
+      }
+    }
+  }
+}
+
+ppc::core::CannonGrid::CannonGrid(size_t q) : q_(q), a_(q * q), b_(q * q), scratch_(q * q) {
+  if (q == 0) {
+    throw std::invalid_argument("CannonGrid: empty grid");
+  }
+  std::iota(a_.begin(), a_.end(), size_t{0});
+  std::iota(b_.begin(), b_.end(), size_t{0});
+}
+
+template <class AStep, class BStep>
+void ppc::core::CannonGrid::Rotate(const AStep &a_step, const BStep &b_step) {
+  std::ranges::copy(a_, scratch_.begin());
+  for (size_t bi = 0; bi < q_; bi++) {
+    for (size_t bj = 0; bj < q_; bj++) {
+      a_[(bi * q_) + bj] = scratch_[(bi * q_) + ((bj + a_step(bi)) % q_)];
+    }
+  }
+  std::ranges::copy(b_, scratch_.begin());
+  for (size_t bi = 0; bi < q_; bi++) {
+    for (size_t bj = 0; bj < q_; bj++) {
+      b_[(bi * q_) + bj] = scratch_[(((bi + b_step(bj)) % q_) * q_) + bj];
+    }
+  }
+}
+
+void ppc::core::CannonGrid::InitialShift() {
+  Rotate([](size_t bi) { return bi; }, [](size_t bj) { return bj; });
+}
+
+void ppc::core::CannonGrid::Shift() {
+  Rotate([](size_t) { return size_t{1}; }, [](size_t) { return size_t{1}; });
+}
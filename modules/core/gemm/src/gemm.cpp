@@ -0,0 +1,194 @@
+#include "core/gemm/include/gemm.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+#include "core/arena/include/arena.hpp"
+#include "core/util/include/simd_level.hpp"
+#include "core/util/include/topology.hpp"
+
+namespace {
+
+// Below this many multiply-adds packing costs more than it saves
+constexpr size_t kGemmPackThreshold = size_t{32} * 32 * 32;
+
+struct CacheSizes {
+  size_t l1 = size_t{32} << 10;
+  size_t l2 = size_t{256} << 10;
+  size_t l3 = size_t{2} << 20;
+};
+
+CacheSizes HostCacheSizes() {
+  CacheSizes sizes;
+  bool l1 = false;
+  bool l2 = false;
+  bool l3 = false;
+  for (const auto &cache : ppc::util::Topology::Host().Caches()) {
+    if (cache.type == "Instruction" || cache.size_bytes == 0) {
+      continue;
+    }
+    if (cache.level == 1 && !l1) {
+      sizes.l1 = cache.size_bytes;
+      l1 = true;
+    } else if (cache.level == 2 && !l2) {
+      sizes.l2 = cache.size_bytes;
+      l2 = true;
+    } else if (cache.level == 3 && !l3) {
+      // Every core sharing the L3 streams its own panels of B through it
+      sizes.l3 = cache.size_bytes / std::max<size_t>(cache.shared_cpus.size(), 1);
+      l3 = true;
+    }
+  }
+  return sizes;
+}
+
+template <size_t kMr, size_t kNr>
+void GemmKernelGeneric(size_t kc, const double *a, const double *b, double *c, size_t ldc, size_t m, size_t n) {
+  std::array<double, kMr * kNr> acc{};
+  for (size_t p = 0; p < kc; p++) {
+    for (size_t i = 0; i < kMr; i++) {
+      const double a_ip = a[(p * kMr) + i];
+      for (size_t j = 0; j < kNr; j++) {
+        acc[(i * kNr) + j] += a_ip * b[(p * kNr) + j];
+      }
+    }
+  }
+  for (size_t i = 0; i < m; i++) {
+    for (size_t j = 0; j < n; j++) {
+      c[(i * ldc) + j] += acc[(i * kNr) + j];
+    }
+  }
+}
+
+struct ActiveKernel {
+  ppc::core::GemmKernelShape shape;
+  ppc::core::detail::GemmKernel kernel;
+};
+
+ActiveKernel SelectKernel() {
+  switch (ppc::util::ActiveSimdLevel()) {
+#ifdef PPC_GEMM_X86
+    case ppc::util::SimdLevel::kAvx512:
+      return {.shape = ppc::core::detail::kGemmShapeAvx512, .kernel = ppc::core::detail::GemmKernelAvx512};
+    case ppc::util::SimdLevel::kAvx2:
+      if (__builtin_cpu_supports("fma")) {
+        return {.shape = ppc::core::detail::kGemmShapeAvx2, .kernel = ppc::core::detail::GemmKernelAvx2};
+      }
+      break;
+#else
+    case ppc::util::SimdLevel::kAvx512:
+    case ppc::util::SimdLevel::kAvx2:
+#endif
+    case ppc::util::SimdLevel::kScalar:
+      break;
+  }
+  constexpr auto kShape = ppc::core::detail::kGemmShapeScalar;
+  return {.shape = kShape, .kernel = GemmKernelGeneric<kShape.mr, kShape.nr>};
+}
+
+// rows x cols block of B as nr-wide slivers, each stored row after row; the last sliver is padded
+// with zeros so the kernel always runs full width
+void PackB(size_t rows, size_t cols, size_t nr, const double *b, size_t ldb, double *packed) {
+  for (size_t j = 0; j < cols; j += nr) {
+    const size_t width = std::min(nr, cols - j);
+    for (size_t p = 0; p < rows; p++) {
+      const double *src = b + (p * ldb) + j;
+      std::copy(src, src + width, packed);
+      std::fill(packed + width, packed + nr, 0.0);
+      packed += nr;
+    }
+  }
+}
+
+// rows x cols block of A as mr-tall slivers, each stored column after column (mr values per
+// step of k), zero padded like PackB
+void PackA(size_t rows, size_t cols, size_t mr, const double *a, size_t lda, double *packed) {
+  for (size_t i = 0; i < rows; i += mr) {
+    const size_t height = std::min(mr, rows - i);
+    for (size_t p = 0; p < cols; p++) {
+      for (size_t r = 0; r < height; r++) {
+        packed[r] = a[((i + r) * lda) + p];
+      }
+      std::fill(packed + height, packed + mr, 0.0);
+      packed += mr;
+    }
+  }
+}
+
+void GemmSmall(size_t m, size_t n, size_t k, const double *a, size_t lda, const double *b, size_t ldb, double *c,
+               size_t ldc) {
+  for (size_t i = 0; i < m; i++) {
+    double *c_row = c + (i * ldc);
+    for (size_t p = 0; p < k; p++) {
+      const double a_ip = a[(i * lda) + p];
+      const double *b_row = b + (p * ldb);
+      for (size_t j = 0; j < n; j++) {
+        c_row[j] += a_ip * b_row[j];
+      }
+    }
+  }
+}
+
+size_t RoundDown(size_t value, size_t multiple) { return std::max(multiple, value / multiple * multiple); }
+
+}  // namespace
+
+ppc::core::GemmKernelShape ppc::core::ActiveGemmKernelShape() { return SelectKernel().shape; }
+
+ppc::core::GemmBlocking ppc::core::ComputeGemmBlocking(GemmKernelShape shape, size_t l1_bytes, size_t l2_bytes,
+                                                       size_t l3_bytes) {
+  GemmBlocking blocking;
+  blocking.kc = std::clamp<size_t>(l1_bytes / 2 / (shape.nr * sizeof(double)), 16, 512);
+  const size_t row_bytes = blocking.kc * sizeof(double);
+  blocking.mc = RoundDown(std::min<size_t>(l2_bytes / 2 / row_bytes, 1024), shape.mr);
+  blocking.nc = RoundDown(std::min<size_t>(l3_bytes / 2 / row_bytes, 4096), shape.nr);
+  return blocking;
+}
+
+ppc::core::GemmBlocking ppc::core::HostGemmBlocking() {
+  static const CacheSizes kSizes = HostCacheSizes();
+  return ComputeGemmBlocking(ActiveGemmKernelShape(), kSizes.l1, kSizes.l2, kSizes.l3);
+}
+
+void ppc::core::Gemm(size_t m, size_t n, size_t k, const double *a, size_t lda, const double *b, size_t ldb,
+                     double *c, size_t ldc) {
+  if (m == 0 || n == 0 || k == 0) {
+    return;
+  }
+  if (m * n * k < kGemmPackThreshold) {
+    GemmSmall(m, n, k, a, lda, b, ldb, c, ldc);
+    return;
+  }
+  const auto [shape, kernel] = SelectKernel();
+  const auto blocking = HostGemmBlocking();
+  const size_t mr = shape.mr;
+  const size_t nr = shape.nr;
+
+  Arena &arena = ThreadArena();
+  ArenaScope scope(arena);
+  const size_t nc_max = std::min(blocking.nc, (n + nr - 1) / nr * nr);
+  const size_t mc_max = std::min(blocking.mc, (m + mr - 1) / mr * mr);
+  const size_t kc_max = std::min(blocking.kc, k);
+  double *packed_b = arena.AllocateArray<double>(kc_max * nc_max).data();
+  double *packed_a = arena.AllocateArray<double>(mc_max * kc_max).data();
+
+  for (size_t jc = 0; jc < n; jc += blocking.nc) {
+    const size_t nc = std::min(blocking.nc, n - jc);
+    for (size_t pc = 0; pc < k; pc += blocking.kc) {
+      const size_t kc = std::min(blocking.kc, k - pc);
+      PackB(kc, nc, nr, b + (pc * ldb) + jc, ldb, packed_b);
+      for (size_t ic = 0; ic < m; ic += blocking.mc) {
+        const size_t mc = std::min(blocking.mc, m - ic);
+        PackA(mc, kc, mr, a + (ic * lda) + pc, lda, packed_a);
+        for (size_t jr = 0; jr < nc; jr += nr) {
+          const double *b_sliver = packed_b + (jr * kc);
+          for (size_t ir = 0; ir < mc; ir += mr) {
+            kernel(kc, packed_a + (ir * kc), b_sliver, c + ((ic + ir) * ldc) + jc + jr, ldc, std::min(mr, mc - ir),
+                   std::min(nr, nc - jr));
+          }
+        }
+      }
+    }
+  }
+}
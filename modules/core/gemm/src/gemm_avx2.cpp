@@ -0,0 +1,70 @@
+#include <cstddef>
+
+#include "core/gemm/include/gemm.hpp"
+
+#ifdef PPC_GEMM_X86
+
+#include <immintrin.h>
+
+#ifdef __clang__
+#pragma clang attribute push(__attribute__((target("avx2,fma"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+#endif
+
+namespace {
+
+constexpr size_t kMr = ppc::core::detail::kGemmShapeAvx2.mr;
+constexpr size_t kNr = ppc::core::detail::kGemmShapeAvx2.nr;
+
+}  // namespace
+
+// 6 x 8 tile in twelve ymm accumulators: each step broadcasts one value of the A sliver against
+// the two halves of the B row
+void ppc::core::detail::GemmKernelAvx2(size_t kc, const double *a, const double *b, double *c, size_t ldc, size_t m,
+                                       size_t n) {
+  __m256d acc[kMr][2];
+  for (auto &row : acc) {
+    row[0] = _mm256_setzero_pd();
+    row[1] = _mm256_setzero_pd();
+  }
+  for (size_t p = 0; p < kc; p++) {
+    const __m256d b_lo = _mm256_loadu_pd(b);
+    const __m256d b_hi = _mm256_loadu_pd(b + 4);
+    for (size_t i = 0; i < kMr; i++) {
+      const __m256d a_ip = _mm256_broadcast_sd(a + i);
+      acc[i][0] = _mm256_fmadd_pd(a_ip, b_lo, acc[i][0]);
+      acc[i][1] = _mm256_fmadd_pd(a_ip, b_hi, acc[i][1]);
+    }
+    a += kMr;
+    b += kNr;
+  }
+  if (m == kMr && n == kNr) {
+    for (size_t i = 0; i < kMr; i++) {
+      double *c_row = c + (i * ldc);
+      _mm256_storeu_pd(c_row, _mm256_add_pd(_mm256_loadu_pd(c_row), acc[i][0]));
+      _mm256_storeu_pd(c_row + 4, _mm256_add_pd(_mm256_loadu_pd(c_row + 4), acc[i][1]));
+    }
+    return;
+  }
+  // Edge tile: spill and add the valid part only
+  alignas(32) double tile[kMr][kNr];
+  for (size_t i = 0; i < kMr; i++) {
+    _mm256_store_pd(tile[i], acc[i][0]);
+    _mm256_store_pd(tile[i] + 4, acc[i][1]);
+  }
+  for (size_t i = 0; i < m; i++) {
+    for (size_t j = 0; j < n; j++) {
+      c[(i * ldc) + j] += tile[i][j];
+    }
+  }
+}
+
+#ifdef __clang__
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#endif  // PPC_GEMM_X86
@@ -0,0 +1,64 @@
+#include <cstddef>
+
+#include "core/gemm/include/gemm.hpp"
+
+#ifdef PPC_GEMM_X86
+
+// GCC 12 reports the _mm512_undefined_* placeholders inside the intrinsics as uninitialized
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#include <immintrin.h>
+
+#ifdef __clang__
+#pragma clang attribute push(__attribute__((target("avx512f"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#endif
+
+namespace {
+
+constexpr size_t kMr = ppc::core::detail::kGemmShapeAvx512.mr;
+constexpr size_t kNr = ppc::core::detail::kGemmShapeAvx512.nr;
+
+}  // namespace
+
+// 6 x 16 tile in twelve zmm accumulators; edge tiles load and store C through lane masks
+void ppc::core::detail::GemmKernelAvx512(size_t kc, const double *a, const double *b, double *c, size_t ldc,
+                                         size_t m, size_t n) {
+  __m512d acc[kMr][2];
+  for (auto &row : acc) {
+    row[0] = _mm512_setzero_pd();
+    row[1] = _mm512_setzero_pd();
+  }
+  for (size_t p = 0; p < kc; p++) {
+    const __m512d b_lo = _mm512_loadu_pd(b);
+    const __m512d b_hi = _mm512_loadu_pd(b + 8);
+    for (size_t i = 0; i < kMr; i++) {
+      const __m512d a_ip = _mm512_set1_pd(a[i]);
+      acc[i][0] = _mm512_fmadd_pd(a_ip, b_lo, acc[i][0]);
+      acc[i][1] = _mm512_fmadd_pd(a_ip, b_hi, acc[i][1]);
+    }
+    a += kMr;
+    b += kNr;
+  }
+  const auto mask_lo = static_cast<__mmask8>(n >= 8 ? 0xFFU : (1U << n) - 1U);
+  const auto mask_hi = static_cast<__mmask8>(n >= 16 ? 0xFFU : n <= 8 ? 0U : (1U << (n - 8)) - 1U);
+  for (size_t i = 0; i < m; i++) {
+    double *c_row = c + (i * ldc);
+    _mm512_mask_storeu_pd(c_row, mask_lo, _mm512_add_pd(_mm512_maskz_loadu_pd(mask_lo, c_row), acc[i][0]));
+    _mm512_mask_storeu_pd(c_row + 8, mask_hi, _mm512_add_pd(_mm512_maskz_loadu_pd(mask_hi, c_row + 8), acc[i][1]));
+  }
+}
+
+#ifdef __clang__
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#pragma GCC diagnostic pop
+#endif
+
+#endif  // PPC_GEMM_X86
@@ -0,0 +1,16 @@
+#include "core/gemm/include/strassen.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+size_t ppc::core::StrassenWorkspaceSize(size_t m, size_t n, size_t k, size_t crossover) {
+  crossover = std::max<size_t>(crossover, 1);
+  size_t total = 0;
+  while (m > crossover && n > crossover && k > crossover) {
+    m /= 2;
+    n /= 2;
+    k /= 2;
+    total += std::max(m * k, m * n) + (k * n);
+  }
+  return total;
+}
@@ -1,13 +1,24 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <limits>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "core/perf/func_tests/test_task.hpp"
+#include "core/perf/include/call_timing.hpp"
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/result_sink.hpp"
+#include "core/perf/include/scaling.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
 
 TEST(perf_tests, check_perf_pipeline) {
   // Create data
@@ -175,3 +186,293 @@ TEST(perf_tests, check_perf_task_float) {
   ASSERT_LE(perf_results->time_sec, ppc::core::PerfResults::kMaxTime);
   EXPECT_EQ(out[0], in.size());
 }
+
+TEST(perf_tests, check_perf_benchmark_mode) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes with a timer which ticks by half a second per call
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  perf_attr->num_warmup = 3;
+  perf_attr->benchmark_mode = true;
+  uint64_t ticks = 0;
+  perf_attr->current_timer = [&] { return 0.5 * static_cast<double>(ticks++); };
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+
+  // Get perf statistic
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  ASSERT_EQ(perf_results->samples_sec.size(), perf_attr->num_running);
+  EXPECT_EQ(ticks, perf_attr->num_running + 1);
+  EXPECT_DOUBLE_EQ(perf_results->time_sec, 5.0);
+  EXPECT_DOUBLE_EQ(perf_results->statistics.min, 0.5);
+  EXPECT_DOUBLE_EQ(perf_results->statistics.p99, 0.5);
+  EXPECT_DOUBLE_EQ(perf_results->statistics.stddev, 0.0);
+  EXPECT_DOUBLE_EQ(perf_results->statistics.ci_lower, 0.5);
+  EXPECT_DOUBLE_EQ(perf_results->statistics.ci_upper, 0.5);
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_perf_statistics_of_known_samples) {
+  std::vector<double> samples(100);
+  for (size_t i = 0; i < samples.size(); i++) {
+    samples[samples.size() - 1 - i] = static_cast<double>(i + 1);
+  }
+
+  auto stats = ppc::core::ComputePerfStatistics(samples);
+
+  EXPECT_DOUBLE_EQ(stats.min, 1.0);
+  EXPECT_DOUBLE_EQ(stats.median, 50.5);
+  EXPECT_NEAR(stats.p90, 90.1, 1e-9);
+  EXPECT_NEAR(stats.p99, 99.01, 1e-9);
+  EXPECT_DOUBLE_EQ(stats.mean, 50.5);
+  EXPECT_NEAR(stats.stddev, 29.0114919, 1e-6);
+  EXPECT_LT(stats.ci_lower, stats.mean);
+  EXPECT_GT(stats.ci_upper, stats.mean);
+  EXPECT_GT(stats.ci_lower, 40.0);
+  EXPECT_LT(stats.ci_upper, 61.0);
+}
+
+TEST(perf_tests, check_perf_statistics_of_empty_samples) {
+  auto stats = ppc::core::ComputePerfStatistics({});
+
+  EXPECT_DOUBLE_EQ(stats.min, 0.0);
+  EXPECT_DOUBLE_EQ(stats.mean, 0.0);
+  EXPECT_DOUBLE_EQ(stats.ci_upper, 0.0);
+}
+
+TEST(perf_tests, check_perf_counters_degrade_gracefully) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  perf_attr->collect_counters = true;
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  ASSERT_NO_THROW(perf_analyzer.PipelineRun(perf_attr, perf_results));
+
+  // Get perf statistic
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  const auto &counters = perf_results->counters;
+  if (counters.valid[ppc::core::PerfCounters::kInstructions]) {
+    EXPECT_GT(counters.values[ppc::core::PerfCounters::kInstructions], 0U);
+  }
+  if (!counters.valid[ppc::core::PerfCounters::kCycles]) {
+    EXPECT_DOUBLE_EQ(counters.Ipc(), 0.0);
+  }
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_perf_record_from_test_path) {
+  ppc::core::PerfResults perf_results;
+  perf_results.type_of_running = ppc::core::PerfResults::kTaskRun;
+  perf_results.time_sec = 0.25;
+  perf_results.num_threads = 4;
+  perf_results.inputs_count = {100, 2};
+
+  auto record = ppc::core::MakePerfRecord(perf_results, "/home/ppc/tasks/omp/example/perf_tests/main.cpp");
+
+  EXPECT_EQ(record.task_path, "omp/example");
+  EXPECT_EQ(record.technology, "omp");
+  EXPECT_EQ(record.type_of_running, "task_run");
+  EXPECT_EQ(record.num_threads, 4);
+  EXPECT_GT(record.timestamp, 0);
+
+  auto core_record = ppc::core::MakePerfRecord(perf_results, "/home/ppc/modules/core/perf/func_tests/perf_tests.cpp");
+  EXPECT_EQ(core_record.task_path, "core/perf");
+  EXPECT_EQ(core_record.technology, "core");
+}
+
+TEST(perf_tests, check_perf_result_sink_formats) {
+  ppc::core::PerfRecord record;
+  record.task_path = "seq/example";
+  record.technology = "seq";
+  record.type_of_running = "pipeline";
+  record.inputs_count = {100, 2};
+  record.num_running = 2;
+  record.time_sec = 0.5;
+  record.samples_sec = {0.25, 0.25};
+  record.statistics = ppc::core::ComputePerfStatistics(record.samples_sec);
+  record.counters.values[ppc::core::PerfCounters::kCycles] = 200;
+  record.counters.valid[ppc::core::PerfCounters::kCycles] = true;
+
+  auto json = ppc::core::PerfResultSink::ToJson(record);
+  EXPECT_NE(json.find(R"("task":"seq/example")"), std::string::npos);
+  EXPECT_NE(json.find(R"("inputs_count":[100,2])"), std::string::npos);
+  EXPECT_NE(json.find(R"("median":0.25)"), std::string::npos);
+  EXPECT_NE(json.find(R"("cycles":200)"), std::string::npos);
+  EXPECT_EQ(json.find("instructions"), std::string::npos);
+  EXPECT_NE(json.find(R"("stages":{"Validation":{"time_sec":0)"), std::string::npos);
+
+  auto header = ppc::core::PerfResultSink::CsvHeader();
+  auto row = ppc::core::PerfResultSink::ToCsv(record);
+  EXPECT_EQ(std::count(header.begin(), header.end(), ','), std::count(row.begin(), row.end(), ','));
+  EXPECT_EQ(row.find(",seq/example,seq,pipeline,1,100;2,2,0.5,0.25,"), row.find(','));
+
+  record.task_path = R"(seq/a,"b")";
+  EXPECT_EQ(ppc::core::PerfResultSink::ToCsv(record).find(R"(,"seq/a,""b""",seq,pipeline,)"), row.find(','));
+}
+
+TEST(perf_tests, check_perf_result_sink_json_escaping) {
+  ppc::core::PerfRecord record;
+  record.task_path = std::string("seq/a\r\n\x01\"b\"");
+  record.time_sec = std::numeric_limits<double>::quiet_NaN();
+  record.samples_sec = {0.25, std::numeric_limits<double>::infinity()};
+
+  auto json = ppc::core::PerfResultSink::ToJson(record);
+  EXPECT_NE(json.find(R"("task":"seq/a\r\n\u0001\"b\"")"), std::string::npos);
+  EXPECT_NE(json.find(R"("time_sec":null)"), std::string::npos);
+  EXPECT_NE(json.find(R"("samples_sec":[0.25,null])"), std::string::npos);
+  EXPECT_EQ(json.find("nan"), std::string::npos);
+  EXPECT_EQ(json.find("inf"), std::string::npos);
+}
+
+TEST(perf_tests, check_perf_result_sink_from_env) {
+#ifndef _WIN32
+  auto path = std::filesystem::temp_directory_path() / "ppc_perf_result_sink_test.csv";
+  std::filesystem::remove(path);
+  setenv("PPC_PERF_RESULTS", path.string().c_str(), 1);  // NOLINT(misc-include-cleaner)
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  perf_results->type_of_running = ppc::core::PerfResults::kPipeline;
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  unsetenv("PPC_PERF_RESULTS");  // NOLINT(misc-include-cleaner)
+
+  std::ifstream file(path);
+  std::string line;
+  std::vector<std::string> lines;
+  while (std::getline(file, line)) {
+    lines.push_back(line);
+  }
+  std::filesystem::remove(path);
+
+  ASSERT_EQ(lines.size(), 3U);
+  EXPECT_EQ(lines[0], ppc::core::PerfResultSink::CsvHeader());
+  EXPECT_NE(lines[1].find("pipeline"), std::string::npos);
+#else
+  GTEST_SKIP();
+#endif
+}
+
+TEST(perf_tests, check_stages_printed_only_when_recorded) {
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  perf_results->type_of_running = ppc::core::PerfResults::kPipeline;
+
+  testing::internal::CaptureStdout();
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  EXPECT_EQ(testing::internal::GetCapturedStdout().find(":stages:"), std::string::npos);
+
+  perf_results->task_statistics.stages[ppc::core::TaskStatistics::kRun].calls = 1;
+  testing::internal::CaptureStdout();
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  EXPECT_NE(testing::internal::GetCapturedStdout().find(":stages:"), std::string::npos);
+}
+
+TEST(perf_tests, check_best_task_run_of_a_call) {
+  int calls = 0;
+  int syncs = 0;
+  const double time = ppc::core::BestTaskRun(10, [&] { calls++; }, [&] { syncs++; });
+  EXPECT_GE(calls, 3);
+  // after PreProcessing and after every call
+  EXPECT_GT(syncs, calls);
+  EXPECT_GE(time, 0.0);
+}
+
+TEST(perf_tests, check_default_thread_ladder) {
+  EXPECT_EQ(ppc::core::DefaultThreadLadder(1), std::vector<int>({1}));
+  EXPECT_EQ(ppc::core::DefaultThreadLadder(8), std::vector<int>({1, 2, 4, 8}));
+  EXPECT_EQ(ppc::core::DefaultThreadLadder(6), std::vector<int>({1, 2, 4, 6}));
+}
+
+TEST(perf_tests, check_strong_and_weak_scaling_sweep) {
+  const int save_var = ppc::util::GetPPCNumThreads();
+
+  std::vector<std::vector<uint32_t>> inputs;
+  std::vector<std::vector<uint32_t>> outputs;
+  std::vector<int> created_scales;
+  auto factory = [&](int input_scale) {
+    created_scales.push_back(input_scale);
+    inputs.emplace_back(static_cast<size_t>(100 * input_scale), 1);
+    outputs.emplace_back(1, 0);
+
+    auto task_data = std::make_shared<ppc::core::TaskData>();
+    task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(inputs.back().data()));
+    task_data->inputs_count.emplace_back(inputs.back().size());
+    task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(outputs.back().data()));
+    task_data->outputs_count.emplace_back(outputs.back().size());
+    return std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+  };
+
+  // Ideal scaling: every run takes 1 / num_threads seconds
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 1;
+  double now = 0.0;
+  perf_attr->current_timer = [&] { return now += 1.0 / ppc::util::GetPPCNumThreads(); };
+
+  ppc::core::ScalingAttr scaling_attr;
+  scaling_attr.thread_counts = {1, 2, 4};
+  inputs.reserve(9);
+  outputs.reserve(9);
+
+  auto strong = ppc::core::ScalingSweep(factory, scaling_attr).Run(perf_attr);
+  ppc::core::ScalingSweep::PrintScaling(strong, scaling_attr.kind);
+  ASSERT_EQ(strong.size(), 3U);
+  EXPECT_NEAR(strong[2].speedup, 4.0, 1e-9);
+  EXPECT_NEAR(strong[2].efficiency, 1.0, 1e-9);
+  EXPECT_NEAR(strong[2].serial_fraction, 0.0, 1e-9);
+  EXPECT_EQ(strong[1].perf_results.num_threads, 2);
+  EXPECT_EQ(ppc::util::GetPPCNumThreads(), save_var);
+
+  scaling_attr.kind = ppc::core::ScalingAttr::kWeak;
+  auto weak = ppc::core::ScalingSweep(factory, scaling_attr).Run(perf_attr);
+  ASSERT_EQ(weak.size(), 3U);
+  EXPECT_EQ(weak[2].input_scale, 4);
+  EXPECT_EQ(weak[2].perf_results.inputs_count[0], 400U);
+  EXPECT_NEAR(weak[2].speedup, 16.0, 1e-9);
+  EXPECT_EQ(created_scales, std::vector<int>({1, 1, 1, 1, 2, 4}));
+  EXPECT_EQ(outputs.back()[0], 400U);
+
+  // 3 and 5 threads over a baseline of 2 need 1.5x and 2.5x the input, rounded to the nearest whole one
+  scaling_attr.thread_counts = {2, 3, 5};
+  created_scales.clear();
+  auto uneven = ppc::core::ScalingSweep(factory, scaling_attr).Run(perf_attr);
+  EXPECT_EQ(created_scales, std::vector<int>({1, 2, 3}));
+  EXPECT_NEAR(uneven[1].speedup, 2.0 * 1.5, 1e-9);
+  EXPECT_EQ(ppc::util::GetPPCNumThreads(), save_var);
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+// Task whose Run() is a plain library call, so Perf times it like any task. A non-empty sync runs
+// at the end of PreProcessing and after every call, e.g. an MPI barrier so that every rank times
+// the slowest one.
+class CallTask : public Task {
+ public:
+  CallTask(TaskDataPtr task_data, std::function<void()> body, std::function<void()> sync = {})
+      : Task(std::move(task_data)), body_(std::move(body)), sync_(std::move(sync)) {}
+
+  bool ValidationImpl() override { return true; }
+  bool PreProcessingImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override { return true; }
+
+ private:
+  std::function<void()> body_;
+  std::function<void()> sync_;
+};
+
+// Fastest of three timed Run() calls of body over count elements. The time only goes to the caller,
+// so comparison runs stay out of the task_run output of the perf test.
+double BestTaskRun(size_t count, const std::function<void()> &body, const std::function<void()> &sync = {});
+
+// Three decimals of value as a property of the current test in the gtest report
+void RecordFigure(const std::string &key, double value);
+
+}  // namespace ppc::core
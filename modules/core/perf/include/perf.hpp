@@ -3,7 +3,9 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <vector>
 
+#include "core/perf/include/perf_counters.hpp"
 #include "core/task/include/task.hpp"
 
 namespace ppc::core {
@@ -11,16 +13,53 @@ namespace ppc::core {
 struct PerfAttr {
   // count of task's running
   uint64_t num_running;
+  // count of untimed runs before measurement (cache, page and frequency warmup)
+  uint64_t num_warmup = 0;
+  // time every run separately and compute statistics over the samples
+  bool benchmark_mode = false;
+  // count of bootstrap resamples and confidence level of the mean's interval
+  uint64_t num_bootstrap = 1000;
+  double confidence_level = 0.95;
+  // collect hardware counters over the measured runs (also enabled by PPC_PERF_COUNTERS=1)
+  bool collect_counters = false;
   std::function<double()> current_timer = [&] { return 0.0; };
 };
 
+struct PerfStatistics {
+  // statistics over per-run samples (in seconds)
+  double min = 0.0;
+  double median = 0.0;
+  double p90 = 0.0;
+  double p99 = 0.0;
+  double mean = 0.0;
+  double stddev = 0.0;
+  // bootstrap confidence interval of the mean
+  double ci_lower = 0.0;
+  double ci_upper = 0.0;
+};
+
 struct PerfResults {
   // measurement of task's time (in seconds)
   double time_sec = 0.0;
+  // per-run samples and their statistics, filled in benchmark mode only
+  std::vector<double> samples_sec;
+  PerfStatistics statistics;
+  // hardware counters summed over the measured runs, unavailable unless requested
+  PerfCounters counters;
+  // per-stage time, memory and allocations of the task after the measurement
+  TaskStatistics task_statistics;
+  // description of the measured run for the result sink
+  uint64_t num_running = 0;
+  int num_threads = 1;
+  std::vector<uint32_t> inputs_count;
   enum TypeOfRunning : uint8_t { kPipeline, kTaskRun, kNone } type_of_running = kNone;
   constexpr static double kMaxTime = 10.0;
 };
 
+// Compute order statistics, moments and a percentile bootstrap interval of the mean
+PerfStatistics ComputePerfStatistics(const std::vector<double>& samples, uint64_t num_bootstrap = 1000,
+                                     double confidence_level = 0.95);
+
 class Perf {
  public:
   // Init performance analysis with initialized task and initialized data
@@ -33,7 +72,7 @@ class Perf {
   void PipelineRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::shared_ptr<PerfResults>& perf_results) const;
   // Check performance of task's Run() function
   void TaskRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::shared_ptr<PerfResults>& perf_results) const;
-  // Pint results for automation checkers
+  // Pint results for automation checkers and append them to the PPC_PERF_RESULTS sink
   static void PrintPerfStatistic(const std::shared_ptr<PerfResults>& perf_results);
 
  private:
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ppc::core {
+
+struct PerfCounters {
+  enum Event : uint8_t { kCycles, kInstructions, kL1dMisses, kLlcMisses, kBranchMisses, kDtlbMisses, kNumEvents };
+
+  // raw event counts, scaled up when the kernel multiplexed the counters
+  std::array<uint64_t, kNumEvents> values{};
+  // false for events which could not be opened or were never scheduled
+  std::array<bool, kNumEvents> valid{};
+
+  [[nodiscard]] bool IsAvailable() const;
+  [[nodiscard]] double Ipc() const;
+  static std::string Name(Event event);
+};
+
+// Hardware counters of the whole process opened through perf_event_open. perf events follow
+// threads, not processes, so one set of events is opened for every thread listed in
+// /proc/self/task at construction: the OpenMP, TBB and ThreadPool workers that already exist are
+// counted like the calling thread. Each set is inherited by the threads its thread creates later,
+// so workers started during the measurement are counted as well. Read() sums all sets.
+// Events are split into two groups so that every group fits into the programmable counters of
+// one core. When the kernel denies access (perf_event_paranoid, containers, non-Linux) the group
+// stays unavailable and Start/Stop/Read are no-ops.
+class PerfCounterGroup {
+ public:
+  PerfCounterGroup();
+  PerfCounterGroup(const PerfCounterGroup &) = delete;
+  PerfCounterGroup &operator=(const PerfCounterGroup &) = delete;
+  ~PerfCounterGroup();
+
+  [[nodiscard]] bool IsAvailable() const;
+  void Start();
+  void Stop();
+  [[nodiscard]] PerfCounters Read() const;
+
+ private:
+  // Event descriptors of one thread of the process, -1 where an event could not be opened
+  using ThreadEvents = std::array<int, PerfCounters::kNumEvents>;
+
+  std::vector<ThreadEvents> threads_;
+  std::vector<int> leaders_;
+};
+
+// Counters are requested explicitly through PerfAttr or for every perf test with PPC_PERF_COUNTERS=1
+bool PerfCountersRequested();
+
+}  // namespace ppc::core
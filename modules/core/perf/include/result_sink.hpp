@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+
+namespace ppc::core {
+
+// One measurement of one perf test, flattened for machine consumption
+struct PerfRecord {
+  // seconds since the Unix epoch when the record was produced
+  int64_t timestamp = 0;
+  // task directory relative to tasks/, e.g. "omp/example", or module relative to modules/, e.g. "core/perf"
+  std::string task_path;
+  // seq, omp, tbb, stl, mpi, all, or core for the core module tests
+  std::string technology;
+  // pipeline, task_run or none
+  std::string type_of_running;
+  int num_threads = 1;
+  std::vector<uint32_t> inputs_count;
+  uint64_t num_running = 0;
+  double time_sec = 0.0;
+  std::vector<double> samples_sec;
+  PerfStatistics statistics;
+  PerfCounters counters;
+  TaskStatistics task_statistics;
+};
+
+// Appends perf records to a file, one JSON object per line or one CSV row per record
+class PerfResultSink {
+ public:
+  enum class Format : uint8_t { kJsonLines, kCsv };
+
+  PerfResultSink(std::string path, Format format);
+
+  // Sink configured by PPC_PERF_RESULTS=<path>; files ending with .csv get CSV, others JSON lines
+  static std::optional<PerfResultSink> FromEnvironment();
+
+  void Append(const PerfRecord &record) const;
+
+  [[nodiscard]] const std::string &Path() const { return path_; }
+  [[nodiscard]] Format GetFormat() const { return format_; }
+
+  static std::string ToJson(const PerfRecord &record);
+  static std::string ToCsv(const PerfRecord &record);
+  static std::string CsvHeader();
+
+ private:
+  std::string path_;
+  Format format_;
+};
+
+// Build a record from the results and the path of the perf test source file
+PerfRecord MakePerfRecord(const PerfResults &perf_results, const std::string &test_file_path);
+
+}  // namespace ppc::core
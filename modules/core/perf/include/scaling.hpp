@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+struct ScalingAttr {
+  // strong: fixed input for every thread count; weak: input grows with the thread count
+  enum Kind : uint8_t { kStrong, kWeak } kind = kStrong;
+  // thread counts of the sweep, DefaultThreadLadder() when empty; the first one is the baseline
+  std::vector<int> thread_counts;
+  PerfResults::TypeOfRunning type_of_running = PerfResults::kTaskRun;
+};
+
+struct ScalingPoint {
+  int num_threads = 1;
+  // multiplier of the baseline input passed to the task factory: 1 for strong scaling, the thread count
+  // relative to the baseline rounded to the nearest integer for weak scaling
+  int input_scale = 1;
+  // time of one run: median in benchmark mode, otherwise the mean
+  double time_sec = 0.0;
+  // scaled speedup for weak scaling
+  double speedup = 1.0;
+  double efficiency = 1.0;
+  // Karp-Flatt experimentally determined serial fraction, 0 for the baseline
+  double serial_fraction = 0.0;
+  PerfResults perf_results;
+};
+
+// Creates a task with initialized data whose input is input_scale times the baseline input
+using TaskFactory = std::function<std::shared_ptr<Task>(int input_scale)>;
+
+// 1, 2, 4, ... up to max_threads, which is always included
+std::vector<int> DefaultThreadLadder(int max_threads = 0);
+
+// Re-run a task factory across a thread-count ladder through Perf. The thread count is applied with
+// ppc::util::SetPPCNumThreads, so OpenMP, TBB and std::thread consumers observe the same value, and
+// the original count is restored afterwards.
+class ScalingSweep {
+ public:
+  ScalingSweep(TaskFactory factory, ScalingAttr scaling_attr);
+
+  [[nodiscard]] std::vector<ScalingPoint> Run(const std::shared_ptr<PerfAttr> &perf_attr) const;
+
+  // Print one line per point and append the points to the PPC_PERF_RESULTS sink
+  static void PrintScaling(const std::vector<ScalingPoint> &points, ScalingAttr::Kind kind);
+
+ private:
+  TaskFactory factory_;
+  ScalingAttr scaling_attr_;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,56 @@
+#include "core/perf/include/call_timing.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+
+bool ppc::core::CallTask::PreProcessingImpl() {
+  if (sync_) {
+    sync_();
+  }
+  return true;
+}
+
+bool ppc::core::CallTask::RunImpl() {
+  body_();
+  if (sync_) {
+    sync_();
+  }
+  return true;
+}
+
+double ppc::core::BestTaskRun(size_t count, const std::function<void()> &body, const std::function<void()> &sync) {
+  auto task_data = std::make_shared<TaskData>();
+  task_data->inputs_count.emplace_back(static_cast<std::uint32_t>(count));
+  auto task = std::make_shared<CallTask>(task_data, body, sync);
+
+  auto perf_attr = std::make_shared<PerfAttr>();
+  perf_attr->num_running = 3;
+  perf_attr->benchmark_mode = true;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [t0]() {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perf_results = std::make_shared<PerfResults>();
+  Perf(task).TaskRun(perf_attr, perf_results);
+  return perf_results->statistics.min;
+}
+
+void ppc::core::RecordFigure(const std::string &key, double value) {
+  std::stringstream str;
+  str << std::fixed << std::setprecision(3) << value;
+  ::testing::Test::RecordProperty(key, str.str());
+}
@@ -2,16 +2,132 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <numeric>
+#include <optional>
+#include <random>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
+#include "core/perf/include/perf_counters.hpp"
+#include "core/perf/include/result_sink.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+// Percentile of sorted samples with linear interpolation between closest ranks
+double SortedPercentile(const std::vector<double>& sorted, double fraction) {
+  const double position = fraction * static_cast<double>(sorted.size() - 1);
+  const auto lower = static_cast<size_t>(std::floor(position));
+  const size_t upper = std::min(lower + 1, sorted.size() - 1);
+  const double weight = position - static_cast<double>(lower);
+  return sorted[lower] + (weight * (sorted[upper] - sorted[lower]));
+}
+
+void PrintStatistics(const std::string& prefix, const ppc::core::PerfResults& perf_results) {
+  if (perf_results.samples_sec.empty()) {
+    return;
+  }
+  const auto& stats = perf_results.statistics;
+  std::stringstream stats_str;
+  stats_str << std::fixed << std::setprecision(10);
+  stats_str << "runs=" << perf_results.samples_sec.size() << " min=" << stats.min << " median=" << stats.median
+            << " p90=" << stats.p90 << " p99=" << stats.p99 << " mean=" << stats.mean << " stddev=" << stats.stddev
+            << " ci=[" << stats.ci_lower << "," << stats.ci_upper << "]";
+  std::cout << prefix << ":statistics:" << stats_str.str() << '\n';
+}
+
+void PrintCounters(const std::string& prefix, const ppc::core::PerfResults& perf_results) {
+  const auto& counters = perf_results.counters;
+  if (!counters.IsAvailable()) {
+    return;
+  }
+  std::stringstream counters_str;
+  for (int i = 0; i < ppc::core::PerfCounters::kNumEvents; i++) {
+    if (counters.valid[i]) {
+      counters_str << ppc::core::PerfCounters::Name(static_cast<ppc::core::PerfCounters::Event>(i)) << "="
+                   << counters.values[i] << " ";
+    }
+  }
+  counters_str << "ipc=" << std::fixed << std::setprecision(3) << counters.Ipc();
+  std::cout << prefix << ":counters:" << counters_str.str() << '\n';
+}
+
+void PrintStages(const std::string& prefix, const ppc::core::PerfResults& perf_results) {
+  const auto& stages = perf_results.task_statistics.stages;
+  if (std::ranges::all_of(stages, [](const auto& stats) { return stats.calls == 0; })) {
+    return;
+  }
+  std::stringstream stages_str;
+  for (int i = 0; i < ppc::core::TaskStatistics::kNumStages; i++) {
+    const auto stage = static_cast<ppc::core::TaskStatistics::Stage>(i);
+    const auto& stats = stages[stage];
+    stages_str << (i == 0 ? "" : " ") << ppc::core::TaskStatistics::StageName(stage) << "(time=" << std::fixed
+               << std::setprecision(10) << stats.time_sec << " allocs=" << stats.allocations
+               << " bytes=" << stats.allocated_bytes << " peak_rss_delta=" << stats.peak_rss_delta_bytes << ")";
+  }
+  std::cout << prefix << ":stages:" << stages_str.str() << '\n';
+}
+
+}  // namespace
+
+ppc::core::PerfStatistics ppc::core::ComputePerfStatistics(const std::vector<double>& samples, uint64_t num_bootstrap,
+                                                           double confidence_level) {
+  PerfStatistics stats;
+  if (samples.empty()) {
+    return stats;
+  }
+
+  std::vector<double> sorted(samples);
+  std::ranges::sort(sorted);
+  const auto n = static_cast<double>(sorted.size());
+
+  stats.min = sorted.front();
+  stats.median = SortedPercentile(sorted, 0.5);
+  stats.p90 = SortedPercentile(sorted, 0.9);
+  stats.p99 = SortedPercentile(sorted, 0.99);
+  stats.mean = std::accumulate(sorted.begin(), sorted.end(), 0.0) / n;
+
+  double sq_sum = 0.0;
+  for (double sample : sorted) {
+    sq_sum += (sample - stats.mean) * (sample - stats.mean);
+  }
+  stats.stddev = sorted.size() > 1 ? std::sqrt(sq_sum / (n - 1.0)) : 0.0;
+
+  stats.ci_lower = stats.mean;
+  stats.ci_upper = stats.mean;
+  if (sorted.size() < 2 || num_bootstrap == 0) {
+    return stats;
+  }
+
+  // Fixed seed keeps the interval reproducible between runs with equal samples
+  std::mt19937_64 gen(sorted.size());
+  std::uniform_int_distribution<size_t> pick(0, sorted.size() - 1);
+  std::vector<double> means(num_bootstrap);
+  for (auto& resample_mean : means) {
+    double sum = 0.0;
+    for (size_t i = 0; i < sorted.size(); i++) {
+      sum += sorted[pick(gen)];
+    }
+    resample_mean = sum / n;
+  }
+  std::ranges::sort(means);
+
+  const double alpha = std::clamp(1.0 - confidence_level, 0.0, 1.0);
+  stats.ci_lower = SortedPercentile(means, alpha / 2.0);
+  stats.ci_upper = SortedPercentile(means, 1.0 - (alpha / 2.0));
+  return stats;
+}
 
 ppc::core::Perf::Perf(const std::shared_ptr<Task>& task_ptr) { SetTask(task_ptr); }
 
@@ -23,6 +139,7 @@ void ppc::core::Perf::SetTask(const std::shared_ptr<Task>& task_ptr) {
 void ppc::core::Perf::PipelineRun(const std::shared_ptr<PerfAttr>& perf_attr,
                                   const std::shared_ptr<ppc::core::PerfResults>& perf_results) const {
   perf_results->type_of_running = PerfResults::TypeOfRunning::kPipeline;
+  perf_results->inputs_count = task_->GetData()->inputs_count;
 
   CommonRun(
       perf_attr,
@@ -33,11 +150,13 @@ void ppc::core::Perf::PipelineRun(const std::shared_ptr<PerfAttr>& perf_attr,
         task_->PostProcessing();
       },
       perf_results);
+  perf_results->task_statistics = task_->GetStatistics();
 }
 
 void ppc::core::Perf::TaskRun(const std::shared_ptr<PerfAttr>& perf_attr,
                               const std::shared_ptr<ppc::core::PerfResults>& perf_results) const {
   perf_results->type_of_running = PerfResults::TypeOfRunning::kTaskRun;
+  perf_results->inputs_count = task_->GetData()->inputs_count;
 
   task_->Validation();
   task_->PreProcessing();
@@ -48,20 +167,64 @@ void ppc::core::Perf::TaskRun(const std::shared_ptr<PerfAttr>& perf_attr,
   task_->PreProcessing();
   task_->Run();
   task_->PostProcessing();
+  perf_results->task_statistics = task_->GetStatistics();
 }
 
 void ppc::core::Perf::CommonRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::function<void()>& pipeline,
                                 const std::shared_ptr<ppc::core::PerfResults>& perf_results) {
-  auto begin = perf_attr->current_timer();
-  for (uint64_t i = 0; i < perf_attr->num_running; i++) {
+  for (uint64_t i = 0; i < perf_attr->num_warmup; i++) {
     pipeline();
   }
-  auto end = perf_attr->current_timer();
-  perf_results->time_sec = end - begin;
+
+  perf_results->samples_sec.clear();
+  perf_results->statistics = PerfStatistics{};
+  perf_results->counters = PerfCounters{};
+  perf_results->num_running = perf_attr->num_running;
+  perf_results->num_threads = ppc::util::GetPPCNumThreads();
+
+  std::optional<PerfCounterGroup> counter_group;
+  if (perf_attr->collect_counters || PerfCountersRequested()) {
+    counter_group.emplace();
+    counter_group->Start();
+  }
+
+  if (!perf_attr->benchmark_mode) {
+    auto begin = perf_attr->current_timer();
+    for (uint64_t i = 0; i < perf_attr->num_running; i++) {
+      pipeline();
+    }
+    auto end = perf_attr->current_timer();
+    perf_results->time_sec = end - begin;
+  } else {
+    // Samples share their boundaries, so no time between runs is lost
+    perf_results->samples_sec.reserve(perf_attr->num_running);
+    auto begin = perf_attr->current_timer();
+    auto previous = begin;
+    for (uint64_t i = 0; i < perf_attr->num_running; i++) {
+      pipeline();
+      auto current = perf_attr->current_timer();
+      perf_results->samples_sec.push_back(current - previous);
+      previous = current;
+    }
+    perf_results->time_sec = previous - begin;
+  }
+
+  if (counter_group) {
+    counter_group->Stop();
+    perf_results->counters = counter_group->Read();
+  }
+  if (perf_attr->benchmark_mode) {
+    perf_results->statistics =
+        ComputePerfStatistics(perf_results->samples_sec, perf_attr->num_bootstrap, perf_attr->confidence_level);
+  }
 }
 
 void ppc::core::Perf::PrintPerfStatistic(const std::shared_ptr<PerfResults>& perf_results) {
   std::string relative_path(::testing::UnitTest::GetInstance()->current_test_info()->file());
+  if (auto sink = PerfResultSink::FromEnvironment()) {
+    sink->Append(MakePerfRecord(*perf_results, relative_path));
+  }
+
   std::string ppc_regex_template("parallel_programming_course");
   std::string perf_regex_template("perf_tests");
   std::string type_test_name;
@@ -86,6 +249,9 @@ void ppc::core::Perf::PrintPerfStatistic(const std::shared_ptr<PerfResults>& per
   if (time_secs < PerfResults::kMaxTime) {
     perf_res_str << std::fixed << std::setprecision(10) << time_secs;
     std::cout << relative_path << ":" << type_test_name << ":" << perf_res_str.str() << '\n';
+    PrintStatistics(relative_path + ":" + type_test_name, *perf_results);
+    PrintCounters(relative_path + ":" + type_test_name, *perf_results);
+    PrintStages(relative_path + ":" + type_test_name, *perf_results);
   } else {
     std::stringstream err_msg;
     err_msg << '\n' << "Task execute time need to be: ";
@@ -93,6 +259,9 @@ void ppc::core::Perf::PrintPerfStatistic(const std::shared_ptr<PerfResults>& per
     err_msg << "Original time in secs: " << time_secs << '\n';
     perf_res_str << std::fixed << std::setprecision(10) << -1.0;
     std::cout << relative_path << ":" << type_test_name << ":" << perf_res_str.str() << '\n';
+    PrintStatistics(relative_path + ":" + type_test_name, *perf_results);
+    PrintCounters(relative_path + ":" + type_test_name, *perf_results);
+    PrintStages(relative_path + ":" + type_test_name, *perf_results);
     throw std::runtime_error(err_msg.str().c_str());
   }
 }
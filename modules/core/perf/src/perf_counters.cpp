@@ -0,0 +1,196 @@
+#include "core/perf/include/perf_counters.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <sys/types.h>
+
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+#endif
+
+namespace {
+
+#ifdef __linux__
+struct EventConfig {
+  uint32_t type;
+  uint64_t config;
+  // index of the leader event of the group this event belongs to
+  ppc::core::PerfCounters::Event leader;
+};
+
+constexpr uint64_t CacheMissConfig(uint64_t cache) {
+  return cache | (static_cast<uint64_t>(PERF_COUNT_HW_CACHE_OP_READ) << 8) |
+         (static_cast<uint64_t>(PERF_COUNT_HW_CACHE_RESULT_MISS) << 16);
+}
+
+using Counters = ppc::core::PerfCounters;
+
+// Core pipeline events and memory hierarchy events live in separate groups
+constexpr std::array<EventConfig, Counters::kNumEvents> kEventConfigs = {{
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, Counters::kCycles},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, Counters::kCycles},
+    {PERF_TYPE_HW_CACHE, CacheMissConfig(PERF_COUNT_HW_CACHE_L1D), Counters::kL1dMisses},
+    {PERF_TYPE_HW_CACHE, CacheMissConfig(PERF_COUNT_HW_CACHE_LL), Counters::kL1dMisses},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, Counters::kCycles},
+    {PERF_TYPE_HW_CACHE, CacheMissConfig(PERF_COUNT_HW_CACHE_DTLB), Counters::kL1dMisses},
+}};
+
+int OpenEvent(const EventConfig &event, pid_t tid, int group_fd) {
+  perf_event_attr attr{};
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = event.type;
+  attr.config = event.config;
+  attr.disabled = group_fd == -1 ? 1 : 0;
+  attr.inherit = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, tid, -1, group_fd, 0));
+}
+
+// Threads of the calling process; empty when /proc is not mounted
+std::vector<pid_t> ProcessThreads() {
+  std::vector<pid_t> tids;
+  std::error_code error;
+  for (const auto &entry : std::filesystem::directory_iterator("/proc/self/task", error)) {
+    const std::string name = entry.path().filename().string();
+    if (!name.empty() && std::ranges::all_of(name, [](char c) { return c >= '0' && c <= '9'; })) {
+      tids.push_back(static_cast<pid_t>(std::stol(name)));
+    }
+  }
+  return tids;
+}
+#endif
+
+}  // namespace
+
+bool ppc::core::PerfCounters::IsAvailable() const { return std::ranges::any_of(valid, [](bool v) { return v; }); }
+
+double ppc::core::PerfCounters::Ipc() const {
+  if (!valid[kCycles] || !valid[kInstructions] || values[kCycles] == 0) {
+    return 0.0;
+  }
+  return static_cast<double>(values[kInstructions]) / static_cast<double>(values[kCycles]);
+}
+
+std::string ppc::core::PerfCounters::Name(Event event) {
+  switch (event) {
+    case kCycles:
+      return "cycles";
+    case kInstructions:
+      return "instructions";
+    case kL1dMisses:
+      return "l1d_misses";
+    case kLlcMisses:
+      return "llc_misses";
+    case kBranchMisses:
+      return "branch_misses";
+    case kDtlbMisses:
+      return "dtlb_misses";
+    case kNumEvents:
+      break;
+  }
+  return "unknown";
+}
+
+ppc::core::PerfCounterGroup::PerfCounterGroup() {
+#ifdef __linux__
+  auto tids = ProcessThreads();
+  if (tids.empty()) {
+    // pid 0 is the calling thread
+    tids.push_back(0);
+  }
+  for (pid_t tid : tids) {
+    ThreadEvents fds;
+    fds.fill(-1);
+    for (int i = 0; i < PerfCounters::kNumEvents; i++) {
+      const auto &event = kEventConfigs[i];
+      if (event.leader == i) {
+        fds[i] = OpenEvent(event, tid, -1);
+        if (fds[i] != -1) {
+          leaders_.push_back(fds[i]);
+        }
+      } else if (fds[event.leader] != -1) {
+        fds[i] = OpenEvent(event, tid, fds[event.leader]);
+      }
+    }
+    // A thread that exited after the listing opens nothing
+    if (std::ranges::any_of(fds, [](int fd) { return fd != -1; })) {
+      threads_.push_back(fds);
+    }
+  }
+#endif
+}
+
+ppc::core::PerfCounterGroup::~PerfCounterGroup() {
+#ifdef __linux__
+  for (const auto &fds : threads_) {
+    for (int fd : fds) {
+      if (fd != -1) {
+        close(fd);
+      }
+    }
+  }
+#endif
+}
+
+bool ppc::core::PerfCounterGroup::IsAvailable() const { return !leaders_.empty(); }
+
+void ppc::core::PerfCounterGroup::Start() {
+#ifdef __linux__
+  for (int fd : leaders_) {
+    ioctl(fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+#endif
+}
+
+void ppc::core::PerfCounterGroup::Stop() {
+#ifdef __linux__
+  for (int fd : leaders_) {
+    ioctl(fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+  }
+#endif
+}
+
+ppc::core::PerfCounters ppc::core::PerfCounterGroup::Read() const {
+  PerfCounters counters;
+#ifdef __linux__
+  for (const auto &fds : threads_) {
+    for (int i = 0; i < PerfCounters::kNumEvents; i++) {
+      // value, time enabled, time running
+      std::array<uint64_t, 3> data{};
+      if (fds[i] == -1 || read(fds[i], data.data(), sizeof(data)) != static_cast<ssize_t>(sizeof(data)) ||
+          data[2] == 0) {
+        continue;
+      }
+      const double scale = static_cast<double>(data[1]) / static_cast<double>(data[2]);
+      counters.values[i] += static_cast<uint64_t>(static_cast<double>(data[0]) * scale);
+      counters.valid[i] = true;
+    }
+  }
+#endif
+  return counters;
+}
+
+bool ppc::core::PerfCountersRequested() {
+#ifdef _WIN32
+  return false;
+#else
+  const char *env = std::getenv("PPC_PERF_COUNTERS");
+  return env != nullptr && std::string(env) == "1";
+#endif
+}
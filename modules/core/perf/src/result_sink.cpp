@@ -0,0 +1,273 @@
+#include "core/perf/include/result_sink.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "core/perf/include/perf.hpp"
+#include "core/perf/include/perf_counters.hpp"
+
+namespace {
+
+std::string JsonString(const std::string &value) {
+  std::stringstream out;
+  out << '"';
+  for (char c : value) {
+    switch (c) {
+      case '"':
+        out << "\\\"";
+        break;
+      case '\\':
+        out << "\\\\";
+        break;
+      case '\b':
+        out << "\\b";
+        break;
+      case '\f':
+        out << "\\f";
+        break;
+      case '\n':
+        out << "\\n";
+        break;
+      case '\r':
+        out << "\\r";
+        break;
+      case '\t':
+        out << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+        } else {
+          out << c;
+        }
+    }
+  }
+  out << '"';
+  return out.str();
+}
+
+// JSON has no literals for NaN and infinities
+struct JsonNumber {
+  double value;
+};
+
+std::ostream &operator<<(std::ostream &out, JsonNumber number) {
+  if (!std::isfinite(number.value)) {
+    return out << "null";
+  }
+  return out << number.value;
+}
+
+// RFC 4180 field: quoted, with inner quotes doubled, when it holds a separator, quote or line break
+std::string CsvField(const std::string &value) {
+  if (value.find_first_of(",\"\r\n") == std::string::npos) {
+    return value;
+  }
+  std::string out("\"");
+  for (char c : value) {
+    out.push_back(c);
+    if (c == '"') {
+      out.push_back('"');
+    }
+  }
+  out.push_back('"');
+  return out;
+}
+
+std::string TypeOfRunningName(ppc::core::PerfResults::TypeOfRunning type_of_running) {
+  switch (type_of_running) {
+    case ppc::core::PerfResults::kPipeline:
+      return "pipeline";
+    case ppc::core::PerfResults::kTaskRun:
+      return "task_run";
+    case ppc::core::PerfResults::kNone:
+      break;
+  }
+  return "none";
+}
+
+std::stringstream MakeNumberStream() {
+  std::stringstream out;
+  out << std::setprecision(std::numeric_limits<double>::max_digits10);
+  return out;
+}
+
+}  // namespace
+
+ppc::core::PerfResultSink::PerfResultSink(std::string path, Format format) : path_(std::move(path)), format_(format) {}
+
+std::optional<ppc::core::PerfResultSink> ppc::core::PerfResultSink::FromEnvironment() {
+#ifdef _WIN32
+  size_t len;
+  char env[512];
+  errno_t err = getenv_s(&len, env, sizeof(env), "PPC_PERF_RESULTS");
+  if (err != 0 || len == 0) {
+    return std::nullopt;
+  }
+#else
+  const char *env = std::getenv("PPC_PERF_RESULTS");
+  if (env == nullptr || *env == '\0') {
+    return std::nullopt;
+  }
+#endif
+  std::string path(env);
+  const auto format = std::filesystem::path(path).extension() == ".csv" ? Format::kCsv : Format::kJsonLines;
+  return PerfResultSink(path, format);
+}
+
+void ppc::core::PerfResultSink::Append(const PerfRecord &record) const {
+  const bool write_header = format_ == Format::kCsv &&
+                            (!std::filesystem::exists(path_) || std::filesystem::file_size(path_) == 0);
+  std::ofstream out(path_, std::ios::app);
+  if (!out) {
+    throw std::runtime_error("Unable to open perf results file: " + path_);
+  }
+  // Whole lines are written at once so that concurrent test processes do not interleave
+  std::string lines = write_header ? CsvHeader() + '\n' : std::string();
+  lines.append(format_ == Format::kCsv ? ToCsv(record) : ToJson(record)).push_back('\n');
+  out << lines << std::flush;
+}
+
+std::string ppc::core::PerfResultSink::ToJson(const PerfRecord &record) {
+  auto out = MakeNumberStream();
+  const auto &stats = record.statistics;
+  out << "{\"timestamp\":" << record.timestamp << ",\"task\":" << JsonString(record.task_path)
+      << ",\"technology\":" << JsonString(record.technology)
+      << ",\"type_of_running\":" << JsonString(record.type_of_running) << ",\"num_threads\":" << record.num_threads
+      << ",\"inputs_count\":[";
+  for (size_t i = 0; i < record.inputs_count.size(); i++) {
+    out << (i == 0 ? "" : ",") << record.inputs_count[i];
+  }
+  out << "],\"num_running\":" << record.num_running << ",\"time_sec\":" << JsonNumber{record.time_sec};
+  if (!record.samples_sec.empty()) {
+    out << ",\"statistics\":{\"min\":" << JsonNumber{stats.min} << ",\"median\":" << JsonNumber{stats.median}
+        << ",\"p90\":" << JsonNumber{stats.p90} << ",\"p99\":" << JsonNumber{stats.p99}
+        << ",\"mean\":" << JsonNumber{stats.mean} << ",\"stddev\":" << JsonNumber{stats.stddev}
+        << ",\"ci_lower\":" << JsonNumber{stats.ci_lower} << ",\"ci_upper\":" << JsonNumber{stats.ci_upper} << "}";
+    out << ",\"samples_sec\":[";
+    for (size_t i = 0; i < record.samples_sec.size(); i++) {
+      out << (i == 0 ? "" : ",") << JsonNumber{record.samples_sec[i]};
+    }
+    out << "]";
+  }
+  if (record.counters.IsAvailable()) {
+    out << ",\"counters\":{";
+    for (int i = 0; i < PerfCounters::kNumEvents; i++) {
+      if (record.counters.valid[i]) {
+        out << JsonString(PerfCounters::Name(static_cast<PerfCounters::Event>(i))) << ":"
+            << record.counters.values[i] << ",";
+      }
+    }
+    out << "\"ipc\":" << JsonNumber{record.counters.Ipc()} << "}";
+  }
+  out << ",\"stages\":{";
+  for (int i = 0; i < TaskStatistics::kNumStages; i++) {
+    const auto stage = static_cast<TaskStatistics::Stage>(i);
+    const auto &stats = record.task_statistics.stages[stage];
+    out << (i == 0 ? "" : ",") << JsonString(TaskStatistics::StageName(stage))
+        << ":{\"time_sec\":" << JsonNumber{stats.time_sec} << ",\"allocations\":" << stats.allocations
+        << ",\"allocated_bytes\":" << stats.allocated_bytes << ",\"peak_rss_delta_bytes\":" << stats.peak_rss_delta_bytes
+        << "}";
+  }
+  out << "}}";
+  return out.str();
+}
+
+std::string ppc::core::PerfResultSink::CsvHeader() {
+  std::string header =
+      "timestamp,task,technology,type_of_running,num_threads,inputs_count,num_running,time_sec,"
+      "min,median,p90,p99,mean,stddev,ci_lower,ci_upper";
+  for (int i = 0; i < PerfCounters::kNumEvents; i++) {
+    header.append(",").append(PerfCounters::Name(static_cast<PerfCounters::Event>(i)));
+  }
+  header.append(",ipc");
+  for (int i = 0; i < TaskStatistics::kNumStages; i++) {
+    const std::string stage = TaskStatistics::StageName(static_cast<TaskStatistics::Stage>(i));
+    for (const char *column : {"_time_sec", "_allocations", "_allocated_bytes", "_peak_rss_delta_bytes"}) {
+      header.append(",").append(stage).append(column);
+    }
+  }
+  return header;
+}
+
+std::string ppc::core::PerfResultSink::ToCsv(const PerfRecord &record) {
+  auto out = MakeNumberStream();
+  out << record.timestamp << "," << CsvField(record.task_path) << "," << CsvField(record.technology) << ","
+      << CsvField(record.type_of_running) << "," << record.num_threads << ",";
+  for (size_t i = 0; i < record.inputs_count.size(); i++) {
+    out << (i == 0 ? "" : ";") << record.inputs_count[i];
+  }
+  out << "," << record.num_running << "," << record.time_sec;
+  // Statistics and counters stay empty when they were not collected
+  const auto &stats = record.statistics;
+  if (!record.samples_sec.empty()) {
+    out << "," << stats.min << "," << stats.median << "," << stats.p90 << "," << stats.p99 << "," << stats.mean << ","
+        << stats.stddev << "," << stats.ci_lower << "," << stats.ci_upper;
+  } else {
+    out << ",,,,,,,,";
+  }
+  for (int i = 0; i < PerfCounters::kNumEvents; i++) {
+    out << ",";
+    if (record.counters.valid[i]) {
+      out << record.counters.values[i];
+    }
+  }
+  out << ",";
+  if (record.counters.IsAvailable()) {
+    out << record.counters.Ipc();
+  }
+  for (const auto &stats : record.task_statistics.stages) {
+    out << "," << stats.time_sec << "," << stats.allocations << "," << stats.allocated_bytes << ","
+        << stats.peak_rss_delta_bytes;
+  }
+  return out.str();
+}
+
+ppc::core::PerfRecord ppc::core::MakePerfRecord(const PerfResults &perf_results, const std::string &test_file_path) {
+  PerfRecord record;
+  record.timestamp = std::chrono::duration_cast<std::chrono::seconds>(
+                         std::chrono::system_clock::now().time_since_epoch())
+                         .count();
+
+  // ".../tasks/<technology>/<task>/perf_tests/main.cpp" -> "<technology>/<task>",
+  // ".../modules/core/<module>/func_tests/<file>.cpp" -> "core/<module>" with technology "core"
+  const std::string generic_path = std::filesystem::path(test_file_path).generic_string();
+  size_t begin = 0;
+  for (const std::string dir : {"tasks/", "modules/"}) {
+    const auto found = generic_path.rfind(dir);
+    if (found != std::string::npos) {
+      begin = std::max(begin, found + dir.length());
+    }
+  }
+  auto end = generic_path.find("/perf_tests/", begin);
+  if (end == std::string::npos) {
+    end = generic_path.find("/func_tests/", begin);
+  }
+  record.task_path = generic_path.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+  record.technology = record.task_path.substr(0, record.task_path.find('/'));
+
+  record.type_of_running = TypeOfRunningName(perf_results.type_of_running);
+  record.num_threads = perf_results.num_threads;
+  record.inputs_count = perf_results.inputs_count;
+  record.num_running = perf_results.num_running;
+  record.time_sec = perf_results.time_sec;
+  record.samples_sec = perf_results.samples_sec;
+  record.statistics = perf_results.statistics;
+  record.counters = perf_results.counters;
+  record.task_statistics = perf_results.task_statistics;
+  return record;
+}
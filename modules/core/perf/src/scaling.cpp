@@ -0,0 +1,108 @@
+#include "core/perf/include/scaling.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/perf/include/result_sink.hpp"
+#include "core/util/include/util.hpp"
+
+std::vector<int> ppc::core::DefaultThreadLadder(int max_threads) {
+  if (max_threads <= 0) {
+    max_threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  }
+  std::vector<int> ladder;
+  for (int num_threads = 1; num_threads < max_threads; num_threads *= 2) {
+    ladder.push_back(num_threads);
+  }
+  ladder.push_back(max_threads);
+  return ladder;
+}
+
+ppc::core::ScalingSweep::ScalingSweep(TaskFactory factory, ScalingAttr scaling_attr)
+    : factory_(std::move(factory)), scaling_attr_(std::move(scaling_attr)) {
+  if (scaling_attr_.thread_counts.empty()) {
+    scaling_attr_.thread_counts = DefaultThreadLadder();
+  }
+  if (std::ranges::any_of(scaling_attr_.thread_counts, [](int num_threads) { return num_threads <= 0; })) {
+    throw std::invalid_argument("Thread counts of a scaling sweep must be positive");
+  }
+}
+
+std::vector<ppc::core::ScalingPoint> ppc::core::ScalingSweep::Run(const std::shared_ptr<PerfAttr> &perf_attr) const {
+  const int saved_num_threads = ppc::util::GetPPCNumThreads();
+  const int base_threads = scaling_attr_.thread_counts.front();
+
+  std::vector<ScalingPoint> points;
+  points.reserve(scaling_attr_.thread_counts.size());
+  for (int num_threads : scaling_attr_.thread_counts) {
+    ppc::util::SetPPCNumThreads(num_threads);
+
+    ScalingPoint point;
+    point.num_threads = num_threads;
+    if (scaling_attr_.kind == ScalingAttr::kWeak) {
+      // Thread counts that are no multiple of the baseline round to the nearest whole input
+      const double scale = static_cast<double>(num_threads) / static_cast<double>(base_threads);
+      point.input_scale = std::max(1, static_cast<int>(std::lround(scale)));
+    }
+
+    auto perf_results = std::make_shared<PerfResults>();
+    Perf perf_analyzer(factory_(point.input_scale));
+    if (scaling_attr_.type_of_running == PerfResults::kPipeline) {
+      perf_analyzer.PipelineRun(perf_attr, perf_results);
+    } else {
+      perf_analyzer.TaskRun(perf_attr, perf_results);
+    }
+    point.perf_results = *perf_results;
+    point.time_sec = perf_results->samples_sec.empty()
+                         ? perf_results->time_sec / static_cast<double>(std::max<uint64_t>(1, perf_attr->num_running))
+                         : perf_results->statistics.median;
+    points.push_back(std::move(point));
+  }
+  ppc::util::SetPPCNumThreads(saved_num_threads);
+
+  const double base_time = points.front().time_sec;
+  for (auto &point : points) {
+    if (point.time_sec <= 0.0) {
+      continue;
+    }
+    // Relative thread count keeps the metrics meaningful when the ladder does not start at 1
+    const double p = static_cast<double>(point.num_threads) / static_cast<double>(base_threads);
+    const double ratio = base_time / point.time_sec;
+    point.speedup = scaling_attr_.kind == ScalingAttr::kWeak ? static_cast<double>(point.input_scale) * ratio : ratio;
+    point.efficiency = point.speedup / p;
+    point.serial_fraction = p > 1.0 ? ((1.0 / point.speedup) - (1.0 / p)) / (1.0 - (1.0 / p)) : 0.0;
+  }
+  return points;
+}
+
+void ppc::core::ScalingSweep::PrintScaling(const std::vector<ScalingPoint> &points, ScalingAttr::Kind kind) {
+  const std::string test_file(::testing::UnitTest::GetInstance()->current_test_info()->file());
+  const std::string kind_name = kind == ScalingAttr::kWeak ? "weak_scaling" : "strong_scaling";
+  auto sink = PerfResultSink::FromEnvironment();
+
+  for (const auto &point : points) {
+    auto record = MakePerfRecord(point.perf_results, test_file);
+    std::stringstream point_str;
+    point_str << std::fixed << std::setprecision(10);
+    point_str << "threads=" << point.num_threads << " input_scale=" << point.input_scale
+              << " time=" << point.time_sec << " speedup=" << point.speedup << " efficiency=" << point.efficiency
+              << " serial_fraction=" << point.serial_fraction;
+    std::cout << record.task_path << ":" << kind_name << ":" << point_str.str() << '\n';
+    if (sink) {
+      sink->Append(record);
+    }
+  }
+}
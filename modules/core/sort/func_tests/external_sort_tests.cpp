@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iterator>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "core/sort/include/external_sort.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/file_io.hpp"
+
+namespace {
+
+template <class T>
+void WriteValues(const std::filesystem::path &path, const std::vector<T> &values) {
+  ppc::util::FileWriter writer(path);
+  writer.Write(std::as_bytes(std::span(values)));
+  writer.Close();
+}
+
+template <class T>
+std::vector<T> ReadValues(const std::filesystem::path &path) {
+  const ppc::util::MappedFile mapped(path);
+  const auto *begin = reinterpret_cast<const T *>(mapped.Bytes().data());
+  return {begin, begin + (mapped.Size() / sizeof(T))};
+}
+
+std::vector<int32_t> RandomValues(size_t n, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::vector<int32_t> values(n);
+  for (auto &value : values) {
+    value = static_cast<int32_t>(gen());
+  }
+  return values;
+}
+
+}  // namespace
+
+TEST(external_sort_tests, merges_many_runs_over_several_passes) {
+  ppc::util::ScratchDirectory directory;
+  const auto input = directory.NewFile();
+  const auto output = directory.NewFile();
+  auto values = RandomValues(1000000, 1);
+  WriteValues(input, values);
+
+  // 512 KiB: runs of 65536 values, 8 blocks of the minimum size give a fan-in of 3
+  const ppc::core::ExternalSortOptions options{.memory_budget = size_t{512} << 10, .temp_dir = directory.Path()};
+  const auto stats = ppc::core::ExternalSort<int32_t>(input, output, options, ppc::core::PoolForEach{.grain = 1});
+  std::ranges::sort(values);
+  EXPECT_EQ(ReadValues<int32_t>(output), values);
+  EXPECT_EQ(stats.elements, values.size());
+  EXPECT_EQ(stats.runs, 16U);
+  EXPECT_EQ(stats.fan_in, 3U);
+  // 16 runs -> 6 -> 2 -> 1
+  EXPECT_EQ(stats.merge_passes, 3U);
+  // The runs, two passes that leave the last run alone and the output
+  EXPECT_GT(stats.bytes_written, 3 * values.size() * sizeof(int32_t));
+  EXPECT_EQ(stats.bytes_written - stats.bytes_read, values.size() * sizeof(int32_t));
+  // Only the input and the output are left next to the scratch files
+  EXPECT_EQ(std::distance(std::filesystem::directory_iterator(directory.Path()), {}), 2);
+}
+
+TEST(external_sort_tests, max_fan_in_limits_the_merge) {
+  ppc::util::ScratchDirectory directory;
+  const auto input = directory.NewFile();
+  const auto output = directory.NewFile();
+  auto values = RandomValues(300000, 2);
+  WriteValues(input, values);
+
+  const ppc::core::ExternalSortOptions options{
+      .memory_budget = size_t{256} << 10, .temp_dir = directory.Path(), .max_fan_in = 2};
+  const auto stats = ppc::core::ExternalSort<int32_t>(input, output, options);
+  std::ranges::sort(values);
+  EXPECT_EQ(ReadValues<int32_t>(output), values);
+  // 10 runs merged pairwise: 10 -> 5 -> 3 -> 2 -> 1
+  EXPECT_EQ(stats.runs, 10U);
+  EXPECT_EQ(stats.merge_passes, 4U);
+}
+
+TEST(external_sort_tests, input_within_budget_is_one_run) {
+  ppc::util::ScratchDirectory directory;
+  const auto input = directory.NewFile();
+  const auto output = directory.NewFile();
+  std::mt19937 gen(3);
+  std::uniform_real_distribution<double> distribution(-1e6, 1e6);
+  std::vector<double> values(50000);
+  for (auto &value : values) {
+    value = distribution(gen);
+  }
+  WriteValues(input, values);
+
+  const auto stats = ppc::core::ExternalSort<double>(input, output, {.temp_dir = directory.Path()});
+  std::ranges::sort(values);
+  EXPECT_EQ(ReadValues<double>(output), values);
+  EXPECT_EQ(stats.runs, 1U);
+  EXPECT_EQ(stats.merge_passes, 0U);
+}
+
+TEST(external_sort_tests, empty_input_gives_empty_output) {
+  ppc::util::ScratchDirectory directory;
+  const auto input = directory.NewFile();
+  const auto output = directory.NewFile();
+  WriteValues(input, std::vector<int64_t>());
+  const auto stats = ppc::core::ExternalSort<int64_t>(input, output, {.temp_dir = directory.Path()});
+  EXPECT_EQ(stats.runs, 0U);
+  ASSERT_TRUE(std::filesystem::exists(output));
+  EXPECT_EQ(std::filesystem::file_size(output), 0U);
+}
+
+TEST(external_sort_tests, rejects_bad_arguments) {
+  ppc::util::ScratchDirectory directory;
+  const auto input = directory.NewFile();
+  const auto output = directory.NewFile();
+  WriteValues(input, std::vector<char>(7));
+  EXPECT_THROW(ppc::core::ExternalSort<int32_t>(input, output, {.temp_dir = directory.Path()}), std::invalid_argument);
+  EXPECT_THROW(ppc::core::ExternalSort<int32_t>(input, output, {.memory_budget = 1024, .temp_dir = directory.Path()}),
+               std::invalid_argument);
+  EXPECT_THROW(ppc::core::ExternalSort<int32_t>(input, input, {.temp_dir = directory.Path()}), std::invalid_argument);
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "core/sort/include/key_transform.hpp"
+#include "core/sort/include/radix_sort.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace {
+
+// Random bit patterns: every sign, exponent and NaN payload shows up
+template <class T>
+std::vector<T> RandomBits(size_t n, uint32_t seed) {
+  std::mt19937_64 gen(seed);
+  std::vector<T> values(n);
+  for (auto &value : values) {
+    value = std::bit_cast<T>(static_cast<ppc::core::RadixKey<T>>(gen()));
+  }
+  return values;
+}
+
+template <class T>
+void CheckRoundTrip(size_t n) {
+  const auto values = RandomBits<T>(n, 1);
+  const auto keys = ppc::core::ToRadixKeys(std::span<const T>(values));
+  std::vector<T> back(n);
+  ppc::core::FromRadixKeys(std::span<const ppc::core::RadixKey<T>>(keys), std::span<T>(back));
+  for (size_t i = 0; i < n; i++) {
+    ASSERT_EQ(std::bit_cast<ppc::core::RadixKey<T>>(back[i]), std::bit_cast<ppc::core::RadixKey<T>>(values[i]));
+  }
+}
+
+template <class T>
+void CheckTotalOrder() {
+  constexpr T kInf = std::numeric_limits<T>::infinity();
+  const T nan = std::numeric_limits<T>::quiet_NaN();
+  constexpr T kMin = std::numeric_limits<T>::denorm_min();
+  // Ascending, NaNs with the sign bit first and without it last
+  const std::vector<T> ordered{-nan, -kInf, std::numeric_limits<T>::lowest(), T(-1.5), -kMin, T(-0.0),
+                               T(0.0), kMin, T(1.5), std::numeric_limits<T>::max(), kInf, nan};
+  const auto keys = ppc::core::ToRadixKeys(std::span<const T>(ordered));
+  EXPECT_TRUE(std::ranges::is_sorted(keys));
+  EXPECT_EQ(std::ranges::adjacent_find(keys), keys.end());
+}
+
+}  // namespace
+
+TEST(key_transform_tests, round_trips_every_bit_pattern) {
+  CheckRoundTrip<float>(100000);
+  CheckRoundTrip<double>(100000);
+  CheckRoundTrip<int32_t>(1000);
+  CheckRoundTrip<int64_t>(1000);
+  CheckRoundTrip<uint32_t>(1000);
+  CheckRoundTrip<uint64_t>(1000);
+}
+
+TEST(key_transform_tests, keys_order_special_values) {
+  CheckTotalOrder<float>();
+  CheckTotalOrder<double>();
+}
+
+TEST(key_transform_tests, sorted_keys_sort_the_values) {
+  std::mt19937_64 gen(2);
+  std::uniform_real_distribution<double> dist(-1e6, 1e6);
+  std::vector<double> values(50000);
+  for (auto &value : values) {
+    value = dist(gen);
+  }
+  auto keys = ppc::core::ToRadixKeys(std::span<const double>(values));
+  ppc::core::RadixSort(std::span<uint64_t>(keys));
+  std::vector<double> sorted(values.size());
+  ppc::core::FromRadixKeys(std::span<const uint64_t>(keys), std::span<double>(sorted));
+  std::ranges::sort(values);
+  EXPECT_EQ(sorted, values);
+}
+
+TEST(key_transform_tests, parallel_backend_matches_sequential) {
+  const auto values = RandomBits<double>((ppc::core::kKeyTransformChunk * 5) + 17, 3);
+  const auto expected = ppc::core::ToRadixKeys(std::span<const double>(values));
+  EXPECT_EQ(ppc::core::ToRadixKeys(std::span<const double>(values), ppc::core::PoolForEach{}), expected);
+
+  std::vector<double> back(values.size());
+  ppc::core::FromRadixKeys(std::span<const uint64_t>(expected), std::span<double>(back), ppc::core::PoolForEach{});
+  EXPECT_TRUE(std::ranges::equal(back, values, [](double a, double b) {
+    return std::bit_cast<uint64_t>(a) == std::bit_cast<uint64_t>(b);
+  }));
+}
+
+TEST(key_transform_tests, rejects_size_mismatch) {
+  const std::vector<float> values(10);
+  std::vector<uint32_t> keys(9);
+  EXPECT_THROW(ppc::core::ToRadixKeys(std::span<const float>(values), std::span<uint32_t>(keys)),
+               std::invalid_argument);
+  std::vector<float> back(11);
+  EXPECT_THROW(ppc::core::FromRadixKeys(std::span<const uint32_t>(keys), std::span<float>(back)),
+               std::invalid_argument);
+}
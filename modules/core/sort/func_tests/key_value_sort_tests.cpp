@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "core/sort/include/key_value_sort.hpp"
+#include "core/sort/include/parallel_quicksort.hpp"
+#include "core/sort/include/sorting_network.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace {
+
+// Keys with many duplicates, so that stability is observable
+template <class K>
+std::vector<K> RandomKeys(size_t n, uint32_t seed) {
+  std::mt19937_64 gen(seed);
+  std::vector<K> keys(n);
+  for (auto &key : keys) {
+    if constexpr (std::is_floating_point_v<K>) {
+      key = static_cast<K>(static_cast<int>(gen() % 2001) - 1000) / K(8);
+    } else if constexpr (std::is_signed_v<K>) {
+      key = static_cast<K>(static_cast<int64_t>(gen() % 2001) - 1000);
+    } else {
+      key = static_cast<K>(gen() % 2001);
+    }
+  }
+  return keys;
+}
+
+// The permutation a stable sort of keys produces
+template <class K>
+std::vector<size_t> StableOrder(const std::vector<K> &keys) {
+  std::vector<size_t> order(keys.size());
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::ranges::stable_sort(order, [&](size_t a, size_t b) { return keys[a] < keys[b]; });
+  return order;
+}
+
+struct WidePayload {
+  uint64_t id;
+  uint64_t check;
+  uint64_t padding[6];
+};
+
+}  // namespace
+
+template <class K>
+class KeyValueSortTypedTest : public ::testing::Test {};
+
+using KeyValueSortTypes = ::testing::Types<int32_t, uint32_t, int64_t, uint64_t, float, double>;
+TYPED_TEST_SUITE(KeyValueSortTypedTest, KeyValueSortTypes);
+
+TYPED_TEST(KeyValueSortTypedTest, pairs_sort_is_stable) {
+  using K = TypeParam;
+  for (size_t n : {0, 1, 2, 50, 65, 3000, 300000}) {
+    auto keys = RandomKeys<K>(n, static_cast<uint32_t>(n));
+    const auto order = StableOrder(keys);
+    std::vector<uint32_t> values(n);
+    std::iota(values.begin(), values.end(), 0U);
+    ppc::core::RadixSortPairs(std::span<K>(keys), std::span<uint32_t>(values), ppc::core::PoolForEach{.grain = 16});
+    for (size_t i = 0; i < n; i++) {
+      ASSERT_EQ(values[i], order[i]) << "n=" << n << " i=" << i;
+    }
+    EXPECT_TRUE(std::ranges::is_sorted(keys));
+  }
+}
+
+TYPED_TEST(KeyValueSortTypedTest, argsort_matches_stable_sort) {
+  using K = TypeParam;
+  for (size_t n : {0, 7, 1000, 400000}) {
+    const auto keys = RandomKeys<K>(n, static_cast<uint32_t>(n) + 1);
+    const auto order = StableOrder(keys);
+    std::vector<uint32_t> indices32(n);
+    std::vector<uint64_t> indices64(n);
+    ppc::core::RadixArgSort(std::span<const K>(keys), std::span<uint32_t>(indices32));
+    ppc::core::RadixArgSort(std::span<const K>(keys), std::span<uint64_t>(indices64),
+                            ppc::core::PoolForEach{.grain = 16});
+    for (size_t i = 0; i < n; i++) {
+      ASSERT_EQ(indices32[i], order[i]) << "n=" << n << " i=" << i;
+      ASSERT_EQ(indices64[i], order[i]) << "n=" << n << " i=" << i;
+    }
+  }
+}
+
+TEST(key_value_sort_tests, wide_payload_is_gathered_once) {
+  constexpr size_t kN = 500000;
+  auto keys = RandomKeys<int32_t>(kN, 3);
+  const auto order = StableOrder(keys);
+  std::vector<WidePayload> values(kN);
+  for (size_t i = 0; i < kN; i++) {
+    values[i] = {.id = i, .check = static_cast<uint64_t>(keys[i]) * 31, .padding = {}};
+  }
+  ppc::core::RadixSortByKey(std::span<int32_t>(keys), std::span<WidePayload>(values),
+                            ppc::core::PoolForEach{.grain = 16});
+  EXPECT_TRUE(std::ranges::is_sorted(keys));
+  for (size_t i = 0; i < kN; i++) {
+    ASSERT_EQ(values[i].id, order[i]);
+    ASSERT_EQ(values[i].check, static_cast<uint64_t>(keys[i]) * 31);
+  }
+}
+
+TEST(key_value_sort_tests, narrow_payload_moves_with_keys) {
+  auto keys = RandomKeys<double>(100000, 4);
+  std::vector<double> values(keys.begin(), keys.end());
+  ppc::core::RadixSortByKey(std::span<double>(keys), std::span<double>(values));
+  EXPECT_EQ(keys, values);
+  EXPECT_TRUE(std::ranges::is_sorted(keys));
+}
+
+TEST(key_value_sort_tests, index_path_matches_moved_path) {
+  const auto keys = RandomKeys<int64_t>(300000, 6);
+  auto moved_keys = keys;
+  auto indexed_keys = keys;
+  std::vector<uint64_t> moved(keys.size());
+  std::iota(moved.begin(), moved.end(), uint64_t{0});
+  auto indexed = moved;
+  ppc::core::RadixSortPairs(std::span<int64_t>(moved_keys), std::span<uint64_t>(moved),
+                            ppc::core::PoolForEach{.grain = 16});
+  ppc::core::RadixSortByIndex(std::span<int64_t>(indexed_keys), std::span<uint64_t>(indexed),
+                              ppc::core::PoolForEach{.grain = 16});
+  EXPECT_EQ(moved_keys, indexed_keys);
+  EXPECT_EQ(moved, indexed);
+}
+
+TEST(key_value_sort_tests, packed_argsort_through_comparison_sorters) {
+  const auto keys = RandomKeys<int32_t>(200000, 5);
+  const auto order = StableOrder(keys);
+  std::vector<size_t> expected(order.begin(), order.end());
+
+  // Hoare family: the parallel quicksort is unstable, unique words make the result stable anyway
+  std::vector<uint32_t> by_quicksort(keys.size());
+  ppc::core::PackedArgSort(std::span<const int32_t>(keys), std::span<uint32_t>(by_quicksort),
+                           [](std::span<uint64_t> words) { ppc::core::ParallelQuickSort(words); });
+  // Batcher family: the bitonic network sorts signed words
+  std::vector<uint32_t> by_network(keys.size());
+  ppc::core::PackedArgSort<int64_t>(std::span<const int32_t>(keys), std::span<uint32_t>(by_network),
+                                    [](std::span<int64_t> words) { ppc::core::NetworkSort(words); });
+  for (size_t i = 0; i < keys.size(); i++) {
+    ASSERT_EQ(by_quicksort[i], expected[i]) << i;
+    ASSERT_EQ(by_network[i], expected[i]) << i;
+  }
+}
+
+TEST(key_value_sort_tests, packed_words_keep_key_order) {
+  const std::vector<float> keys = {-std::numeric_limits<float>::infinity(), -2.5F, -0.0F, 0.0F, 1.0F, 3.5F};
+  for (size_t i = 1; i < keys.size(); i++) {
+    EXPECT_LT(ppc::core::PackKeyIndex(keys[i - 1], 7), ppc::core::PackKeyIndex(keys[i], 0));
+    EXPECT_LT(ppc::core::PackKeyIndex<int64_t>(keys[i - 1], 7), ppc::core::PackKeyIndex<int64_t>(keys[i], 0));
+  }
+  EXPECT_LT(ppc::core::PackKeyIndex(5, 1), ppc::core::PackKeyIndex(5, 2));
+}
+
+TEST(key_value_sort_tests, apply_permutation_gathers) {
+  const std::vector<uint32_t> order = {2, 0, 1};
+  const std::vector<char> in = {'a', 'b', 'c'};
+  std::vector<char> out(3);
+  ppc::core::ApplyPermutation(std::span<const uint32_t>(order), std::span<const char>(in), std::span<char>(out));
+  EXPECT_EQ(out, (std::vector<char>{'c', 'a', 'b'}));
+}
+
+TEST(key_value_sort_tests, rejects_mismatched_sizes) {
+  std::vector<int32_t> keys(4);
+  std::vector<uint32_t> short_values(3);
+  EXPECT_THROW(ppc::core::RadixSortPairs(std::span<int32_t>(keys), std::span<uint32_t>(short_values)),
+               std::invalid_argument);
+  EXPECT_THROW(ppc::core::RadixArgSort(std::span<const int32_t>(keys), std::span<uint32_t>(short_values)),
+               std::invalid_argument);
+  std::vector<WidePayload> wide(5);
+  EXPECT_THROW(ppc::core::RadixSortByKey(std::span<int32_t>(keys), std::span<WidePayload>(wide)),
+               std::invalid_argument);
+}
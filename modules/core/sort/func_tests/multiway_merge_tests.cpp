@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "core/sort/include/multiway_merge.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace {
+
+// Sorted runs of random length over a small value range, so that there are many ties
+std::vector<std::vector<int>> RandomRuns(size_t k, size_t max_len, int max_value, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::vector<std::vector<int>> runs(k);
+  for (auto &run : runs) {
+    run.resize(gen() % (max_len + 1));
+    for (auto &value : run) {
+      value = static_cast<int>(gen() % static_cast<unsigned>(max_value));
+    }
+    std::ranges::sort(run);
+  }
+  return runs;
+}
+
+template <class T>
+std::vector<std::span<const T>> Spans(const std::vector<std::vector<T>> &runs) {
+  return {runs.begin(), runs.end()};
+}
+
+template <class T>
+std::vector<T> Concatenated(const std::vector<std::vector<T>> &runs) {
+  std::vector<T> all;
+  for (const auto &run : runs) {
+    all.insert(all.end(), run.begin(), run.end());
+  }
+  return all;
+}
+
+}  // namespace
+
+TEST(multiway_merge_tests, loser_tree_merges_runs) {
+  for (size_t k : {1, 2, 3, 5, 8, 13, 64}) {
+    const auto runs = RandomRuns(k, 200, 50, static_cast<unsigned>(k));
+    auto expected = Concatenated(runs);
+    std::ranges::sort(expected);
+
+    std::vector<int> out(expected.size());
+    const auto spans = Spans(runs);
+    int *end = ppc::core::LoserTree<int>(spans).MergeTo(out.data());
+    EXPECT_EQ(end, out.data() + out.size());
+    EXPECT_EQ(out, expected) << "k=" << k;
+  }
+}
+
+TEST(multiway_merge_tests, loser_tree_handles_empty_input) {
+  const std::vector<std::span<const int>> none;
+  EXPECT_TRUE(ppc::core::LoserTree<int>(none).Empty());
+  const std::vector<std::vector<int>> empty_runs(3);
+  EXPECT_TRUE(ppc::core::LoserTree<int>(Spans(empty_runs)).Empty());
+}
+
+TEST(multiway_merge_tests, merge_is_stable) {
+  // Values are (key, run) pairs ordered by key only: equal keys must keep run order
+  std::vector<std::vector<std::pair<int, int>>> runs(6);
+  std::mt19937 gen(7);
+  for (int r = 0; r < 6; r++) {
+    for (int i = 0; i < 300; i++) {
+      runs[r].emplace_back(static_cast<int>(gen() % 20), r);
+    }
+    std::ranges::stable_sort(runs[r], {}, &std::pair<int, int>::first);
+  }
+  auto expected = Concatenated(runs);
+  std::ranges::stable_sort(expected, {}, &std::pair<int, int>::first);
+
+  auto by_key = [](const std::pair<int, int> &a, const std::pair<int, int> &b) { return a.first < b.first; };
+  for (size_t parts : {1, 4, 7}) {
+    std::vector<std::pair<int, int>> out(expected.size());
+    ppc::core::MultiwayMerge<std::pair<int, int>>(Spans(runs), out, parts, by_key, ppc::core::PoolForEach{});
+    EXPECT_EQ(out, expected) << "parts=" << parts;
+  }
+}
+
+TEST(multiway_merge_tests, co_rank_splits_at_every_rank) {
+  const auto runs = RandomRuns(4, 40, 10, 11);
+  const auto spans = Spans(runs);
+  auto merged = Concatenated(runs);
+  std::ranges::sort(merged);
+  for (size_t rank = 0; rank <= merged.size(); rank++) {
+    const auto split = ppc::core::MultiwayCoRank<int>(spans, rank);
+    size_t sum = 0;
+    for (size_t i = 0; i < runs.size(); i++) {
+      sum += split[i];
+      // Everything taken is not greater than anything left
+      if (split[i] > 0 && rank < merged.size()) {
+        EXPECT_LE(runs[i][split[i] - 1], merged[rank]);
+      }
+      if (split[i] < runs[i].size() && rank > 0) {
+        EXPECT_GE(runs[i][split[i]], merged[rank - 1]);
+      }
+    }
+    EXPECT_EQ(sum, rank);
+  }
+}
+
+TEST(multiway_merge_tests, parallel_merge_matches_sort) {
+  for (size_t k : {2, 3, 16, 100}) {
+    const auto runs = RandomRuns(k, 5000, 1 << 20, static_cast<unsigned>(k) + 100);
+    auto expected = Concatenated(runs);
+    std::ranges::sort(expected, std::greater<>());
+
+    // Merging descending runs with a descending comparator
+    auto reversed = runs;
+    for (auto &run : reversed) {
+      std::ranges::reverse(run);
+    }
+    for (size_t parts : {1, 3, 8, 64}) {
+      std::vector<int> out(expected.size());
+      ppc::core::MultiwayMerge<int>(Spans(reversed), out, parts, std::greater<>(), ppc::core::PoolForEach{});
+      EXPECT_EQ(out, expected) << "k=" << k << " parts=" << parts;
+    }
+  }
+}
+
+TEST(multiway_merge_tests, merge_with_more_parts_than_elements) {
+  const std::vector<std::vector<int>> runs = {{1, 4}, {}, {2}, {0, 3}};
+  std::vector<int> out(5);
+  ppc::core::MultiwayMerge<int>(Spans(runs), out, 16);
+  EXPECT_EQ(out, (std::vector<int>{0, 1, 2, 3, 4}));
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/sort/include/parallel_quicksort.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace {
+
+// Inputs that break naive quicksorts: presorted, reversed, few distinct values, organ pipe
+std::vector<std::pair<std::string, std::vector<int>>> Inputs(size_t n) {
+  std::mt19937 gen(static_cast<unsigned>(n));
+  std::vector<std::pair<std::string, std::vector<int>>> inputs;
+  std::vector<int> values(n);
+  for (auto &value : values) {
+    value = static_cast<int>(gen());
+  }
+  inputs.emplace_back("random", values);
+  std::ranges::sort(values);
+  inputs.emplace_back("sorted", values);
+  std::ranges::reverse(values);
+  inputs.emplace_back("reverse", values);
+  for (auto &value : values) {
+    value = static_cast<int>(gen() % 4);
+  }
+  inputs.emplace_back("four_values", values);
+  std::ranges::fill(values, 7);
+  inputs.emplace_back("equal", values);
+  for (size_t i = 0; i < n; i++) {
+    values[i] = static_cast<int>(std::min(i, n - i));
+  }
+  inputs.emplace_back("organ_pipe", values);
+  for (size_t i = 0; i < n; i++) {
+    values[i] = static_cast<int>(i % 1000);
+  }
+  inputs.emplace_back("sawtooth", values);
+  return inputs;
+}
+
+}  // namespace
+
+TEST(parallel_quicksort_tests, sequential_sort_matches_std) {
+  for (size_t n : {0, 1, 2, 24, 25, 129, 1000, 20000}) {
+    for (auto &[name, values] : Inputs(n)) {
+      auto expected = values;
+      std::ranges::sort(expected);
+      ppc::core::ParallelQuickSort(std::span<int>(values));
+      EXPECT_EQ(values, expected) << name << " n=" << n;
+    }
+  }
+}
+
+TEST(parallel_quicksort_tests, parallel_sort_matches_std) {
+  for (size_t n : {size_t{100000}, size_t{600001}}) {
+    for (auto &[name, values] : Inputs(n)) {
+      auto expected = values;
+      std::ranges::sort(expected);
+      for (size_t blocks : {1, 3, 8}) {
+        auto sorted = values;
+        ppc::core::ParallelQuickSort(std::span<int>(sorted), blocks, std::less<>(), ppc::core::PoolInvoke{},
+                                     ppc::core::PoolForEach{});
+        EXPECT_EQ(sorted, expected) << name << " n=" << n << " blocks=" << blocks;
+      }
+    }
+  }
+}
+
+TEST(parallel_quicksort_tests, sort_with_comparator) {
+  std::vector<std::pair<int, double>> values(300000);
+  std::mt19937 gen(5);
+  for (auto &[key, payload] : values) {
+    key = static_cast<int>(gen() % 1000);
+    payload = static_cast<double>(gen());
+  }
+  auto by_key_desc = [](const auto &a, const auto &b) { return a.first > b.first; };
+  ppc::core::ParallelQuickSort(std::span<std::pair<int, double>>(values), 4, by_key_desc, ppc::core::PoolInvoke{},
+                               ppc::core::PoolForEach{});
+  EXPECT_TRUE(std::ranges::is_sorted(values, by_key_desc));
+}
+
+TEST(parallel_quicksort_tests, comparisons_stay_n_log_n) {
+  // Organ pipe and sawtooth defeat median-of-three; the depth limit has to keep the sort O(n log n)
+  constexpr size_t kN = 200000;
+  for (auto &[name, values] : Inputs(kN)) {
+    size_t comparisons = 0;
+    auto counting_less = [&](int a, int b) {
+      comparisons++;
+      return a < b;
+    };
+    ppc::core::ParallelQuickSort(std::span<int>(values), 1, counting_less);
+    EXPECT_TRUE(std::ranges::is_sorted(values)) << name;
+    EXPECT_LT(comparisons, 4 * kN * std::bit_width(kN)) << name;
+  }
+}
+
+TEST(parallel_quicksort_tests, parallel_partition_splits_at_predicate) {
+  for (size_t n : {0, 5, 64, 1000, 77777}) {
+    for (size_t blocks : {1, 2, 5, 16}) {
+      std::vector<int> values(n);
+      std::iota(values.begin(), values.end(), 0);
+      std::ranges::shuffle(values, std::mt19937(static_cast<unsigned>(n + blocks)));
+      const int threshold = static_cast<int>(n / 3);
+      auto below = [&](int value) { return value < threshold; };
+
+      const size_t split =
+          ppc::core::ParallelPartition(std::span<int>(values), below, blocks, ppc::core::PoolForEach{});
+      EXPECT_EQ(split, static_cast<size_t>(threshold)) << "n=" << n << " blocks=" << blocks;
+      EXPECT_TRUE(std::all_of(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(split), below));
+      EXPECT_TRUE(std::none_of(values.begin() + static_cast<std::ptrdiff_t>(split), values.end(), below));
+      std::ranges::sort(values);
+      for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(values[i], static_cast<int>(i));
+      }
+    }
+  }
+}
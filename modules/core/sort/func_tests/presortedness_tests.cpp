@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "core/sort/include/presortedness.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace {
+
+std::vector<int> RandomValues(size_t n, int range, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::vector<int> values(n);
+  for (auto &value : values) {
+    value = static_cast<int>(gen() % static_cast<unsigned>(range));
+  }
+  return values;
+}
+
+// num_runs sorted runs of random lengths, one after another
+std::vector<int> NaturalRuns(size_t n, size_t num_runs, unsigned seed) {
+  auto values = RandomValues(n, 1 << 20, seed);
+  std::mt19937 gen(seed + 1);
+  std::vector<size_t> cuts = {0, n};
+  for (size_t i = 1; i < num_runs; i++) {
+    cuts.push_back(gen() % n);
+  }
+  std::ranges::sort(cuts);
+  for (size_t i = 0; i + 1 < cuts.size(); i++) {
+    std::sort(values.begin() + static_cast<std::ptrdiff_t>(cuts[i]),
+              values.begin() + static_cast<std::ptrdiff_t>(cuts[i + 1]));
+  }
+  return values;
+}
+
+// Key and position in the input, ordered by key only
+struct Record {
+  int key;
+  size_t position;
+};
+
+struct KeyLess {
+  bool operator()(const Record &a, const Record &b) const { return a.key < b.key; }
+};
+
+std::vector<Record> Records(const std::vector<int> &keys) {
+  std::vector<Record> records(keys.size());
+  for (size_t i = 0; i < keys.size(); i++) {
+    records[i] = {.key = keys[i], .position = i};
+  }
+  return records;
+}
+
+void ExpectStableSorted(std::vector<Record> records, const std::vector<Record> &sorted) {
+  std::ranges::stable_sort(records, KeyLess{});
+  ASSERT_EQ(records.size(), sorted.size());
+  for (size_t i = 0; i < records.size(); i++) {
+    ASSERT_EQ(records[i].key, sorted[i].key) << i;
+    ASSERT_EQ(records[i].position, sorted[i].position) << i;
+  }
+}
+
+// Full sort of the tests where the fast paths must do everything
+struct FailingSort {
+  template <class T>
+  void operator()(std::span<T> /*data*/) const {
+    ADD_FAILURE() << "full sort called";
+  }
+};
+
+}  // namespace
+
+TEST(presortedness_tests, counts_descents_and_ascents) {
+  const std::vector<int> data = {1, 3, 3, 2, 5, 4, 4, 6};
+  const auto stats = ppc::core::MeasurePresortedness(std::span<const int>(data));
+  EXPECT_EQ(stats.size, 8U);
+  EXPECT_EQ(stats.descents, 2U);
+  EXPECT_EQ(stats.ascents, 3U);
+  EXPECT_EQ(stats.runs, 3U);
+  EXPECT_EQ(ppc::core::NaturalRunBounds(std::span<const int>(data)), (std::vector<size_t>{0, 3, 5, 8}));
+
+  EXPECT_EQ(ppc::core::MeasurePresortedness(std::span<const int>()).path, ppc::core::PresortPath::kSorted);
+  EXPECT_EQ(ppc::core::NaturalRunBounds(std::span<const int>()), (std::vector<size_t>{0, 0}));
+}
+
+TEST(presortedness_tests, parallel_scan_matches_sequential) {
+  // Chunk borders fall inside the data, and descents sit right on them
+  auto data = RandomValues(5 * ppc::core::kPresortChunk + 17, 1000, 3);
+  std::sort(data.begin(), data.end());
+  for (size_t i = ppc::core::kPresortChunk; i < data.size(); i += ppc::core::kPresortChunk) {
+    data[i] = -1;
+  }
+  const auto sequential = ppc::core::MeasurePresortedness(std::span<const int>(data));
+  const auto parallel = ppc::core::MeasurePresortedness(std::span<const int>(data), std::less<>(),
+                                                        ppc::core::PoolForEach{});
+  EXPECT_EQ(parallel.descents, sequential.descents);
+  EXPECT_EQ(parallel.ascents, sequential.ascents);
+  EXPECT_EQ(parallel.descents, 5U);
+  EXPECT_EQ(ppc::core::NaturalRunBounds(std::span<const int>(data), std::less<>(), ppc::core::PoolForEach{}),
+            ppc::core::NaturalRunBounds(std::span<const int>(data)));
+}
+
+TEST(presortedness_tests, sorted_input_is_left_alone) {
+  auto data = RandomValues(100000, 50, 5);
+  std::ranges::sort(data);
+  const auto expected = data;
+  const auto stats = ppc::core::AdaptiveSort(std::span<int>(data), FailingSort{}, 4, std::less<>(),
+                                             ppc::core::PoolForEach{});
+  EXPECT_EQ(stats.path, ppc::core::PresortPath::kSorted);
+  EXPECT_EQ(stats.runs, 1U);
+  EXPECT_EQ(data, expected);
+}
+
+TEST(presortedness_tests, reversed_input_keeps_equal_values_in_order) {
+  for (size_t n : {size_t{2}, size_t{1000}, (3 * ppc::core::kPresortChunk) + 5}) {
+    // Few distinct keys: blocks of equal keys cross the chunk borders
+    auto keys = RandomValues(n, 7, static_cast<unsigned>(n));
+    std::ranges::sort(keys, std::greater<>());
+    const auto records = Records(keys);
+    auto data = records;
+    const auto stats = ppc::core::AdaptiveSort(std::span<Record>(data), FailingSort{}, 4, KeyLess{},
+                                               ppc::core::PoolForEach{});
+    EXPECT_EQ(stats.path, ppc::core::PresortPath::kReversed) << n;
+    ExpectStableSorted(records, data);
+  }
+}
+
+TEST(presortedness_tests, few_runs_are_merged) {
+  for (size_t num_runs : {2, 3, 16, 17, 300, 3000}) {
+    const auto keys = NaturalRuns(400000, num_runs, static_cast<unsigned>(num_runs));
+    const auto records = Records(keys);
+    auto data = records;
+    const auto stats = ppc::core::AdaptiveSort(std::span<Record>(data), FailingSort{}, 4, KeyLess{},
+                                               ppc::core::PoolForEach{});
+    EXPECT_EQ(stats.path, ppc::core::PresortPath::kRunMerge) << num_runs;
+    EXPECT_LE(stats.runs, num_runs);
+    ExpectStableSorted(records, data);
+  }
+}
+
+TEST(presortedness_tests, random_input_goes_to_full_sort) {
+  auto data = RandomValues(10000, 1 << 20, 9);
+  auto expected = data;
+  std::ranges::sort(expected);
+  bool full_sort_called = false;
+  const auto stats = ppc::core::AdaptiveSort(std::span<int>(data), [&](std::span<int> values) {
+    full_sort_called = true;
+    std::ranges::sort(values);
+  });
+  EXPECT_EQ(stats.path, ppc::core::PresortPath::kFullSort);
+  EXPECT_TRUE(full_sort_called);
+  EXPECT_EQ(data, expected);
+  EXPECT_STREQ(ppc::core::PresortPathName(stats.path), "full sort");
+}
+
+TEST(presortedness_tests, merge_rounds_in_sequence) {
+  // More runs than one round merges, no parallel backend
+  auto data = NaturalRuns(50000, 1000, 21);
+  auto expected = data;
+  std::ranges::sort(expected);
+  ppc::core::MergeNaturalRuns(std::span<int>(data), ppc::core::NaturalRunBounds(std::span<const int>(data)));
+  EXPECT_EQ(data, expected);
+}
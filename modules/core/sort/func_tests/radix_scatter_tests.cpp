@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "core/sort/include/prefix_scan.hpp"
+#include "core/sort/include/radix_scatter.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace {
+
+std::vector<uint32_t> RandomKeys(size_t n, uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::vector<uint32_t> keys(n);
+  for (auto &key : keys) {
+    key = gen();
+  }
+  return keys;
+}
+
+// Reference: stable sort by bucket is exactly what the scatter has to produce
+template <class T, class BucketFn>
+std::vector<T> StableByBucket(std::vector<T> values, const BucketFn &bucket) {
+  std::ranges::stable_sort(values, [&](T a, T b) { return bucket(a) < bucket(b); });
+  return values;
+}
+
+}  // namespace
+
+TEST(radix_scatter_tests, exclusive_scan_matches_std) {
+  for (size_t n : {0, 1, 7, 256, 1000, 4099}) {
+    for (size_t blocks : {1, 3, 8, 64}) {
+      std::vector<size_t> values(n);
+      std::iota(values.begin(), values.end(), size_t{1});
+      std::vector<size_t> expected(n);
+      std::exclusive_scan(values.begin(), values.end(), expected.begin(), size_t{0});
+
+      const size_t total = ppc::core::ExclusiveScan(std::span<size_t>(values), blocks, ppc::core::PoolForEach{});
+      EXPECT_EQ(values, expected) << "n=" << n << " blocks=" << blocks;
+      EXPECT_EQ(total, n * (n + 1) / 2);
+    }
+  }
+}
+
+TEST(radix_scatter_tests, scatter_is_stable_for_any_chunking) {
+  const auto keys = RandomKeys(100003, 1);
+  auto bucket = [](uint32_t key) { return static_cast<size_t>(key >> 24); };
+  const auto expected = StableByBucket(keys, bucket);
+  for (size_t chunks : {1, 2, 3, 7, 16}) {
+    std::vector<uint32_t> out(keys.size());
+    ppc::core::ParallelRadixScatter<uint32_t>(keys, out, 256, bucket, chunks, ppc::core::PoolForEach{});
+    EXPECT_EQ(out, expected) << "chunks=" << chunks;
+  }
+}
+
+TEST(radix_scatter_tests, scatter_handles_unaligned_destination_and_tiny_buckets) {
+  // Few values per bucket and chunk: most of them end in partial head and tail lines
+  const auto keys = RandomKeys(3001, 2);
+  auto bucket = [](uint32_t key) { return static_cast<size_t>(key % 1000); };
+  const auto expected = StableByBucket(keys, bucket);
+  for (size_t shift = 0; shift < 16; shift++) {
+    std::vector<uint32_t> buffer(keys.size() + 16, 0xDEADBEEF);
+    std::span<uint32_t> out(buffer.data() + shift, keys.size());
+    ppc::core::ParallelRadixScatter<uint32_t>(keys, out, 1000, bucket, 5);
+    EXPECT_TRUE(std::ranges::equal(out, expected)) << "shift=" << shift;
+    EXPECT_TRUE(std::all_of(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(shift),
+                            [](uint32_t v) { return v == 0xDEADBEEF; }));
+    EXPECT_TRUE(std::all_of(buffer.begin() + static_cast<std::ptrdiff_t>(shift + keys.size()), buffer.end(),
+                            [](uint32_t v) { return v == 0xDEADBEEF; }));
+  }
+}
+
+TEST(radix_scatter_tests, scatter_with_streaming_stores) {
+  // Above kRadixStreamingThresholdBytes, full lines go through non-temporal stores
+  std::vector<uint64_t> keys(ppc::core::kRadixStreamingThresholdBytes / sizeof(uint64_t) + 77);
+  std::mt19937_64 gen(3);
+  for (auto &key : keys) {
+    key = gen();
+  }
+  auto bucket = [](uint64_t key) { return static_cast<size_t>(key & 0xFF); };
+  const auto expected = StableByBucket(keys, bucket);
+  std::vector<uint64_t> out(keys.size());
+  ppc::core::ParallelRadixScatter<uint64_t>(keys, out, 256, bucket, 4, ppc::core::PoolForEach{});
+  EXPECT_EQ(out, expected);
+}
+
+TEST(radix_scatter_tests, scatter_of_empty_input) {
+  std::vector<int> empty;
+  std::vector<int> out;
+  ppc::core::ParallelRadixScatter<int>(empty, out, 256, [](int) { return size_t{0}; }, 4);
+  EXPECT_TRUE(out.empty());
+}
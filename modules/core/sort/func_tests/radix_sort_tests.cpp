@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "core/sort/include/radix_sort.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace {
+
+template <class T>
+std::vector<T> RandomValues(size_t n, uint32_t seed) {
+  std::mt19937_64 gen(seed);
+  std::vector<T> values(n);
+  if constexpr (std::is_floating_point_v<T>) {
+    std::uniform_real_distribution<T> dist(-1e6, 1e6);
+    for (auto &value : values) {
+      value = dist(gen);
+    }
+  } else {
+    std::uniform_int_distribution<T> dist(std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+    for (auto &value : values) {
+      value = dist(gen);
+    }
+  }
+  return values;
+}
+
+template <class T>
+void CheckSortsLikeStdSort(std::vector<T> values) {
+  auto expected = values;
+  std::ranges::sort(expected);
+  ppc::core::RadixSort(std::span<T>(values));
+  EXPECT_EQ(values, expected);
+}
+
+}  // namespace
+
+template <class T>
+class RadixSortTypedTest : public ::testing::Test {};
+
+using RadixSortTypes = ::testing::Types<int32_t, uint32_t, int64_t, uint64_t, float, double>;
+TYPED_TEST_SUITE(RadixSortTypedTest, RadixSortTypes);
+
+TYPED_TEST(RadixSortTypedTest, sorts_small_inputs) {
+  for (size_t n : {0, 1, 2, 17, 64, 65, 1000}) {
+    CheckSortsLikeStdSort(RandomValues<TypeParam>(n, static_cast<uint32_t>(n)));
+  }
+}
+
+TYPED_TEST(RadixSortTypedTest, sorts_lsd_sized_input) { CheckSortsLikeStdSort(RandomValues<TypeParam>(20000, 1)); }
+
+TYPED_TEST(RadixSortTypedTest, sorts_msd_sized_input) { CheckSortsLikeStdSort(RandomValues<TypeParam>(600000, 2)); }
+
+TYPED_TEST(RadixSortTypedTest, sorts_sorted_and_reversed_input) {
+  auto values = RandomValues<TypeParam>(300000, 3);
+  std::ranges::sort(values);
+  CheckSortsLikeStdSort(values);
+  std::ranges::reverse(values);
+  CheckSortsLikeStdSort(values);
+}
+
+TEST(radix_sort_tests, sorts_extreme_integers) {
+  std::vector<int32_t> values = {0, -1, std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min(), 1,
+                                 std::numeric_limits<int32_t>::min() + 1};
+  CheckSortsLikeStdSort(values);
+  std::vector<int64_t> wide = {std::numeric_limits<int64_t>::min(), -5, 5, std::numeric_limits<int64_t>::max(), 0};
+  CheckSortsLikeStdSort(wide);
+}
+
+TEST(radix_sort_tests, orders_special_doubles) {
+  const double inf = std::numeric_limits<double>::infinity();
+  std::vector<double> values = {1.0, -0.0, inf, -inf, 0.0, -1.5, std::numeric_limits<double>::denorm_min(),
+                                -std::numeric_limits<double>::denorm_min()};
+  ppc::core::RadixSort(std::span<double>(values));
+  const std::vector<double> expected = {-inf, -1.5, -std::numeric_limits<double>::denorm_min(), -0.0, 0.0,
+                                        std::numeric_limits<double>::denorm_min(), 1.0, inf};
+  ASSERT_EQ(values.size(), expected.size());
+  for (size_t i = 0; i < values.size(); i++) {
+    EXPECT_EQ(values[i], expected[i]);
+    EXPECT_EQ(std::signbit(values[i]), std::signbit(expected[i])) << i;
+  }
+}
+
+TEST(radix_sort_tests, sorts_few_distinct_keys) {
+  std::vector<int32_t> values(500000);
+  std::mt19937 gen(4);
+  for (auto &value : values) {
+    value = static_cast<int32_t>(gen() % 3) * 1000000;
+  }
+  CheckSortsLikeStdSort(values);
+  CheckSortsLikeStdSort(std::vector<int32_t>(500000, 42));
+}
+
+TEST(radix_sort_tests, uses_caller_scratch) {
+  auto values = RandomValues<uint64_t>(400000, 5);
+  auto expected = values;
+  std::ranges::sort(expected);
+  std::vector<uint64_t> scratch(values.size());
+  ppc::core::RadixSort(std::span<uint64_t>(values), std::span<uint64_t>(scratch));
+  EXPECT_EQ(values, expected);
+}
+
+TEST(radix_sort_tests, parallel_backend_matches_sequential) {
+  auto values = RandomValues<double>(800000, 6);
+  auto expected = values;
+  std::ranges::sort(expected);
+  ppc::core::RadixSort(std::span<double>(values), ppc::core::PoolForEach{.grain = 16});
+  EXPECT_EQ(values, expected);
+}
+
+TEST(radix_sort_tests, backend_receives_msd_buckets) {
+  std::atomic<size_t> calls{0};
+  auto counting = [&calls](size_t count, const auto &body) {
+    calls++;
+    for (size_t i = 0; i < count; i++) {
+      body(i);
+    }
+  };
+  auto values = RandomValues<int32_t>(1000000, 7);
+  ppc::core::RadixSort(std::span<int32_t>(values), counting);
+  EXPECT_TRUE(std::ranges::is_sorted(values));
+  EXPECT_GE(calls.load(), 1U);
+}
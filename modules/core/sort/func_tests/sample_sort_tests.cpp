@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "core/sort/include/sample_sort.hpp"
+
+namespace {
+
+using SplitterSpan = std::span<const ppc::core::SampleSplitter<int>>;
+
+// Sorted pieces as the ranks of a sample sort would hold them
+std::vector<std::vector<int>> SortedPieces(size_t num_pieces, size_t piece_size, int range, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::vector<std::vector<int>> pieces(num_pieces, std::vector<int>(piece_size));
+  for (auto &piece : pieces) {
+    for (auto &value : piece) {
+      value = static_cast<int>(gen() % static_cast<unsigned>(range));
+    }
+    std::ranges::sort(piece);
+  }
+  return pieces;
+}
+
+// Bucket sizes summed over all pieces
+std::vector<size_t> BucketTotals(const std::vector<std::vector<int>> &pieces, size_t num_buckets) {
+  std::vector<int> samples;
+  for (const auto &piece : pieces) {
+    auto piece_samples =
+        ppc::core::RegularSamples(std::span<const int>(piece), ppc::core::SampleSortSamplesPerPiece(num_buckets));
+    samples.insert(samples.end(), piece_samples.begin(), piece_samples.end());
+  }
+  const auto splitters = ppc::core::SelectSplitters(samples, num_buckets);
+  std::vector<size_t> totals(num_buckets, 0);
+  for (const auto &piece : pieces) {
+    const auto bounds = ppc::core::BucketBounds(std::span<const int>(piece), SplitterSpan(splitters));
+    EXPECT_EQ(bounds.size(), num_buckets + 1);
+    for (size_t b = 0; b < num_buckets; b++) {
+      totals[b] += bounds[b + 1] - bounds[b];
+    }
+  }
+  return totals;
+}
+
+}  // namespace
+
+TEST(sample_sort_tests, regular_samples_are_evenly_spaced) {
+  std::vector<int> sorted(100);
+  for (size_t i = 0; i < sorted.size(); i++) {
+    sorted[i] = static_cast<int>(i);
+  }
+  EXPECT_EQ(ppc::core::RegularSamples(std::span<const int>(sorted), 4), (std::vector<int>{12, 37, 62, 87}));
+  EXPECT_EQ(ppc::core::RegularSamples(std::span<const int>(sorted).first(3), 8), (std::vector<int>{0, 1, 2}));
+  EXPECT_TRUE(ppc::core::RegularSamples(std::span<const int>(), 8).empty());
+}
+
+TEST(sample_sort_tests, buckets_partition_every_piece_in_order) {
+  for (size_t num_buckets : {1, 2, 3, 8}) {
+    const auto pieces = SortedPieces(num_buckets, 5000, 1 << 30, static_cast<unsigned>(num_buckets));
+    std::vector<int> samples = {5, 1, 9, 3, 7, 2};
+    const auto splitters = ppc::core::SelectSplitters(samples, num_buckets);
+    ASSERT_EQ(splitters.size(), num_buckets - 1);
+    for (const auto &piece : pieces) {
+      const auto bounds = ppc::core::BucketBounds(std::span<const int>(piece), SplitterSpan(splitters));
+      EXPECT_EQ(bounds.front(), 0U);
+      EXPECT_EQ(bounds.back(), piece.size());
+      EXPECT_TRUE(std::ranges::is_sorted(bounds));
+      // Bucket b holds no value above splitter b and bucket b + 1 none below it
+      for (size_t b = 0; b + 1 < num_buckets; b++) {
+        for (size_t i = bounds[b]; i < bounds[b + 1]; i++) {
+          EXPECT_LE(piece[i], splitters[b].value);
+        }
+        for (size_t i = bounds[b + 1]; i < bounds[b + 2]; i++) {
+          EXPECT_GE(piece[i], splitters[b].value);
+        }
+      }
+    }
+  }
+}
+
+TEST(sample_sort_tests, random_buckets_are_balanced) {
+  for (size_t num_buckets : {2, 4, 8}) {
+    constexpr size_t kPieceSize = 100000;
+    const auto totals = BucketTotals(SortedPieces(num_buckets, kPieceSize, 1 << 30, 7), num_buckets);
+    for (size_t total : totals) {
+      EXPECT_LT(total, kPieceSize * 5 / 4) << "buckets=" << num_buckets;
+      EXPECT_GT(total, kPieceSize * 3 / 4) << "buckets=" << num_buckets;
+    }
+  }
+}
+
+TEST(sample_sort_tests, duplicated_values_spread_over_buckets) {
+  // Four distinct values over eight buckets: cutting only between distinct values would leave
+  // four buckets empty
+  constexpr size_t kNumBuckets = 8;
+  constexpr size_t kPieceSize = 40000;
+  const auto totals = BucketTotals(SortedPieces(kNumBuckets, kPieceSize, 4, 11), kNumBuckets);
+  for (size_t total : totals) {
+    EXPECT_LT(total, kPieceSize * 9 / 8);
+    EXPECT_GT(total, kPieceSize * 7 / 8);
+  }
+  const auto all_equal = BucketTotals(SortedPieces(kNumBuckets, kPieceSize, 1, 13), kNumBuckets);
+  EXPECT_EQ(all_equal, std::vector<size_t>(kNumBuckets, kPieceSize));
+}
+
+TEST(sample_sort_tests, no_samples_give_one_bucket) {
+  std::vector<int> samples;
+  const auto splitters = ppc::core::SelectSplitters(samples, 4);
+  EXPECT_TRUE(splitters.empty());
+  std::vector<int> piece = {1, 2, 3};
+  const auto bounds = ppc::core::BucketBounds(std::span<const int>(piece), SplitterSpan(splitters));
+  EXPECT_EQ(bounds, (std::vector<size_t>{0, 3}));
+}
+
+TEST(sample_sort_tests, descending_comparator) {
+  std::vector<int> piece = {9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+  std::vector<ppc::core::SampleSplitter<int>> splitters = {{6, 0, 1}, {3, 1, 1}};
+  const auto bounds = ppc::core::BucketBounds(std::span<const int>(piece), SplitterSpan(splitters), std::greater<>());
+  EXPECT_EQ(bounds, (std::vector<size_t>{0, 3, 7, 10}));
+}
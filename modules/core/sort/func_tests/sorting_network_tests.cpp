@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "core/sort/include/sorting_network.hpp"
+#include "core/util/include/simd_level.hpp"
+
+namespace {
+
+template <class T>
+std::vector<T> RandomValues(size_t n, T range, unsigned seed) {
+  std::mt19937_64 gen(seed);
+  std::vector<T> values(n);
+  for (auto &value : values) {
+    if constexpr (std::is_floating_point_v<T>) {
+      value = std::uniform_real_distribution<T>(-range, range)(gen);
+    } else {
+      value = std::uniform_int_distribution<T>(-range, range)(gen);
+    }
+  }
+  return values;
+}
+
+// Every level this machine can run, the widest one is restored afterwards
+std::vector<ppc::util::SimdLevel> Levels() {
+  std::vector<ppc::util::SimdLevel> levels = {ppc::util::SimdLevel::kScalar};
+  const auto widest = ppc::util::DetectSimdLevel();
+  if (widest >= ppc::util::SimdLevel::kAvx2) {
+    levels.push_back(ppc::util::SimdLevel::kAvx2);
+  }
+  if (widest >= ppc::util::SimdLevel::kAvx512) {
+    levels.push_back(ppc::util::SimdLevel::kAvx512);
+  }
+  return levels;
+}
+
+template <class T>
+class SortingNetworkTest : public ::testing::Test {
+ protected:
+  void TearDown() override { ppc::util::SetSimdLevel(ppc::util::SimdLevel::kAvx512); }
+};
+
+using NetworkTypes = ::testing::Types<int32_t, int64_t, double>;
+TYPED_TEST_SUITE(SortingNetworkTest, NetworkTypes);
+
+}  // namespace
+
+TYPED_TEST(SortingNetworkTest, sort_block_of_every_size) {
+  using T = TypeParam;
+  for (auto level : Levels()) {
+    ppc::util::SetSimdLevel(level);
+    for (size_t n = 0; n <= ppc::core::kNetworkBlockMax; n++) {
+      for (T range : {T(3), T(1000000)}) {
+        auto values = RandomValues<T>(n, range, static_cast<unsigned>(n));
+        auto expected = values;
+        std::ranges::sort(expected);
+        ppc::core::NetworkSortBlock(std::span<T>(values));
+        EXPECT_EQ(values, expected) << ppc::util::SimdLevelName(level) << " n=" << n;
+      }
+    }
+  }
+}
+
+TYPED_TEST(SortingNetworkTest, merge_runs_of_any_length) {
+  using T = TypeParam;
+  for (auto level : Levels()) {
+    ppc::util::SetSimdLevel(level);
+    for (size_t left_size : {0, 1, 3, 4, 8, 15, 16, 17, 100, 1000}) {
+      for (size_t right_size : {0, 2, 7, 8, 31, 64, 333}) {
+        auto left = RandomValues<T>(left_size, T(50), static_cast<unsigned>(left_size));
+        auto right = RandomValues<T>(right_size, T(50), static_cast<unsigned>(right_size) + 1000);
+        std::ranges::sort(left);
+        std::ranges::sort(right);
+        std::vector<T> expected(left_size + right_size);
+        std::ranges::merge(left, right, expected.begin());
+
+        std::vector<T> out(expected.size());
+        ppc::core::BitonicMerge<T>(left, right, out);
+        EXPECT_EQ(out, expected) << ppc::util::SimdLevelName(level) << " " << left_size << "+" << right_size;
+      }
+    }
+  }
+}
+
+TYPED_TEST(SortingNetworkTest, sort_matches_std_sort) {
+  using T = TypeParam;
+  for (auto level : Levels()) {
+    ppc::util::SetSimdLevel(level);
+    for (size_t n : {0, 1, 33, 64, 65, 100, 1023, 4096, 50001}) {
+      auto values = RandomValues<T>(n, T(1 << 20), static_cast<unsigned>(n));
+      auto expected = values;
+      std::ranges::sort(expected);
+      ppc::core::NetworkSort(std::span<T>(values));
+      EXPECT_EQ(values, expected) << ppc::util::SimdLevelName(level) << " n=" << n;
+    }
+  }
+}
+
+TYPED_TEST(SortingNetworkTest, sort_keeps_extreme_values) {
+  using T = TypeParam;
+  using Limits = std::numeric_limits<T>;
+  for (auto level : Levels()) {
+    ppc::util::SetSimdLevel(level);
+    // The padding value is the largest one, it must not leak into or out of the data
+    std::vector<T> values = {Limits::max(), Limits::lowest(), 0, Limits::max(), T(-1), Limits::lowest(), T(7)};
+    if constexpr (Limits::has_infinity) {
+      values.push_back(Limits::infinity());
+      values.push_back(-Limits::infinity());
+    }
+    for (int copies = 0; copies < 5; copies++) {
+      values.insert(values.end(), values.begin(), values.end());
+    }
+    auto expected = values;
+    std::ranges::sort(expected);
+    auto block = std::vector<T>(values.begin(), values.begin() + 29);
+    auto block_expected = block;
+    std::ranges::sort(block_expected);
+    ppc::core::NetworkSortBlock(std::span<T>(block));
+    EXPECT_EQ(block, block_expected) << ppc::util::SimdLevelName(level);
+    ppc::core::NetworkSort(std::span<T>(values));
+    EXPECT_EQ(values, expected) << ppc::util::SimdLevelName(level);
+  }
+}
+
+TEST(sorting_network_tests, rejects_bad_sizes) {
+  std::vector<int32_t> big(ppc::core::kNetworkBlockMax + 1);
+  EXPECT_THROW(ppc::core::NetworkSortBlock(std::span<int32_t>(big)), std::invalid_argument);
+  std::vector<int32_t> run = {1, 2};
+  std::vector<int32_t> out(3);
+  EXPECT_THROW(ppc::core::BitonicMerge<int32_t>(run, run, out), std::invalid_argument);
+}
@@ -0,0 +1,292 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/sort/include/multiway_merge.hpp"
+#include "core/sort/include/radix_sort.hpp"
+#include "core/trace/include/trace.hpp"
+#include "core/util/include/file_io.hpp"
+#include "core/util/include/for_each.hpp"
+
+namespace ppc::core {
+
+// Merge blocks are not made smaller than this, a tight budget merges fewer runs per pass instead
+constexpr size_t kExternalMinBlockBytes = size_t{64} << 10;
+// nor larger: sequential reads of a few MiB already run at disk speed
+constexpr size_t kExternalMaxBlockBytes = size_t{4} << 20;
+// Elements per task when a run is copied out of the mapped input
+constexpr size_t kExternalCopyChunk = size_t{1} << 16;
+
+struct ExternalSortOptions {
+  // Bytes of memory the sort holds at once: a run and its radix scratch while runs are formed,
+  // two blocks per merged run and two output blocks while they are merged
+  size_t memory_budget = size_t{256} << 20;
+  // Runs go to a fresh directory under this one, removed afterwards. Empty: the system temp directory.
+  std::filesystem::path temp_dir;
+  // Most runs merged by one pass, a small budget allows fewer
+  size_t max_fan_in = 128;
+};
+
+struct ExternalSortStats {
+  size_t elements = 0;
+  // Sorted runs written by the first phase, 1 when the input fits the budget
+  size_t runs = 0;
+  // Merge passes over the data, the last one writes the output
+  size_t merge_passes = 0;
+  // Runs merged at once
+  size_t fan_in = 0;
+  // Bytes read back from runs and written to runs and the output
+  size_t bytes_read = 0;
+  size_t bytes_written = 0;
+};
+
+namespace detail {
+
+template <class T>
+struct RadixKeyLess {
+  bool operator()(const T &a, const T &b) const { return RadixTraits<T>::ToKey(a) < RadixTraits<T>::ToKey(b); }
+};
+
+// Run of a merge pass, read in blocks: while the current block is merged the next one is
+// already being read by an asynchronous task
+template <class T>
+class RunReader {
+ public:
+  RunReader(const std::filesystem::path &path, size_t block_elements)
+      : file_(path),
+        remaining_(file_.Size() / sizeof(T)),
+        block_elements_(block_elements),
+        current_(std::make_unique_for_overwrite<T[]>(block_elements)),
+        next_(std::make_unique_for_overwrite<T[]>(block_elements)) {
+    Prefetch();
+  }
+  RunReader(const RunReader &) = delete;
+  RunReader &operator=(const RunReader &) = delete;
+  ~RunReader() = default;
+
+  // Next block of the run, empty at its end. Valid until the following call.
+  std::span<const T> NextBlock() {
+    if (!pending_.valid()) {
+      return {};
+    }
+    const size_t count = pending_.get();
+    std::swap(current_, next_);
+    Prefetch();
+    return {current_.get(), count};
+  }
+
+ private:
+  void Prefetch() {
+    if (remaining_ == 0) {
+      return;
+    }
+    const size_t count = std::min(block_elements_, remaining_);
+    const size_t offset = offset_;
+    offset_ += count * sizeof(T);
+    remaining_ -= count;
+    pending_ = std::async(std::launch::async, [this, offset, count, buffer = next_.get()] {
+      file_.ReadAt(offset, std::as_writable_bytes(std::span<T>(buffer, count)));
+      return count;
+    });
+  }
+
+  util::FileReader file_;
+  size_t remaining_;
+  size_t offset_ = 0;
+  size_t block_elements_;
+  std::unique_ptr<T[]> current_;
+  std::unique_ptr<T[]> next_;
+  // Last member: destroyed first, so a read in flight finishes before its buffer goes away
+  std::future<size_t> pending_;
+};
+
+// Output of a merge pass: a full block is written by an asynchronous task while the next one fills
+template <class T>
+class RunWriter {
+ public:
+  RunWriter(const std::filesystem::path &path, size_t block_elements)
+      : file_(path),
+        block_elements_(block_elements),
+        filling_(std::make_unique_for_overwrite<T[]>(block_elements)),
+        writing_(std::make_unique_for_overwrite<T[]>(block_elements)) {}
+  RunWriter(const RunWriter &) = delete;
+  RunWriter &operator=(const RunWriter &) = delete;
+  ~RunWriter() = default;
+
+  void Push(const T &value) {
+    filling_[size_++] = value;
+    if (size_ == block_elements_) {
+      Flush();
+    }
+  }
+
+  // Write what is left and close the file, returns the bytes written
+  size_t Close() {
+    Flush();
+    Wait();
+    file_.Close();
+    return file_.BytesWritten();
+  }
+
+ private:
+  void Flush() {
+    Wait();
+    if (size_ == 0) {
+      return;
+    }
+    std::swap(filling_, writing_);
+    pending_ = std::async(std::launch::async, [this, count = size_] {
+      file_.Write(std::as_bytes(std::span<const T>(writing_.get(), count)));
+    });
+    size_ = 0;
+  }
+
+  void Wait() {
+    if (pending_.valid()) {
+      pending_.get();
+    }
+  }
+
+  util::FileWriter file_;
+  size_t block_elements_;
+  size_t size_ = 0;
+  std::unique_ptr<T[]> filling_;
+  std::unique_ptr<T[]> writing_;
+  std::future<void> pending_;
+};
+
+// Stable merge of the sorted run files into out with a LoserTree over their current blocks
+template <class T>
+void MergeRunFiles(std::span<const std::filesystem::path> runs, const std::filesystem::path &out,
+                   size_t memory_budget, ExternalSortStats &stats) {
+  PPC_TRACE_SCOPE("external merge");
+  // Two blocks for every run and two for the output
+  const size_t block_bytes = std::clamp(memory_budget / ((2 * runs.size()) + 2), sizeof(T), kExternalMaxBlockBytes);
+  const size_t block_elements = block_bytes / sizeof(T);
+
+  std::vector<std::unique_ptr<RunReader<T>>> readers;
+  std::vector<std::span<const T>> blocks;
+  for (const auto &run : runs) {
+    stats.bytes_read += std::filesystem::file_size(run);
+    readers.push_back(std::make_unique<RunReader<T>>(run, block_elements));
+    blocks.push_back(readers.back()->NextBlock());
+  }
+  // Values left in the current block of every run
+  std::vector<size_t> left(runs.size());
+  for (size_t run = 0; run < runs.size(); run++) {
+    left[run] = blocks[run].size();
+  }
+
+  RunWriter<T> writer(out, block_elements);
+  LoserTree<T, RadixKeyLess<T>> tree(blocks);
+  while (!tree.Empty()) {
+    const size_t run = tree.TopRun();
+    writer.Push(tree.Top());
+    if (--left[run] == 0) {
+      const auto next = readers[run]->NextBlock();
+      left[run] = next.size();
+      tree.PopAndRefill(next);
+    } else {
+      tree.Pop();
+    }
+  }
+  stats.bytes_written += writer.Close();
+}
+
+}  // namespace detail
+
+// Sorts the binary file input (raw values of one RadixSort type) into the file output without
+// holding more than options.memory_budget bytes. Budget-sized runs are copied out of the mapped
+// input, radix sorted in parallel by for_each and written to a scratch directory; then they are
+// merged options.max_fan_in (or fewer, as the budget allows) at a time, each run read in large
+// sequential blocks prefetched asynchronously, until the last pass writes output.
+template <class T, class ForEach = ppc::util::SequentialForEach>
+ExternalSortStats ExternalSort(const std::filesystem::path &input, const std::filesystem::path &output,
+                               const ExternalSortOptions &options = {}, const ForEach &for_each = {}) {
+  static_assert(std::is_trivially_copyable_v<T>, "ExternalSort writes values as raw bytes");
+  if (options.memory_budget < kExternalMinBlockBytes) {
+    throw std::invalid_argument("ExternalSort: memory budget is smaller than one block");
+  }
+  if (std::filesystem::exists(output) && std::filesystem::equivalent(input, output)) {
+    throw std::invalid_argument("ExternalSort: output must not be the input file");
+  }
+  const util::MappedFile mapped(input);
+  if (mapped.Size() % sizeof(T) != 0) {
+    throw std::invalid_argument("ExternalSort: input size is not a multiple of the value size");
+  }
+  const std::span<const T> data(reinterpret_cast<const T *>(mapped.Bytes().data()), mapped.Size() / sizeof(T));
+
+  ExternalSortStats stats{.elements = data.size()};
+  // 2 * fan_in + 2 blocks of at least kExternalMinBlockBytes
+  const size_t min_blocks = options.memory_budget / kExternalMinBlockBytes;
+  stats.fan_in = std::clamp(min_blocks >= 4 ? (min_blocks / 2) - 1 : 0, size_t{2},
+                            std::max(options.max_fan_in, size_t{2}));
+  // A run and its scratch buffer fill the budget
+  const size_t run_elements = options.memory_budget / (2 * sizeof(T));
+  const size_t num_runs = (data.size() + run_elements - 1) / run_elements;
+  auto buffer = std::make_unique_for_overwrite<T[]>(std::min(run_elements, data.size()));
+  auto scratch = std::make_unique_for_overwrite<T[]>(std::min(run_elements, data.size()));
+
+  util::ScratchDirectory directory(options.temp_dir);
+  std::vector<std::filesystem::path> runs;
+  for (size_t first = 0; first < data.size(); first += run_elements) {
+    PPC_TRACE_SCOPE("external run");
+    const size_t count = std::min(run_elements, data.size() - first);
+    const std::span<T> run(buffer.get(), count);
+    for_each((count + kExternalCopyChunk - 1) / kExternalCopyChunk, [&](size_t chunk) {
+      const size_t begin = chunk * kExternalCopyChunk;
+      const size_t end = std::min(count, begin + kExternalCopyChunk);
+      const auto from = data.subspan(first + begin, end - begin);
+      std::ranges::copy(from, run.begin() + static_cast<std::ptrdiff_t>(begin));
+    });
+    mapped.Release(first * sizeof(T), count * sizeof(T));
+    RadixSort(run, std::span<T>(scratch.get(), count), for_each);
+    // A single run is the output already
+    runs.push_back(num_runs == 1 ? output : directory.NewFile());
+    util::FileWriter writer(runs.back());
+    writer.Write(std::as_bytes(std::span<const T>(run)));
+    writer.Close();
+    stats.bytes_written += writer.BytesWritten();
+  }
+  stats.runs = runs.size();
+  buffer.reset();
+  scratch.reset();
+
+  if (runs.empty()) {
+    util::FileWriter(output).Close();
+    return stats;
+  }
+  while (runs.size() > 1) {
+    const bool last_pass = runs.size() <= stats.fan_in;
+    std::vector<std::filesystem::path> merged;
+    for (size_t first = 0; first < runs.size(); first += stats.fan_in) {
+      const std::span<const std::filesystem::path> group(runs.data() + first,
+                                                         std::min(stats.fan_in, runs.size() - first));
+      if (group.size() == 1) {
+        // Left over, it takes part in the next pass as it is
+        merged.push_back(group.front());
+        continue;
+      }
+      merged.push_back(last_pass ? output : directory.NewFile());
+      detail::MergeRunFiles<T>(group, merged.back(), options.memory_budget, stats);
+      // Merged runs give their disk space back right away
+      for (const auto &run : group) {
+        std::filesystem::remove(run);
+      }
+    }
+    runs = std::move(merged);
+    stats.merge_passes++;
+  }
+  return stats;
+}
+
+}  // namespace ppc::core
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "core/sort/include/radix_sort.hpp"
+#include "core/util/include/for_each.hpp"
+
+namespace ppc::core {
+
+// Elements per task of the key transforms
+constexpr size_t kKeyTransformChunk = size_t{1} << 14;
+
+template <class T>
+using RadixKey = typename RadixTraits<T>::Key;
+
+namespace detail {
+
+// Branch-free bodies over plain arrays: the compiler turns them into SIMD loops
+template <class T>
+void ToKeysKernel(const T *values, RadixKey<T> *keys, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    keys[i] = RadixTraits<T>::ToKey(values[i]);
+  }
+}
+
+template <class T>
+void FromKeysKernel(const RadixKey<T> *keys, T *values, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    values[i] = RadixTraits<T>::FromKey(keys[i]);
+  }
+}
+
+template <class ForEach, class Kernel>
+void ForEachKeyChunk(size_t n, const ForEach &for_each, const Kernel &kernel) {
+  for_each((n + kKeyTransformChunk - 1) / kKeyTransformChunk, [&](size_t chunk) {
+    const size_t begin = chunk * kKeyTransformChunk;
+    kernel(begin, std::min(n, begin + kKeyTransformChunk) - begin);
+  });
+}
+
+}  // namespace detail
+
+// keys[i] = RadixTraits<T>::ToKey(values[i]) in one pass. Sorting the keys as plain unsigned
+// integers orders the values, so radix passes skip the per-digit conversion; for floating point
+// -0.0 goes before +0.0, NaNs with the sign bit set before everything and the others after.
+template <class T, class ForEach = ppc::util::SequentialForEach>
+void ToRadixKeys(std::span<const T> values, std::span<RadixKey<T>> keys, const ForEach &for_each = {}) {
+  if (keys.size() != values.size()) {
+    throw std::invalid_argument("ToRadixKeys: values and keys differ in size");
+  }
+  detail::ForEachKeyChunk(values.size(), for_each, [&](size_t begin, size_t count) {
+    detail::ToKeysKernel(values.data() + begin, keys.data() + begin, count);
+  });
+}
+
+// Same into a new vector
+template <class T, class ForEach = ppc::util::SequentialForEach>
+std::vector<RadixKey<T>> ToRadixKeys(std::span<const T> values, const ForEach &for_each = {}) {
+  std::vector<RadixKey<T>> keys(values.size());
+  ToRadixKeys(values, std::span<RadixKey<T>>(keys), for_each);
+  return keys;
+}
+
+// Inverse of ToRadixKeys, every value comes back bit for bit (NaN payloads included)
+template <class T, class ForEach = ppc::util::SequentialForEach>
+void FromRadixKeys(std::span<const RadixKey<T>> keys, std::span<T> values, const ForEach &for_each = {}) {
+  if (keys.size() != values.size()) {
+    throw std::invalid_argument("FromRadixKeys: keys and values differ in size");
+  }
+  detail::ForEachKeyChunk(keys.size(), for_each, [&](size_t begin, size_t count) {
+    detail::FromKeysKernel(keys.data() + begin, values.data() + begin, count);
+  });
+}
+
+}  // namespace ppc::core
@@ -0,0 +1,268 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/sort/include/radix_sort.hpp"
+#include "core/util/include/for_each.hpp"
+
+namespace ppc::core {
+
+// Payloads up to this size travel with their keys on every radix pass, wider ones are sorted as
+// indices and gathered once at the end. After the MSD split the remaining passes run in cache, so
+// moving stays cheaper than the random-access gather for small payloads; from 24 bytes on the
+// gather wins. The burykin_m tbb perf test test_key_value_payload_sizes times both layouts.
+constexpr size_t kRadixMovedPayloadBytes = 16;
+// Elements per task of ApplyPermutation
+constexpr size_t kPermutationChunk = size_t{1} << 14;
+
+namespace detail {
+
+// Keys and payloads of one buffer, structure of arrays
+template <class K, class V>
+struct PairBuffer {
+  K *keys;
+  V *values;
+
+  [[nodiscard]] PairBuffer Offset(size_t offset) const { return {keys + offset, values + offset}; }
+  bool operator==(const PairBuffer &) const = default;
+};
+
+template <class K, class V>
+void CopyPairs(PairBuffer<K, V> from, size_t n, PairBuffer<K, V> to) {
+  std::copy(from.keys, from.keys + n, to.keys);
+  std::copy(from.values, from.values + n, to.values);
+}
+
+template <class K, class V>
+void InsertionSortPairs(PairBuffer<K, V> data, size_t n) {
+  for (size_t i = 1; i < n; i++) {
+    const K key = data.keys[i];
+    const V value = data.values[i];
+    const auto radix_key = RadixTraits<K>::ToKey(key);
+    size_t j = i;
+    for (; j > 0 && radix_key < RadixTraits<K>::ToKey(data.keys[j - 1]); j--) {
+      data.keys[j] = data.keys[j - 1];
+      data.values[j] = data.values[j - 1];
+    }
+    data.keys[j] = key;
+    data.values[j] = value;
+  }
+}
+
+// LsdSort moving the payload with every key
+template <class K, class V>
+void LsdSortPairs(PairBuffer<K, V> src, PairBuffer<K, V> other, size_t n, int num_digits, PairBuffer<K, V> result) {
+  if (n <= kRadixInsertionSortThreshold) {
+    InsertionSortPairs(src, n);
+    if (result != src) {
+      CopyPairs(src, n, result);
+    }
+    return;
+  }
+  std::vector<size_t> histograms(static_cast<size_t>(num_digits) * kRadixBuckets, 0);
+  for (size_t i = 0; i < n; i++) {
+    const auto key = RadixTraits<K>::ToKey(src.keys[i]);
+    for (int digit = 0; digit < num_digits; digit++) {
+      histograms[(digit * kRadixBuckets) + (static_cast<size_t>(key >> (digit * kRadixBits)) & (kRadixBuckets - 1))]++;
+    }
+  }
+
+  PairBuffer<K, V> from = src;
+  PairBuffer<K, V> to = other;
+  for (int digit = 0; digit < num_digits; digit++) {
+    size_t *offsets = &histograms[digit * kRadixBuckets];
+    if (offsets[RadixDigit(from.keys[0], digit)] == n) {
+      continue;
+    }
+    size_t sum = 0;
+    for (size_t bucket = 0; bucket < kRadixBuckets; bucket++) {
+      const size_t count = offsets[bucket];
+      offsets[bucket] = sum;
+      sum += count;
+    }
+    for (size_t i = 0; i < n; i++) {
+      const size_t pos = offsets[RadixDigit(from.keys[i], digit)]++;
+      to.keys[pos] = from.keys[i];
+      to.values[pos] = from.values[i];
+    }
+    std::swap(from, to);
+  }
+  if (from != result) {
+    CopyPairs(from, n, result);
+  }
+}
+
+// MsdSort moving the payload with every key
+template <class K, class V, class ForEach>
+void MsdSortPairs(PairBuffer<K, V> src, PairBuffer<K, V> other, size_t n, int num_digits, PairBuffer<K, V> result,
+                  const ForEach &for_each) {
+  if (num_digits <= 1 || n * (sizeof(K) + sizeof(V)) < kRadixMsdThresholdBytes) {
+    LsdSortPairs(src, other, n, num_digits, result);
+    return;
+  }
+
+  const int digit = num_digits - 1;
+  std::vector<size_t> offsets(kRadixBuckets + 1, 0);
+  for (size_t i = 0; i < n; i++) {
+    offsets[RadixDigit(src.keys[i], digit) + 1]++;
+  }
+  if (offsets[RadixDigit(src.keys[0], digit) + 1] == n) {
+    MsdSortPairs(src, other, n, digit, result, for_each);
+    return;
+  }
+  for (size_t bucket = 1; bucket <= kRadixBuckets; bucket++) {
+    offsets[bucket] += offsets[bucket - 1];
+  }
+  std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+  for (size_t i = 0; i < n; i++) {
+    const size_t pos = next[RadixDigit(src.keys[i], digit)]++;
+    other.keys[pos] = src.keys[i];
+    other.values[pos] = src.values[i];
+  }
+
+  const PairBuffer<K, V> bucket_result = result == src ? src : other;
+  for_each(kRadixBuckets, [&](size_t bucket) {
+    const size_t begin = offsets[bucket];
+    const size_t size = offsets[bucket + 1] - begin;
+    if (size > 0) {
+      MsdSortPairs(other.Offset(begin), src.Offset(begin), size, digit, bucket_result.Offset(begin), for_each);
+    }
+  });
+}
+
+}  // namespace detail
+
+// Stable sort of keys with values[i] moved along with keys[i], structure of arrays: the payload
+// array is scattered next to the key array on every pass. Keys are the RadixSort types, values
+// any trivially copyable type; payloads wider than a word are better served by RadixSortByKey.
+template <class K, class V, class ForEach = ppc::util::SequentialForEach>
+void RadixSortPairs(std::span<K> keys, std::span<V> values, const ForEach &for_each = {}) {
+  static_assert(std::is_trivially_copyable_v<K> && std::is_trivially_copyable_v<V>,
+                "RadixSortPairs moves values with plain copies");
+  if (keys.size() != values.size()) {
+    throw std::invalid_argument("RadixSortPairs: keys and values differ in size");
+  }
+  const size_t n = keys.size();
+  if (n < 2) {
+    return;
+  }
+  auto key_scratch = std::make_unique_for_overwrite<K[]>(n);
+  auto value_scratch = std::make_unique_for_overwrite<V[]>(n);
+  const detail::PairBuffer<K, V> data{.keys = keys.data(), .values = values.data()};
+  const detail::PairBuffer<K, V> scratch{.keys = key_scratch.get(), .values = value_scratch.get()};
+  detail::MsdSortPairs(data, scratch, n, detail::kRadixDigits<K>, data, for_each);
+}
+
+// out[i] = in[order[i]], cut into kPermutationChunk tasks
+template <class V, class Index, class ForEach = ppc::util::SequentialForEach>
+void ApplyPermutation(std::span<const Index> order, std::span<const V> in, std::span<V> out,
+                      const ForEach &for_each = {}) {
+  if (order.size() != in.size() || out.size() != in.size()) {
+    throw std::invalid_argument("ApplyPermutation: order, input and output differ in size");
+  }
+  const size_t n = order.size();
+  for_each((n + kPermutationChunk - 1) / kPermutationChunk, [&](size_t chunk) {
+    const size_t end = std::min(n, (chunk + 1) * kPermutationChunk);
+    for (size_t i = chunk * kPermutationChunk; i < end; i++) {
+      out[i] = in[static_cast<size_t>(order[i])];
+    }
+  });
+}
+
+// Stable argsort: indices receives the permutation that orders keys, equal keys keep their
+// order. Index is uint32_t or uint64_t and must be able to address every key.
+template <class K, class Index, class ForEach = ppc::util::SequentialForEach>
+void RadixArgSort(std::span<const K> keys, std::span<Index> indices, const ForEach &for_each = {}) {
+  static_assert(std::is_same_v<Index, uint32_t> || std::is_same_v<Index, uint64_t>, "indices are 32 or 64 bits");
+  if (keys.size() != indices.size()) {
+    throw std::invalid_argument("RadixArgSort: keys and indices differ in size");
+  }
+  if (keys.size() > static_cast<size_t>(std::numeric_limits<Index>::max())) {
+    throw std::invalid_argument("RadixArgSort: too many keys for the index type");
+  }
+  auto sorted_keys = std::make_unique_for_overwrite<K[]>(keys.size());
+  std::copy(keys.begin(), keys.end(), sorted_keys.get());
+  for (size_t i = 0; i < indices.size(); i++) {
+    indices[i] = static_cast<Index>(i);
+  }
+  RadixSortPairs(std::span<K>(sorted_keys.get(), keys.size()), indices, for_each);
+}
+
+// Stable key + payload sort where only 32-bit indices ride along with the keys: every pass moves
+// 8 bytes per element whatever the payload size, and the payloads are gathered into place once
+template <class K, class V, class ForEach = ppc::util::SequentialForEach>
+void RadixSortByIndex(std::span<K> keys, std::span<V> values, const ForEach &for_each = {}) {
+  if (keys.size() != values.size()) {
+    throw std::invalid_argument("RadixSortByIndex: keys and values differ in size");
+  }
+  if (keys.size() > std::numeric_limits<uint32_t>::max()) {
+    throw std::invalid_argument("RadixSortByIndex: too many keys for 32-bit indices");
+  }
+  const size_t n = keys.size();
+  auto order = std::make_unique_for_overwrite<uint32_t[]>(n);
+  for (size_t i = 0; i < n; i++) {
+    order[i] = static_cast<uint32_t>(i);
+  }
+  RadixSortPairs(keys, std::span<uint32_t>(order.get(), n), for_each);
+  auto unsorted = std::make_unique_for_overwrite<V[]>(n);
+  std::copy(values.begin(), values.end(), unsorted.get());
+  ApplyPermutation(std::span<const uint32_t>(order.get(), n), std::span<const V>(unsorted.get(), n), values, for_each);
+}
+
+// Stable key + payload sort in the cheaper layout: RadixSortPairs up to kRadixMovedPayloadBytes
+// of payload, RadixSortByIndex above
+template <class K, class V, class ForEach = ppc::util::SequentialForEach>
+void RadixSortByKey(std::span<K> keys, std::span<V> values, const ForEach &for_each = {}) {
+  if constexpr (sizeof(V) <= kRadixMovedPayloadBytes) {
+    RadixSortPairs(keys, values, for_each);
+  } else {
+    RadixSortByIndex(keys, values, for_each);
+  }
+}
+
+// 64-bit word holding the radix key of a 32-bit key in the high half and index in the low half:
+// the words order by key, ties by index. Word int64_t has the top bit flipped so that signed
+// comparison keeps the order, for sorters working on signed values.
+template <class Word = uint64_t, class K>
+Word PackKeyIndex(K key, uint32_t index) {
+  static_assert(sizeof(typename RadixTraits<K>::Key) == 4, "packing needs 32-bit keys");
+  static_assert(std::is_same_v<Word, uint64_t> || std::is_same_v<Word, int64_t>, "words are 64 bits");
+  const uint64_t word = (static_cast<uint64_t>(RadixTraits<K>::ToKey(key)) << 32) | index;
+  if constexpr (std::is_signed_v<Word>) {
+    return static_cast<Word>(word ^ 0x8000000000000000ULL);
+  } else {
+    return word;
+  }
+}
+
+// Stable argsort of 32-bit keys through any sorter of 64-bit words: keys and indices are packed
+// by PackKeyIndex, sort_words(std::span<Word>) orders them (a quicksort, a sorting network, Shell
+// sort, ...) and the low halves are the permutation. Unique words make any sorter stable.
+template <class Word = uint64_t, class K, class SortWords>
+void PackedArgSort(std::span<const K> keys, std::span<uint32_t> indices, const SortWords &sort_words) {
+  if (keys.size() != indices.size()) {
+    throw std::invalid_argument("PackedArgSort: keys and indices differ in size");
+  }
+  if (keys.size() > std::numeric_limits<uint32_t>::max()) {
+    throw std::invalid_argument("PackedArgSort: too many keys for 32-bit indices");
+  }
+  std::vector<Word> words(keys.size());
+  for (size_t i = 0; i < keys.size(); i++) {
+    words[i] = PackKeyIndex<Word>(keys[i], static_cast<uint32_t>(i));
+  }
+  sort_words(std::span<Word>(words));
+  for (size_t i = 0; i < words.size(); i++) {
+    indices[i] = static_cast<uint32_t>(static_cast<uint64_t>(words[i]) & 0xFFFFFFFFULL);
+  }
+}
+
+}  // namespace ppc::core
@@ -0,0 +1,191 @@
+#pragma once
+
+// Distributed sample sort over MPI. The core library itself does not link MPI: this header is
+// only included by the mpi and all tasks, which do.
+
+#include <mpi.h>
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/sort/include/multiway_merge.hpp"
+#include "core/sort/include/sample_sort.hpp"
+#include "core/trace/include/trace.hpp"
+#include "core/util/include/for_each.hpp"
+
+namespace ppc::core {
+
+namespace detail {
+
+// MPI datatype of sizeof(T) contiguous bytes, freed with the object
+template <class T>
+class MpiBytesType {
+ public:
+  MpiBytesType() {
+    MPI_Type_contiguous(static_cast<int>(sizeof(T)), MPI_BYTE, &type_);
+    MPI_Type_commit(&type_);
+  }
+  MpiBytesType(const MpiBytesType &) = delete;
+  MpiBytesType &operator=(const MpiBytesType &) = delete;
+  ~MpiBytesType() { MPI_Type_free(&type_); }
+
+  [[nodiscard]] MPI_Datatype Get() const { return type_; }
+
+ private:
+  MPI_Datatype type_{};
+};
+
+inline int CheckedMpiCount(size_t count) {
+  if (count > static_cast<size_t>(INT_MAX)) {
+    throw std::invalid_argument("Sample sort: more than INT_MAX values on one rank");
+  }
+  return static_cast<int>(count);
+}
+
+// Throws on every rank of comm once count exceeds INT_MAX on any of them. A rank must not throw
+// alone between collectives: the others would wait for it in the next one forever.
+inline void CheckMpiCountOnAllRanks(MPI_Comm comm, size_t count) {
+  int overflow = count > static_cast<size_t>(INT_MAX) ? 1 : 0;
+  MPI_Allreduce(MPI_IN_PLACE, &overflow, 1, MPI_INT, MPI_LOR, comm);
+  if (overflow != 0) {
+    throw std::invalid_argument("Sample sort: more than INT_MAX values on one rank");
+  }
+}
+
+// Exclusive prefix sums of counts, total receives their sum
+inline std::vector<int> Displacements(const std::vector<int> &counts, size_t &total) {
+  std::vector<int> displs(counts.size(), 0);
+  total = 0;
+  for (size_t i = 0; i < counts.size(); i++) {
+    displs[i] = CheckedMpiCount(total);
+    total += static_cast<size_t>(counts[i]);
+  }
+  CheckedMpiCount(total);
+  return displs;
+}
+
+}  // namespace detail
+
+// Sorts values spread over the ranks of comm; every rank passes its own piece, of any size.
+// Rank r returns the r-th bucket of the global order, so the concatenation over the ranks is
+// sorted and no rank ever holds more than its share. Regular sampling (PSRS):
+//   1. local_sort(std::span<T>) sorts the piece, with whatever threads the caller has;
+//   2. every rank takes evenly spaced samples, one allgather gives all of them to everyone and
+//      each rank picks the same size - 1 splitters;
+//   3. the sorted piece is cut at the splitters and one MPI_Alltoallv delivers bucket r to rank r;
+//   4. the size sorted runs received are merged by MultiwayMerge over num_parts parts.
+// T must be trivially copyable, it travels as bytes. Call GatherSorted for the whole result.
+// A rank holding or receiving more than INT_MAX values makes every rank throw std::invalid_argument.
+template <class T, class LocalSort, class Compare = std::less<>, class ForEach = ppc::util::SequentialForEach>
+std::vector<T> DistributedSampleSort(MPI_Comm comm, std::vector<T> local, const LocalSort &local_sort,
+                                     size_t num_parts = 1, const Compare &comp = {}, const ForEach &for_each = {}) {
+  static_assert(std::is_trivially_copyable_v<T>, "Sample sort sends values as raw bytes");
+  int rank = 0;
+  int size = 1;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &size);
+  const auto ranks = static_cast<size_t>(size);
+  const detail::MpiBytesType<T> type;
+
+  {
+    PPC_TRACE_SCOPE("sample sort local");
+    local_sort(std::span<T>(local));
+  }
+  if (size == 1) {
+    return local;
+  }
+
+  std::vector<SampleSplitter<T>> splitters;
+  {
+    PPC_TRACE_SCOPE("sample sort splitters");
+    auto samples = RegularSamples(std::span<const T>(local), SampleSortSamplesPerPiece(ranks));
+    int sample_count = detail::CheckedMpiCount(samples.size());
+    std::vector<int> sample_counts(ranks);
+    MPI_Allgather(&sample_count, 1, MPI_INT, sample_counts.data(), 1, MPI_INT, comm);
+    size_t total_samples = 0;
+    const auto sample_displs = detail::Displacements(sample_counts, total_samples);
+    std::vector<T> all_samples(total_samples);
+    MPI_Allgatherv(samples.data(), sample_count, type.Get(), all_samples.data(), sample_counts.data(),
+                   sample_displs.data(), type.Get(), comm);
+    splitters = SelectSplitters(all_samples, ranks, comp);
+  }
+
+  std::vector<T> received;
+  std::vector<int> recv_counts(ranks);
+  std::vector<int> recv_displs;
+  {
+    PPC_TRACE_SCOPE("sample sort exchange");
+    detail::CheckMpiCountOnAllRanks(comm, local.size());
+    const auto bounds = BucketBounds(std::span<const T>(local), std::span<const SampleSplitter<T>>(splitters), comp);
+    std::vector<int> send_counts(ranks, 0);
+    std::vector<int> send_displs(ranks, 0);
+    for (size_t r = 0; r + 1 < bounds.size() && r < ranks; r++) {
+      send_counts[r] = detail::CheckedMpiCount(bounds[r + 1] - bounds[r]);
+      send_displs[r] = detail::CheckedMpiCount(bounds[r]);
+    }
+    MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, comm);
+    size_t total_received = 0;
+    for (const int count : recv_counts) {
+      total_received += static_cast<size_t>(count);
+    }
+    detail::CheckMpiCountOnAllRanks(comm, total_received);
+    recv_displs = detail::Displacements(recv_counts, total_received);
+    received.resize(total_received);
+    MPI_Alltoallv(local.data(), send_counts.data(), send_displs.data(), type.Get(), received.data(),
+                  recv_counts.data(), recv_displs.data(), type.Get(), comm);
+  }
+  local.clear();
+  local.shrink_to_fit();
+
+  PPC_TRACE_SCOPE("sample sort merge");
+  std::vector<std::span<const T>> runs;
+  for (size_t r = 0; r < ranks; r++) {
+    if (recv_counts[r] > 0) {
+      runs.emplace_back(received.data() + recv_displs[r], static_cast<size_t>(recv_counts[r]));
+    }
+  }
+  if (runs.size() <= 1) {
+    return received;
+  }
+  std::vector<T> bucket(received.size());
+  MultiwayMerge<T>(runs, bucket, num_parts, comp, for_each);
+  return bucket;
+}
+
+// Concatenates the pieces of all ranks, in rank order, on root; the other ranks get an empty vector.
+// More than INT_MAX values in total make every rank throw std::invalid_argument.
+template <class T>
+std::vector<T> GatherSorted(MPI_Comm comm, std::span<const T> local, int root = 0) {
+  static_assert(std::is_trivially_copyable_v<T>, "Sample sort sends values as raw bytes");
+  int rank = 0;
+  int size = 1;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &size);
+  const detail::MpiBytesType<T> type;
+
+  // The total bounds every count, and all ranks agree on it before anyone can throw
+  auto global_count = static_cast<uint64_t>(local.size());
+  MPI_Allreduce(MPI_IN_PLACE, &global_count, 1, MPI_UINT64_T, MPI_SUM, comm);
+  detail::CheckedMpiCount(global_count);
+  const auto count = static_cast<int>(local.size());
+  std::vector<int> counts(rank == root ? static_cast<size_t>(size) : 0);
+  MPI_Gather(&count, 1, MPI_INT, counts.data(), 1, MPI_INT, root, comm);
+  std::vector<int> displs;
+  std::vector<T> result;
+  if (rank == root) {
+    size_t total = 0;
+    displs = detail::Displacements(counts, total);
+    result.resize(total);
+  }
+  MPI_Gatherv(local.data(), count, type.Get(), result.data(), counts.data(), displs.data(), type.Get(), root, comm);
+  return result;
+}
+
+}  // namespace ppc::core
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <vector>
+
+#include "core/util/include/for_each.hpp"
+
+namespace ppc::core {
+
+// Merges k sorted runs with a tournament tree of losers: after the winner is output only
+// the log2(k) matches on its path are replayed. Equal values leave in run order (stable).
+template <class T, class Compare = std::less<>>
+class LoserTree {
+ public:
+  LoserTree(std::span<const std::span<const T>> runs, const Compare &comp = {})
+      : runs_(runs.begin(), runs.end()),
+        positions_(runs.size(), 0),
+        leaves_(std::bit_ceil(std::max<size_t>(runs.size(), 1))),
+        losers_(leaves_, 0),
+        comp_(comp) {
+    // Bottom-up: every inner node keeps the loser of its two subtrees, the overall winner goes to losers_[0]
+    std::vector<size_t> winners(2 * leaves_);
+    for (size_t leaf = 0; leaf < leaves_; leaf++) {
+      winners[leaves_ + leaf] = leaf;
+    }
+    for (size_t node = leaves_ - 1; node > 0; node--) {
+      const size_t left = winners[2 * node];
+      const size_t right = winners[(2 * node) + 1];
+      const bool left_wins = Beats(left, right);
+      winners[node] = left_wins ? left : right;
+      losers_[node] = left_wins ? right : left;
+    }
+    losers_[0] = winners[1];
+  }
+
+  [[nodiscard]] bool Empty() const { return Exhausted(losers_[0]); }
+
+  // Smallest remaining value, the tree must not be empty
+  const T &Top() const { return runs_[losers_[0]][positions_[losers_[0]]]; }
+
+  // Run the current Top() comes from
+  [[nodiscard]] size_t TopRun() const { return losers_[0]; }
+
+  void Pop() {
+    positions_[losers_[0]]++;
+    Replay(losers_[0]);
+  }
+
+  // Pop() for runs that arrive in blocks: Top() is the last value of its run's current span,
+  // the run goes on with next (empty when the run is over)
+  void PopAndRefill(std::span<const T> next) {
+    runs_[losers_[0]] = next;
+    positions_[losers_[0]] = 0;
+    Replay(losers_[0]);
+  }
+
+  // Write everything that is left to out, which must have room for it
+  T *MergeTo(T *out) {
+    for (; !Empty(); Pop()) {
+      *out++ = Top();
+    }
+    return out;
+  }
+
+ private:
+  // The winner's head changed: replay the matches on its path to the root
+  void Replay(size_t winner) {
+    for (size_t node = (leaves_ + winner) / 2; node > 0; node /= 2) {
+      if (Beats(losers_[node], winner)) {
+        std::swap(losers_[node], winner);
+      }
+    }
+    losers_[0] = winner;
+  }
+
+  [[nodiscard]] bool Exhausted(size_t run) const { return run >= runs_.size() || positions_[run] == runs_[run].size(); }
+
+  // Run a wins over run b when its head is smaller, ties go to the lower run index
+  [[nodiscard]] bool Beats(size_t a, size_t b) const {
+    if (Exhausted(a)) {
+      return false;
+    }
+    if (Exhausted(b)) {
+      return true;
+    }
+    const T &head_a = runs_[a][positions_[a]];
+    const T &head_b = runs_[b][positions_[b]];
+    if (comp_(head_a, head_b)) {
+      return true;
+    }
+    return !comp_(head_b, head_a) && a < b;
+  }
+
+  std::vector<std::span<const T>> runs_;
+  std::vector<size_t> positions_;
+  size_t leaves_;
+  std::vector<size_t> losers_;
+  Compare comp_;
+};
+
+// Co-rank of k sorted runs: split[i] elements of run i are the first rank elements of their
+// stable merge (ties ordered by run index). This is the k-way generalization of the merge
+// path split; it costs O(k^2 log^2 n) comparisons and does not depend on the output size.
+template <class T, class Compare = std::less<>>
+std::vector<size_t> MultiwayCoRank(std::span<const std::span<const T>> runs, size_t rank, const Compare &comp = {}) {
+  const size_t k = runs.size();
+  std::vector<size_t> split(k, 0);
+  size_t total = 0;
+  for (size_t i = 0; i < k; i++) {
+    split[i] = runs[i].size();
+    total += runs[i].size();
+  }
+  if (rank >= total) {
+    return split;
+  }
+
+  // Elements of run j ordered before value taken from run i (equal ones precede it when j < i)
+  auto before_in_run = [&](size_t j, size_t i, const T &value) {
+    const auto &run = runs[j];
+    const auto bound = j < i ? std::upper_bound(run.begin(), run.end(), value, comp)
+                             : std::lower_bound(run.begin(), run.end(), value, comp);
+    return static_cast<size_t>(bound - run.begin());
+  };
+  // Position of element p of run i in the merge
+  auto position_in_merge = [&](size_t i, size_t p) {
+    size_t before = p;
+    for (size_t j = 0; j < k; j++) {
+      if (j != i) {
+        before += before_in_run(j, i, runs[i][p]);
+      }
+    }
+    return before;
+  };
+
+  // Exactly one element sits at position rank, find its run and place
+  for (size_t i = 0; i < k; i++) {
+    size_t lo = 0;
+    size_t hi = runs[i].size();
+    while (lo < hi) {
+      const size_t mid = lo + ((hi - lo) / 2);
+      if (position_in_merge(i, mid) < rank) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    if (lo < runs[i].size() && position_in_merge(i, lo) == rank) {
+      for (size_t j = 0; j < k; j++) {
+        split[j] = j == i ? lo : before_in_run(j, i, runs[i][lo]);
+      }
+      return split;
+    }
+  }
+  return split;
+}
+
+// Stable merge of k sorted runs into out (sum of the run sizes) in one parallel pass. The
+// output is cut into num_parts equal pieces, MultiwayCoRank finds where every piece starts
+// in each run, and the pieces are merged independently: two-way merge for two runs, a
+// LoserTree for more. Unlike pairwise rounds, all parts work until the last element.
+template <class T, class Compare = std::less<>, class ForEach = ppc::util::SequentialForEach>
+void MultiwayMerge(std::span<const std::span<const T>> runs, std::span<T> out, size_t num_parts = 1,
+                   const Compare &comp = {}, const ForEach &for_each = {}) {
+  num_parts = std::clamp<size_t>(num_parts, 1, std::max<size_t>(out.size(), 1));
+  std::vector<std::vector<size_t>> splits(num_parts + 1, std::vector<size_t>(runs.size(), 0));
+  for_each(num_parts,
+           [&](size_t part) { splits[part + 1] = MultiwayCoRank(runs, out.size() * (part + 1) / num_parts, comp); });
+
+  for_each(num_parts, [&](size_t part) {
+    std::vector<std::span<const T>> pieces;
+    pieces.reserve(runs.size());
+    for (size_t i = 0; i < runs.size(); i++) {
+      const size_t begin = splits[part][i];
+      const size_t end = splits[part + 1][i];
+      if (end > begin) {
+        pieces.push_back(runs[i].subspan(begin, end - begin));
+      }
+    }
+    T *dst = out.data() + (out.size() * part / num_parts);
+    if (pieces.size() == 1) {
+      std::copy(pieces[0].begin(), pieces[0].end(), dst);
+    } else if (pieces.size() == 2) {
+      std::merge(pieces[0].begin(), pieces[0].end(), pieces[1].begin(), pieces[1].end(), dst, comp);
+    } else if (!pieces.empty()) {
+      LoserTree<T, Compare>(pieces, comp).MergeTo(dst);
+    }
+  });
+}
+
+}  // namespace ppc::core
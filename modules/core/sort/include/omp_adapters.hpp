@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ppc::core {
+
+// ForEach backend starting a new OpenMP team: body(i) for i in [0, count). Items are handed out
+// one at a time; items of equal cost can set dynamic to false to get one static block per thread.
+struct OmpForEach {
+  bool dynamic = true;
+
+  template <class Body>
+  void operator()(size_t count, const Body &body) const {
+    const int n = static_cast<int>(count);
+    if (dynamic) {
+#pragma omp parallel for schedule(dynamic)
+      for (int i = 0; i < n; i++) {
+        body(static_cast<size_t>(i));
+      }
+    } else {
+#pragma omp parallel for schedule(static)
+      for (int i = 0; i < n; i++) {
+        body(static_cast<size_t>(i));
+      }
+    }
+  }
+};
+
+// ForEach and Invoke backends for recursion that already runs inside one parallel region, e.g.
+// under omp single. Tasks need OpenMP 3.0 and taskloop 4.5; older runtimes (MSVC) run sequentially.
+struct OmpTaskForEach {
+  template <class Body>
+  void operator()(size_t count, const Body &body) const {
+#if defined(_OPENMP) && _OPENMP >= 201511
+#pragma omp taskloop default(none) shared(body, count) grainsize(1)
+    for (int i = 0; i < static_cast<int>(count); i++) {
+      body(static_cast<size_t>(i));
+    }
+#else
+    for (size_t i = 0; i < count; i++) {
+      body(i);
+    }
+#endif
+  }
+};
+
+struct OmpInvoke {
+  template <class F, class G>
+  void operator()(const F &left, const G &right) const {
+#if defined(_OPENMP) && _OPENMP >= 200805
+#pragma omp task default(none) shared(left)
+    left();
+    right();
+#pragma omp taskwait
+#else
+    left();
+    right();
+#endif
+  }
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,283 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "core/trace/include/trace.hpp"
+#include "core/util/include/for_each.hpp"
+
+namespace ppc::core {
+
+// Ranges up to this size finish with insertion sort
+constexpr size_t kQuickSortInsertionThreshold = 24;
+// Block of the branchless partition, offsets inside it fit in a byte
+constexpr size_t kQuickSortPartitionBlock = 64;
+// Ranges up to this size are sorted by one task without forking
+constexpr size_t kQuickSortTaskThreshold = size_t{1} << 14;
+// Ranges up to this size are partitioned by one task
+constexpr size_t kQuickSortParallelPartitionThreshold = size_t{1} << 17;
+// Evenly spaced samples whose median is the pivot of a parallel step
+constexpr size_t kQuickSortSamples = 63;
+
+// Invoke backend running both halves of a fork on the calling thread
+struct SequentialInvoke {
+  template <class F, class G>
+  void operator()(const F &f, const G &g) const {
+    f();
+    g();
+  }
+};
+
+namespace detail {
+
+template <class T, class Compare>
+void InsertionSort(T *first, T *last, const Compare &comp) {
+  if (first == last) {
+    return;
+  }
+  for (T *it = first + 1; it != last; ++it) {
+    T value = std::move(*it);
+    T *hole = it;
+    for (; hole != first && comp(value, *(hole - 1)); --hole) {
+      *hole = std::move(*(hole - 1));
+    }
+    *hole = std::move(value);
+  }
+}
+
+// Moves the values satisfying pred to the front and returns the end of them. BlockQuicksort
+// (Edelkamp and Weiss): a block from each end is scanned without branches, recording the
+// offsets of values on the wrong side, then the recorded pairs are swapped. Scanning does
+// not depend on the outcome of the comparisons, so random data causes no mispredictions.
+template <class T, class Pred>
+T *BlockPartition(T *first, T *last, const Pred &pred) {
+  constexpr size_t kBlock = kQuickSortPartitionBlock;
+  unsigned char offsets_left[kBlock];
+  unsigned char offsets_right[kBlock];
+  size_t num_left = 0;
+  size_t num_right = 0;
+  size_t start_left = 0;
+  size_t start_right = 0;
+  while (static_cast<size_t>(last - first) > 2 * kBlock) {
+    if (num_left == 0) {
+      start_left = 0;
+      for (size_t i = 0; i < kBlock; i++) {
+        offsets_left[num_left] = static_cast<unsigned char>(i);
+        num_left += pred(first[i]) ? 0 : 1;
+      }
+    }
+    if (num_right == 0) {
+      start_right = 0;
+      for (size_t i = 0; i < kBlock; i++) {
+        offsets_right[num_right] = static_cast<unsigned char>(i);
+        num_right += pred(*(last - 1 - i)) ? 1 : 0;
+      }
+    }
+    const size_t num = std::min(num_left, num_right);
+    for (size_t k = 0; k < num; k++) {
+      std::iter_swap(first + offsets_left[start_left + k], last - 1 - offsets_right[start_right + k]);
+    }
+    num_left -= num;
+    num_right -= num;
+    start_left += num;
+    start_right += num;
+    if (num_left == 0) {
+      first += kBlock;
+    }
+    if (num_right == 0) {
+      last -= kBlock;
+    }
+  }
+  // At most two blocks are left, one of them possibly half done: a plain partition finishes them
+  return std::partition(first, last, pred);
+}
+
+// Median of three values, Tukey's ninther for larger ranges
+template <class T, class Compare>
+T PivotOfRange(const T *first, const T *last, const Compare &comp) {
+  auto median = [&](const T &a, const T &b, const T &c) -> const T & {
+    if (comp(a, b)) {
+      return comp(b, c) ? b : (comp(a, c) ? c : a);
+    }
+    return comp(a, c) ? a : (comp(b, c) ? c : b);
+  };
+  const size_t n = last - first;
+  const T *mid = first + (n / 2);
+  if (n < 128) {
+    return median(*first, *mid, *(last - 1));
+  }
+  const size_t step = n / 8;
+  return median(median(first[0], first[step], first[2 * step]), median(mid[-step], *mid, mid[step]),
+                median(*(last - 1 - (2 * step)), *(last - 1 - step), *(last - 1)));
+}
+
+// Median of kQuickSortSamples values spread evenly over the range
+template <class T, class Compare>
+T SamplePivot(const T *first, size_t n, const Compare &comp) {
+  std::vector<T> samples;
+  samples.reserve(kQuickSortSamples);
+  for (size_t i = 0; i < kQuickSortSamples; i++) {
+    samples.push_back(first[(n * ((2 * i) + 1)) / (2 * kQuickSortSamples)]);
+  }
+  const auto middle = samples.begin() + (kQuickSortSamples / 2);
+  std::nth_element(samples.begin(), middle, samples.end(), comp);
+  return *middle;
+}
+
+// Sequential introsort: quicksort over BlockPartition with the smaller side recursed, heapsort
+// once depth runs out. When nothing is smaller than the pivot, the values equal to it are split
+// off instead and are done, so runs of duplicates cost one pass.
+template <class T, class Compare>
+void IntroSort(T *first, T *last, const Compare &comp, int depth) {
+  while (static_cast<size_t>(last - first) > kQuickSortInsertionThreshold) {
+    if (depth-- <= 0) {
+      std::make_heap(first, last, comp);
+      std::sort_heap(first, last, comp);
+      return;
+    }
+    const T pivot = PivotOfRange(first, last, comp);
+    T *mid = BlockPartition(first, last, [&](const T &value) { return comp(value, pivot); });
+    T *right = mid;
+    if (mid == first) {
+      right = BlockPartition(first, last, [&](const T &value) { return !comp(pivot, value); });
+    }
+    if (mid - first < last - right) {
+      IntroSort(first, mid, comp, depth);
+      first = right;
+    } else {
+      IntroSort(right, last, comp, depth);
+      last = mid;
+    }
+  }
+  InsertionSort(first, last, comp);
+}
+
+}  // namespace detail
+
+// In-place parallel partition: returns how many values satisfy pred, those values end up in
+// front. num_blocks contiguous blocks are partitioned independently, then the values on the
+// wrong side of the final split point are swapped pairwise, the swaps cut into equal parts.
+// Extra memory is O(num_blocks).
+template <class T, class Pred, class ForEach = ppc::util::SequentialForEach>
+size_t ParallelPartition(std::span<T> data, const Pred &pred, size_t num_blocks = 1, const ForEach &for_each = {}) {
+  const size_t n = data.size();
+  T *first = data.data();
+  num_blocks = std::clamp<size_t>(num_blocks, 1, std::max<size_t>(n / kQuickSortPartitionBlock, 1));
+  if (num_blocks == 1) {
+    return static_cast<size_t>(detail::BlockPartition(first, first + n, pred) - first);
+  }
+
+  auto block_begin = [&](size_t block) { return n * block / num_blocks; };
+  std::vector<size_t> mids(num_blocks);
+  {
+    PPC_TRACE_SCOPE("partition blocks");
+    for_each(num_blocks, [&](size_t block) {
+      T *begin = first + block_begin(block);
+      mids[block] = static_cast<size_t>(detail::BlockPartition(begin, first + block_begin(block + 1), pred) - first);
+    });
+  }
+  size_t split = 0;
+  for (size_t block = 0; block < num_blocks; block++) {
+    split += mids[block] - block_begin(block);
+  }
+
+  // Values failing pred left of split and values passing it right of split, as runs in block order.
+  // Both add up to the same count; the k-th of one kind is swapped with the k-th of the other.
+  std::vector<std::pair<size_t, size_t>> misplaced_right;
+  std::vector<std::pair<size_t, size_t>> misplaced_left;
+  for (size_t block = 0; block < num_blocks; block++) {
+    const size_t begin = block_begin(block);
+    const size_t end = block_begin(block + 1);
+    if (mids[block] < std::min(end, split)) {
+      misplaced_right.emplace_back(mids[block], std::min(end, split));
+    }
+    if (std::max(begin, split) < mids[block]) {
+      misplaced_left.emplace_back(std::max(begin, split), mids[block]);
+    }
+  }
+  auto prefix_of = [](const std::vector<std::pair<size_t, size_t>> &runs) {
+    std::vector<size_t> prefix(runs.size() + 1, 0);
+    for (size_t i = 0; i < runs.size(); i++) {
+      prefix[i + 1] = prefix[i] + runs[i].second - runs[i].first;
+    }
+    return prefix;
+  };
+  const auto prefix_right = prefix_of(misplaced_right);
+  const auto prefix_left = prefix_of(misplaced_left);
+  const size_t total = prefix_right.back();
+  if (total == 0) {
+    return split;
+  }
+
+  // Run index and position of the k-th misplaced value
+  auto locate = [](const std::vector<std::pair<size_t, size_t>> &runs, const std::vector<size_t> &prefix, size_t k) {
+    const auto run = static_cast<size_t>(std::upper_bound(prefix.begin(), prefix.end(), k) - prefix.begin() - 1);
+    return std::make_pair(run, runs[run].first + (k - prefix[run]));
+  };
+  const size_t num_parts = std::min(num_blocks, total);
+  PPC_TRACE_SCOPE("partition swap");
+  for_each(num_parts, [&](size_t part) {
+    const size_t begin = total * part / num_parts;
+    const size_t end = total * (part + 1) / num_parts;
+    auto [run_r, pos_r] = locate(misplaced_right, prefix_right, begin);
+    auto [run_l, pos_l] = locate(misplaced_left, prefix_left, begin);
+    for (size_t k = begin; k < end; k++) {
+      std::iter_swap(first + pos_r, first + pos_l);
+      if (++pos_r == misplaced_right[run_r].second && k + 1 < end) {
+        pos_r = misplaced_right[++run_r].first;
+      }
+      if (++pos_l == misplaced_left[run_l].second && k + 1 < end) {
+        pos_l = misplaced_left[++run_l].first;
+      }
+    }
+  });
+  return split;
+}
+
+namespace detail {
+
+template <class T, class Compare, class Invoke, class ForEach>
+void ParallelQuickSortRange(std::span<T> data, size_t num_blocks, int depth, const Compare &comp, const Invoke &invoke,
+                            const ForEach &for_each) {
+  const size_t n = data.size();
+  if (n <= kQuickSortTaskThreshold || depth <= 0) {
+    IntroSort(data.data(), data.data() + n, comp, depth);
+    return;
+  }
+
+  const T pivot = SamplePivot(data.data(), n, comp);
+  const size_t blocks = n > kQuickSortParallelPartitionThreshold ? num_blocks : 1;
+  const size_t mid = ParallelPartition(data, [&](const T &value) { return comp(value, pivot); }, blocks, for_each);
+  size_t right = mid;
+  if (mid == 0) {
+    right = ParallelPartition(data, [&](const T &value) { return !comp(pivot, value); }, blocks, for_each);
+  }
+
+  // Both sides run at the same time, so each gets the share of the blocks its size asks for
+  const size_t left_blocks = std::max<size_t>(num_blocks * mid / n, 1);
+  const size_t right_blocks = std::max<size_t>(num_blocks * (n - right) / n, 1);
+  invoke([&] { ParallelQuickSortRange(data.first(mid), left_blocks, depth - 1, comp, invoke, for_each); },
+         [&] { ParallelQuickSortRange(data.subspan(right), right_blocks, depth - 1, comp, invoke, for_each); });
+}
+
+}  // namespace detail
+
+// In-place parallel quicksort. Large ranges take the median of kQuickSortSamples samples as
+// pivot, are split by ParallelPartition over num_blocks blocks and fork both sides through
+// invoke(f, g); ranges below kQuickSortTaskThreshold run the sequential introsort. Depth is
+// limited to 2 log2(n) levels, past it a range is heapsorted, so adversarial inputs stay
+// O(n log n). With the default backends this is a sequential introsort.
+template <class T, class Compare = std::less<>, class Invoke = SequentialInvoke,
+          class ForEach = ppc::util::SequentialForEach>
+void ParallelQuickSort(std::span<T> data, size_t num_blocks = 1, const Compare &comp = {}, const Invoke &invoke = {},
+                       const ForEach &for_each = {}) {
+  const int depth = 2 * static_cast<int>(std::bit_width(data.size()));
+  detail::ParallelQuickSortRange(data, std::max<size_t>(num_blocks, 1), depth, comp, invoke, for_each);
+}
+
+}  // namespace ppc::core
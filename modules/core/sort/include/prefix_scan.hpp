@@ -0,0 +1,58 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "core/util/include/for_each.hpp"
+
+namespace ppc::core {
+
+// In-place exclusive prefix sum, returns the total. The range is cut into num_blocks blocks:
+// block sums are computed in parallel, scanned sequentially (num_blocks values), and every
+// block is then scanned from its offset in parallel. for_each follows the RadixSort backend
+// concept for_each(count, body(i)).
+template <class T, class ForEach = ppc::util::SequentialForEach>
+T ExclusiveScan(std::span<T> values, size_t num_blocks = 1, const ForEach &for_each = {}) {
+  num_blocks = std::clamp<size_t>(num_blocks, 1, std::max<size_t>(values.size(), 1));
+  const size_t block_size = (values.size() + num_blocks - 1) / num_blocks;
+  auto block_range = [&](size_t block) {
+    const size_t begin = std::min(block * block_size, values.size());
+    return values.subspan(begin, std::min(block_size, values.size() - begin));
+  };
+
+  std::vector<T> offsets(num_blocks, T{});
+  if (num_blocks > 1) {
+    for_each(num_blocks, [&](size_t block) {
+      T sum{};
+      for (const T &value : block_range(block)) {
+        sum += value;
+      }
+      offsets[block] = sum;
+    });
+  }
+  T total{};
+  for (T &offset : offsets) {
+    const T sum = offset;
+    offset = total;
+    total += sum;
+  }
+
+  auto scan_block = [&](size_t block) {
+    T running = offsets[block];
+    for (T &value : block_range(block)) {
+      const T current = value;
+      value = running;
+      running += current;
+    }
+    return running;
+  };
+  if (num_blocks == 1) {
+    return scan_block(0);
+  }
+  for_each(num_blocks, scan_block);
+  return total;
+}
+
+}  // namespace ppc::core
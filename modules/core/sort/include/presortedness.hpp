@@ -0,0 +1,276 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "core/sort/include/multiway_merge.hpp"
+#include "core/trace/include/trace.hpp"
+#include "core/util/include/for_each.hpp"
+
+namespace ppc::core {
+
+// Elements per task of the scans, the reversal and the copies
+constexpr size_t kPresortChunk = size_t{1} << 16;
+// Runs merged at once by MergeNaturalRuns, more take several rounds
+constexpr size_t kPresortMergeFanIn = 16;
+// Natural runs are merged instead of sorting the data when they are this long on average
+constexpr size_t kPresortMinRunLength = 32;
+
+// What AdaptiveSort did with its input
+enum class PresortPath : uint8_t {
+  kSorted,    // already in order, left as it is
+  kReversed,  // in reverse order, reversed
+  kRunMerge,  // few natural runs, merged
+  kFullSort,  // handed to the full sort
+};
+
+inline const char *PresortPathName(PresortPath path) {
+  switch (path) {
+    case PresortPath::kSorted:
+      return "sorted";
+    case PresortPath::kReversed:
+      return "reversed";
+    case PresortPath::kRunMerge:
+      return "run merge";
+    case PresortPath::kFullSort:
+      return "full sort";
+  }
+  return "unknown";
+}
+
+// Order statistics of the adjacent pairs of a range. Descents are the adjacent inversions
+// (data[i + 1] < data[i]), ascents the strict rises, the remaining pairs are equal.
+struct PresortStats {
+  size_t size = 0;
+  size_t descents = 0;
+  size_t ascents = 0;
+  // Maximal non-decreasing runs, descents + 1 for non-empty data
+  size_t runs = 0;
+  PresortPath path = PresortPath::kFullSort;
+};
+
+namespace detail {
+
+inline size_t PresortChunks(size_t count) { return (count + kPresortChunk - 1) / kPresortChunk; }
+
+inline PresortPath ClassifyPresort(const PresortStats &stats) {
+  if (stats.descents == 0) {
+    return PresortPath::kSorted;
+  }
+  if (stats.ascents == 0) {
+    return PresortPath::kReversed;
+  }
+  if (stats.runs <= std::max(kPresortMergeFanIn, stats.size / kPresortMinRunLength)) {
+    return PresortPath::kRunMerge;
+  }
+  return PresortPath::kFullSort;
+}
+
+template <class T, class ForEach>
+void ParallelCopy(std::span<const T> from, std::span<T> to, const ForEach &for_each) {
+  for_each(PresortChunks(from.size()), [&](size_t chunk) {
+    const size_t begin = chunk * kPresortChunk;
+    const size_t end = std::min(from.size(), begin + kPresortChunk);
+    std::copy(from.begin() + static_cast<std::ptrdiff_t>(begin), from.begin() + static_cast<std::ptrdiff_t>(end),
+              to.begin() + static_cast<std::ptrdiff_t>(begin));
+  });
+}
+
+}  // namespace detail
+
+// Counts descents and ascents of data in kPresortChunk pieces, one task each, and picks the
+// path AdaptiveSort takes. One read of the data, no writes.
+template <class T, class Compare = std::less<>, class ForEach = ppc::util::SequentialForEach>
+PresortStats MeasurePresortedness(std::span<const T> data, const Compare &comp = {}, const ForEach &for_each = {}) {
+  PresortStats stats{.size = data.size()};
+  if (data.size() < 2) {
+    stats.runs = data.size();
+    stats.path = PresortPath::kSorted;
+    return stats;
+  }
+  // Pair i compares data[i] and data[i + 1]
+  const size_t pairs = data.size() - 1;
+  const size_t chunks = detail::PresortChunks(pairs);
+  std::vector<std::pair<size_t, size_t>> counts(chunks);
+  for_each(chunks, [&](size_t chunk) {
+    const size_t end = std::min(pairs, (chunk + 1) * kPresortChunk);
+    size_t descents = 0;
+    size_t ascents = 0;
+    for (size_t i = chunk * kPresortChunk; i < end; i++) {
+      descents += comp(data[i + 1], data[i]) ? 1 : 0;
+      ascents += comp(data[i], data[i + 1]) ? 1 : 0;
+    }
+    counts[chunk] = {descents, ascents};
+  });
+  for (const auto &[descents, ascents] : counts) {
+    stats.descents += descents;
+    stats.ascents += ascents;
+  }
+  stats.runs = stats.descents + 1;
+  stats.path = detail::ClassifyPresort(stats);
+  return stats;
+}
+
+// Starts of the maximal non-decreasing runs of data followed by data.size(): run r is
+// [bounds[r], bounds[r + 1]). Empty data has bounds {0, 0}.
+template <class T, class Compare = std::less<>, class ForEach = ppc::util::SequentialForEach>
+std::vector<size_t> NaturalRunBounds(std::span<const T> data, const Compare &comp = {}, const ForEach &for_each = {}) {
+  std::vector<size_t> bounds = {0};
+  if (data.size() < 2) {
+    bounds.push_back(data.size());
+    return bounds;
+  }
+  const size_t pairs = data.size() - 1;
+  std::vector<std::vector<size_t>> starts(detail::PresortChunks(pairs));
+  for_each(starts.size(), [&](size_t chunk) {
+    const size_t end = std::min(pairs, (chunk + 1) * kPresortChunk);
+    for (size_t i = chunk * kPresortChunk; i < end; i++) {
+      if (comp(data[i + 1], data[i])) {
+        starts[chunk].push_back(i + 1);
+      }
+    }
+  });
+  for (const auto &chunk_starts : starts) {
+    bounds.insert(bounds.end(), chunk_starts.begin(), chunk_starts.end());
+  }
+  bounds.push_back(data.size());
+  return bounds;
+}
+
+// Reverses non-increasing data into non-decreasing order. Equal values would come out in
+// reverse order, so every block of them is turned back: the result is what a stable sort gives.
+template <class T, class Compare = std::less<>, class ForEach = ppc::util::SequentialForEach>
+void ReverseDescending(std::span<T> data, const Compare &comp = {}, const ForEach &for_each = {}) {
+  const size_t n = data.size();
+  for_each(detail::PresortChunks(n / 2), [&](size_t chunk) {
+    const size_t end = std::min(n / 2, (chunk + 1) * kPresortChunk);
+    for (size_t i = chunk * kPresortChunk; i < end; i++) {
+      std::swap(data[i], data[n - 1 - i]);
+    }
+  });
+  // Every chunk turns the blocks starting in it, including their tail in later chunks. The
+  // first block start at or after every chunk begin is found before anything moves.
+  const size_t chunks = detail::PresortChunks(n);
+  std::vector<size_t> firsts(chunks + 1, n);
+  for_each(chunks, [&](size_t chunk) {
+    const size_t end = std::min(n, (chunk + 1) * kPresortChunk);
+    size_t begin = chunk * kPresortChunk;
+    while (begin > 0 && begin < end && !comp(data[begin - 1], data[begin])) {
+      begin++;
+    }
+    firsts[chunk] = begin;
+  });
+  for (size_t chunk = chunks; chunk-- > 0;) {
+    if (firsts[chunk] == std::min(n, (chunk + 1) * kPresortChunk)) {
+      firsts[chunk] = firsts[chunk + 1];
+    }
+  }
+  for_each(chunks, [&](size_t chunk) {
+    const size_t end = std::min(n, (chunk + 1) * kPresortChunk);
+    const size_t limit = firsts[chunk + 1];
+    size_t begin = firsts[chunk];
+    while (begin < end) {
+      size_t block_end = begin + 1;
+      while (block_end < limit && !comp(data[block_end - 1], data[block_end])) {
+        block_end++;
+      }
+      std::reverse(data.begin() + static_cast<std::ptrdiff_t>(begin),
+                   data.begin() + static_cast<std::ptrdiff_t>(block_end));
+      begin = block_end;
+    }
+  });
+}
+
+// Stable merge of the sorted runs of data given by bounds (as NaturalRunBounds returns them),
+// TimSort style but k-way: every round merges groups of kPresortMergeFanIn neighbouring runs
+// with MultiwayMerge. Rounds of at least num_parts groups run the groups as tasks, smaller ones
+// merge group after group over num_parts parts, so the backend is never entered twice.
+template <class T, class Compare = std::less<>, class ForEach = ppc::util::SequentialForEach>
+void MergeNaturalRuns(std::span<T> data, std::vector<size_t> bounds, size_t num_parts = 1, const Compare &comp = {},
+                      const ForEach &for_each = {}) {
+  if (bounds.size() <= 2) {
+    return;
+  }
+  const size_t n = data.size();
+  std::vector<T> scratch(n);
+  std::span<T> from = data;
+  std::span<T> to(scratch);
+  while (bounds.size() > 2) {
+    const size_t num_runs = bounds.size() - 1;
+    const size_t groups = (num_runs + kPresortMergeFanIn - 1) / kPresortMergeFanIn;
+    auto merge_group = [&](size_t group, size_t parts, const auto &group_for_each) {
+      const size_t first = group * kPresortMergeFanIn;
+      const size_t last = std::min(num_runs, first + kPresortMergeFanIn);
+      std::vector<std::span<const T>> runs;
+      runs.reserve(last - first);
+      for (size_t run = first; run < last; run++) {
+        runs.emplace_back(from.data() + bounds[run], bounds[run + 1] - bounds[run]);
+      }
+      MultiwayMerge<T>(runs, to.subspan(bounds[first], bounds[last] - bounds[first]), parts, comp, group_for_each);
+    };
+    if (groups >= num_parts) {
+      for_each(groups, [&](size_t group) { merge_group(group, 1, ppc::util::SequentialForEach{}); });
+    } else {
+      for (size_t group = 0; group < groups; group++) {
+        merge_group(group, num_parts, for_each);
+      }
+    }
+    std::vector<size_t> next;
+    next.reserve(groups + 1);
+    for (size_t group = 0; group < groups; group++) {
+      next.push_back(bounds[group * kPresortMergeFanIn]);
+    }
+    next.push_back(n);
+    bounds = std::move(next);
+    std::swap(from, to);
+  }
+  if (from.data() != data.data()) {
+    detail::ParallelCopy(std::span<const T>(from), data, for_each);
+  }
+}
+
+// Finishes data along the fast path stats picked (stats from MeasurePresortedness of the same
+// data) and returns true, or returns false untouched when the path is kFullSort
+template <class T, class Compare = std::less<>, class ForEach = ppc::util::SequentialForEach>
+bool SortPresorted(std::span<T> data, const PresortStats &stats, size_t num_parts = 1, const Compare &comp = {},
+                   const ForEach &for_each = {}) {
+  PPC_TRACE_SCOPE_DETAIL("presort path", PresortPathName(stats.path));
+  switch (stats.path) {
+    case PresortPath::kSorted:
+      return true;
+    case PresortPath::kReversed:
+      ReverseDescending(data, comp, for_each);
+      return true;
+    case PresortPath::kRunMerge:
+      MergeNaturalRuns(data, NaturalRunBounds(std::span<const T>(data), comp, for_each), num_parts, comp, for_each);
+      return true;
+    case PresortPath::kFullSort:
+      return false;
+  }
+  return false;
+}
+
+// Sorts data with a pre-pass that measures how ordered it already is (MeasurePresortedness):
+// sorted data is left alone, reversed data is reversed, data of few natural runs is merged by
+// MergeNaturalRuns, and everything else goes to full_sort(std::span<T>). The returned stats
+// tell which path ran. Stable when full_sort is.
+template <class T, class FullSort, class Compare = std::less<>, class ForEach = ppc::util::SequentialForEach>
+PresortStats AdaptiveSort(std::span<T> data, const FullSort &full_sort, size_t num_parts = 1, const Compare &comp = {},
+                          const ForEach &for_each = {}) {
+  PresortStats stats;
+  {
+    PPC_TRACE_SCOPE("presort measure");
+    stats = MeasurePresortedness(std::span<const T>(data), comp, for_each);
+  }
+  if (!SortPresorted(data, stats, num_parts, comp, for_each)) {
+    full_sort(data);
+  }
+  return stats;
+}
+
+}  // namespace ppc::core
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define PPC_RADIX_STREAMING_STORES 1
+#else
+#define PPC_RADIX_STREAMING_STORES 0
+#endif
+
+#include "core/sort/include/prefix_scan.hpp"
+#include "core/sort/include/radix_sort.hpp"
+#include "core/trace/include/trace.hpp"
+#include "core/util/include/for_each.hpp"
+
+namespace ppc::core {
+
+constexpr size_t kCacheLineBytes = 64;
+// Destinations larger than this do not stay in the last-level cache anyway, full buffered
+// lines are written around the cache there
+constexpr size_t kRadixStreamingThresholdBytes = size_t{16} << 20;
+
+namespace detail {
+
+// Copy one cache line to a line-aligned destination
+inline void WriteLine(void *dst, const void *src, bool streaming) {
+#if PPC_RADIX_STREAMING_STORES
+  if (streaming) {
+    auto *out = static_cast<__m128i *>(dst);
+    const auto *in = static_cast<const __m128i *>(src);
+    for (size_t i = 0; i < kCacheLineBytes / sizeof(__m128i); i++) {
+      _mm_stream_si128(out + i, _mm_load_si128(in + i));
+    }
+    return;
+  }
+#endif
+  std::memcpy(dst, src, kCacheLineBytes);
+}
+
+inline void StreamingStoreFence() {
+#if PPC_RADIX_STREAMING_STORES
+  _mm_sfence();
+#endif
+}
+
+}  // namespace detail
+
+// Stable parallel counting scatter of src into dst by bucket(value) in [0, num_buckets).
+//
+// src is cut into num_chunks contiguous chunks (one per thread is the intended use). A
+// chunk x bucket histogram is built in parallel and turned into destinations by one
+// ExclusiveScan over its bucket-major layout, so no thread walks the counts of the others.
+// Each chunk then collects values in a cache-line buffer per bucket (num_buckets lines,
+// 16 KiB for 256 buckets) and writes whole aligned lines at once, with streaming stores
+// for destinations beyond the last-level cache. A scattered store per element becomes one
+// line write per 64 bytes, which keeps the TLB and write-combining buffers from thrashing.
+template <class T, class BucketFn, class ForEach = ppc::util::SequentialForEach>
+void ParallelRadixScatter(std::span<const T> src, std::span<T> dst, size_t num_buckets, const BucketFn &bucket,
+                          size_t num_chunks, const ForEach &for_each = {}) {
+  static_assert(std::is_trivially_copyable_v<T>, "values are moved with plain copies");
+  static_assert(kCacheLineBytes % sizeof(T) == 0 && std::has_single_bit(sizeof(T)), "T must tile a cache line");
+  constexpr size_t kLineElems = kCacheLineBytes / sizeof(T);
+  constexpr size_t kLineMask = kLineElems - 1;
+
+  const size_t n = src.size();
+  num_chunks = std::clamp<size_t>(num_chunks, 1, std::max<size_t>(n, 1));
+  const size_t chunk_size = (n + num_chunks - 1) / num_chunks;
+  auto chunk_range = [&](size_t chunk) {
+    const size_t begin = std::min(chunk * chunk_size, n);
+    return std::pair(begin, std::min(begin + chunk_size, n));
+  };
+
+  // offsets[bucket * num_chunks + chunk]: the scan runs over buckets first, then chunks
+  std::vector<size_t> offsets(num_buckets * num_chunks, 0);
+  {
+    PPC_TRACE_SCOPE("count");
+    for_each(num_chunks, [&](size_t chunk) {
+      std::vector<size_t> counts(num_buckets, 0);
+      const auto [begin, end] = chunk_range(chunk);
+      for (size_t i = begin; i < end; i++) {
+        counts[bucket(src[i])]++;
+      }
+      for (size_t b = 0; b < num_buckets; b++) {
+        offsets[(b * num_chunks) + chunk] = counts[b];
+      }
+    });
+  }
+  {
+    PPC_TRACE_SCOPE("scan");
+    ExclusiveScan(std::span<size_t>(offsets), num_chunks, for_each);
+  }
+
+  PPC_TRACE_SCOPE("scatter");
+  const bool streaming = n * sizeof(T) >= kRadixStreamingThresholdBytes;
+  // Position p of dst starts a cache line when (p + phase) % kLineElems == 0
+  const size_t phase = (reinterpret_cast<uintptr_t>(dst.data()) / sizeof(T)) & kLineMask;
+
+  for_each(num_chunks, [&](size_t chunk) {
+    struct alignas(kCacheLineBytes) Line {
+      T values[kLineElems];
+    };
+    std::vector<Line> lines(num_buckets);
+    std::vector<size_t> first(num_buckets);
+    std::vector<size_t> next(num_buckets);
+    for (size_t b = 0; b < num_buckets; b++) {
+      first[b] = next[b] = offsets[(b * num_chunks) + chunk];
+    }
+
+    const auto [begin, end] = chunk_range(chunk);
+    for (size_t i = begin; i < end; i++) {
+      const T value = src[i];
+      const size_t b = bucket(value);
+      const size_t pos = next[b]++;
+      const size_t slot = (pos + phase) & kLineMask;
+      lines[b].values[slot] = value;
+      if (slot == kLineMask) {
+        if (pos - first[b] >= kLineMask) {
+          detail::WriteLine(dst.data() + (pos - kLineMask), lines[b].values, streaming);
+        } else {
+          // Head of the range shares its line with the previous bucket or chunk
+          const size_t head = pos - first[b] + 1;
+          std::copy_n(&lines[b].values[kLineElems - head], head, dst.data() + first[b]);
+        }
+      }
+    }
+    for (size_t b = 0; b < num_buckets; b++) {
+      const size_t slot = (next[b] + phase) & kLineMask;
+      const size_t filled = std::min(slot, next[b] - first[b]);
+      std::copy_n(&lines[b].values[slot - filled], filled, dst.data() + (next[b] - filled));
+    }
+    detail::StreamingStoreFence();
+  });
+}
+
+}  // namespace ppc::core
@@ -0,0 +1,223 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "core/util/include/for_each.hpp"
+
+namespace ppc::core {
+
+// Unsigned key whose unsigned order is the order of the value, and the value back from it
+template <class T>
+struct RadixTraits;
+
+template <>
+struct RadixTraits<uint32_t> {
+  using Key = uint32_t;
+  static Key ToKey(uint32_t value) { return value; }
+  static uint32_t FromKey(Key key) { return key; }
+};
+
+template <>
+struct RadixTraits<uint64_t> {
+  using Key = uint64_t;
+  static Key ToKey(uint64_t value) { return value; }
+  static uint64_t FromKey(Key key) { return key; }
+};
+
+template <>
+struct RadixTraits<int32_t> {
+  using Key = uint32_t;
+  static Key ToKey(int32_t value) { return static_cast<uint32_t>(value) ^ 0x80000000U; }
+  static int32_t FromKey(Key key) { return static_cast<int32_t>(key ^ 0x80000000U); }
+};
+
+template <>
+struct RadixTraits<int64_t> {
+  using Key = uint64_t;
+  static Key ToKey(int64_t value) { return static_cast<uint64_t>(value) ^ 0x8000000000000000ULL; }
+  static int64_t FromKey(Key key) { return static_cast<int64_t>(key ^ 0x8000000000000000ULL); }
+};
+
+// IEEE values: negative numbers have every bit flipped, positive ones only the sign bit.
+// -0.0 sorts before +0.0, NaNs with the sign bit set go first and the others last.
+template <>
+struct RadixTraits<float> {
+  using Key = uint32_t;
+  static Key ToKey(float value) {
+    const auto bits = std::bit_cast<uint32_t>(value);
+    return bits ^ ((0U - (bits >> 31)) | 0x80000000U);
+  }
+  // Keys with the top bit clear came from negative values and get every bit back
+  static float FromKey(Key key) { return std::bit_cast<float>(key ^ (((key >> 31) - 1U) | 0x80000000U)); }
+};
+
+template <>
+struct RadixTraits<double> {
+  using Key = uint64_t;
+  static Key ToKey(double value) {
+    const auto bits = std::bit_cast<uint64_t>(value);
+    return bits ^ ((0ULL - (bits >> 63)) | 0x8000000000000000ULL);
+  }
+  static double FromKey(Key key) {
+    return std::bit_cast<double>(key ^ (((key >> 63) - 1ULL) | 0x8000000000000000ULL));
+  }
+};
+
+// 11-bit digits: three passes for 32-bit keys, and 2048 counters still fit into L1
+constexpr int kRadixBits = 11;
+constexpr size_t kRadixBuckets = size_t{1} << kRadixBits;
+// Ranges up to this size are insertion sorted
+constexpr size_t kRadixInsertionSortThreshold = 64;
+// Below this size clearing the histograms costs more than a comparison sort
+constexpr size_t kRadixSmallSortThreshold = 1024;
+// Ranges larger than this (about the L2 cache) are split by their top digit first (MSD), so
+// the remaining LSD passes of every bucket run in cache
+constexpr size_t kRadixMsdThresholdBytes = size_t{1} << 20;
+
+namespace detail {
+
+template <class T>
+constexpr int kRadixDigits = static_cast<int>((sizeof(typename RadixTraits<T>::Key) * 8 + kRadixBits - 1) / kRadixBits);
+
+template <class T>
+size_t RadixDigit(T value, int digit) {
+  return static_cast<size_t>(RadixTraits<T>::ToKey(value) >> (digit * kRadixBits)) & (kRadixBuckets - 1);
+}
+
+template <class T>
+bool RadixLess(T a, T b) {
+  return RadixTraits<T>::ToKey(a) < RadixTraits<T>::ToKey(b);
+}
+
+template <class T>
+void InsertionSortByKey(T *data, size_t n) {
+  for (size_t i = 1; i < n; i++) {
+    const T value = data[i];
+    const auto key = RadixTraits<T>::ToKey(value);
+    size_t j = i;
+    for (; j > 0 && key < RadixTraits<T>::ToKey(data[j - 1]); j--) {
+      data[j] = data[j - 1];
+    }
+    data[j] = value;
+  }
+}
+
+// Sort [src, src + n) and leave the result in result, which is src or other
+template <class T>
+void SmallSort(T *src, T *other, size_t n, T *result) {
+  if (n <= kRadixInsertionSortThreshold) {
+    InsertionSortByKey(src, n);
+  } else {
+    std::sort(src, src + n, RadixLess<T>);
+  }
+  if (result != src) {
+    std::copy(src, src + n, other);
+  }
+}
+
+// LSD over the low num_digits digits. All histograms come from a single read of the input,
+// and digits where every key falls into one bucket are skipped without moving data.
+template <class T>
+void LsdSort(T *src, T *other, size_t n, int num_digits, T *result) {
+  std::vector<size_t> histograms(static_cast<size_t>(num_digits) * kRadixBuckets, 0);
+  for (size_t i = 0; i < n; i++) {
+    const auto key = RadixTraits<T>::ToKey(src[i]);
+    for (int digit = 0; digit < num_digits; digit++) {
+      histograms[(digit * kRadixBuckets) + (static_cast<size_t>(key >> (digit * kRadixBits)) & (kRadixBuckets - 1))]++;
+    }
+  }
+
+  T *from = src;
+  T *to = other;
+  for (int digit = 0; digit < num_digits; digit++) {
+    size_t *offsets = &histograms[digit * kRadixBuckets];
+    if (offsets[RadixDigit(from[0], digit)] == n) {
+      continue;
+    }
+    size_t sum = 0;
+    for (size_t bucket = 0; bucket < kRadixBuckets; bucket++) {
+      const size_t count = offsets[bucket];
+      offsets[bucket] = sum;
+      sum += count;
+    }
+    for (size_t i = 0; i < n; i++) {
+      to[offsets[RadixDigit(from[i], digit)]++] = from[i];
+    }
+    std::swap(from, to);
+  }
+  if (from != result) {
+    std::copy(from, from + n, result);
+  }
+}
+
+template <class T, class ForEach>
+void MsdSort(T *src, T *other, size_t n, int num_digits, T *result, const ForEach &for_each) {
+  if (n <= kRadixSmallSortThreshold) {
+    SmallSort(src, other, n, result);
+    return;
+  }
+  if (num_digits <= 1 || n * sizeof(T) < kRadixMsdThresholdBytes) {
+    LsdSort(src, other, n, num_digits, result);
+    return;
+  }
+
+  const int digit = num_digits - 1;
+  std::vector<size_t> offsets(kRadixBuckets + 1, 0);
+  for (size_t i = 0; i < n; i++) {
+    offsets[RadixDigit(src[i], digit) + 1]++;
+  }
+  if (offsets[RadixDigit(src[0], digit) + 1] == n) {
+    MsdSort(src, other, n, digit, result, for_each);
+    return;
+  }
+  for (size_t bucket = 1; bucket <= kRadixBuckets; bucket++) {
+    offsets[bucket] += offsets[bucket - 1];
+  }
+  std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+  for (size_t i = 0; i < n; i++) {
+    other[next[RadixDigit(src[i], digit)]++] = src[i];
+  }
+
+  // Buckets are independent: they are sorted in parallel and stay in cache while sorted
+  T *bucket_result = result == src ? src : other;
+  for_each(kRadixBuckets, [&](size_t bucket) {
+    const size_t begin = offsets[bucket];
+    const size_t size = offsets[bucket + 1] - begin;
+    if (size > 0) {
+      MsdSort(other + begin, src + begin, size, digit, bucket_result + begin, for_each);
+    }
+  });
+}
+
+}  // namespace detail
+
+// Sort int32/int64/uint32/uint64/float/double values in ascending order of their keys.
+// scratch must have at least data.size() elements.
+template <class T, class ForEach = ppc::util::SequentialForEach>
+void RadixSort(std::span<T> data, std::span<T> scratch, const ForEach &for_each = {}) {
+  static_assert(std::is_trivially_copyable_v<T>, "RadixSort moves values with plain copies");
+  if (data.size() < 2) {
+    return;
+  }
+  detail::MsdSort(data.data(), scratch.data(), data.size(), detail::kRadixDigits<T>, data.data(), for_each);
+}
+
+// Same with a scratch buffer owned by the call
+template <class T, class ForEach = ppc::util::SequentialForEach>
+void RadixSort(std::span<T> data, const ForEach &for_each = {}) {
+  if (data.size() < 2) {
+    return;
+  }
+  // Uninitialized: every element is written before it is read
+  auto scratch = std::make_unique_for_overwrite<T[]>(data.size());
+  RadixSort(data, std::span<T>(scratch.get(), data.size()), for_each);
+}
+
+}  // namespace ppc::core
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace ppc::core {
+
+// Regular samples taken from every sorted piece: more than one per bucket keeps the buckets
+// within a few percent of each other on random data at little extra exchange
+constexpr size_t kSampleSortMinSamples = 32;
+
+// Samples taken from each of num_buckets sorted pieces
+inline size_t SampleSortSamplesPerPiece(size_t num_buckets) { return std::max(kSampleSortMinSamples, num_buckets); }
+
+// count values at evenly spaced positions of a sorted range, fewer when the range is shorter
+template <class T>
+std::vector<T> RegularSamples(std::span<const T> sorted, size_t count) {
+  const size_t n = sorted.size();
+  count = std::min(count, n);
+  std::vector<T> samples;
+  samples.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    samples.push_back(sorted[(n * ((2 * i) + 1)) / (2 * count)]);
+  }
+  return samples;
+}
+
+// Values below value are left of the splitter and values above it right. Of the values equal
+// to it, the fraction equal_left / equal_total goes left: the share of the equal samples
+// ranked below the splitter. So a heavily duplicated value spreads over several buckets in
+// proportion instead of landing in one.
+template <class T>
+struct SampleSplitter {
+  T value;
+  size_t equal_left;
+  size_t equal_total;
+};
+
+// num_buckets - 1 splitters at evenly spaced ranks of the samples, none when there are no samples.
+// The samples are sorted in place.
+template <class T, class Compare = std::less<>>
+std::vector<SampleSplitter<T>> SelectSplitters(std::vector<T> &samples, size_t num_buckets, const Compare &comp = {}) {
+  std::vector<SampleSplitter<T>> splitters;
+  if (samples.empty() || num_buckets <= 1) {
+    return splitters;
+  }
+  std::sort(samples.begin(), samples.end(), comp);
+  splitters.reserve(num_buckets - 1);
+  for (size_t bucket = 1; bucket < num_buckets; bucket++) {
+    const size_t rank = samples.size() * bucket / num_buckets;
+    const auto [lo, hi] = std::equal_range(samples.begin(), samples.end(), samples[rank], comp);
+    splitters.push_back(
+        {.value = samples[rank], .equal_left = rank - static_cast<size_t>(lo - samples.begin()),
+         .equal_total = static_cast<size_t>(hi - lo)});
+  }
+  return splitters;
+}
+
+// Bucket b of a sorted range is [bounds[b], bounds[b + 1]), for splitters.size() + 1 buckets.
+// Without splitters everything goes to bucket 0.
+template <class T, class Compare = std::less<>>
+std::vector<size_t> BucketBounds(std::span<const T> sorted, std::span<const SampleSplitter<T>> splitters,
+                                 const Compare &comp = {}) {
+  std::vector<size_t> bounds = {0};
+  bounds.reserve(splitters.size() + 2);
+  for (const auto &splitter : splitters) {
+    const auto [lo, hi] = std::equal_range(sorted.begin(), sorted.end(), splitter.value, comp);
+    const auto equal = static_cast<size_t>(hi - lo);
+    bounds.push_back(static_cast<size_t>(lo - sorted.begin()) + (equal * splitter.equal_left / splitter.equal_total));
+  }
+  bounds.push_back(sorted.size());
+  return bounds;
+}
+
+}  // namespace ppc::core
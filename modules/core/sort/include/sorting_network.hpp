@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// The AVX2 and AVX-512 kernels are built with per-function target attributes, so the rest
+// of the library stays baseline x86-64 and ppc::util::ActiveSimdLevel() picks the kernels at run time
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define PPC_SORTING_NETWORK_X86 1
+#endif
+
+namespace ppc::core {
+
+// Largest block NetworkSortBlock accepts
+constexpr size_t kNetworkBlockMax = 32;
+
+// Sorting-network kernels for int32_t, int64_t and double. Comparisons are branch-free
+// SIMD min/max, so run time does not depend on the data; doubles must not be NaN.
+
+// Sorts up to kNetworkBlockMax values in registers: the block is padded to 8, 16 or 32
+// values and put through a full bitonic network.
+template <class T>
+void NetworkSortBlock(std::span<T> block);
+
+// Merges two sorted runs into out (left.size() + right.size() values). Each step merges the
+// kept register with the next register of the run with the smaller head through a bitonic
+// merge network, emits the lower half and keeps the upper one.
+template <class T>
+void BitonicMerge(std::span<const T> left, std::span<const T> right, std::span<T> out);
+
+// Full sort: blocks of four registers are sorted in registers, then merged pairwise with
+// BitonicMerge through a scratch buffer.
+template <class T>
+void NetworkSort(std::span<T> data);
+
+namespace detail {
+
+// Per-ISA entry points, instantiated for int32_t, int64_t and double in
+// sorting_network_avx2.cpp and sorting_network_avx512.cpp
+template <class T>
+void NetworkSortBlockAvx2(T *data, size_t n);
+template <class T>
+void BitonicMergeAvx2(const T *left, size_t left_size, const T *right, size_t right_size, T *out);
+template <class T>
+void NetworkSortAvx2(T *data, size_t n);
+
+template <class T>
+void NetworkSortBlockAvx512(T *data, size_t n);
+template <class T>
+void BitonicMergeAvx512(const T *left, size_t left_size, const T *right, size_t right_size, T *out);
+template <class T>
+void NetworkSortAvx512(T *data, size_t n);
+
+}  // namespace detail
+
+}  // namespace ppc::core
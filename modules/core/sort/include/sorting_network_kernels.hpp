@@ -0,0 +1,235 @@
+#pragma once
+
+// Bitonic network kernels written once against a SIMD policy V and compiled per ISA:
+// sorting_network_avx2.cpp and sorting_network_avx512.cpp include this file inside their
+// target region. Standard headers must be included before that region, so that inline
+// library code shared with other translation units is never built for a wider ISA.
+//
+// V provides T, Reg, kLanes and
+//   Load(const T *), Store(T *, Reg)      unaligned register load and store
+//   Min(Reg, Reg), Max(Reg, Reg)          lane-wise
+//   PermuteXor(Reg, distance)             lane i gets lane i ^ distance
+//   Blend(lo, hi, hi_lanes)               lane i from hi when bit i of hi_lanes is set
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <utility>
+
+namespace ppc::core::detail::network {
+
+// Compare-exchange of every lane with its partner at distance, the lanes in max_lanes keep the larger value
+template <class V>
+inline typename V::Reg Exchange(typename V::Reg v, int distance, unsigned max_lanes) {
+  const auto partner = V::PermuteXor(v, distance);
+  return V::Blend(V::Min(v, partner), V::Max(v, partner), max_lanes);
+}
+
+// Lanes of register r that keep the larger value at stride j of the size-k bitonic stage: the
+// upper element of a pair in ascending subsequences, the lower one in descending ones
+template <class V>
+constexpr unsigned MaxLanes(int r, int j, int k) {
+  unsigned lanes = 0;
+  for (int lane = 0; lane < V::kLanes; lane++) {
+    const int i = (r * V::kLanes) + lane;
+    if (((i & j) != 0) != ((i & k) != 0)) {
+      lanes |= 1U << lane;
+    }
+  }
+  return lanes;
+}
+
+// One stride of a bitonic sort of kRegs registers, recursing into the next one so that every
+// distance and mask is a compile-time constant. Strides of a register or more are vertical
+// min/max between registers, shorter ones run inside them.
+template <class V, int kRegs, int kStage, int kStride>
+inline void SortStep(typename V::Reg *regs) {
+  constexpr int kLanes = V::kLanes;
+  if constexpr (kStride >= kLanes) {
+    for (int a = 0; a < kRegs; a++) {
+      const int b = a ^ (kStride / kLanes);
+      if (b < a) {
+        continue;
+      }
+      const auto lo = V::Min(regs[a], regs[b]);
+      const auto hi = V::Max(regs[a], regs[b]);
+      const bool ascending = ((a * kLanes) & kStage) == 0;
+      regs[a] = ascending ? lo : hi;
+      regs[b] = ascending ? hi : lo;
+    }
+  } else {
+    for (int r = 0; r < kRegs; r++) {
+      regs[r] = Exchange<V>(regs[r], kStride, MaxLanes<V>(r, kStride, kStage));
+    }
+  }
+  if constexpr (kStride > 1) {
+    SortStep<V, kRegs, kStage, kStride / 2>(regs);
+  } else if constexpr (2 * kStage <= kRegs * kLanes) {
+    SortStep<V, kRegs, 2 * kStage, kStage>(regs);
+  }
+}
+
+// Full bitonic sort of kRegs registers, ascending through register 0 to kRegs - 1
+template <class V, int kRegs>
+inline void SortRegisters(typename V::Reg *regs) {
+  SortStep<V, kRegs, 2, 1>(regs);
+}
+
+// Sorts a register holding a bitonic sequence
+template <class V, int kStride = V::kLanes / 2>
+inline typename V::Reg SortBitonicRegister(typename V::Reg v) {
+  v = Exchange<V>(v, kStride, MaxLanes<V>(0, kStride, 2 * V::kLanes));
+  if constexpr (kStride > 1) {
+    return SortBitonicRegister<V, kStride / 2>(v);
+  } else {
+    return v;
+  }
+}
+
+// Merges two sorted registers: lo receives the smaller half, hi the larger one, both sorted
+template <class V>
+inline void MergeRegisters(typename V::Reg &lo, typename V::Reg &hi) {
+  const auto reversed = V::PermuteXor(hi, V::kLanes - 1);
+  const auto smaller = V::Min(lo, reversed);
+  const auto larger = V::Max(lo, reversed);
+  lo = SortBitonicRegister<V>(smaller);
+  hi = SortBitonicRegister<V>(larger);
+}
+
+template <class T>
+constexpr T PadValue() {
+  if constexpr (std::numeric_limits<T>::has_infinity) {
+    return std::numeric_limits<T>::infinity();
+  } else {
+    return std::numeric_limits<T>::max();
+  }
+}
+
+// Sorts n <= kRegs * kLanes values, the missing ones are padded with the largest value
+template <class V, int kRegs>
+inline void SortPadded(typename V::T *data, size_t n) {
+  using T = typename V::T;
+  constexpr int kLanes = V::kLanes;
+  T buffer[kRegs * kLanes];
+  std::copy(data, data + n, buffer);
+  std::fill(buffer + n, buffer + (kRegs * kLanes), PadValue<T>());
+  typename V::Reg regs[kRegs];
+  for (int r = 0; r < kRegs; r++) {
+    regs[r] = V::Load(buffer + (r * kLanes));
+  }
+  SortRegisters<V, kRegs>(regs);
+  for (int r = 0; r < kRegs; r++) {
+    V::Store(buffer + (r * kLanes), regs[r]);
+  }
+  std::copy(buffer, buffer + n, data);
+}
+
+// Block sort through the smallest power-of-two number of registers that holds n values
+template <class V, size_t kMaxValues>
+inline void SortBlock(typename V::T *data, size_t n) {
+  constexpr size_t kLanes = V::kLanes;
+  if (n <= 1) {
+    return;
+  }
+  if (n <= kLanes) {
+    SortPadded<V, 1>(data, n);
+  } else if (n <= 2 * kLanes) {
+    SortPadded<V, 2>(data, n);
+  } else if constexpr (kMaxValues > 2 * kLanes) {
+    if (n <= 4 * kLanes) {
+      SortPadded<V, 4>(data, n);
+    } else if constexpr (kMaxValues > 4 * kLanes) {
+      SortPadded<V, 8>(data, n);
+    }
+  }
+}
+
+// Register-at-a-time merge of two sorted runs. When one run has less than a register left,
+// the kept register is merged with that tail and the result with the rest of the other run.
+template <class V>
+inline void Merge(const typename V::T *left, size_t left_size, const typename V::T *right, size_t right_size,
+                  typename V::T *out) {
+  using T = typename V::T;
+  constexpr size_t kLanes = V::kLanes;
+  if (left_size < kLanes) {
+    if (right_size < kLanes) {
+      std::merge(left, left + left_size, right, right + right_size, out);
+      return;
+    }
+    std::swap(left, right);
+    std::swap(left_size, right_size);
+  }
+
+  auto kept = V::Load(left);
+  size_t l = kLanes;
+  size_t r = 0;
+  while (l + kLanes <= left_size && r + kLanes <= right_size) {
+    // Selecting the source without a branch: which run goes next is as good as random
+    const bool take_left = left[l] <= right[r];
+    auto next = V::Load(take_left ? left + l : right + r);
+    l += take_left ? kLanes : 0;
+    r += take_left ? 0 : kLanes;
+    MergeRegisters<V>(next, kept);
+    V::Store(out, next);
+    out += kLanes;
+  }
+
+  const bool left_short = left_size - l < kLanes;
+  const T *short_run = left_short ? left + l : right + r;
+  const size_t short_size = left_short ? left_size - l : right_size - r;
+  const T *long_run = left_short ? right + r : left + l;
+  const size_t long_size = left_short ? right_size - r : left_size - l;
+
+  T kept_values[kLanes];
+  T tail[2 * kLanes];
+  V::Store(kept_values, kept);
+  T *tail_end = std::merge(kept_values, kept_values + kLanes, short_run, short_run + short_size, tail);
+  std::merge(tail, tail_end, long_run, long_run + long_size, out);
+}
+
+// Blocks of four registers sorted in registers, then bottom-up pairwise merges
+template <class V, size_t kMaxBlockValues>
+inline void Sort(typename V::T *data, size_t n) {
+  using T = typename V::T;
+  constexpr size_t kBlock = 4 * V::kLanes;
+  if (n <= kMaxBlockValues) {
+    SortBlock<V, kMaxBlockValues>(data, n);
+    return;
+  }
+
+  const size_t full = n / kBlock * kBlock;
+  for (size_t begin = 0; begin < full; begin += kBlock) {
+    typename V::Reg regs[4];
+    for (int r = 0; r < 4; r++) {
+      regs[r] = V::Load(data + begin + (r * V::kLanes));
+    }
+    SortRegisters<V, 4>(regs);
+    for (int r = 0; r < 4; r++) {
+      V::Store(data + begin + (r * V::kLanes), regs[r]);
+    }
+  }
+  if (full < n) {
+    SortPadded<V, 4>(data + full, n - full);
+  }
+  if (n <= kBlock) {
+    return;
+  }
+
+  auto scratch = std::make_unique_for_overwrite<T[]>(n);
+  T *src = data;
+  T *dst = scratch.get();
+  for (size_t width = kBlock; width < n; width *= 2) {
+    for (size_t begin = 0; begin < n; begin += 2 * width) {
+      const size_t mid = std::min(begin + width, n);
+      const size_t end = std::min(begin + (2 * width), n);
+      Merge<V>(src + begin, mid - begin, src + mid, end - mid, dst + begin);
+    }
+    std::swap(src, dst);
+  }
+  if (src != data) {
+    std::copy(src, src + n, data);
+  }
+}
+
+}  // namespace ppc::core::detail::network
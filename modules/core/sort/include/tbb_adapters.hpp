@@ -0,0 +1,29 @@
+#pragma once
+
+#include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/task_group.h>
+
+#include <cstddef>
+
+namespace ppc::core {
+
+// ForEach backend over the TBB workers of the current arena: body(i) for i in [0, count)
+struct TbbForEach {
+  template <class Body>
+  void operator()(size_t count, const Body &body) const {
+    oneapi::tbb::parallel_for(size_t{0}, count, body);
+  }
+};
+
+// Invoke backend spawning left() as a TBB task while the calling thread runs right()
+struct TbbInvoke {
+  template <class F, class G>
+  void operator()(const F &left, const G &right) const {
+    oneapi::tbb::task_group group;
+    group.run(left);
+    right();
+    group.wait();
+  }
+};
+
+}  // namespace ppc::core
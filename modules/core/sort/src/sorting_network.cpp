@@ -0,0 +1,88 @@
+#include "core/sort/include/sorting_network.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+#include "core/util/include/simd_level.hpp"
+
+template <class T>
+void ppc::core::NetworkSortBlock(std::span<T> block) {
+  if (block.size() > kNetworkBlockMax) {
+    throw std::invalid_argument("NetworkSortBlock: block of " + std::to_string(block.size()) + " values");
+  }
+  switch (ppc::util::ActiveSimdLevel()) {
+#ifdef PPC_SORTING_NETWORK_X86
+    case ppc::util::SimdLevel::kAvx512:
+      detail::NetworkSortBlockAvx512(block.data(), block.size());
+      return;
+    case ppc::util::SimdLevel::kAvx2:
+      detail::NetworkSortBlockAvx2(block.data(), block.size());
+      return;
+#else
+    case ppc::util::SimdLevel::kAvx512:
+    case ppc::util::SimdLevel::kAvx2:
+#endif
+    case ppc::util::SimdLevel::kScalar:
+      break;
+  }
+  std::ranges::sort(block);
+}
+
+template <class T>
+void ppc::core::BitonicMerge(std::span<const T> left, std::span<const T> right, std::span<T> out) {
+  if (out.size() != left.size() + right.size()) {
+    throw std::invalid_argument("BitonicMerge: output size does not match the runs");
+  }
+  switch (ppc::util::ActiveSimdLevel()) {
+#ifdef PPC_SORTING_NETWORK_X86
+    case ppc::util::SimdLevel::kAvx512:
+      detail::BitonicMergeAvx512(left.data(), left.size(), right.data(), right.size(), out.data());
+      return;
+    case ppc::util::SimdLevel::kAvx2:
+      detail::BitonicMergeAvx2(left.data(), left.size(), right.data(), right.size(), out.data());
+      return;
+#else
+    case ppc::util::SimdLevel::kAvx512:
+    case ppc::util::SimdLevel::kAvx2:
+#endif
+    case ppc::util::SimdLevel::kScalar:
+      break;
+  }
+  std::ranges::merge(left, right, out.begin());
+}
+
+template <class T>
+void ppc::core::NetworkSort(std::span<T> data) {
+  switch (ppc::util::ActiveSimdLevel()) {
+#ifdef PPC_SORTING_NETWORK_X86
+    case ppc::util::SimdLevel::kAvx512:
+      detail::NetworkSortAvx512(data.data(), data.size());
+      return;
+    case ppc::util::SimdLevel::kAvx2:
+      detail::NetworkSortAvx2(data.data(), data.size());
+      return;
+#else
+    case ppc::util::SimdLevel::kAvx512:
+    case ppc::util::SimdLevel::kAvx2:
+#endif
+    case ppc::util::SimdLevel::kScalar:
+      break;
+  }
+  std::ranges::sort(data);
+}
+
+template void ppc::core::NetworkSortBlock<int32_t>(std::span<int32_t>);
+template void ppc::core::NetworkSortBlock<int64_t>(std::span<int64_t>);
+template void ppc::core::NetworkSortBlock<double>(std::span<double>);
+template void ppc::core::BitonicMerge<int32_t>(std::span<const int32_t>, std::span<const int32_t>,
+                                               std::span<int32_t>);
+template void ppc::core::BitonicMerge<int64_t>(std::span<const int64_t>, std::span<const int64_t>,
+                                               std::span<int64_t>);
+template void ppc::core::BitonicMerge<double>(std::span<const double>, std::span<const double>, std::span<double>);
+template void ppc::core::NetworkSort<int32_t>(std::span<int32_t>);
+template void ppc::core::NetworkSort<int64_t>(std::span<int64_t>);
+template void ppc::core::NetworkSort<double>(std::span<double>);
@@ -0,0 +1,131 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include "core/sort/include/sorting_network.hpp"
+
+#ifdef PPC_SORTING_NETWORK_X86
+
+#include <immintrin.h>
+
+#ifdef __clang__
+#pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+#include "core/sort/include/sorting_network_kernels.hpp"
+
+namespace {
+
+// Per-lane masks for blendv: lane i is all ones when bit i of lanes is set
+__m256i LaneMask32(unsigned lanes) {
+  const __m256i bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+  return _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(static_cast<int>(lanes)), bits), bits);
+}
+
+__m256i LaneMask64(unsigned lanes) {
+  const __m256i bits = _mm256_setr_epi64x(1, 2, 4, 8);
+  return _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x(lanes), bits), bits);
+}
+
+// 64-bit lanes move as pairs of 32-bit lanes, so lane i ^ distance is 32-bit lane j ^ (2 * distance)
+__m256i PermuteXor32(__m256i v, int distance) {
+  const __m256i iota = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  return _mm256_permutevar8x32_epi32(v, _mm256_xor_si256(iota, _mm256_set1_epi32(distance)));
+}
+
+struct Int32 {
+  using T = int32_t;
+  using Reg = __m256i;
+  static constexpr int kLanes = 8;
+  static Reg Load(const T *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+  static void Store(T *p, Reg v) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+  static Reg Min(Reg a, Reg b) { return _mm256_min_epi32(a, b); }
+  static Reg Max(Reg a, Reg b) { return _mm256_max_epi32(a, b); }
+  static Reg PermuteXor(Reg v, int distance) { return PermuteXor32(v, distance); }
+  static Reg Blend(Reg lo, Reg hi, unsigned hi_lanes) { return _mm256_blendv_epi8(lo, hi, LaneMask32(hi_lanes)); }
+};
+
+// AVX2 has no 64-bit min/max: compare and blend
+struct Int64 {
+  using T = int64_t;
+  using Reg = __m256i;
+  static constexpr int kLanes = 4;
+  static Reg Load(const T *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+  static void Store(T *p, Reg v) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+  static Reg Min(Reg a, Reg b) { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+  static Reg Max(Reg a, Reg b) { return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)); }
+  static Reg PermuteXor(Reg v, int distance) { return PermuteXor32(v, 2 * distance); }
+  static Reg Blend(Reg lo, Reg hi, unsigned hi_lanes) { return _mm256_blendv_epi8(lo, hi, LaneMask64(hi_lanes)); }
+};
+
+struct Double {
+  using T = double;
+  using Reg = __m256d;
+  static constexpr int kLanes = 4;
+  static Reg Load(const T *p) { return _mm256_loadu_pd(p); }
+  static void Store(T *p, Reg v) { _mm256_storeu_pd(p, v); }
+  static Reg Min(Reg a, Reg b) { return _mm256_min_pd(a, b); }
+  static Reg Max(Reg a, Reg b) { return _mm256_max_pd(a, b); }
+  static Reg PermuteXor(Reg v, int distance) {
+    return _mm256_castsi256_pd(PermuteXor32(_mm256_castpd_si256(v), 2 * distance));
+  }
+  static Reg Blend(Reg lo, Reg hi, unsigned hi_lanes) {
+    return _mm256_blendv_pd(lo, hi, _mm256_castsi256_pd(LaneMask64(hi_lanes)));
+  }
+};
+
+template <class T>
+struct Policy;
+template <>
+struct Policy<int32_t> {
+  using Type = Int32;
+};
+template <>
+struct Policy<int64_t> {
+  using Type = Int64;
+};
+template <>
+struct Policy<double> {
+  using Type = Double;
+};
+
+}  // namespace
+
+template <class T>
+void ppc::core::detail::NetworkSortBlockAvx2(T *data, size_t n) {
+  network::SortBlock<typename Policy<T>::Type, kNetworkBlockMax>(data, n);
+}
+
+template <class T>
+void ppc::core::detail::BitonicMergeAvx2(const T *left, size_t left_size, const T *right, size_t right_size, T *out) {
+  network::Merge<typename Policy<T>::Type>(left, left_size, right, right_size, out);
+}
+
+template <class T>
+void ppc::core::detail::NetworkSortAvx2(T *data, size_t n) {
+  network::Sort<typename Policy<T>::Type, kNetworkBlockMax>(data, n);
+}
+
+template void ppc::core::detail::NetworkSortBlockAvx2<int32_t>(int32_t *, size_t);
+template void ppc::core::detail::NetworkSortBlockAvx2<int64_t>(int64_t *, size_t);
+template void ppc::core::detail::NetworkSortBlockAvx2<double>(double *, size_t);
+template void ppc::core::detail::BitonicMergeAvx2<int32_t>(const int32_t *, size_t, const int32_t *, size_t, int32_t *);
+template void ppc::core::detail::BitonicMergeAvx2<int64_t>(const int64_t *, size_t, const int64_t *, size_t, int64_t *);
+template void ppc::core::detail::BitonicMergeAvx2<double>(const double *, size_t, const double *, size_t, double *);
+template void ppc::core::detail::NetworkSortAvx2<int32_t>(int32_t *, size_t);
+template void ppc::core::detail::NetworkSortAvx2<int64_t>(int64_t *, size_t);
+template void ppc::core::detail::NetworkSortAvx2<double>(double *, size_t);
+
+#ifdef __clang__
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#endif  // PPC_SORTING_NETWORK_X86
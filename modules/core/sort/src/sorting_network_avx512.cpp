@@ -0,0 +1,134 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include "core/sort/include/sorting_network.hpp"
+
+#ifdef PPC_SORTING_NETWORK_X86
+
+// GCC 12 reports the _mm512_undefined_* placeholders inside the intrinsics as uninitialized
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#include <immintrin.h>
+
+#ifdef __clang__
+#pragma clang attribute push(__attribute__((target("avx512f"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#endif
+
+#include "core/sort/include/sorting_network_kernels.hpp"
+
+namespace {
+
+struct Int32 {
+  using T = int32_t;
+  using Reg = __m512i;
+  static constexpr int kLanes = 16;
+  static Reg Load(const T *p) { return _mm512_loadu_si512(p); }
+  static void Store(T *p, Reg v) { _mm512_storeu_si512(p, v); }
+  static Reg Min(Reg a, Reg b) { return _mm512_min_epi32(a, b); }
+  static Reg Max(Reg a, Reg b) { return _mm512_max_epi32(a, b); }
+  static Reg PermuteXor(Reg v, int distance) {
+    const __m512i iota = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    return _mm512_permutexvar_epi32(_mm512_xor_si512(iota, _mm512_set1_epi32(distance)), v);
+  }
+  static Reg Blend(Reg lo, Reg hi, unsigned hi_lanes) {
+    return _mm512_mask_blend_epi32(static_cast<__mmask16>(hi_lanes), lo, hi);
+  }
+};
+
+// Lane indices for the 64-bit permutes
+__m512i XorIndex64(int distance) {
+  const __m512i iota = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+  return _mm512_xor_si512(iota, _mm512_set1_epi64(distance));
+}
+
+struct Int64 {
+  using T = int64_t;
+  using Reg = __m512i;
+  static constexpr int kLanes = 8;
+  static Reg Load(const T *p) { return _mm512_loadu_si512(p); }
+  static void Store(T *p, Reg v) { _mm512_storeu_si512(p, v); }
+  static Reg Min(Reg a, Reg b) { return _mm512_min_epi64(a, b); }
+  static Reg Max(Reg a, Reg b) { return _mm512_max_epi64(a, b); }
+  static Reg PermuteXor(Reg v, int distance) { return _mm512_permutexvar_epi64(XorIndex64(distance), v); }
+  static Reg Blend(Reg lo, Reg hi, unsigned hi_lanes) {
+    return _mm512_mask_blend_epi64(static_cast<__mmask8>(hi_lanes), lo, hi);
+  }
+};
+
+struct Double {
+  using T = double;
+  using Reg = __m512d;
+  static constexpr int kLanes = 8;
+  static Reg Load(const T *p) { return _mm512_loadu_pd(p); }
+  static void Store(T *p, Reg v) { _mm512_storeu_pd(p, v); }
+  static Reg Min(Reg a, Reg b) { return _mm512_min_pd(a, b); }
+  static Reg Max(Reg a, Reg b) { return _mm512_max_pd(a, b); }
+  static Reg PermuteXor(Reg v, int distance) { return _mm512_permutexvar_pd(XorIndex64(distance), v); }
+  static Reg Blend(Reg lo, Reg hi, unsigned hi_lanes) {
+    return _mm512_mask_blend_pd(static_cast<__mmask8>(hi_lanes), lo, hi);
+  }
+};
+
+template <class T>
+struct Policy;
+template <>
+struct Policy<int32_t> {
+  using Type = Int32;
+};
+template <>
+struct Policy<int64_t> {
+  using Type = Int64;
+};
+template <>
+struct Policy<double> {
+  using Type = Double;
+};
+
+}  // namespace
+
+template <class T>
+void ppc::core::detail::NetworkSortBlockAvx512(T *data, size_t n) {
+  network::SortBlock<typename Policy<T>::Type, kNetworkBlockMax>(data, n);
+}
+
+template <class T>
+void ppc::core::detail::BitonicMergeAvx512(const T *left, size_t left_size, const T *right, size_t right_size,
+                                           T *out) {
+  network::Merge<typename Policy<T>::Type>(left, left_size, right, right_size, out);
+}
+
+template <class T>
+void ppc::core::detail::NetworkSortAvx512(T *data, size_t n) {
+  network::Sort<typename Policy<T>::Type, kNetworkBlockMax>(data, n);
+}
+
+template void ppc::core::detail::NetworkSortBlockAvx512<int32_t>(int32_t *, size_t);
+template void ppc::core::detail::NetworkSortBlockAvx512<int64_t>(int64_t *, size_t);
+template void ppc::core::detail::NetworkSortBlockAvx512<double>(double *, size_t);
+template void ppc::core::detail::BitonicMergeAvx512<int32_t>(const int32_t *, size_t, const int32_t *, size_t,
+                                                             int32_t *);
+template void ppc::core::detail::BitonicMergeAvx512<int64_t>(const int64_t *, size_t, const int64_t *, size_t,
+                                                             int64_t *);
+template void ppc::core::detail::BitonicMergeAvx512<double>(const double *, size_t, const double *, size_t, double *);
+template void ppc::core::detail::NetworkSortAvx512<int32_t>(int32_t *, size_t);
+template void ppc::core::detail::NetworkSortAvx512<int64_t>(int64_t *, size_t);
+template void ppc::core::detail::NetworkSortAvx512<double>(double *, size_t);
+
+#ifdef __clang__
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#pragma GCC diagnostic pop
+#endif
+
+#endif  // PPC_SORTING_NETWORK_X86
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "core/sparse/include/sparse_io.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/file_io.hpp"
+
+namespace {
+
+void WriteText(const std::filesystem::path &path, std::string_view text) {
+  ppc::util::FileWriter writer(path);
+  writer.Write(std::as_bytes(std::span(text)));
+  writer.Close();
+}
+
+ppc::core::CooMatrix<double> RandomCoo(size_t rows, size_t cols, size_t entries, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<size_t> row(0, rows - 1);
+  std::uniform_int_distribution<size_t> col(0, cols - 1);
+  std::normal_distribution<double> value(0.0, 1e3);
+  ppc::core::CooMatrix<double> coo{.rows = rows, .cols = cols, .row = {}, .col = {}, .val = {}};
+  for (size_t e = 0; e < entries; e++) {
+    coo.row.push_back(static_cast<int>(row(gen)));
+    coo.col.push_back(static_cast<int>(col(gen)));
+    coo.val.push_back(value(gen));
+  }
+  return coo;
+}
+
+}  // namespace
+
+TEST(sparse_io_tests, reads_symmetric_matrix_market) {
+  ppc::util::ScratchDirectory directory;
+  const auto path = directory.NewFile();
+  WriteText(path,
+            "%%MatrixMarket matrix coordinate real symmetric\n"
+            "% a comment\n"
+            "\n"
+            "3 3 3\n"
+            "1 1 2.5\n"
+            "3 1 -1e2\n"
+            "  2 3 +4\r\n");
+  const auto coo = ppc::core::ReadMatrixMarket<double>(path);
+  EXPECT_EQ(coo.rows, 3U);
+  const auto csr = ppc::core::CompressCoo(coo, ppc::core::SparseLayout::kRows);
+  EXPECT_EQ(csr.ptr, (std::vector<int>{0, 2, 3, 5}));
+  EXPECT_EQ(csr.idx, (std::vector<int>{0, 2, 2, 0, 1}));
+  EXPECT_EQ(csr.val, (std::vector<double>{2.5, -100.0, 4.0, -100.0, 4.0}));
+}
+
+TEST(sparse_io_tests, reads_pattern_and_hermitian_matrix_market) {
+  ppc::util::ScratchDirectory directory;
+  const auto pattern = directory.NewFile();
+  WriteText(pattern, "%%MatrixMarket matrix coordinate pattern general\n2 2 2\n1 2\n2 1\n");
+  const auto ones = ppc::core::ReadMatrixMarket<float>(pattern);
+  EXPECT_EQ(ones.val, (std::vector<float>{1.0F, 1.0F}));
+
+  using Complex = std::complex<double>;
+  const auto hermitian = directory.NewFile();
+  WriteText(hermitian, "%%MatrixMarket matrix coordinate complex hermitian\n2 2 2\n1 1 1 0\n2 1 3 -4\n");
+  const auto coo = ppc::core::ReadMatrixMarket<Complex, uint32_t>(hermitian);
+  EXPECT_EQ(coo.val, (std::vector<Complex>{Complex(1, 0), Complex(3, -4), Complex(3, 4)}));
+  EXPECT_EQ(coo.row, (std::vector<uint32_t>{0, 1, 0}));
+  EXPECT_THROW(ppc::core::ReadMatrixMarket<double>(hermitian), std::invalid_argument);
+}
+
+TEST(sparse_io_tests, rejects_malformed_matrix_market) {
+  ppc::util::ScratchDirectory directory;
+  const auto check = [&](std::string_view text) {
+    const auto path = directory.NewFile();
+    WriteText(path, text);
+    return ppc::core::ReadMatrixMarket<double>(path);
+  };
+  EXPECT_THROW(check("%%MatrixMarket matrix array real general\n2 2\n1\n2\n3\n4\n"), std::runtime_error);
+  EXPECT_THROW(check("%%MatrixMarket matrix coordinate real general\n2 2 2\n1 1 1\n"), std::runtime_error);
+  EXPECT_THROW(check("%%MatrixMarket matrix coordinate real general\n2 2 1\n3 1 1\n"), std::runtime_error);
+  EXPECT_THROW(check("%%MatrixMarket matrix coordinate real general\n2 2 1\n1 1 x\n"), std::runtime_error);
+  EXPECT_THROW(check("not a matrix\n"), std::runtime_error);
+}
+
+TEST(sparse_io_tests, matrix_market_round_trips_exactly) {
+  ppc::util::ScratchDirectory directory;
+  const auto path = directory.NewFile();
+  const auto coo = RandomCoo(5000, 4000, 300000, 1);
+  ppc::core::WriteMatrixMarket(path, coo);
+  // Large enough for the parallel reader to cut the file into several chunks
+  ASSERT_GT(std::filesystem::file_size(path), size_t{4} << 20);
+  for (const auto &read : {ppc::core::ReadMatrixMarket<double>(path),
+                           ppc::core::ReadMatrixMarket<double>(path, ppc::core::PoolForEach{})}) {
+    EXPECT_EQ(read.rows, coo.rows);
+    EXPECT_EQ(read.cols, coo.cols);
+    EXPECT_EQ(read.row, coo.row);
+    EXPECT_EQ(read.col, coo.col);
+    EXPECT_EQ(read.val, coo.val);
+  }
+}
+
+TEST(sparse_io_tests, binary_maps_in_place) {
+  ppc::util::ScratchDirectory directory;
+  const auto path = directory.NewFile();
+  const auto csr = ppc::core::CompressCoo(RandomCoo(700, 900, 20000, 2), ppc::core::SparseLayout::kRows);
+  ppc::core::WriteSparseBinary(path, csr.View());
+
+  const ppc::core::MappedSparseMatrix<double> mapped(path);
+  const auto view = mapped.View();
+  EXPECT_EQ(view.lines, csr.lines);
+  EXPECT_EQ(view.extent, csr.extent);
+  EXPECT_TRUE(std::ranges::equal(view.ptr, csr.ptr));
+  EXPECT_TRUE(std::ranges::equal(view.idx, csr.idx));
+  EXPECT_TRUE(std::ranges::equal(view.val, csr.val));
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(view.val.data()) % alignof(double), 0U);
+
+  const auto copy = ppc::core::ReadSparseBinary<double>(path);
+  EXPECT_EQ(copy.ptr, csr.ptr);
+  EXPECT_EQ(copy.idx, csr.idx);
+  EXPECT_EQ(copy.val, csr.val);
+}
+
+TEST(sparse_io_tests, binary_rejects_foreign_files) {
+  ppc::util::ScratchDirectory directory;
+  const auto path = directory.NewFile();
+  const ppc::core::CompressedMatrix<float, int64_t> m{
+      .lines = 2, .extent = 2, .ptr = {0, 1, 2}, .idx = {1, 0}, .val = {1.0F, 2.0F}};
+  ppc::core::WriteSparseBinary(path, m.View());
+  const auto read_wide = [](const std::filesystem::path &file) {
+    return ppc::core::ReadSparseBinary<float, int64_t>(file);
+  };
+  EXPECT_EQ(read_wide(path).idx, m.idx);
+  EXPECT_THROW(ppc::core::ReadSparseBinary<double>(path), std::invalid_argument);
+  EXPECT_THROW(ppc::core::ReadSparseBinary<float>(path), std::invalid_argument);
+
+  const auto truncated = directory.NewFile();
+  {
+    const ppc::util::MappedFile file(path);
+    ppc::util::FileWriter writer(truncated);
+    writer.Write(file.Bytes().first(file.Size() - 4));
+    writer.Close();
+  }
+  EXPECT_THROW(read_wide(truncated), std::runtime_error);
+
+  const auto text = directory.NewFile();
+  WriteText(text, "%%MatrixMarket matrix coordinate real general\n1 1 0\n");
+  EXPECT_THROW(ppc::core::ReadSparseBinary<double>(text), std::runtime_error);
+}
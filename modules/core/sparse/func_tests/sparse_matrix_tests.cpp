@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/sparse/include/spgemm.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace {
+
+// Row-major dense matrix with about `density` of its entries nonzero
+std::vector<double> RandomDense(size_t rows, size_t cols, double density, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::bernoulli_distribution nonzero(density);
+  std::vector<double> dense(rows * cols);
+  for (auto &value : dense) {
+    if (nonzero(gen)) {
+      value = dist(gen);
+    }
+  }
+  return dense;
+}
+
+// COO entries of a dense matrix in a shuffled order
+ppc::core::CooMatrix<double> ShuffledCoo(const std::vector<double> &dense, size_t rows, size_t cols, unsigned seed) {
+  ppc::core::CooMatrix<double> coo{.rows = rows, .cols = cols, .row = {}, .col = {}, .val = {}};
+  std::vector<size_t> order(dense.size());
+  for (size_t i = 0; i < order.size(); i++) {
+    order[i] = i;
+  }
+  std::shuffle(order.begin(), order.end(), std::mt19937(seed));
+  for (size_t i : order) {
+    if (dense[i] != 0.0) {
+      coo.row.push_back(static_cast<int>(i / cols));
+      coo.col.push_back(static_cast<int>(i % cols));
+      coo.val.push_back(dense[i]);
+    }
+  }
+  return coo;
+}
+
+// Dense row-major matrix of a compressed one whose lines are rows (or columns, read transposed)
+std::vector<double> ToDense(const ppc::core::CompressedMatrix<double> &m) {
+  std::vector<double> dense(m.lines * m.extent);
+  for (size_t line = 0; line < m.lines; line++) {
+    for (auto e = static_cast<size_t>(m.ptr[line]); e < static_cast<size_t>(m.ptr[line + 1]); e++) {
+      dense[(line * m.extent) + static_cast<size_t>(m.idx[e])] = m.val[e];
+    }
+  }
+  return dense;
+}
+
+std::vector<double> TransposeDense(const std::vector<double> &dense, size_t rows, size_t cols) {
+  std::vector<double> t(dense.size());
+  for (size_t i = 0; i < rows; i++) {
+    for (size_t j = 0; j < cols; j++) {
+      t[(j * rows) + i] = dense[(i * cols) + j];
+    }
+  }
+  return t;
+}
+
+}  // namespace
+
+TEST(sparse_matrix_tests, compresses_coo_into_sorted_rows_and_columns) {
+  const size_t rows = 70;
+  const size_t cols = 50;
+  const auto dense = RandomDense(rows, cols, 0.1, 1);
+  const auto coo = ShuffledCoo(dense, rows, cols, 2);
+
+  const auto csr = ppc::core::CompressCoo(coo, ppc::core::SparseLayout::kRows);
+  EXPECT_NO_THROW(ppc::core::Validate(csr.View()));
+  EXPECT_EQ(csr.lines, rows);
+  EXPECT_EQ(ToDense(csr), dense);
+
+  const auto csc = ppc::core::CompressCoo(coo, ppc::core::SparseLayout::kColumns);
+  EXPECT_NO_THROW(ppc::core::Validate(csc.View()));
+  EXPECT_EQ(csc.lines, cols);
+  EXPECT_EQ(ToDense(csc), TransposeDense(dense, rows, cols));
+}
+
+TEST(sparse_matrix_tests, compress_sums_duplicates) {
+  const ppc::core::CooMatrix<double> coo{
+      .rows = 2, .cols = 3, .row = {1, 0, 1, 1, 0}, .col = {2, 1, 0, 2, 1}, .val = {1.0, 2.0, 3.0, 4.0, 5.0}};
+  const auto csr = ppc::core::CompressCoo(coo, ppc::core::SparseLayout::kRows);
+  EXPECT_EQ(csr.ptr, (std::vector<int>{0, 1, 3}));
+  EXPECT_EQ(csr.idx, (std::vector<int>{1, 0, 2}));
+  EXPECT_EQ(csr.val, (std::vector<double>{7.0, 3.0, 5.0}));
+}
+
+TEST(sparse_matrix_tests, transpose_converts_between_layouts) {
+  const size_t rows = 300;
+  const size_t cols = 200;
+  const auto dense = RandomDense(rows, cols, 0.05, 3);
+  const auto csr = ppc::core::CompressCoo(ShuffledCoo(dense, rows, cols, 4), ppc::core::SparseLayout::kRows);
+  const auto csc = ppc::core::CompressCoo(ShuffledCoo(dense, rows, cols, 5), ppc::core::SparseLayout::kColumns);
+
+  const auto converted = ppc::core::Transpose(csr.View());
+  EXPECT_EQ(converted.ptr, csc.ptr);
+  EXPECT_EQ(converted.idx, csc.idx);
+  EXPECT_EQ(converted.val, csc.val);
+  const auto back = ppc::core::Transpose(converted.View());
+  EXPECT_EQ(back.ptr, csr.ptr);
+  EXPECT_EQ(back.idx, csr.idx);
+  EXPECT_EQ(back.val, csr.val);
+}
+
+TEST(sparse_matrix_tests, parallel_backend_matches) {
+  const size_t rows = 3000;
+  const size_t cols = 2000;
+  const auto dense = RandomDense(rows, cols, 0.02, 6);
+  auto coo = ShuffledCoo(dense, rows, cols, 7);
+  // A few duplicates spread over the input
+  for (size_t e = 0; e < 1000; e++) {
+    coo.row.push_back(coo.row[e * 7]);
+    coo.col.push_back(coo.col[e * 7]);
+    coo.val.push_back(0.5);
+  }
+
+  const auto sequential = ppc::core::CompressCoo(coo, ppc::core::SparseLayout::kRows);
+  const auto parallel = ppc::core::CompressCoo(coo, ppc::core::SparseLayout::kRows, ppc::core::PoolForEach{});
+  EXPECT_EQ(parallel.ptr, sequential.ptr);
+  EXPECT_EQ(parallel.idx, sequential.idx);
+  EXPECT_EQ(parallel.val, sequential.val);
+  EXPECT_NO_THROW(ppc::core::Validate(parallel.View(), ppc::core::PoolForEach{}));
+
+  const auto t_sequential = ppc::core::Transpose(sequential.View());
+  const auto t_parallel = ppc::core::Transpose(sequential.View(), ppc::core::PoolForEach{});
+  EXPECT_EQ(t_parallel.ptr, t_sequential.ptr);
+  EXPECT_EQ(t_parallel.idx, t_sequential.idx);
+  EXPECT_EQ(t_parallel.val, t_sequential.val);
+
+  const auto coo_back =
+      ppc::core::ToCoo(t_parallel.View(), ppc::core::SparseLayout::kColumns, ppc::core::PoolForEach{});
+  const auto again = ppc::core::CompressCoo(coo_back, ppc::core::SparseLayout::kRows, ppc::core::PoolForEach{});
+  EXPECT_EQ(again.ptr, sequential.ptr);
+  EXPECT_EQ(again.idx, sequential.idx);
+  EXPECT_EQ(again.val, sequential.val);
+}
+
+TEST(sparse_matrix_tests, transpose_keeps_unsigned_indices_and_complex_values) {
+  using Complex = std::complex<double>;
+  const ppc::core::CompressedMatrix<Complex, uint32_t> m{.lines = 2,
+                                                         .extent = 3,
+                                                         .ptr = {0, 2, 3},
+                                                         .idx = {2, 0, 1},
+                                                         .val = {Complex(1, 1), Complex(2, 0), Complex(0, 3)}};
+  const auto t = ppc::core::Transpose(m.View());
+  EXPECT_EQ(t.lines, 3U);
+  EXPECT_EQ(t.ptr, (std::vector<uint32_t>{0, 1, 2, 3}));
+  EXPECT_EQ(t.idx, (std::vector<uint32_t>{0, 1, 0}));
+  EXPECT_EQ(t.val, (std::vector<Complex>{Complex(2, 0), Complex(0, 3), Complex(1, 1)}));
+}
+
+TEST(sparse_matrix_tests, blocks_round_trip) {
+  const size_t rows = 37;
+  const size_t cols = 29;
+  const auto dense = RandomDense(rows, cols, 0.08, 8);
+  const auto csr = ppc::core::CompressCoo(ShuffledCoo(dense, rows, cols, 9), ppc::core::SparseLayout::kRows);
+  for (const auto &[height, width] : {std::pair<size_t, size_t>{1, 1}, {4, 4}, {3, 5}, {40, 1}}) {
+    const auto bsr = ppc::core::ToBlocks(csr.View(), height, width, ppc::core::PoolForEach{});
+    EXPECT_NO_THROW(ppc::core::Validate(bsr));
+    EXPECT_EQ(bsr.ptr.size(), bsr.BlockRows() + 1);
+    const auto back = ppc::core::FromBlocks(bsr, ppc::core::PoolForEach{});
+    EXPECT_EQ(back.ptr, csr.ptr) << height << "x" << width;
+    EXPECT_EQ(back.idx, csr.idx) << height << "x" << width;
+    EXPECT_EQ(back.val, csr.val) << height << "x" << width;
+  }
+}
+
+TEST(sparse_matrix_tests, block_layout) {
+  // [1 0 | 0 0]
+  // [0 2 | 0 3]
+  // [0 0 | 4 0]
+  const ppc::core::CompressedMatrix<double> csr{
+      .lines = 3, .extent = 4, .ptr = {0, 1, 3, 4}, .idx = {0, 1, 3, 2}, .val = {1, 2, 3, 4}};
+  const auto bsr = ppc::core::ToBlocks(csr.View(), 2, 2);
+  EXPECT_EQ(bsr.ptr, (std::vector<int>{0, 2, 3}));
+  EXPECT_EQ(bsr.idx, (std::vector<int>{0, 1, 1}));
+  EXPECT_EQ(bsr.val, (std::vector<double>{1, 0, 0, 2, 0, 0, 0, 3, 4, 0, 0, 0}));
+}
+
+TEST(sparse_matrix_tests, validate_names_defects) {
+  const auto check = [](std::vector<int> ptr, std::vector<int> idx) {
+    const std::vector<double> val(idx.size(), 1.0);
+    const ppc::core::CompressedView<double> view{
+        .lines = ptr.size() - 1, .extent = 3, .ptr = ptr, .idx = idx, .val = val};
+    ppc::core::Validate(view);
+  };
+  EXPECT_NO_THROW(check({0, 2, 3}, {0, 2, 1}));
+  EXPECT_THROW(check({1, 2, 3}, {0, 2, 1}), std::invalid_argument);
+  EXPECT_THROW(check({0, 2, 2}, {0, 2, 1}), std::invalid_argument);
+  EXPECT_THROW(check({0, 2, 3}, {2, 0, 1}), std::invalid_argument);
+  EXPECT_THROW(check({0, 2, 3}, {1, 1, 1}), std::invalid_argument);
+  EXPECT_THROW(check({0, 2, 3}, {0, 3, 1}), std::invalid_argument);
+  EXPECT_THROW(check({0, 2, 3}, {0, -1, 1}), std::invalid_argument);
+
+  const ppc::core::CooMatrix<double> outside{.rows = 2, .cols = 2, .row = {0, 2}, .col = {1, 1}, .val = {1, 2}};
+  EXPECT_THROW(ppc::core::CompressCoo(outside, ppc::core::SparseLayout::kRows), std::invalid_argument);
+  ppc::core::BlockMatrix<double> blocks{
+      .rows = 2, .cols = 2, .block_height = 2, .block_width = 2, .ptr = {0, 1}, .idx = {0}, .val = {1, 2}};
+  EXPECT_THROW(ppc::core::Validate(blocks), std::invalid_argument);
+}
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "core/sparse/include/spgemm.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/for_each.hpp"
+
+namespace {
+
+// Column-major dense matrix with about `density` of its entries nonzero
+template <class T>
+std::vector<T> RandomDense(size_t rows, size_t cols, double density, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::bernoulli_distribution nonzero(density);
+  std::vector<T> dense(rows * cols);
+  for (auto &value : dense) {
+    if (nonzero(gen)) {
+      if constexpr (std::is_same_v<T, double>) {
+        value = dist(gen);
+      } else {
+        value = T(dist(gen), dist(gen));
+      }
+    }
+  }
+  return dense;
+}
+
+template <class T, class Index>
+ppc::core::CompressedMatrix<T, Index> ToCompressed(const std::vector<T> &dense, size_t rows, size_t cols) {
+  ppc::core::CompressedMatrix<T, Index> m{.lines = cols, .extent = rows, .ptr = {0}, .idx = {}, .val = {}};
+  for (size_t j = 0; j < cols; j++) {
+    for (size_t i = 0; i < rows; i++) {
+      if (dense[(j * rows) + i] != T{}) {
+        m.idx.push_back(static_cast<Index>(i));
+        m.val.push_back(dense[(j * rows) + i]);
+      }
+    }
+    m.ptr.push_back(static_cast<Index>(m.idx.size()));
+  }
+  return m;
+}
+
+template <class T>
+std::vector<T> DenseProduct(const std::vector<T> &a, const std::vector<T> &b, size_t m, size_t k, size_t n) {
+  std::vector<T> c(m * n);
+  for (size_t j = 0; j < n; j++) {
+    for (size_t p = 0; p < k; p++) {
+      if (b[(j * k) + p] == T{}) {
+        continue;
+      }
+      for (size_t i = 0; i < m; i++) {
+        c[(j * m) + i] += a[(p * m) + i] * b[(j * k) + p];
+      }
+    }
+  }
+  return c;
+}
+
+template <class T, class Index>
+void ExpectMatches(const ppc::core::CompressedMatrix<T, Index> &c, const std::vector<T> &expected, size_t rows) {
+  std::vector<T> dense(expected.size());
+  ASSERT_EQ(c.ptr.size(), c.lines + 1);
+  for (size_t j = 0; j < c.lines; j++) {
+    for (auto p = static_cast<size_t>(c.ptr[j]); p < static_cast<size_t>(c.ptr[j + 1]); p++) {
+      if (p > static_cast<size_t>(c.ptr[j])) {
+        ASSERT_LT(c.idx[p - 1], c.idx[p]) << "line " << j << " is not sorted";
+      }
+      dense[(j * rows) + static_cast<size_t>(c.idx[p])] = c.val[p];
+    }
+  }
+  for (size_t i = 0; i < expected.size(); i++) {
+    ASSERT_NEAR(std::abs(dense[i] - expected[i]), 0.0, 1e-12) << "at " << i;
+  }
+}
+
+template <class T, class Index, class ForEach = ppc::util::SequentialForEach>
+void CheckProduct(size_t m, size_t k, size_t n, double density, const ForEach &for_each = {}) {
+  const auto a = RandomDense<T>(m, k, density, 1);
+  const auto b = RandomDense<T>(k, n, density, 2);
+  const auto ca = ToCompressed<T, Index>(a, m, k);
+  const auto cb = ToCompressed<T, Index>(b, k, n);
+  const auto c = ppc::core::SpGemm(ca.View(), cb.View(), for_each);
+  EXPECT_EQ(c.lines, n);
+  EXPECT_EQ(c.extent, m);
+  ExpectMatches(c, DenseProduct(a, b, m, k, n), m);
+}
+
+}  // namespace
+
+TEST(spgemm_tests, matches_dense_product_with_hash_lines) {
+  CheckProduct<double, int>(400, 300, 200, 0.002);
+  CheckProduct<double, int>(50, 60, 70, 0.01);
+}
+
+TEST(spgemm_tests, matches_dense_product_with_dense_lines) {
+  CheckProduct<double, int>(64, 80, 48, 0.3);
+  CheckProduct<double, int>(7, 9, 5, 1.0);
+}
+
+TEST(spgemm_tests, multiplies_complex_with_unsigned_indices) {
+  CheckProduct<std::complex<double>, uint32_t>(120, 90, 100, 0.05);
+  CheckProduct<std::complex<double>, uint32_t>(30, 30, 30, 0.5);
+}
+
+TEST(spgemm_tests, parallel_backend_matches) {
+  CheckProduct<double, int>(3000, 2000, 2500, 0.003, ppc::core::PoolForEach{});
+  CheckProduct<std::complex<double>, int>(500, 400, 600, 0.05, ppc::core::PoolForEach{});
+}
+
+TEST(spgemm_tests, swapped_operands_multiply_compressed_rows) {
+  // Row-major dense matrices read as column-major are their transposes, so the CCS helpers give CRS
+  const size_t m = 40;
+  const size_t k = 30;
+  const size_t n = 50;
+  const auto a_rows = RandomDense<double>(k, m, 0.1, 3);
+  const auto b_rows = RandomDense<double>(n, k, 0.1, 4);
+  const auto a_crs = ToCompressed<double, int>(a_rows, k, m);
+  const auto b_crs = ToCompressed<double, int>(b_rows, n, k);
+  const auto c_crs = ppc::core::SpGemm(b_crs.View(), a_crs.View());
+  // (A B)^T = B^T A^T, and the transposes are the row-major buffers read as column-major
+  ExpectMatches(c_crs, DenseProduct(b_rows, a_rows, n, k, m), n);
+}
+
+TEST(spgemm_tests, keep_drops_cancelled_entries) {
+  // A = [1 1], B = [1; -1]: the only product entry cancels
+  const ppc::core::CompressedMatrix<double, int> a{.lines = 2, .extent = 1, .ptr = {0, 1, 2}, .idx = {0, 0},
+                                                  .val = {1.0, 1.0}};
+  const ppc::core::CompressedMatrix<double, int> b{.lines = 2, .extent = 2, .ptr = {0, 2, 3}, .idx = {0, 1, 1},
+                                                  .val = {1.0, -1.0, 2.0}};
+  const auto all = ppc::core::SpGemm(a.View(), b.View());
+  EXPECT_EQ(all.ptr, (std::vector<int>{0, 1, 2}));
+  const auto kept = ppc::core::SpGemm(a.View(), b.View(), ppc::util::SequentialForEach{},
+                                      [](double value) { return value != 0.0; });
+  EXPECT_EQ(kept.ptr, (std::vector<int>{0, 0, 1}));
+  EXPECT_EQ(kept.idx, (std::vector<int>{0}));
+  EXPECT_EQ(kept.val, (std::vector<double>{2.0}));
+}
+
+TEST(spgemm_tests, rejects_mismatched_operands) {
+  const ppc::core::CompressedMatrix<double, int> a{.lines = 2, .extent = 2, .ptr = {0, 0, 0}, .idx = {}, .val = {}};
+  const ppc::core::CompressedMatrix<double, int> b{.lines = 1, .extent = 3, .ptr = {0, 0}, .idx = {}, .val = {}};
+  EXPECT_THROW(ppc::core::SpGemm(a.View(), b.View()), std::invalid_argument);
+}
+
+TEST(spgemm_tests, split_by_cost_balances_chunks) {
+  const std::vector<size_t> cost{5, 1, 1, 1, 10, 0, 0, 2, 2, 2};
+  EXPECT_EQ(ppc::core::SplitByCost(cost, 5, 100), (std::vector<size_t>{0, 1, 5, 10}));
+  EXPECT_EQ(ppc::core::SplitByCost(cost, 1, 2), (std::vector<size_t>{0, 5, 10}));
+  EXPECT_EQ(ppc::core::SplitByCost(cost, 1000, 8), (std::vector<size_t>{0, 10}));
+  EXPECT_EQ(ppc::core::SplitByCost(std::vector<size_t>{}, 1, 8), (std::vector<size_t>{0, 0}));
+}
@@ -0,0 +1,294 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/sparse/include/spgemm.hpp"
+#include "core/util/include/file_io.hpp"
+#include "core/util/include/for_each.hpp"
+
+namespace ppc::core {
+
+namespace detail {
+
+template <class T>
+struct IsComplex : std::false_type {};
+template <class T>
+struct IsComplex<std::complex<T>> : std::true_type {};
+
+enum class MatrixMarketField : std::uint8_t { kReal, kInteger, kComplex, kPattern };
+enum class MatrixMarketSymmetry : std::uint8_t { kGeneral, kSymmetric, kSkewSymmetric, kHermitian };
+
+struct MatrixMarketHeader {
+  MatrixMarketField field = MatrixMarketField::kReal;
+  MatrixMarketSymmetry symmetry = MatrixMarketSymmetry::kGeneral;
+  size_t rows = 0;
+  size_t cols = 0;
+  size_t entries = 0;
+  // Offset of the first entry line
+  size_t data_offset = 0;
+};
+
+// Banner, comments and size line of a coordinate MatrixMarket file; throws std::runtime_error
+// for anything else
+MatrixMarketHeader ParseMatrixMarketHeader(std::string_view text);
+
+// Offsets cutting text[begin, text.size()) into at most `parts` pieces just after line breaks
+std::vector<size_t> SplitAtLines(std::string_view text, size_t begin, size_t parts);
+
+struct MatrixMarketEntry {
+  size_t row = 0;
+  size_t col = 0;
+  double re = 1.0;
+  double im = 0.0;
+};
+
+// Parses the entry line at text[pos], skipping blank lines. Returns false at the end of the
+// text, throws std::runtime_error for a malformed line; pos moves past the line.
+bool NextMatrixMarketEntry(std::string_view text, size_t &pos, MatrixMarketField field, MatrixMarketEntry &entry);
+
+// "row col value[ imaginary]\n" with 1-based indices and values that read back exactly
+void AppendMatrixMarketEntry(std::string &out, size_t row, size_t col, double re, const double *im);
+
+// File header of the binary format. Arrays follow at offsets rounded up to kSparseBinaryAlignment.
+struct SparseBinaryHeader {
+  std::array<char, 8> magic;
+  std::uint32_t version;
+  // kSparseBinaryByteOrder as written, so files from a machine of the other byte order are refused
+  std::uint32_t byte_order;
+  std::uint32_t value_code;
+  std::uint32_t index_code;
+  std::uint64_t lines;
+  std::uint64_t extent;
+  std::uint64_t nnz;
+};
+
+constexpr size_t kSparseBinaryAlignment = 64;
+constexpr std::uint32_t kSparseBinaryVersion = 1;
+constexpr std::uint32_t kSparseBinaryByteOrder = 0x01020304;
+
+template <class T>
+constexpr std::uint32_t SparseValueCode() {
+  static_assert(std::is_trivially_copyable_v<T>, "binary matrices store plain values");
+  if constexpr (IsComplex<T>::value) {
+    return 0x200 | static_cast<std::uint32_t>(sizeof(T));
+  } else if constexpr (std::is_floating_point_v<T>) {
+    return 0x100 | static_cast<std::uint32_t>(sizeof(T));
+  } else {
+    return (std::is_signed_v<T> ? 0x300 : 0x400) | static_cast<std::uint32_t>(sizeof(T));
+  }
+}
+
+struct SparseBinaryLayout {
+  size_t ptr_offset;
+  size_t idx_offset;
+  size_t val_offset;
+  size_t file_size;
+};
+
+SparseBinaryLayout ComputeSparseBinaryLayout(size_t lines, size_t nnz, size_t index_size, size_t value_size);
+
+// Checks magic, version, byte order, type codes and size of a mapped file; throws
+// std::runtime_error for a damaged or foreign file and std::invalid_argument for a type mismatch
+SparseBinaryHeader ReadSparseBinaryHeader(std::span<const std::byte> bytes, std::uint32_t value_code,
+                                          std::uint32_t index_code, size_t index_size, size_t value_size);
+
+void WriteSparseBinaryFile(const std::filesystem::path &path, const SparseBinaryHeader &header,
+                           const SparseBinaryLayout &layout, std::span<const std::byte> ptr,
+                           std::span<const std::byte> idx, std::span<const std::byte> val);
+
+}  // namespace detail
+
+// Reads a coordinate MatrixMarket file (real, integer, pattern or complex; general, symmetric,
+// skew-symmetric or hermitian) into COO with 0-based indices, symmetric storage expanded to both
+// triangles. The file is mapped and cut at line breaks into chunks parsed on `for_each`. Throws
+// std::runtime_error for a malformed file and std::invalid_argument for complex data into real T.
+template <class T, class Index = int, class ForEach = ppc::util::SequentialForEach>
+CooMatrix<T, Index> ReadMatrixMarket(const std::filesystem::path &path, const ForEach &for_each = {}) {
+  using detail::MatrixMarketField;
+  using detail::MatrixMarketSymmetry;
+  const ppc::util::MappedFile file(path);
+  const std::string_view text(reinterpret_cast<const char *>(file.Bytes().data()), file.Size());
+  const auto header = detail::ParseMatrixMarketHeader(text);
+  if (header.field == MatrixMarketField::kComplex && !detail::IsComplex<T>::value) {
+    throw std::invalid_argument("ReadMatrixMarket: complex matrix read into a real type: " + path.string());
+  }
+  detail::CheckIndexFits<Index>(std::max(header.rows, header.cols), "ReadMatrixMarket: matrix size");
+  const auto make_value = [](const detail::MatrixMarketEntry &entry) {
+    if constexpr (detail::IsComplex<T>::value) {
+      return T(static_cast<typename T::value_type>(entry.re), static_cast<typename T::value_type>(entry.im));
+    } else {
+      return static_cast<T>(entry.re);
+    }
+  };
+  // Value of the entry mirrored across the diagonal
+  const auto mirror_value = [&](const T &value) {
+    if (header.symmetry == MatrixMarketSymmetry::kSkewSymmetric) {
+      return T(-value);
+    }
+    if constexpr (detail::IsComplex<T>::value) {
+      if (header.symmetry == MatrixMarketSymmetry::kHermitian) {
+        return std::conj(value);
+      }
+    }
+    return value;
+  };
+
+  // Every chunk parses into its own arrays, which are then copied to their place
+  constexpr size_t kChunkBytes = size_t{1} << 20;
+  const size_t parts = std::is_same_v<ForEach, ppc::util::SequentialForEach> ? 1 : (text.size() / kChunkBytes) + 1;
+  const auto bounds = detail::SplitAtLines(text, header.data_offset, parts);
+  const size_t chunks = bounds.size() - 1;
+  std::vector<CooMatrix<T, Index>> parsed(chunks);
+  std::vector<size_t> stored(chunks, 0);
+  for_each(chunks, [&](size_t chunk) {
+    const std::string_view piece = text.substr(0, bounds[chunk + 1]);
+    CooMatrix<T, Index> &part = parsed[chunk];
+    detail::MatrixMarketEntry entry;
+    size_t pos = bounds[chunk];
+    while (detail::NextMatrixMarketEntry(piece, pos, header.field, entry)) {
+      if (entry.row == 0 || entry.row > header.rows || entry.col == 0 || entry.col > header.cols) {
+        throw std::runtime_error("ReadMatrixMarket: entry outside the matrix: " + path.string());
+      }
+      const T value = make_value(entry);
+      part.row.push_back(static_cast<Index>(entry.row - 1));
+      part.col.push_back(static_cast<Index>(entry.col - 1));
+      part.val.push_back(value);
+      stored[chunk]++;
+      if (header.symmetry != MatrixMarketSymmetry::kGeneral && entry.row != entry.col) {
+        part.row.push_back(static_cast<Index>(entry.col - 1));
+        part.col.push_back(static_cast<Index>(entry.row - 1));
+        part.val.push_back(mirror_value(value));
+      }
+    }
+  });
+  size_t total_stored = 0;
+  std::vector<size_t> offsets(chunks + 1, 0);
+  for (size_t chunk = 0; chunk < chunks; chunk++) {
+    total_stored += stored[chunk];
+    offsets[chunk + 1] = offsets[chunk] + parsed[chunk].val.size();
+  }
+  if (total_stored != header.entries) {
+    throw std::runtime_error("ReadMatrixMarket: expected " + std::to_string(header.entries) + " entries, found " +
+                             std::to_string(total_stored) + ": " + path.string());
+  }
+
+  CooMatrix<T, Index> coo{.rows = header.rows,
+                          .cols = header.cols,
+                          .row = std::vector<Index>(offsets[chunks]),
+                          .col = std::vector<Index>(offsets[chunks]),
+                          .val = std::vector<T>(offsets[chunks])};
+  for_each(chunks, [&](size_t chunk) {
+    const auto at = static_cast<std::ptrdiff_t>(offsets[chunk]);
+    std::ranges::copy(parsed[chunk].row, coo.row.begin() + at);
+    std::ranges::copy(parsed[chunk].col, coo.col.begin() + at);
+    std::ranges::copy(parsed[chunk].val, coo.val.begin() + at);
+  });
+  return coo;
+}
+
+// Writes a general coordinate MatrixMarket file, complex when T is, with 1-based indices and
+// values printed to read back exactly
+template <class T, class Index>
+void WriteMatrixMarket(const std::filesystem::path &path, const CooMatrix<T, Index> &coo) {
+  Validate(coo);
+  constexpr bool kComplex = detail::IsComplex<T>::value;
+  std::string out = "%%MatrixMarket matrix coordinate ";
+  out += kComplex ? "complex" : "real";
+  out += " general\n" + std::to_string(coo.rows) + " " + std::to_string(coo.cols) + " " +
+         std::to_string(coo.val.size()) + "\n";
+  constexpr size_t kFlushBytes = size_t{1} << 20;
+  ppc::util::FileWriter writer(path);
+  for (size_t e = 0; e < coo.val.size(); e++) {
+    const auto row = static_cast<size_t>(coo.row[e]) + 1;
+    const auto col = static_cast<size_t>(coo.col[e]) + 1;
+    if constexpr (kComplex) {
+      const auto im = static_cast<double>(coo.val[e].imag());
+      detail::AppendMatrixMarketEntry(out, row, col, static_cast<double>(coo.val[e].real()), &im);
+    } else {
+      detail::AppendMatrixMarketEntry(out, row, col, static_cast<double>(coo.val[e]), nullptr);
+    }
+    if (out.size() >= kFlushBytes) {
+      writer.Write(std::as_bytes(std::span(out)));
+      out.clear();
+    }
+  }
+  writer.Write(std::as_bytes(std::span(out)));
+  writer.Close();
+}
+
+// Writes a compressed matrix in the compact binary format: a header with the dimensions and the
+// value and index types, then the ptr, idx and val arrays as they are in memory, each starting on
+// a 64-byte boundary so MappedSparseMatrix can use them in place. Byte order is the machine's.
+template <class T, class Index>
+void WriteSparseBinary(const std::filesystem::path &path, const CompressedView<T, Index> &m) {
+  Validate(m);
+  detail::SparseBinaryHeader header{.magic = {'P', 'P', 'C', 'S', 'P', 'M', 'A', 'T'},
+                                    .version = detail::kSparseBinaryVersion,
+                                    .byte_order = detail::kSparseBinaryByteOrder,
+                                    .value_code = detail::SparseValueCode<T>(),
+                                    .index_code = detail::SparseValueCode<Index>(),
+                                    .lines = m.lines,
+                                    .extent = m.extent,
+                                    .nnz = m.idx.size()};
+  const auto layout = detail::ComputeSparseBinaryLayout(m.lines, m.idx.size(), sizeof(Index), sizeof(T));
+  detail::WriteSparseBinaryFile(path, header, layout, std::as_bytes(m.ptr), std::as_bytes(m.idx),
+                                std::as_bytes(m.val));
+}
+
+// A binary matrix file mapped into memory: View() points straight into the mapping, so loading
+// costs no parse and no copy, and pages are read as the matrix is first touched. The structure is
+// checked with Validate on opening.
+template <class T, class Index = int>
+class MappedSparseMatrix {
+ public:
+  explicit MappedSparseMatrix(const std::filesystem::path &path) : file_(path) {
+    const auto bytes = file_.Bytes();
+    const auto header = detail::ReadSparseBinaryHeader(bytes, detail::SparseValueCode<T>(),
+                                                       detail::SparseValueCode<Index>(), sizeof(Index), sizeof(T));
+    const auto layout = detail::ComputeSparseBinaryLayout(header.lines, header.nnz, sizeof(Index), sizeof(T));
+    view_ = {.lines = header.lines,
+             .extent = header.extent,
+             .ptr = ArrayAt<Index>(bytes, layout.ptr_offset, header.lines + 1),
+             .idx = ArrayAt<Index>(bytes, layout.idx_offset, header.nnz),
+             .val = ArrayAt<T>(bytes, layout.val_offset, header.nnz)};
+    Validate(view_);
+  }
+
+  [[nodiscard]] CompressedView<T, Index> View() const { return view_; }
+
+ private:
+  // Offsets are aligned for U and the mapping (or the fallback copy) is at least that aligned
+  template <class U>
+  static std::span<const U> ArrayAt(std::span<const std::byte> bytes, size_t offset, size_t count) {
+    return {reinterpret_cast<const U *>(bytes.data() + offset), count};
+  }
+
+  ppc::util::MappedFile file_;
+  CompressedView<T, Index> view_;
+};
+
+// Reads a binary matrix file into memory
+template <class T, class Index = int>
+CompressedMatrix<T, Index> ReadSparseBinary(const std::filesystem::path &path) {
+  const MappedSparseMatrix<T, Index> mapped(path);
+  const auto view = mapped.View();
+  return {.lines = view.lines,
+          .extent = view.extent,
+          .ptr = std::vector<Index>(view.ptr.begin(), view.ptr.end()),
+          .idx = std::vector<Index>(view.idx.begin(), view.idx.end()),
+          .val = std::vector<T>(view.val.begin(), view.val.end())};
+}
+
+}  // namespace ppc::core
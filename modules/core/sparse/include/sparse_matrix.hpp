@@ -0,0 +1,479 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "core/sort/include/prefix_scan.hpp"
+#include "core/sparse/include/spgemm.hpp"
+#include "core/util/include/for_each.hpp"
+
+namespace ppc::core {
+
+// Coordinate (triplet) form: entry e is val[e] at (row[e], col[e]), in any order, duplicates allowed
+template <class T, class Index = int>
+struct CooMatrix {
+  size_t rows = 0;
+  size_t cols = 0;
+  std::vector<Index> row;
+  std::vector<Index> col;
+  std::vector<T> val;
+};
+
+// Block compressed rows (BSR): the matrix is cut into block_height x block_width blocks, the last
+// block row and column padded with zeros. Block row i stores the block columns idx[ptr[i]..ptr[i + 1])
+// in increasing order, and val holds their dense row-major blocks, block_height * block_width
+// values each.
+template <class T, class Index = int>
+struct BlockMatrix {
+  size_t rows = 0;
+  size_t cols = 0;
+  size_t block_height = 1;
+  size_t block_width = 1;
+  std::vector<Index> ptr;
+  std::vector<Index> idx;
+  std::vector<T> val;
+
+  [[nodiscard]] size_t BlockRows() const { return (rows + block_height - 1) / block_height; }
+  [[nodiscard]] size_t BlockCols() const { return (cols + block_width - 1) / block_width; }
+  [[nodiscard]] size_t BlockSize() const { return block_height * block_width; }
+};
+
+// Which index of a matrix entry picks its line: CSR (rows) or CSC (columns)
+enum class SparseLayout { kRows, kColumns };
+
+namespace detail {
+
+constexpr size_t kSparseLinesPerTask = 4096;
+// Entries a chunk of a counting sort should at least hold, and the cap on chunks. Chunks are also
+// held to about four times the entries per key, so the chunk x key counters stay within a few
+// times the size of the data.
+constexpr size_t kSparseMinChunkEntries = size_t{1} << 14;
+constexpr size_t kSparseMaxChunks = 256;
+
+template <class ForEach>
+size_t CountingSortChunks(size_t entries, size_t keys) {
+  if constexpr (std::is_same_v<ForEach, ppc::util::SequentialForEach>) {
+    return 1;
+  } else {
+    const size_t by_size = entries / kSparseMinChunkEntries;
+    const size_t by_keys = (4 * entries) / std::max<size_t>(keys, 1);
+    return std::clamp<size_t>(std::min(by_size, by_keys), 1, kSparseMaxChunks);
+  }
+}
+
+// body(begin, end) over blocks of kSparseLinesPerTask lines
+template <class ForEach, class Body>
+void ForEachLineBlock(size_t lines, const ForEach &for_each, const Body &body) {
+  for_each((lines + kSparseLinesPerTask - 1) / kSparseLinesPerTask, [&](size_t block) {
+    const size_t begin = block * kSparseLinesPerTask;
+    body(begin, std::min(lines, begin + kSparseLinesPerTask));
+  });
+}
+
+// Stable counting sort of entries into `keys` buckets. The input is cut into `chunks` consecutive
+// chunks; visit(chunk, emit) calls emit(key, entry...) for the entries of a chunk in order, and
+// place(position, entry...) stores an entry at its sorted position. The chunk x key counters are
+// laid out key-major, so one ExclusiveScan turns them into the start of every (key, chunk) run and
+// no chunk reads the counts of another. Returns the bucket starts, keys + 1 of them.
+template <class Visit, class Place, class ForEach>
+std::vector<size_t> CountingSort(size_t keys, size_t chunks, const Visit &visit, const Place &place,
+                                 const ForEach &for_each) {
+  std::vector<size_t> next(keys * chunks, 0);
+  for_each(chunks, [&](size_t chunk) {
+    visit(chunk, [&](size_t key, const auto &.../*entry*/) { next[(key * chunks) + chunk]++; });
+  });
+  const size_t total = ExclusiveScan(std::span<size_t>(next), chunks, for_each);
+  std::vector<size_t> starts(keys + 1, total);
+  for (size_t key = 0; key < keys; key++) {
+    starts[key] = next[key * chunks];
+  }
+  for_each(chunks, [&](size_t chunk) {
+    visit(chunk, [&](size_t key, const auto &...entry) { place(next[(key * chunks) + chunk]++, entry...); });
+  });
+  return starts;
+}
+
+template <class Index>
+bool IndexBelow(Index value, size_t bound) {
+  if constexpr (std::is_signed_v<Index>) {
+    if (value < 0) {
+      return false;
+    }
+  }
+  return static_cast<size_t>(value) < bound;
+}
+
+template <class Index>
+void CheckIndexFits(size_t value, const char *what) {
+  if (value > static_cast<size_t>(std::numeric_limits<Index>::max())) {
+    throw std::overflow_error(std::string(what) + " does not fit the index type");
+  }
+}
+
+// Neighbouring equal indices of a line (left by a stable sort) summed into one entry
+template <class T, class Index, class ForEach>
+void SumDuplicates(CompressedMatrix<T, Index> &m, const ForEach &for_each) {
+  std::vector<size_t> unique(m.lines + 1, 0);
+  ForEachLineBlock(m.lines, for_each, [&](size_t begin, size_t end) {
+    for (size_t line = begin; line < end; line++) {
+      const auto first = static_cast<size_t>(m.ptr[line]);
+      const auto last = static_cast<size_t>(m.ptr[line + 1]);
+      size_t count = 0;
+      for (size_t e = first; e < last; e++) {
+        count += (e == first || m.idx[e] != m.idx[e - 1]) ? 1 : 0;
+      }
+      unique[line] = count;
+    }
+  });
+  const size_t total = ExclusiveScan(std::span<size_t>(unique), 1, ppc::util::SequentialForEach{});
+  unique[m.lines] = total;
+  if (total == m.idx.size()) {
+    return;
+  }
+  std::vector<Index> idx(total);
+  std::vector<T> val(total);
+  ForEachLineBlock(m.lines, for_each, [&](size_t begin, size_t end) {
+    for (size_t line = begin; line < end; line++) {
+      size_t out = unique[line];
+      for (auto e = static_cast<size_t>(m.ptr[line]); e < static_cast<size_t>(m.ptr[line + 1]); e++) {
+        if (out != unique[line] && idx[out - 1] == m.idx[e]) {
+          val[out - 1] += m.val[e];
+        } else {
+          idx[out] = m.idx[e];
+          val[out] = m.val[e];
+          out++;
+        }
+      }
+    }
+  });
+  for (size_t line = 0; line <= m.lines; line++) {
+    m.ptr[line] = static_cast<Index>(unique[line]);
+  }
+  m.idx = std::move(idx);
+  m.val = std::move(val);
+}
+
+}  // namespace detail
+
+// Throws std::invalid_argument naming the first defect of a compressed matrix: line pointers that
+// do not start at 0, decrease or disagree with the array sizes, indices outside [0, extent), or
+// lines whose indices are not strictly increasing (unsorted or duplicate entries)
+template <class T, class Index, class ForEach = ppc::util::SequentialForEach>
+void Validate(const CompressedView<T, Index> &m, const ForEach &for_each = {}) {
+  const auto fail = [](const std::string &what) { throw std::invalid_argument("Validate: " + what); };
+  if (m.ptr.size() != m.lines + 1) {
+    fail("expected " + std::to_string(m.lines + 1) + " line pointers, got " + std::to_string(m.ptr.size()));
+  }
+  if (m.ptr[0] != 0 || static_cast<size_t>(m.ptr[m.lines]) != m.idx.size() || m.idx.size() != m.val.size()) {
+    fail("line pointers do not span the index and value arrays");
+  }
+  // Each block records its first bad line, the message is built for the first of those
+  constexpr size_t kNone = std::numeric_limits<size_t>::max();
+  const size_t blocks = (m.lines + detail::kSparseLinesPerTask - 1) / detail::kSparseLinesPerTask;
+  std::vector<size_t> bad(blocks, kNone);
+  detail::ForEachLineBlock(m.lines, for_each, [&](size_t begin, size_t end) {
+    for (size_t line = begin; line < end && bad[begin / detail::kSparseLinesPerTask] == kNone; line++) {
+      const auto first = static_cast<size_t>(m.ptr[line]);
+      const auto last = static_cast<size_t>(m.ptr[line + 1]);
+      bool ok = first <= last && last <= m.idx.size();
+      for (size_t e = first; ok && e < last; e++) {
+        ok = detail::IndexBelow(m.idx[e], m.extent) && (e == first || m.idx[e - 1] < m.idx[e]);
+      }
+      if (!ok) {
+        bad[begin / detail::kSparseLinesPerTask] = line;
+      }
+    }
+  });
+  for (size_t line : bad) {
+    if (line != kNone) {
+      fail("line " + std::to_string(line) + " has decreasing pointers, indices outside [0, " +
+           std::to_string(m.extent) + ") or unsorted or duplicate indices");
+    }
+  }
+}
+
+// Throws std::invalid_argument if the arrays of a COO matrix differ in length or an index lies
+// outside the matrix
+template <class T, class Index>
+void Validate(const CooMatrix<T, Index> &m) {
+  if (m.row.size() != m.val.size() || m.col.size() != m.val.size()) {
+    throw std::invalid_argument("Validate: COO row, column and value arrays differ in length");
+  }
+  for (size_t e = 0; e < m.val.size(); e++) {
+    if (!detail::IndexBelow(m.row[e], m.rows) || !detail::IndexBelow(m.col[e], m.cols)) {
+      throw std::invalid_argument("Validate: COO entry " + std::to_string(e) + " lies outside the " +
+                                  std::to_string(m.rows) + " x " + std::to_string(m.cols) + " matrix");
+    }
+  }
+}
+
+// Throws std::invalid_argument if a BSR matrix has no block size, malformed block row pointers,
+// block columns out of range or not strictly increasing, or a value array of the wrong size
+template <class T, class Index>
+void Validate(const BlockMatrix<T, Index> &m) {
+  if (m.block_height == 0 || m.block_width == 0) {
+    throw std::invalid_argument("Validate: BSR block size is empty");
+  }
+  if (m.val.size() != m.idx.size() * m.BlockSize()) {
+    throw std::invalid_argument("Validate: BSR value array does not hold one dense block per block column");
+  }
+  // The block structure is checked as a compressed matrix of the block columns
+  Validate(CompressedView<T, Index>{.lines = m.BlockRows(),
+                                    .extent = m.BlockCols(),
+                                    .ptr = m.ptr,
+                                    .idx = m.idx,
+                                    .val = std::span<const T>(m.val).first(m.idx.size())});
+}
+
+// Transpose of a compressed matrix: `lines` x `extent` becomes `extent` x `lines`. Read the other
+// way, this converts between CSR and CSC: the CSR arrays of A are the CSC arrays of A^T, so the
+// result holds A in the other layout. A stable parallel counting sort by index over chunks of about
+// equal entries, which leaves every output line sorted whatever the order within input lines.
+// Indices must lie in [0, extent); Validate checks that for untrusted input.
+template <class T, class Index, class ForEach = ppc::util::SequentialForEach>
+CompressedMatrix<T, Index> Transpose(const CompressedView<T, Index> &a, const ForEach &for_each = {}) {
+  if (a.ptr.size() != a.lines + 1) {
+    throw std::invalid_argument("Transpose: line pointers are malformed");
+  }
+  detail::CheckIndexFits<Index>(a.lines, "Transpose: number of lines");
+  const auto base = static_cast<size_t>(a.ptr[0]);
+  const size_t nnz = static_cast<size_t>(a.ptr[a.lines]) - base;
+  const size_t chunks = detail::CountingSortChunks<ForEach>(nnz, a.extent);
+  // Lines are cut where the running entry count crosses multiples of nnz / chunks
+  std::vector<size_t> bounds = {0};
+  bounds.resize(chunks + 1, a.lines);
+  for (size_t chunk = 1; chunk < chunks; chunk++) {
+    const auto target = static_cast<Index>(base + (nnz * chunk / chunks));
+    const auto *first = a.ptr.data();
+    bounds[chunk] = static_cast<size_t>(std::lower_bound(first, first + a.lines, target) - first);
+  }
+
+  CompressedMatrix<T, Index> t{.lines = a.extent,
+                               .extent = a.lines,
+                               .ptr = std::vector<Index>(a.extent + 1),
+                               .idx = std::vector<Index>(nnz),
+                               .val = std::vector<T>(nnz)};
+  const auto starts = detail::CountingSort(
+      a.extent, chunks,
+      [&](size_t chunk, const auto &emit) {
+        for (size_t line = bounds[chunk]; line < bounds[chunk + 1]; line++) {
+          for (auto e = static_cast<size_t>(a.ptr[line]); e < static_cast<size_t>(a.ptr[line + 1]); e++) {
+            emit(static_cast<size_t>(a.idx[e]), line, e);
+          }
+        }
+      },
+      [&](size_t position, size_t line, size_t e) {
+        t.idx[position] = static_cast<Index>(line);
+        t.val[position] = a.val[e];
+      },
+      for_each);
+  for (size_t line = 0; line <= a.extent; line++) {
+    t.ptr[line] = static_cast<Index>(starts[line]);
+  }
+  return t;
+}
+
+// CSR (kRows) or CSC (kColumns) arrays of a COO matrix, by two stable parallel counting sorts: by
+// the minor index, then by the line, so every line comes out sorted without comparison sorts.
+// Duplicate coordinates are summed. Throws std::invalid_argument for entries outside the matrix.
+template <class T, class Index, class ForEach = ppc::util::SequentialForEach>
+CompressedMatrix<T, Index> CompressCoo(const CooMatrix<T, Index> &coo, SparseLayout layout,
+                                       const ForEach &for_each = {}) {
+  Validate(coo);
+  const bool by_rows = layout == SparseLayout::kRows;
+  const std::vector<Index> &major = by_rows ? coo.row : coo.col;
+  const std::vector<Index> &minor = by_rows ? coo.col : coo.row;
+  const size_t nnz = coo.val.size();
+  detail::CheckIndexFits<Index>(nnz, "CompressCoo: number of entries");
+  CompressedMatrix<T, Index> c{.lines = by_rows ? coo.rows : coo.cols,
+                               .extent = by_rows ? coo.cols : coo.rows,
+                               .ptr = {},
+                               .idx = std::vector<Index>(nnz),
+                               .val = std::vector<T>(nnz)};
+
+  // First pass: entry numbers ordered by the minor index
+  std::vector<Index> order(nnz);
+  size_t chunks = detail::CountingSortChunks<ForEach>(nnz, c.extent);
+  detail::CountingSort(
+      c.extent, chunks,
+      [&](size_t chunk, const auto &emit) {
+        for (size_t e = nnz * chunk / chunks; e < nnz * (chunk + 1) / chunks; e++) {
+          emit(static_cast<size_t>(minor[e]), e);
+        }
+      },
+      [&](size_t position, size_t e) { order[position] = static_cast<Index>(e); }, for_each);
+
+  // Second pass: stable by line, gathering the entries in that order
+  chunks = detail::CountingSortChunks<ForEach>(nnz, c.lines);
+  const auto starts = detail::CountingSort(
+      c.lines, chunks,
+      [&](size_t chunk, const auto &emit) {
+        for (size_t p = nnz * chunk / chunks; p < nnz * (chunk + 1) / chunks; p++) {
+          const auto e = static_cast<size_t>(order[p]);
+          emit(static_cast<size_t>(major[e]), e);
+        }
+      },
+      [&](size_t position, size_t e) {
+        c.idx[position] = minor[e];
+        c.val[position] = coo.val[e];
+      },
+      for_each);
+  c.ptr.resize(c.lines + 1);
+  for (size_t line = 0; line <= c.lines; line++) {
+    c.ptr[line] = static_cast<Index>(starts[line]);
+  }
+  detail::SumDuplicates(c, for_each);
+  return c;
+}
+
+// COO entries of a compressed matrix whose lines are rows (kRows) or columns (kColumns), in line
+// order
+template <class T, class Index, class ForEach = ppc::util::SequentialForEach>
+CooMatrix<T, Index> ToCoo(const CompressedView<T, Index> &m, SparseLayout layout, const ForEach &for_each = {}) {
+  const bool by_rows = layout == SparseLayout::kRows;
+  const auto base = static_cast<size_t>(m.ptr[0]);
+  const size_t nnz = static_cast<size_t>(m.ptr[m.lines]) - base;
+  CooMatrix<T, Index> coo{.rows = by_rows ? m.lines : m.extent,
+                          .cols = by_rows ? m.extent : m.lines,
+                          .row = std::vector<Index>(nnz),
+                          .col = std::vector<Index>(nnz),
+                          .val = std::vector<T>(nnz)};
+  std::vector<Index> &major = by_rows ? coo.row : coo.col;
+  std::vector<Index> &minor = by_rows ? coo.col : coo.row;
+  detail::ForEachLineBlock(m.lines, for_each, [&](size_t begin, size_t end) {
+    for (size_t line = begin; line < end; line++) {
+      for (auto e = static_cast<size_t>(m.ptr[line]); e < static_cast<size_t>(m.ptr[line + 1]); e++) {
+        major[e - base] = static_cast<Index>(line);
+        minor[e - base] = m.idx[e];
+        coo.val[e - base] = m.val[e];
+      }
+    }
+  });
+  return coo;
+}
+
+// BSR form of a CSR matrix (lines are rows) with block_height x block_width blocks. Every block
+// holding at least one entry is stored; its other values are zero.
+template <class T, class Index, class ForEach = ppc::util::SequentialForEach>
+BlockMatrix<T, Index> ToBlocks(const CompressedView<T, Index> &csr, size_t block_height, size_t block_width,
+                               const ForEach &for_each = {}) {
+  if (block_height == 0 || block_width == 0) {
+    throw std::invalid_argument("ToBlocks: block size is empty");
+  }
+  BlockMatrix<T, Index> b{.rows = csr.lines,
+                          .cols = csr.extent,
+                          .block_height = block_height,
+                          .block_width = block_width,
+                          .ptr = {},
+                          .idx = {},
+                          .val = {}};
+  const size_t block_rows = b.BlockRows();
+  // Sorted distinct block columns of block row `block_row`, gathered into `columns`
+  const auto block_columns = [&](size_t block_row, std::vector<Index> &columns) {
+    columns.clear();
+    const size_t last_row = std::min(csr.lines, (block_row + 1) * block_height);
+    for (size_t row = block_row * block_height; row < last_row; row++) {
+      for (auto e = static_cast<size_t>(csr.ptr[row]); e < static_cast<size_t>(csr.ptr[row + 1]); e++) {
+        columns.push_back(static_cast<Index>(static_cast<size_t>(csr.idx[e]) / block_width));
+      }
+    }
+    std::ranges::sort(columns);
+    columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+  };
+
+  std::vector<size_t> counts(block_rows + 1, 0);
+  detail::ForEachLineBlock(block_rows, for_each, [&](size_t begin, size_t end) {
+    std::vector<Index> columns;
+    for (size_t block_row = begin; block_row < end; block_row++) {
+      block_columns(block_row, columns);
+      counts[block_row] = columns.size();
+    }
+  });
+  const size_t total = ExclusiveScan(std::span<size_t>(counts), 1, ppc::util::SequentialForEach{});
+  counts[block_rows] = total;
+  detail::CheckIndexFits<Index>(total, "ToBlocks: number of blocks");
+  b.ptr.resize(block_rows + 1);
+  for (size_t block_row = 0; block_row <= block_rows; block_row++) {
+    b.ptr[block_row] = static_cast<Index>(counts[block_row]);
+  }
+  b.idx.resize(total);
+  b.val.assign(total * b.BlockSize(), T{});
+
+  detail::ForEachLineBlock(block_rows, for_each, [&](size_t begin, size_t end) {
+    std::vector<Index> columns;
+    for (size_t block_row = begin; block_row < end; block_row++) {
+      block_columns(block_row, columns);
+      const size_t first = counts[block_row];
+      std::ranges::copy(columns, b.idx.begin() + static_cast<std::ptrdiff_t>(first));
+      const size_t last_row = std::min(csr.lines, (block_row + 1) * block_height);
+      for (size_t row = block_row * block_height; row < last_row; row++) {
+        for (auto e = static_cast<size_t>(csr.ptr[row]); e < static_cast<size_t>(csr.ptr[row + 1]); e++) {
+          const auto col = static_cast<size_t>(csr.idx[e]);
+          const auto block_col = static_cast<Index>(col / block_width);
+          const auto slot = static_cast<size_t>(std::ranges::lower_bound(columns, block_col) - columns.begin());
+          const size_t offset = ((first + slot) * b.BlockSize()) + ((row % block_height) * block_width);
+          b.val[offset + (col % block_width)] = csr.val[e];
+        }
+      }
+    }
+  });
+  return b;
+}
+
+// CSR form of a BSR matrix. Values equal to T{}, such as the padding of blocks, are not stored.
+template <class T, class Index, class ForEach = ppc::util::SequentialForEach>
+CompressedMatrix<T, Index> FromBlocks(const BlockMatrix<T, Index> &b, const ForEach &for_each = {}) {
+  Validate(b);
+  const size_t block_rows = b.BlockRows();
+  // body(row, col, value) for the stored nonzeros of the rows of block row `block_row`, in row-major order
+  const auto for_each_entry = [&](size_t block_row, const auto &body) {
+    const size_t last_row = std::min(b.rows, (block_row + 1) * b.block_height);
+    for (size_t row = block_row * b.block_height; row < last_row; row++) {
+      for (auto p = static_cast<size_t>(b.ptr[block_row]); p < static_cast<size_t>(b.ptr[block_row + 1]); p++) {
+        const T *values = &b.val[(p * b.BlockSize()) + ((row % b.block_height) * b.block_width)];
+        const size_t first_col = static_cast<size_t>(b.idx[p]) * b.block_width;
+        for (size_t j = 0; j < b.block_width && first_col + j < b.cols; j++) {
+          if (values[j] != T{}) {
+            body(row, first_col + j, values[j]);
+          }
+        }
+      }
+    }
+  };
+
+  std::vector<size_t> counts(b.rows + 1, 0);
+  detail::ForEachLineBlock(block_rows, for_each, [&](size_t begin, size_t end) {
+    for (size_t block_row = begin; block_row < end; block_row++) {
+      for_each_entry(block_row, [&](size_t row, size_t /*col*/, const T & /*value*/) { counts[row]++; });
+    }
+  });
+  const size_t total = ExclusiveScan(std::span<size_t>(counts), 1, ppc::util::SequentialForEach{});
+  counts[b.rows] = total;
+  detail::CheckIndexFits<Index>(total, "FromBlocks: number of entries");
+  CompressedMatrix<T, Index> csr{.lines = b.rows,
+                                 .extent = b.cols,
+                                 .ptr = std::vector<Index>(b.rows + 1),
+                                 .idx = std::vector<Index>(total),
+                                 .val = std::vector<T>(total)};
+  for (size_t row = 0; row <= b.rows; row++) {
+    csr.ptr[row] = static_cast<Index>(counts[row]);
+  }
+  detail::ForEachLineBlock(block_rows, for_each, [&](size_t begin, size_t end) {
+    for (size_t block_row = begin; block_row < end; block_row++) {
+      for_each_entry(block_row, [&](size_t row, size_t col, const T &value) {
+        const size_t position = counts[row]++;
+        csr.idx[position] = static_cast<Index>(col);
+        csr.val[position] = value;
+      });
+    }
+  });
+  return csr;
+}
+
+}  // namespace ppc::core
@@ -0,0 +1,332 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "core/arena/include/arena.hpp"
+#include "core/util/include/for_each.hpp"
+
+namespace ppc::core {
+
+// Read-only view of a compressed sparse matrix: `lines` columns (CCS) or rows (CRS) of `extent`
+// entries each. Line j holds the indices idx[ptr[j]..ptr[j + 1]) in increasing order and their
+// values val[ptr[j]..ptr[j + 1]).
+template <class T, class Index = int>
+struct CompressedView {
+  size_t lines = 0;
+  size_t extent = 0;
+  std::span<const Index> ptr;
+  std::span<const Index> idx;
+  std::span<const T> val;
+};
+
+template <class T, class Index = int>
+struct CompressedMatrix {
+  size_t lines = 0;
+  size_t extent = 0;
+  std::vector<Index> ptr;
+  std::vector<Index> idx;
+  std::vector<T> val;
+
+  [[nodiscard]] CompressedView<T, Index> View() const {
+    return {.lines = lines, .extent = extent, .ptr = ptr, .idx = idx, .val = val};
+  }
+};
+
+// Default filter of SpGemm: every structural nonzero of the product is stored, even when its
+// entries cancel out
+struct KeepAll {
+  template <class T>
+  bool operator()(const T & /*value*/) const {
+    return true;
+  }
+};
+
+// Splits lines [0, cost.size()) into consecutive chunks of about equal total cost, each of at least
+// min_chunk_cost (but the last) and at most max_chunks of them. Returns the chunk boundaries,
+// starting with 0 and ending with cost.size().
+std::vector<size_t> SplitByCost(std::span<const size_t> cost, size_t min_chunk_cost, size_t max_chunks);
+
+namespace detail {
+
+// Multiply-adds per chunk below which a chunk is not worth a task, and the cap on chunks
+constexpr size_t kSpGemmMinChunkFlops = size_t{1} << 15;
+constexpr size_t kSpGemmMaxChunks = 1024;
+// A line whose flops reach extent / kSpGemmDenseRatio accumulates into a dense array of the
+// extent; sparser lines use a hash table of at least twice their flops, which stays in L1/L2 where
+// a dense array of a 10^6 extent would miss on every update
+constexpr size_t kSpGemmDenseRatio = 4;
+// Dense lines with more than extent / kSpGemmScanRatio nonzeros are emitted by a scan of the
+// marks instead of sorting their indices
+constexpr size_t kSpGemmScanRatio = 16;
+
+inline bool SpGemmUsesDense(size_t flops, size_t extent) { return flops * kSpGemmDenseRatio >= extent; }
+
+inline size_t SpGemmHashSize(size_t flops) { return std::bit_ceil(std::max<size_t>(flops * 2, 8)); }
+
+template <class Index>
+size_t SpGemmHashSlot(Index key, size_t mask) {
+  return static_cast<size_t>((static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ULL) >> 32) & mask;
+}
+
+// Scratch of one chunk: dense marks stamped with line + 1 (so they never need clearing within the
+// chunk) or an open-addressing table cleared per line
+template <class T, class Index, bool kNumeric>
+class SpGemmAccumulator {
+ public:
+  SpGemmAccumulator(Arena &arena, size_t extent, size_t max_dense_extent, size_t max_hash_size)
+      : extent_(extent) {
+    if (max_dense_extent != 0) {
+      marks_ = arena.AllocateArray<size_t>(extent);
+      std::ranges::fill(marks_, size_t{0});
+      if constexpr (kNumeric) {
+        dense_ = arena.AllocateArray<T>(extent);
+      }
+    }
+    if (max_hash_size != 0) {
+      keys_ = arena.AllocateArray<Index>(max_hash_size);
+      if constexpr (kNumeric) {
+        hashed_ = arena.AllocateArray<T>(max_hash_size);
+      }
+    }
+  }
+
+  // Union of the columns of `a` picked by line `line` of `b`, scaled by its values when numeric.
+  // Returns the number of distinct indices; numeric passes also store the sorted line at out_idx /
+  // out_val, keeping only the entries `keep` accepts, and return the number kept.
+  template <class Keep>
+  size_t Line(const CompressedView<T, Index> &a, const CompressedView<T, Index> &b, size_t line, size_t flops,
+              Index *out_idx, T *out_val, const Keep &keep) {
+    return SpGemmUsesDense(flops, extent_) ? DenseLine(a, b, line, out_idx, out_val, keep)
+                                           : HashLine(a, b, line, flops, out_idx, out_val, keep);
+  }
+
+ private:
+  static constexpr Index kEmpty = std::numeric_limits<Index>::max();
+
+  template <class Visit>
+  static void ForEachProduct(const CompressedView<T, Index> &a, const CompressedView<T, Index> &b, size_t line,
+                             const Visit &visit) {
+    for (auto e = static_cast<size_t>(b.ptr[line]); e < static_cast<size_t>(b.ptr[line + 1]); e++) {
+      const auto k = static_cast<size_t>(b.idx[e]);
+      for (auto p = static_cast<size_t>(a.ptr[k]); p < static_cast<size_t>(a.ptr[k + 1]); p++) {
+        if constexpr (kNumeric) {
+          visit(a.idx[p], a.val[p] * b.val[e]);
+        } else {
+          visit(a.idx[p], T{});
+        }
+      }
+    }
+  }
+
+  template <class Keep>
+  size_t DenseLine(const CompressedView<T, Index> &a, const CompressedView<T, Index> &b, size_t line,
+                   Index *out_idx, T *out_val, const Keep &keep) {
+    const size_t stamp = line + 1;
+    size_t count = 0;
+    ForEachProduct(a, b, line, [&](Index row, const T &product) {
+      const auto r = static_cast<size_t>(row);
+      if (marks_[r] != stamp) {
+        marks_[r] = stamp;
+        if constexpr (kNumeric) {
+          // Summed onto zero like a zeroed accumulator would be, so -0.0 products come out as 0.0
+          dense_[r] = T{} + product;
+          out_idx[count] = row;
+        }
+        count++;
+      } else if constexpr (kNumeric) {
+        dense_[r] += product;
+      }
+    });
+    if constexpr (!kNumeric) {
+      return count;
+    } else {
+      if (count * kSpGemmScanRatio > extent_) {
+        size_t pos = 0;
+        for (size_t r = 0; r < extent_; r++) {
+          if (marks_[r] == stamp) {
+            out_idx[pos++] = static_cast<Index>(r);
+          }
+        }
+      } else {
+        std::sort(out_idx, out_idx + count);
+      }
+      size_t kept = 0;
+      for (size_t i = 0; i < count; i++) {
+        const auto r = static_cast<size_t>(out_idx[i]);
+        if (keep(dense_[r])) {
+          out_idx[kept] = out_idx[i];
+          out_val[kept++] = dense_[r];
+        }
+      }
+      return kept;
+    }
+  }
+
+  template <class Keep>
+  size_t HashLine(const CompressedView<T, Index> &a, const CompressedView<T, Index> &b, size_t line, size_t flops,
+                  Index *out_idx, T *out_val, const Keep &keep) {
+    const size_t size = SpGemmHashSize(flops);
+    const size_t mask = size - 1;
+    std::fill(keys_.begin(), keys_.begin() + static_cast<std::ptrdiff_t>(size), kEmpty);
+    size_t count = 0;
+    ForEachProduct(a, b, line, [&](Index row, const T &product) {
+      size_t slot = SpGemmHashSlot(row, mask);
+      while (keys_[slot] != row && keys_[slot] != kEmpty) {
+        slot = (slot + 1) & mask;
+      }
+      if (keys_[slot] == kEmpty) {
+        keys_[slot] = row;
+        if constexpr (kNumeric) {
+          hashed_[slot] = T{} + product;
+          out_idx[count] = row;
+        }
+        count++;
+      } else if constexpr (kNumeric) {
+        hashed_[slot] += product;
+      }
+    });
+    if constexpr (!kNumeric) {
+      return count;
+    } else {
+      std::sort(out_idx, out_idx + count);
+      size_t kept = 0;
+      for (size_t i = 0; i < count; i++) {
+        const Index row = out_idx[i];
+        size_t slot = SpGemmHashSlot(row, mask);
+        while (keys_[slot] != row) {
+          slot = (slot + 1) & mask;
+        }
+        if (keep(hashed_[slot])) {
+          out_idx[kept] = row;
+          out_val[kept++] = hashed_[slot];
+        }
+      }
+      return kept;
+    }
+  }
+
+  size_t extent_;
+  std::span<size_t> marks_;
+  std::span<T> dense_;
+  std::span<Index> keys_;
+  std::span<T> hashed_;
+};
+
+// Runs one pass over the chunks; body(accumulator, line, flops) handles a line
+template <class T, class Index, bool kNumeric, class ForEach, class Body>
+void SpGemmPass(const CompressedView<T, Index> &a, std::span<const size_t> flops, std::span<const size_t> chunks,
+                const ForEach &for_each, const Body &body) {
+  for_each(chunks.size() - 1, [&](size_t chunk) {
+    size_t max_hash = 0;
+    bool dense = false;
+    for (size_t line = chunks[chunk]; line < chunks[chunk + 1]; line++) {
+      if (SpGemmUsesDense(flops[line], a.extent)) {
+        dense = true;
+      } else if (flops[line] != 0) {
+        max_hash = std::max(max_hash, SpGemmHashSize(flops[line]));
+      }
+    }
+    Arena &arena = ThreadArena();
+    ArenaScope scope(arena);
+    SpGemmAccumulator<T, Index, kNumeric> accumulator(arena, a.extent, dense ? a.extent : 0, max_hash);
+    for (size_t line = chunks[chunk]; line < chunks[chunk + 1]; line++) {
+      if (flops[line] != 0) {
+        body(accumulator, line, flops[line]);
+      }
+    }
+  });
+}
+
+}  // namespace detail
+
+// C = A * B for compressed-column A (m x k: k lines of extent m) and B (k x n), as a compressed-
+// column m x n matrix; with the operands swapped the same call multiplies compressed-row matrices,
+// SpGemm(b_crs, a_crs) is the CRS form of A * B. Gustavson's algorithm in two passes: a symbolic
+// pass counts the exact nonzeros of every output line, C is allocated once, and a numeric pass
+// fills each line in place. Each line accumulates into a dense array or a hash table, whichever
+// its flop count (multiply-adds) makes cheaper. Entries of an output line are summed in increasing
+// inner index. Lines are split into chunks of about equal flops run on `for_each`; `keep` drops
+// values such as cancelled zeros before they are stored. Throws std::invalid_argument if the
+// inner dimensions differ and std::overflow_error if C's nonzeros do not fit Index.
+template <class T, class Index, class ForEach = ppc::util::SequentialForEach, class Keep = KeepAll>
+CompressedMatrix<T, Index> SpGemm(const CompressedView<T, Index> &a, const CompressedView<T, Index> &b,
+                                  const ForEach &for_each = {}, const Keep &keep = {}) {
+  if (a.lines != b.extent || a.ptr.size() != a.lines + 1 || b.ptr.size() != b.lines + 1) {
+    throw std::invalid_argument("SpGemm: inner dimensions differ or line pointers are malformed");
+  }
+  CompressedMatrix<T, Index> c{
+      .lines = b.lines, .extent = a.extent, .ptr = std::vector<Index>(b.lines + 1), .idx = {}, .val = {}};
+
+  std::vector<size_t> flops(b.lines);
+  constexpr size_t kLinesPerTask = 4096;
+  for_each((b.lines + kLinesPerTask - 1) / kLinesPerTask, [&](size_t block) {
+    for (size_t line = block * kLinesPerTask; line < std::min(b.lines, (block + 1) * kLinesPerTask); line++) {
+      size_t count = 0;
+      for (auto e = static_cast<size_t>(b.ptr[line]); e < static_cast<size_t>(b.ptr[line + 1]); e++) {
+        const auto k = static_cast<size_t>(b.idx[e]);
+        count += static_cast<size_t>(a.ptr[k + 1] - a.ptr[k]);
+      }
+      flops[line] = count;
+    }
+  });
+  std::vector<size_t> chunks;
+  if constexpr (std::is_same_v<ForEach, ppc::util::SequentialForEach>) {
+    chunks = {0, b.lines};
+  } else {
+    chunks = SplitByCost(flops, detail::kSpGemmMinChunkFlops, detail::kSpGemmMaxChunks);
+  }
+
+  // Symbolic pass: nonzeros per line, then one allocation of C
+  std::vector<size_t> nnz(b.lines, 0);
+  detail::SpGemmPass<T, Index, false>(a, flops, chunks, for_each, [&](auto &accumulator, size_t line, size_t f) {
+    nnz[line] = accumulator.Line(a, b, line, f, nullptr, nullptr, keep);
+  });
+  size_t total = 0;
+  for (size_t line = 0; line < b.lines; line++) {
+    total += nnz[line];
+    if (total > static_cast<size_t>(std::numeric_limits<Index>::max())) {
+      throw std::overflow_error("SpGemm: nonzeros of the product overflow the index type");
+    }
+    c.ptr[line + 1] = static_cast<Index>(total);
+  }
+  c.idx.resize(total);
+  c.val.resize(total);
+
+  // Numeric pass: every line fills its own slice of C
+  detail::SpGemmPass<T, Index, true>(a, flops, chunks, for_each, [&](auto &accumulator, size_t line, size_t f) {
+    const auto begin = static_cast<size_t>(c.ptr[line]);
+    nnz[line] = accumulator.Line(a, b, line, f, c.idx.data() + begin, c.val.data() + begin, keep);
+  });
+
+  // Entries `keep` rejected leave gaps at the end of their lines, close them
+  if constexpr (!std::is_same_v<Keep, KeepAll>) {
+    size_t write = 0;
+    for (size_t line = 0; line < b.lines; line++) {
+      const auto begin = static_cast<size_t>(c.ptr[line]);
+      if (write != begin) {
+        std::copy(c.idx.begin() + static_cast<std::ptrdiff_t>(begin),
+                  c.idx.begin() + static_cast<std::ptrdiff_t>(begin + nnz[line]),
+                  c.idx.begin() + static_cast<std::ptrdiff_t>(write));
+        std::copy(c.val.begin() + static_cast<std::ptrdiff_t>(begin),
+                  c.val.begin() + static_cast<std::ptrdiff_t>(begin + nnz[line]),
+                  c.val.begin() + static_cast<std::ptrdiff_t>(write));
+      }
+      c.ptr[line] = static_cast<Index>(write);
+      write += nnz[line];
+    }
+    c.ptr[b.lines] = static_cast<Index>(write);
+    c.idx.resize(write);
+    c.val.resize(write);
+  }
+  return c;
+}
+
+}  // namespace ppc::core
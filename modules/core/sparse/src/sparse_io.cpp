@@ -0,0 +1,246 @@
+#include "core/sparse/include/sparse_io.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "core/util/include/file_io.hpp"
+
+namespace {
+
+[[noreturn]] void ThrowFormatError(const std::string &what) {
+  throw std::runtime_error("MatrixMarket: " + what);
+}
+
+bool IsBlank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+// Line starting at pos without its terminator; pos moves to the next line
+std::string_view NextLine(std::string_view text, size_t &pos) {
+  const size_t end = std::min(text.find('\n', pos), text.size());
+  std::string_view line = text.substr(pos, end - pos);
+  pos = std::min(end + 1, text.size());
+  while (!line.empty() && IsBlank(line.back())) {
+    line.remove_suffix(1);
+  }
+  return line;
+}
+
+std::vector<std::string> LowercaseTokens(std::string_view line) {
+  std::vector<std::string> tokens;
+  size_t pos = 0;
+  while (pos < line.size()) {
+    while (pos < line.size() && IsBlank(line[pos])) {
+      pos++;
+    }
+    std::string token;
+    while (pos < line.size() && !IsBlank(line[pos])) {
+      token += static_cast<char>(std::tolower(static_cast<unsigned char>(line[pos++])));
+    }
+    if (!token.empty()) {
+      tokens.push_back(std::move(token));
+    }
+  }
+  return tokens;
+}
+
+// Number at text[pos] after blanks; pos moves past it
+template <class T>
+bool ParseNumber(std::string_view text, size_t &pos, T &value) {
+  while (pos < text.size() && IsBlank(text[pos])) {
+    pos++;
+  }
+  // from_chars takes no explicit plus sign
+  if (pos < text.size() && text[pos] == '+') {
+    pos++;
+  }
+  const char *begin = text.data() + pos;
+  const auto [end, error] = std::from_chars(begin, text.data() + text.size(), value);
+  if (error != std::errc{}) {
+    return false;
+  }
+  pos += static_cast<size_t>(end - begin);
+  return true;
+}
+
+size_t AlignUp(size_t offset) {
+  constexpr size_t kAlign = ppc::core::detail::kSparseBinaryAlignment;
+  return (offset + kAlign - 1) / kAlign * kAlign;
+}
+
+}  // namespace
+
+ppc::core::detail::MatrixMarketHeader ppc::core::detail::ParseMatrixMarketHeader(std::string_view text) {
+  size_t pos = 0;
+  const auto banner = LowercaseTokens(NextLine(text, pos));
+  if (banner.size() != 5 || banner[0] != "%%matrixmarket" || banner[1] != "matrix") {
+    ThrowFormatError("missing %%MatrixMarket matrix banner");
+  }
+  if (banner[2] != "coordinate") {
+    ThrowFormatError("only coordinate matrices are supported, not " + banner[2]);
+  }
+
+  MatrixMarketHeader header;
+  if (banner[3] == "real") {
+    header.field = MatrixMarketField::kReal;
+  } else if (banner[3] == "integer") {
+    header.field = MatrixMarketField::kInteger;
+  } else if (banner[3] == "complex") {
+    header.field = MatrixMarketField::kComplex;
+  } else if (banner[3] == "pattern") {
+    header.field = MatrixMarketField::kPattern;
+  } else {
+    ThrowFormatError("unknown field " + banner[3]);
+  }
+  if (banner[4] == "general") {
+    header.symmetry = MatrixMarketSymmetry::kGeneral;
+  } else if (banner[4] == "symmetric") {
+    header.symmetry = MatrixMarketSymmetry::kSymmetric;
+  } else if (banner[4] == "skew-symmetric") {
+    header.symmetry = MatrixMarketSymmetry::kSkewSymmetric;
+  } else if (banner[4] == "hermitian") {
+    header.symmetry = MatrixMarketSymmetry::kHermitian;
+  } else {
+    ThrowFormatError("unknown symmetry " + banner[4]);
+  }
+
+  std::string_view line;
+  do {
+    if (pos >= text.size()) {
+      ThrowFormatError("missing size line");
+    }
+    line = NextLine(text, pos);
+  } while (line.empty() || line.front() == '%');
+  size_t at = 0;
+  if (!ParseNumber(line, at, header.rows) || !ParseNumber(line, at, header.cols) ||
+      !ParseNumber(line, at, header.entries) || at != line.size()) {
+    ThrowFormatError("malformed size line");
+  }
+  header.data_offset = pos;
+  return header;
+}
+
+std::vector<size_t> ppc::core::detail::SplitAtLines(std::string_view text, size_t begin, size_t parts) {
+  std::vector<size_t> bounds{begin};
+  const size_t size = text.size() - std::min(begin, text.size());
+  for (size_t part = 1; part < parts; part++) {
+    const size_t target = std::max(begin + (size * part / parts), bounds.back());
+    const size_t line_end = text.find('\n', target);
+    if (line_end == std::string_view::npos || line_end + 1 >= text.size()) {
+      break;
+    }
+    if (line_end + 1 > bounds.back()) {
+      bounds.push_back(line_end + 1);
+    }
+  }
+  bounds.push_back(std::max(text.size(), begin));
+  return bounds;
+}
+
+bool ppc::core::detail::NextMatrixMarketEntry(std::string_view text, size_t &pos, MatrixMarketField field,
+                                              MatrixMarketEntry &entry) {
+  std::string_view line;
+  do {
+    if (pos >= text.size()) {
+      return false;
+    }
+    line = NextLine(text, pos);
+    while (!line.empty() && IsBlank(line.front())) {
+      line.remove_prefix(1);
+    }
+  } while (line.empty() || line.front() == '%');
+
+  size_t at = 0;
+  bool ok = ParseNumber(line, at, entry.row) && ParseNumber(line, at, entry.col);
+  entry.re = 1.0;
+  entry.im = 0.0;
+  if (ok && field != MatrixMarketField::kPattern) {
+    ok = ParseNumber(line, at, entry.re);
+  }
+  if (ok && field == MatrixMarketField::kComplex) {
+    ok = ParseNumber(line, at, entry.im);
+  }
+  if (!ok || at != line.size()) {
+    ThrowFormatError("malformed entry line '" + std::string(line) + "'");
+  }
+  return true;
+}
+
+void ppc::core::detail::AppendMatrixMarketEntry(std::string &out, size_t row, size_t col, double re,
+                                                const double *im) {
+  std::array<char, 32> buffer{};
+  const auto append = [&](auto value, char separator) {
+    // Shortest form that reads back to the same value
+    out.append(buffer.data(), std::to_chars(buffer.data(), buffer.data() + buffer.size(), value).ptr);
+    out.push_back(separator);
+  };
+  append(row, ' ');
+  append(col, ' ');
+  if (im == nullptr) {
+    append(re, '\n');
+  } else {
+    append(re, ' ');
+    append(*im, '\n');
+  }
+}
+
+ppc::core::detail::SparseBinaryLayout ppc::core::detail::ComputeSparseBinaryLayout(size_t lines, size_t nnz,
+                                                                                   size_t index_size,
+                                                                                   size_t value_size) {
+  SparseBinaryLayout layout{};
+  layout.ptr_offset = AlignUp(sizeof(SparseBinaryHeader));
+  layout.idx_offset = AlignUp(layout.ptr_offset + ((lines + 1) * index_size));
+  layout.val_offset = AlignUp(layout.idx_offset + (nnz * index_size));
+  layout.file_size = layout.val_offset + (nnz * value_size);
+  return layout;
+}
+
+ppc::core::detail::SparseBinaryHeader ppc::core::detail::ReadSparseBinaryHeader(std::span<const std::byte> bytes,
+                                                                                std::uint32_t value_code,
+                                                                                std::uint32_t index_code,
+                                                                                size_t index_size, size_t value_size) {
+  SparseBinaryHeader header{};
+  if (bytes.size() < sizeof(header)) {
+    throw std::runtime_error("Sparse binary: file too short for its header");
+  }
+  std::memcpy(&header, bytes.data(), sizeof(header));
+  if (std::string_view(header.magic.data(), header.magic.size()) != "PPCSPMAT" ||
+      header.version != kSparseBinaryVersion || header.byte_order != kSparseBinaryByteOrder) {
+    throw std::runtime_error("Sparse binary: not a matrix file of this version and byte order");
+  }
+  if (header.value_code != value_code || header.index_code != index_code) {
+    throw std::invalid_argument("Sparse binary: file stores another value or index type");
+  }
+  // Sizes beyond the file are rejected before they can overflow the layout arithmetic
+  if (header.lines >= bytes.size() || header.nnz > bytes.size() ||
+      ComputeSparseBinaryLayout(header.lines, header.nnz, index_size, value_size).file_size > bytes.size()) {
+    throw std::runtime_error("Sparse binary: file is truncated");
+  }
+  return header;
+}
+
+void ppc::core::detail::WriteSparseBinaryFile(const std::filesystem::path &path, const SparseBinaryHeader &header,
+                                              const SparseBinaryLayout &layout, std::span<const std::byte> ptr,
+                                              std::span<const std::byte> idx, std::span<const std::byte> val) {
+  const std::array<std::byte, kSparseBinaryAlignment> padding{};
+  ppc::util::FileWriter writer(path);
+  const auto write_at = [&](size_t offset, std::span<const std::byte> bytes) {
+    writer.Write(std::span(padding).first(offset - writer.BytesWritten()));
+    writer.Write(bytes);
+  };
+  write_at(0, std::as_bytes(std::span(&header, 1)));
+  write_at(layout.ptr_offset, ptr);
+  write_at(layout.idx_offset, idx);
+  write_at(layout.val_offset, val);
+  writer.Close();
+}
@@ -0,0 +1,31 @@
+#include "core/sparse/include/spgemm.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+std::vector<size_t> ppc::core::SplitByCost(std::span<const size_t> cost, size_t min_chunk_cost, size_t max_chunks) {
+  size_t total = 0;
+  for (size_t c : cost) {
+    total += c;
+  }
+  max_chunks = std::max<size_t>(max_chunks, 1);
+  const size_t target = std::max({min_chunk_cost, (total + max_chunks - 1) / max_chunks, size_t{1}});
+
+  std::vector<size_t> bounds{0};
+  size_t accumulated = 0;
+  for (size_t i = 0; i < cost.size(); i++) {
+    accumulated += cost[i];
+    if (accumulated >= target && i + 1 < cost.size()) {
+      bounds.push_back(i + 1);
+      accumulated = 0;
+    }
+  }
+  // Every chunk but the last holds at least `target`, so at most one chunk too many can appear
+  if (bounds.size() > max_chunks) {
+    bounds.pop_back();
+  }
+  bounds.push_back(cost.size());
+  return bounds;
+}
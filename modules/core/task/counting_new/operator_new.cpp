@@ -0,0 +1,76 @@
+// Replaces global operator new with one that reports to ppc::core::CountAllocation. Kept out of
+// core_module_lib: only binaries linking the core_counting_new object library get it.
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "core/task/include/alloc_counter.hpp"
+
+// Sanitizers intercept operator new themselves, replacing it would hide their reports
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+#define PPC_COUNT_OPERATOR_NEW 0
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer) || __has_feature(memory_sanitizer)
+#define PPC_COUNT_OPERATOR_NEW 0
+#endif
+#endif
+#ifndef PPC_COUNT_OPERATOR_NEW
+#define PPC_COUNT_OPERATOR_NEW 1
+#endif
+
+#if PPC_COUNT_OPERATOR_NEW
+namespace {
+
+void *AllocateCounted(size_t size) {
+  ppc::core::CountAllocation(size);
+  if (size == 0) {
+    size = 1;
+  }
+  while (true) {
+    void *ptr = std::malloc(size);
+    if (ptr != nullptr) {
+      return ptr;
+    }
+    std::new_handler handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+#ifndef _WIN32
+void *AllocateCountedAligned(size_t size, std::align_val_t alignment) {
+  ppc::core::CountAllocation(size);
+  const auto align = static_cast<size_t>(alignment);
+  // aligned_alloc wants a size multiple of the alignment
+  const size_t rounded = size == 0 ? align : (size + align - 1) / align * align;
+  while (true) {
+    void *ptr = std::aligned_alloc(align, rounded);
+    if (ptr != nullptr) {
+      return ptr;
+    }
+    std::new_handler handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+#endif
+
+[[maybe_unused]] const bool kMarked = (ppc::core::MarkOperatorNewCounted(), true);
+
+}  // namespace
+
+// Array, nothrow and sized forms of the standard library forward to these two
+void *operator new(std::size_t size) { return AllocateCounted(size); }
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t /*size*/) noexcept { std::free(ptr); }
+#ifndef _WIN32
+// Windows pairs aligned new with _aligned_free, so the runtime's own versions are kept there
+void *operator new(std::size_t size, std::align_val_t alignment) { return AllocateCountedAligned(size, alignment); }
+void operator delete(void *ptr, std::align_val_t /*alignment*/) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept { std::free(ptr); }
+#endif
+#endif
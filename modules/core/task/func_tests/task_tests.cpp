@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "core/task/func_tests/test_task.hpp"
+#include "core/task/include/alloc_counter.hpp"
 #include "core/task/include/task.hpp"
 
 TEST(task_tests, check_int32_t) {
@@ -178,6 +179,122 @@ TEST(task_tests, check_wrong_order) {
   ASSERT_ANY_THROW(test_task.PostProcessing());
 }
 
+TEST(task_tests, check_typed_views_of_task_data) {
+  std::vector<double> matrix(6, 0.0);
+  std::vector<int32_t> out(1, 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(matrix.data(), {2, 3});
+  task_data->AdoptInput(std::vector<int32_t>{1, 2, 3}, {3});
+  task_data->AddOutput(out.data(), {1});
+
+  auto view = task_data->InputView<double>(0);
+  ASSERT_EQ(view.Rank(), 2U);
+  EXPECT_EQ(view.Size(), 6U);
+  EXPECT_EQ(view.Stride(0), 3);
+  EXPECT_TRUE(view.IsContiguous());
+  view(1, 2) = 5.0;
+  EXPECT_EQ(matrix[5], 5.0);
+  EXPECT_EQ(task_data->inputs_count[0], 6U);
+
+  auto adopted = task_data->InputView<const int32_t>(1);
+  EXPECT_EQ(task_data->inputs_desc[1].ownership, ppc::core::BufferDesc::kOwned);
+  EXPECT_EQ(adopted[2], 3);
+  EXPECT_EQ(task_data->inputs_desc[0].ownership, ppc::core::BufferDesc::kBorrowed);
+
+  task_data->OutputView<int32_t>(0)[0] = 7;
+  EXPECT_EQ(out[0], 7);
+}
+
+TEST(task_tests, check_views_of_untyped_buffers) {
+  std::vector<int32_t> in(20, 1);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->AddInput(in.data(), {4, 5});
+
+  auto view = task_data->InputView<int32_t>(0);
+  EXPECT_EQ(view.Rank(), 1U);
+  EXPECT_EQ(view.Size(), in.size());
+  EXPECT_EQ(task_data->InputView<int32_t>(1).Extent(1), 5U);
+}
+
+TEST(task_tests, check_strided_view) {
+  std::vector<int32_t> data{0, 1, 2, 3, 4, 5, 6, 7, 8};
+
+  // Every second column of a 3x3 matrix
+  ppc::core::DataView<int32_t> view(data.data(), {3, 2}, {3, 2});
+  EXPECT_FALSE(view.IsContiguous());
+  EXPECT_EQ(view(2, 1), 8);
+  EXPECT_ANY_THROW((void)view.Span());
+}
+
+#ifndef NDEBUG
+TEST(task_tests, check_view_type_mismatch_in_debug) {
+  std::vector<float> in(4, 1.0F);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(in.data(), {4});
+
+  EXPECT_ANY_THROW((void)task_data->InputView<int32_t>(0));
+  EXPECT_ANY_THROW((void)task_data->InputView<float>(0)[4]);
+}
+
+TEST(task_tests, check_view_shape_mismatch_in_debug) {
+  std::vector<float> in(6, 1.0F);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(in.data(), {2, 3});
+  EXPECT_NO_THROW((void)task_data->InputView<float>(0));
+
+  task_data->inputs_count[0] = 4;
+  EXPECT_ANY_THROW((void)task_data->InputView<float>(0));
+}
+#endif
+
+TEST(task_tests, check_stage_statistics) {
+  std::vector<int32_t> in(1 << 16, 1);
+  std::vector<int32_t> out(1, 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  ppc::test::task::CopyInTask<int32_t> test_task(task_data);
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.Run();
+  test_task.PostProcessing();
+
+  const auto &stages = test_task.GetStatistics().stages;
+  EXPECT_EQ(stages[ppc::core::TaskStatistics::kValidation].calls, 1U);
+  EXPECT_EQ(stages[ppc::core::TaskStatistics::kRun].calls, 2U);
+  EXPECT_GT(stages[ppc::core::TaskStatistics::kRun].time_sec, 0.0);
+  EXPECT_GE(stages[ppc::core::TaskStatistics::kPreProcessing].peak_rss_delta_bytes, 0);
+  if (ppc::core::OperatorNewCounted()) {
+    EXPECT_GE(stages[ppc::core::TaskStatistics::kPreProcessing].allocations, 1U);
+    EXPECT_GE(stages[ppc::core::TaskStatistics::kPreProcessing].allocated_bytes, in.size() * sizeof(int32_t));
+    EXPECT_EQ(stages[ppc::core::TaskStatistics::kRun].allocations, 0U);
+  }
+  EXPECT_EQ(ppc::core::TaskStatistics::StageName(ppc::core::TaskStatistics::kPostProcessing), "PostProcessing");
+
+  // New data starts a new accounting
+  test_task.SetData(task_data);
+  EXPECT_EQ(test_task.GetStatistics().stages[ppc::core::TaskStatistics::kRun].calls, 0U);
+}
+
+TEST(task_tests, check_allocation_counter_hook) {
+  const auto before = ppc::core::GetAllocationStats();
+  ppc::core::CountAllocation(100);
+  const auto after = ppc::core::GetAllocationStats();
+  EXPECT_GE(after.count - before.count, 1U);
+  EXPECT_GE(after.bytes - before.bytes, 100U);
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -46,4 +46,20 @@ class FakeSlowTask : public TestTask<T> {
   }
 };
 
+// Copies its input in PreProcessing, so copy-in shows up in the stage statistics
+template <class T>
+class CopyInTask : public TestTask<T> {
+ public:
+  explicit CopyInTask(ppc::core::TaskDataPtr task_data) : TestTask<T>(task_data) {}
+
+  bool PreProcessingImpl() override {
+    auto *input = reinterpret_cast<T *>(this->task_data->inputs[0]);
+    copy_ = std::vector<T>(input, input + this->task_data->inputs_count[0]);
+    return TestTask<T>::PreProcessingImpl();
+  }
+
+ private:
+  std::vector<T> copy_;
+};
+
 }  // namespace ppc::test::task
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ppc::core {
+
+struct AllocationStats {
+  uint64_t count = 0;
+  uint64_t bytes = 0;
+};
+
+// Allocations of the whole process since start, summed over all threads. Global operator new
+// reports itself here in binaries linking core_counting_new; allocators bypassing it (arena blocks
+// taken from mmap) call CountAllocation.
+AllocationStats GetAllocationStats();
+
+// Hook for custom allocators, cheap enough for hot paths (relaxed per-thread-shard counters)
+void CountAllocation(size_t bytes);
+
+// false unless core_counting_new is linked in, and in sanitizer builds, which keep their own
+// operator new; only explicit CountAllocation calls are seen then
+bool OperatorNewCounted();
+
+// Called once by the counting operator new at static initialization
+void MarkOperatorNewCounted();
+
+// Peak resident set size of the process in bytes, 0 where the OS does not report it
+int64_t PeakRssBytes();
+
+}  // namespace ppc::core
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace ppc::core {
+
+// Description of one TaskData buffer: element type, logical shape and strides (in elements)
+struct BufferDesc {
+  // nullptr for buffers registered through the raw pointer vectors only
+  const std::type_info *type = nullptr;
+  size_t element_size = 1;
+  std::vector<size_t> shape;
+  std::vector<std::ptrdiff_t> strides;
+  // borrowed buffers belong to the caller and tasks may work on them in place;
+  // owned buffers are kept alive by TaskData through owner
+  enum Ownership : uint8_t { kBorrowed, kOwned } ownership = kBorrowed;
+  std::shared_ptr<void> owner;
+};
+
+// Row-major strides of a dense array with the given shape
+inline std::vector<std::ptrdiff_t> ContiguousStrides(const std::vector<size_t> &shape) {
+  std::vector<std::ptrdiff_t> strides(shape.size(), 1);
+  for (size_t dim = shape.size(); dim > 1; dim--) {
+    strides[dim - 2] = strides[dim - 1] * static_cast<std::ptrdiff_t>(shape[dim - 1]);
+  }
+  return strides;
+}
+
+// Non-owning typed view over a TaskData buffer. Bounds are checked in debug builds only,
+// so release builds index the caller memory directly.
+template <class T>
+class DataView {
+ public:
+  DataView() = default;
+  DataView(T *data, std::vector<size_t> shape, std::vector<std::ptrdiff_t> strides = {})
+      : data_(data), shape_(std::move(shape)), strides_(std::move(strides)) {
+    if (strides_.empty()) {
+      strides_ = ContiguousStrides(shape_);
+    }
+    if (strides_.size() != shape_.size()) {
+      throw std::invalid_argument("DataView: rank of strides and shape differ");
+    }
+  }
+
+  [[nodiscard]] T *Data() const { return data_; }
+  [[nodiscard]] size_t Rank() const { return shape_.size(); }
+  [[nodiscard]] size_t Extent(size_t dim) const { return shape_[dim]; }
+  [[nodiscard]] std::ptrdiff_t Stride(size_t dim) const { return strides_[dim]; }
+  [[nodiscard]] const std::vector<size_t> &Shape() const { return shape_; }
+  [[nodiscard]] size_t Size() const {
+    return std::accumulate(shape_.begin(), shape_.end(), size_t{1}, std::multiplies<>());
+  }
+  [[nodiscard]] bool Empty() const { return Size() == 0; }
+
+  [[nodiscard]] bool IsContiguous() const { return strides_ == ContiguousStrides(shape_); }
+  [[nodiscard]] bool IsAligned(size_t alignment) const {
+    return reinterpret_cast<std::uintptr_t>(data_) % alignment == 0;
+  }
+
+  // Linear access to contiguous views
+  T &operator[](size_t index) const {
+#ifndef NDEBUG
+    if (index >= Size()) {
+      throw std::out_of_range("DataView: index " + std::to_string(index) + " is out of " + std::to_string(Size()));
+    }
+#endif
+    return data_[index];
+  }
+
+  // Multi-dimensional access through the strides
+  template <class... Indices>
+  T &operator()(Indices... indices) const {
+    const std::array<size_t, sizeof...(Indices)> index{static_cast<size_t>(indices)...};
+#ifndef NDEBUG
+    if (index.size() != Rank()) {
+      throw std::invalid_argument("DataView: wrong number of indices");
+    }
+#endif
+    std::ptrdiff_t offset = 0;
+    for (size_t dim = 0; dim < index.size(); dim++) {
+#ifndef NDEBUG
+      if (index[dim] >= shape_[dim]) {
+        throw std::out_of_range("DataView: index is out of extent in dimension " + std::to_string(dim));
+      }
+#endif
+      offset += static_cast<std::ptrdiff_t>(index[dim]) * strides_[dim];
+    }
+    return data_[offset];
+  }
+
+  [[nodiscard]] std::span<T> Span() const {
+    if (!IsContiguous()) {
+      throw std::logic_error("DataView: span of a strided view");
+    }
+    return std::span<T>(data_, Size());
+  }
+  T *begin() const { return Span().data(); }
+  T *end() const { return Span().data() + Size(); }
+
+ private:
+  T *data_ = nullptr;
+  std::vector<size_t> shape_;
+  std::vector<std::ptrdiff_t> strides_;
+};
+
+}  // namespace ppc::core
@@ -1,11 +1,19 @@
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
 #include <vector>
 
+#include "core/task/include/data_view.hpp"
+
 namespace ppc::core {
 
 struct TaskData {
@@ -14,10 +22,111 @@ struct TaskData {
   std::vector<uint8_t *> outputs;
   std::vector<std::uint32_t> outputs_count;
   enum StateOfTesting : uint8_t { kFunc, kPerf } state_of_testing;
+  // typed descriptions of inputs/outputs, filled by AddInput/AddOutput; may be shorter than
+  // the raw vectors when buffers were registered with emplace_back. Declared last with default
+  // initializers so that designated initializers of the fields above stay valid.
+  std::vector<BufferDesc> inputs_desc{};
+  std::vector<BufferDesc> outputs_desc{};
+
+  // Register a caller-owned buffer; tasks may read it (and write outputs) in place
+  template <class T>
+  void AddInput(T *data, std::vector<size_t> shape) {
+    AddBuffer(inputs, inputs_count, inputs_desc, data, std::move(shape), {});
+  }
+  template <class T>
+  void AddOutput(T *data, std::vector<size_t> shape) {
+    AddBuffer(outputs, outputs_count, outputs_desc, data, std::move(shape), {});
+  }
+  // Hand a buffer over to TaskData, which keeps it alive as long as itself
+  template <class T>
+  void AdoptInput(std::vector<T> data, std::vector<size_t> shape) {
+    auto owner = std::make_shared<std::vector<T>>(std::move(data));
+    AddBuffer(inputs, inputs_count, inputs_desc, owner->data(), std::move(shape), owner);
+  }
+
+  // Typed views replacing reinterpret_cast of the raw pointers. In debug builds the element
+  // type is checked against the registered description and its shape against the element count.
+  template <class T>
+  [[nodiscard]] DataView<T> InputView(size_t index) const {
+    return MakeView<T>(inputs, inputs_count, inputs_desc, index);
+  }
+  template <class T>
+  [[nodiscard]] DataView<T> OutputView(size_t index) const {
+    return MakeView<T>(outputs, outputs_count, outputs_desc, index);
+  }
+
+ private:
+  template <class T>
+  static void AddBuffer(std::vector<uint8_t *> &ptrs, std::vector<std::uint32_t> &counts,
+                        std::vector<BufferDesc> &descs, T *data, std::vector<size_t> shape,
+                        std::shared_ptr<void> owner) {
+    // Keep descriptions aligned with buffers registered through the raw vectors
+    descs.resize(ptrs.size());
+    BufferDesc desc;
+    desc.type = &typeid(std::remove_const_t<T>);
+    desc.element_size = sizeof(T);
+    desc.strides = ContiguousStrides(shape);
+    desc.shape = std::move(shape);
+    desc.ownership = owner ? BufferDesc::kOwned : BufferDesc::kBorrowed;
+    desc.owner = std::move(owner);
+
+    size_t count = 1;
+    for (size_t extent : desc.shape) {
+      count *= extent;
+    }
+    ptrs.emplace_back(reinterpret_cast<uint8_t *>(const_cast<std::remove_const_t<T> *>(data)));
+    counts.emplace_back(static_cast<std::uint32_t>(count));
+    descs.emplace_back(std::move(desc));
+  }
+
+  template <class T>
+  static DataView<T> MakeView(const std::vector<uint8_t *> &ptrs, const std::vector<std::uint32_t> &counts,
+                              const std::vector<BufferDesc> &descs, size_t index) {
+    auto *data = reinterpret_cast<T *>(ptrs.at(index));
+    if (index >= descs.size() || descs[index].type == nullptr) {
+      // Untyped buffer: one dimension of the registered element count
+      return DataView<T>(data, {counts.at(index)});
+    }
+    const auto &desc = descs[index];
+#ifndef NDEBUG
+    if (*desc.type != typeid(std::remove_const_t<T>) || desc.element_size != sizeof(T)) {
+      throw std::invalid_argument(std::string("TaskData: buffer ") + std::to_string(index) + " holds " +
+                                  desc.type->name() + ", requested " + typeid(T).name());
+    }
+    size_t count = 1;
+    for (size_t extent : desc.shape) {
+      count *= extent;
+    }
+    if (count != counts.at(index)) {
+      throw std::invalid_argument(std::string("TaskData: buffer ") + std::to_string(index) + " has shape of " +
+                                  std::to_string(count) + " elements, count is " + std::to_string(counts.at(index)));
+    }
+#endif
+    return DataView<T>(data, desc.shape, desc.strides);
+  }
 };
 
 using TaskDataPtr = std::shared_ptr<ppc::core::TaskData>;
 
+// Cost of the last call of one pipeline stage
+struct StageStatistics {
+  double time_sec = 0.0;
+  // growth of the process peak resident set size during the stage
+  int64_t peak_rss_delta_bytes = 0;
+  // allocations made by all threads of the process during the stage
+  uint64_t allocations = 0;
+  uint64_t allocated_bytes = 0;
+  // calls of the stage since the data was set
+  uint64_t calls = 0;
+};
+
+struct TaskStatistics {
+  enum Stage : uint8_t { kValidation, kPreProcessing, kRun, kPostProcessing, kNumStages };
+  std::array<StageStatistics, kNumStages> stages{};
+
+  static std::string StageName(Stage stage);
+};
+
 // Memory of inputs and outputs need to be initialized before create object of
 // Task class
 class Task {
@@ -42,6 +151,9 @@ class Task {
   // get input and output data
   [[nodiscard]] TaskDataPtr GetData() const;
 
+  // time, memory and allocations of every stage, shows copy-in/copy-out overhead around Run
+  [[nodiscard]] const TaskStatistics &GetStatistics() const { return statistics_; }
+
   virtual ~Task();
 
  protected:
@@ -65,6 +177,7 @@ class Task {
   std::vector<std::string> right_functions_order_ = {"Validation", "PreProcessing", "Run", "PostProcessing"};
   const double max_test_time_ = 1.0;
   std::chrono::high_resolution_clock::time_point tmp_time_point_;
+  TaskStatistics statistics_;
 };
 
 }  // namespace ppc::core
@@ -0,0 +1,68 @@
+#include "core/task/include/alloc_counter.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace {
+
+constexpr size_t kNumShards = 64;
+
+// Threads update different cache lines, so counting does not serialize parallel allocations
+struct alignas(64) Shard {
+  std::atomic<uint64_t> count{0};
+  std::atomic<uint64_t> bytes{0};
+};
+
+std::array<Shard, kNumShards> shards;
+std::atomic<size_t> next_shard{0};
+std::atomic<bool> operator_new_counted{false};
+
+Shard &ThreadShard() {
+  // A trivially destructible thread_local, initializing it must not allocate
+  thread_local const size_t kIndex = next_shard.fetch_add(1, std::memory_order_relaxed) % kNumShards;
+  return shards[kIndex];
+}
+
+}  // namespace
+
+void ppc::core::CountAllocation(size_t bytes) {
+  auto &shard = ThreadShard();
+  shard.count.fetch_add(1, std::memory_order_relaxed);
+  shard.bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+ppc::core::AllocationStats ppc::core::GetAllocationStats() {
+  AllocationStats stats;
+  for (const auto &shard : shards) {
+    stats.count += shard.count.load(std::memory_order_relaxed);
+    stats.bytes += shard.bytes.load(std::memory_order_relaxed);
+  }
+  return stats;
+}
+
+void ppc::core::MarkOperatorNewCounted() { operator_new_counted.store(true, std::memory_order_relaxed); }
+
+bool ppc::core::OperatorNewCounted() { return operator_new_counted.load(std::memory_order_relaxed); }
+
+int64_t ppc::core::PeakRssBytes() {
+#if defined(__linux__) || defined(__APPLE__)
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+#ifdef __APPLE__
+  return static_cast<int64_t>(usage.ru_maxrss);
+#else
+  // Linux reports kilobytes
+  return static_cast<int64_t>(usage.ru_maxrss) * 1024;
+#endif
+#else
+  return 0;
+#endif
+}
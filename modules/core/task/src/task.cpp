@@ -1,15 +1,70 @@
 #include "core/task/include/task.hpp"
 
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <typeinfo>
+
+#include "core/arena/include/arena.hpp"
+#include "core/task/include/alloc_counter.hpp"
+#include "core/trace/include/trace.hpp"
+
+namespace {
+
+// Fills the statistics of one stage over its enclosing scope
+class StageMeasurement {
+ public:
+  explicit StageMeasurement(ppc::core::StageStatistics& stats)
+      : stats_(stats),
+        allocations_(ppc::core::GetAllocationStats()),
+        peak_rss_(ppc::core::PeakRssBytes()),
+        begin_(std::chrono::steady_clock::now()) {}
+  StageMeasurement(const StageMeasurement&) = delete;
+  StageMeasurement& operator=(const StageMeasurement&) = delete;
+  ~StageMeasurement() {
+    const auto end = std::chrono::steady_clock::now();
+    const auto allocations = ppc::core::GetAllocationStats();
+    stats_.time_sec = std::chrono::duration<double>(end - begin_).count();
+    stats_.peak_rss_delta_bytes = ppc::core::PeakRssBytes() - peak_rss_;
+    stats_.allocations = allocations.count - allocations_.count;
+    stats_.allocated_bytes = allocations.bytes - allocations_.bytes;
+    stats_.calls++;
+  }
+
+ private:
+  ppc::core::StageStatistics& stats_;
+  ppc::core::AllocationStats allocations_;
+  int64_t peak_rss_;
+  std::chrono::steady_clock::time_point begin_;
+};
+
+}  // namespace
+
+std::string ppc::core::TaskStatistics::StageName(Stage stage) {
+  switch (stage) {
+    case kValidation:
+      return "Validation";
+    case kPreProcessing:
+      return "PreProcessing";
+    case kRun:
+      return "Run";
+    case kPostProcessing:
+      return "PostProcessing";
+    case kNumStages:
+      break;
+  }
+  return "Unknown";
+}
 
 void ppc::core::Task::SetData(TaskDataPtr task_data_ptr) {
   task_data_ptr->state_of_testing = TaskData::StateOfTesting::kFunc;
   functions_order_.clear();
+  statistics_ = TaskStatistics{};
   this->task_data = std::move(task_data_ptr);
 }
 
@@ -19,21 +74,31 @@ ppc::core::Task::Task(TaskDataPtr task_data) { SetData(std::move(task_data)); }
 
 bool ppc::core::Task::Validation() {
   InternalOrderTest();
+  PPC_TRACE_SCOPE_DETAIL("Validation", typeid(*this).name());
+  StageMeasurement measurement(statistics_.stages[TaskStatistics::kValidation]);
   return ValidationImpl();
 }
 
 bool ppc::core::Task::PreProcessing() {
   InternalOrderTest();
+  PPC_TRACE_SCOPE_DETAIL("PreProcessing", typeid(*this).name());
+  StageMeasurement measurement(statistics_.stages[TaskStatistics::kPreProcessing]);
   return PreProcessingImpl();
 }
 
 bool ppc::core::Task::Run() {
   InternalOrderTest();
+  PPC_TRACE_SCOPE_DETAIL("Run", typeid(*this).name());
+  StageMeasurement measurement(statistics_.stages[TaskStatistics::kRun]);
+  // Scratch memory of the previous run is recycled, not freed
+  ResetThreadArenas();
   return RunImpl();
 }
 
 bool ppc::core::Task::PostProcessing() {
   InternalOrderTest();
+  PPC_TRACE_SCOPE_DETAIL("PostProcessing", typeid(*this).name());
+  StageMeasurement measurement(statistics_.stages[TaskStatistics::kPostProcessing]);
   return PostProcessingImpl();
 }
 
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+int64_t Fibonacci(int n, ppc::core::ThreadPool &pool) {
+  if (n < 12) {
+    return n < 2 ? n : Fibonacci(n - 1, pool) + Fibonacci(n - 2, pool);
+  }
+  int64_t left = 0;
+  ppc::core::TaskGroup group(pool);
+  group.Run([&] { left = Fibonacci(n - 1, pool); });
+  const int64_t right = Fibonacci(n - 2, pool);
+  group.Wait();
+  return left + right;
+}
+
+}  // namespace
+
+TEST(thread_pool_tests, check_parallel_for_visits_every_index_once) {
+  ppc::core::ThreadPool pool(4);
+  std::vector<std::atomic<int>> visits(10000);
+  ppc::core::ParallelFor<size_t>(0, visits.size(), [&](size_t i) { visits[i]++; }, 1, pool);
+  for (const auto &v : visits) {
+    ASSERT_EQ(v.load(), 1);
+  }
+}
+
+TEST(thread_pool_tests, check_parallel_for_empty_and_tiny_ranges) {
+  ppc::core::ThreadPool pool(3);
+  int calls = 0;
+  ppc::core::ParallelFor(5, 5, [&](int) { calls++; }, 1, pool);
+  EXPECT_EQ(calls, 0);
+  ppc::core::ParallelFor(0, 1, [&](int) { calls++; }, 1, pool);
+  EXPECT_EQ(calls, 1);
+}
+
+TEST(thread_pool_tests, check_parallel_reduce) {
+  ppc::core::ThreadPool pool(4);
+  std::vector<int64_t> data(100001);
+  std::iota(data.begin(), data.end(), 0);
+  auto sum = ppc::core::ParallelReduce<size_t>(
+      0, data.size(), int64_t{0},
+      [&](size_t begin, size_t end) { return std::accumulate(data.begin() + begin, data.begin() + end, int64_t{0}); },
+      [](int64_t a, int64_t b) { return a + b; }, 1, pool);
+  EXPECT_EQ(sum, int64_t{100000} * 100001 / 2);
+}
+
+TEST(thread_pool_tests, check_nested_fork_join) {
+  ppc::core::ThreadPool pool(4);
+  EXPECT_EQ(Fibonacci(25, pool), 75025);
+}
+
+TEST(thread_pool_tests, check_task_group_rethrows) {
+  ppc::core::ThreadPool pool(2);
+  ppc::core::TaskGroup group(pool);
+  std::atomic<int> done = 0;
+  for (int i = 0; i < 8; i++) {
+    group.Run([&, i] {
+      if (i == 3) {
+        throw std::runtime_error("task failed");
+      }
+      done++;
+    });
+  }
+  EXPECT_THROW(group.Wait(), std::runtime_error);
+  EXPECT_EQ(done.load(), 7);
+}
+
+TEST(thread_pool_tests, check_workers_are_reused) {
+  ppc::core::ThreadPool pool(3);
+  std::set<std::thread::id> ids;
+  std::mutex mutex;
+  for (int run = 0; run < 20; run++) {
+    ppc::core::ParallelFor(
+        0, 64,
+        [&](int) {
+          std::this_thread::yield();
+          std::lock_guard lock(mutex);
+          ids.insert(std::this_thread::get_id());
+        },
+        1, pool);
+  }
+  EXPECT_LE(ids.size(), 3U);
+}
+
+TEST(thread_pool_tests, check_instance_follows_num_threads) {
+  const int save_var = ppc::util::GetPPCNumThreads();
+  ppc::util::SetPPCNumThreads(3);
+  EXPECT_EQ(ppc::core::ThreadPool::Instance().NumThreads(), 3);
+  ppc::util::SetPPCNumThreads(2);
+  EXPECT_EQ(ppc::core::ThreadPool::Instance().NumThreads(), 2);
+  ppc::util::SetPPCNumThreads(save_var);
+}
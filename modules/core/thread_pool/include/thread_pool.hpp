@@ -0,0 +1,170 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace ppc::core {
+
+// Persistent work-stealing pool for the std::thread technology. Every worker owns a deque:
+// it pushes and pops its own tasks at the back (LIFO keeps fork-join recursion cache-hot)
+// while idle workers steal from the front of other deques. Tasks submitted from outside
+// the pool are distributed round-robin. Threads waiting for a TaskGroup execute pending
+// tasks instead of blocking, so nested parallelism cannot deadlock.
+class ThreadPool {
+ public:
+  // num_threads counts the calling thread, which takes part in waits: num_threads - 1 workers
+  explicit ThreadPool(int num_threads);
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+  ~ThreadPool();
+
+  [[nodiscard]] int NumThreads() const { return static_cast<int>(workers_.size()) + 1; }
+
+  void Submit(std::function<void()> task);
+
+  // Run one pending task on the calling thread, false when there was none
+  bool TryRunPendingTask();
+
+  // Pool shared by all tasks of the process, sized by ppc::util::GetPPCNumThreads(). It is
+  // recreated when the thread count changes between runs, so it follows scaling sweeps.
+  static ThreadPool &Instance();
+
+ private:
+  struct Worker {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+    std::thread thread;
+  };
+
+  void WorkerLoop(size_t index);
+  bool PopTask(size_t home, std::function<void()> &task);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::atomic<size_t> next_worker_{0};
+  std::atomic<size_t> queued_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_up_;
+  bool stop_ = false;
+};
+
+// Fork-join group of tasks: Run() forks, Wait() joins and rethrows the first exception
+class TaskGroup {
+ public:
+  explicit TaskGroup(ThreadPool &pool = ThreadPool::Instance()) : pool_(pool) {}
+  TaskGroup(const TaskGroup &) = delete;
+  TaskGroup &operator=(const TaskGroup &) = delete;
+  ~TaskGroup();
+
+  void Run(std::function<void()> task);
+  void Wait();
+
+ private:
+  ThreadPool &pool_;
+  std::atomic<size_t> pending_{0};
+  std::mutex error_mutex_;
+  std::exception_ptr error_;
+};
+
+// Call body(chunk_begin, chunk_end) over [begin, end) split into about four chunks per
+// thread of the pool, but not smaller than grain
+template <class Index, class Body>
+void ParallelForRange(Index begin, Index end, const Body &body, Index grain = 1,
+                      ThreadPool &pool = ThreadPool::Instance()) {
+  if (begin >= end) {
+    return;
+  }
+  const auto total = static_cast<size_t>(end - begin);
+  const size_t max_chunks = static_cast<size_t>(pool.NumThreads()) * 4;
+  const size_t num_chunks =
+      std::clamp<size_t>(total / std::max<size_t>(1, static_cast<size_t>(grain)), 1, max_chunks);
+  if (num_chunks == 1) {
+    body(begin, end);
+    return;
+  }
+
+  TaskGroup group(pool);
+  for (size_t chunk = 1; chunk < num_chunks; chunk++) {
+    const auto chunk_begin = static_cast<Index>(begin + static_cast<Index>(total * chunk / num_chunks));
+    const auto chunk_end = static_cast<Index>(begin + static_cast<Index>(total * (chunk + 1) / num_chunks));
+    group.Run([&body, chunk_begin, chunk_end] { body(chunk_begin, chunk_end); });
+  }
+  // The calling thread takes the first chunk itself
+  body(begin, static_cast<Index>(begin + static_cast<Index>(total / num_chunks)));
+  group.Wait();
+}
+
+// Call body(i) for every i in [begin, end)
+template <class Index, class Body>
+void ParallelFor(Index begin, Index end, const Body &body, Index grain = 1,
+                 ThreadPool &pool = ThreadPool::Instance()) {
+  ParallelForRange(
+      begin, end,
+      [&body](Index chunk_begin, Index chunk_end) {
+        for (Index i = chunk_begin; i < chunk_end; i++) {
+          body(i);
+        }
+      },
+      grain, pool);
+}
+
+// ForEach backend over the shared pool: body(i) for i in [0, count), at least grain items per task
+struct PoolForEach {
+  size_t grain = 1;
+
+  template <class Body>
+  void operator()(size_t count, const Body &body) const {
+    ParallelFor(size_t{0}, count, body, grain);
+  }
+};
+
+// Invoke backend forking left() into the shared pool while the calling thread runs right()
+struct PoolInvoke {
+  template <class F, class G>
+  void operator()(const F &left, const G &right) const {
+    TaskGroup group;
+    group.Run([&] { left(); });
+    right();
+    group.Wait();
+  }
+};
+
+// Reduce map(chunk_begin, chunk_end) over [begin, end) with an associative combine
+template <class Index, class T, class Map, class Combine>
+T ParallelReduce(Index begin, Index end, T identity, const Map &map, const Combine &combine, Index grain = 1,
+                 ThreadPool &pool = ThreadPool::Instance()) {
+  if (begin >= end) {
+    return identity;
+  }
+  const auto total = static_cast<size_t>(end - begin);
+  const size_t max_chunks = static_cast<size_t>(pool.NumThreads()) * 4;
+  const size_t num_chunks =
+      std::clamp<size_t>(total / std::max<size_t>(1, static_cast<size_t>(grain)), 1, max_chunks);
+
+  std::vector<T> partial(num_chunks, identity);
+  ParallelFor<size_t>(
+      0, num_chunks,
+      [&](size_t chunk) {
+        partial[chunk] = map(static_cast<Index>(begin + static_cast<Index>(total * chunk / num_chunks)),
+                             static_cast<Index>(begin + static_cast<Index>(total * (chunk + 1) / num_chunks)));
+      },
+      1, pool);
+
+  // Combining in chunk order keeps non-commutative reductions deterministic
+  T result = identity;
+  for (auto &value : partial) {
+    result = combine(result, value);
+  }
+  return result;
+}
+
+}  // namespace ppc::core
@@ -0,0 +1,173 @@
+#include "core/thread_pool/include/thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "core/trace/include/trace.hpp"
+#include "core/util/include/topology.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+// Pool and deque index of the calling thread when it is a pool worker
+thread_local ppc::core::ThreadPool *current_pool = nullptr;
+thread_local size_t current_worker = 0;
+
+}  // namespace
+
+ppc::core::ThreadPool::ThreadPool(int num_threads) {
+  const int num_workers = std::max(1, num_threads) - 1;
+  workers_.reserve(num_workers);
+  for (int i = 0; i < num_workers; i++) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  for (size_t i = 0; i < workers_.size(); i++) {
+    workers_[i]->thread = std::thread([this, i] { WorkerLoop(i); });
+  }
+}
+
+ppc::core::ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard lock(sleep_mutex_);
+    stop_ = true;
+  }
+  wake_up_.notify_all();
+  for (auto &worker : workers_) {
+    worker->thread.join();
+  }
+}
+
+void ppc::core::ThreadPool::Submit(std::function<void()> task) {
+  if (workers_.empty()) {
+    task();
+    return;
+  }
+  const size_t target = current_pool == this ? current_worker : next_worker_++ % workers_.size();
+  {
+    std::lock_guard lock(workers_[target]->mutex);
+    workers_[target]->tasks.push_back(std::move(task));
+  }
+  queued_.fetch_add(1);
+  {
+    // Taking the lock orders the increment before a worker decides to sleep
+    std::lock_guard lock(sleep_mutex_);
+  }
+  wake_up_.notify_one();
+}
+
+bool ppc::core::ThreadPool::PopTask(size_t home, std::function<void()> &task) {
+  if (queued_.load() == 0) {
+    return false;
+  }
+  for (size_t shift = 0; shift < workers_.size(); shift++) {
+    auto &worker = *workers_[(home + shift) % workers_.size()];
+    std::lock_guard lock(worker.mutex);
+    if (worker.tasks.empty()) {
+      continue;
+    }
+    // Own tasks are taken LIFO, stolen ones FIFO (the oldest, usually the largest, pieces)
+    if (shift == 0 && current_pool == this) {
+      task = std::move(worker.tasks.back());
+      worker.tasks.pop_back();
+    } else {
+      task = std::move(worker.tasks.front());
+      worker.tasks.pop_front();
+    }
+    queued_.fetch_sub(1);
+    return true;
+  }
+  return false;
+}
+
+bool ppc::core::ThreadPool::TryRunPendingTask() {
+  std::function<void()> task;
+  const size_t home = current_pool == this ? current_worker : next_worker_.load() % std::max<size_t>(1, workers_.size());
+  if (workers_.empty() || !PopTask(home, task)) {
+    return false;
+  }
+  task();
+  return true;
+}
+
+void ppc::core::ThreadPool::WorkerLoop(size_t index) {
+  current_pool = this;
+  current_worker = index;
+  // Slot 0 belongs to the thread that owns the pool and waits on task groups
+  ppc::util::PinCurrentThreadToSlot(static_cast<int>(index) + 1);
+  if (trace::Enabled()) {
+    trace::SetThreadName("pool worker " + std::to_string(index + 1));
+  }
+  while (true) {
+    std::function<void()> task;
+    if (PopTask(index, task)) {
+      task();
+      continue;
+    }
+    std::unique_lock lock(sleep_mutex_);
+    wake_up_.wait(lock, [this] { return stop_ || queued_.load() > 0; });
+    if (stop_ && queued_.load() == 0) {
+      return;
+    }
+  }
+}
+
+ppc::core::ThreadPool &ppc::core::ThreadPool::Instance() {
+  static std::mutex mutex;
+  static std::unique_ptr<ThreadPool> pool;
+
+  // Tasks running inside the pool must never recreate it
+  if (current_pool != nullptr) {
+    return *current_pool;
+  }
+  const int num_threads = std::max(1, ppc::util::GetPPCNumThreads());
+  std::lock_guard lock(mutex);
+  if (!pool || pool->NumThreads() != num_threads) {
+    pool.reset();
+    pool = std::make_unique<ThreadPool>(num_threads);
+  }
+  return *pool;
+}
+
+ppc::core::TaskGroup::~TaskGroup() {
+  while (pending_.load(std::memory_order_acquire) > 0) {
+    if (!pool_.TryRunPendingTask()) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+void ppc::core::TaskGroup::Run(std::function<void()> task) {
+  pending_.fetch_add(1, std::memory_order_relaxed);
+  pool_.Submit([this, task = std::move(task)] {
+    try {
+      task();
+    } catch (...) {
+      std::lock_guard lock(error_mutex_);
+      if (!error_) {
+        error_ = std::current_exception();
+      }
+    }
+    pending_.fetch_sub(1, std::memory_order_release);
+  });
+}
+
+void ppc::core::TaskGroup::Wait() {
+  while (pending_.load(std::memory_order_acquire) > 0) {
+    if (!pool_.TryRunPendingTask()) {
+      std::this_thread::yield();
+    }
+  }
+  std::lock_guard lock(error_mutex_);
+  if (error_) {
+    std::exception_ptr error = std::exchange(error_, nullptr);
+    std::rethrow_exception(error);
+  }
+}
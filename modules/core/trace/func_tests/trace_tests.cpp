@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "core/trace/include/trace.hpp"
+
+namespace {
+
+size_t CountOccurrences(const std::string &text, const std::string &pattern) {
+  size_t count = 0;
+  for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) {
+    count++;
+  }
+  return count;
+}
+
+class TraceTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    was_enabled_ = ppc::core::trace::Enabled();
+    ppc::core::trace::Clear();
+  }
+  void TearDown() override {
+    ppc::core::trace::Enable(was_enabled_);
+    ppc::core::trace::Clear();
+  }
+
+ private:
+  bool was_enabled_ = false;
+};
+
+class EmptyTask : public ppc::core::Task {
+ public:
+  explicit EmptyTask(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+  bool ValidationImpl() override { return true; }
+  bool PreProcessingImpl() override { return true; }
+  bool RunImpl() override { return true; }
+  bool PostProcessingImpl() override { return true; }
+};
+
+}  // namespace
+
+TEST_F(TraceTest, records_spans_only_when_enabled) {
+  ppc::core::trace::Enable(false);
+  { ppc::core::trace::Span span("trace_test_disabled"); }
+  ppc::core::trace::Enable(true);
+  { ppc::core::trace::Span span("trace_test_enabled", "detail"); }
+
+  const std::string json = ppc::core::trace::ExportChromeJson();
+  EXPECT_EQ(CountOccurrences(json, "trace_test_disabled"), 0U);
+  EXPECT_EQ(CountOccurrences(json, "\"name\":\"trace_test_enabled\""), 1U);
+  EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+  EXPECT_NE(json.find("\"detail\":\"detail\""), std::string::npos);
+}
+
+TEST_F(TraceTest, threads_get_their_own_tracks) {
+  ppc::core::trace::Enable(true);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 3; i++) {
+    threads.emplace_back([i] {
+      ppc::core::trace::SetThreadName("trace_test_thread_" + std::to_string(i));
+      ppc::core::trace::Span span("trace_test_parallel");
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  const std::string json = ppc::core::trace::ExportChromeJson();
+  EXPECT_EQ(CountOccurrences(json, "\"name\":\"trace_test_parallel\""), 3U);
+  for (int i = 0; i < 3; i++) {
+    EXPECT_NE(json.find("trace_test_thread_" + std::to_string(i)), std::string::npos);
+  }
+}
+
+TEST_F(TraceTest, clear_drops_recorded_spans) {
+  ppc::core::trace::Enable(true);
+  { ppc::core::trace::Span span("trace_test_cleared"); }
+  ppc::core::trace::Clear();
+  EXPECT_EQ(ppc::core::trace::ExportChromeJson().find("trace_test_cleared"), std::string::npos);
+}
+
+TEST_F(TraceTest, writes_trace_file) {
+  ppc::core::trace::Enable(true);
+  { ppc::core::trace::Span span("trace_test_file"); }
+  const auto path = std::filesystem::temp_directory_path() / "ppc_trace_test.json";
+  ASSERT_TRUE(ppc::core::trace::WriteChromeTrace(path.string()));
+
+  std::ifstream file(path);
+  std::stringstream content;
+  content << file.rdbuf();
+  EXPECT_EQ(content.str().rfind("{\"displayTimeUnit\"", 0), 0U);
+  EXPECT_NE(content.str().find("trace_test_file"), std::string::npos);
+  std::filesystem::remove(path);
+}
+
+TEST_F(TraceTest, task_stages_are_traced_when_compiled_in) {
+  ppc::core::trace::Enable(true);
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  EmptyTask task(task_data);
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  const std::string json = ppc::core::trace::ExportChromeJson();
+#ifdef PPC_ENABLE_TRACING
+  for (const char *stage : {"Validation", "PreProcessing", "Run", "PostProcessing"}) {
+    EXPECT_EQ(CountOccurrences(json, std::string("\"name\":\"") + stage + "\""), 1U) << stage;
+  }
+  EXPECT_NE(json.find("EmptyTask"), std::string::npos);
+#else
+  EXPECT_EQ(json.find("\"name\":\"Run\""), std::string::npos);
+#endif
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace ppc::core::trace {
+
+// Nanoseconds of a monotonic clock, the time base of every span
+inline uint64_t Now() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+// Tracing is switched on at runtime by the PPC_TRACE environment variable (path of the trace
+// file written at exit) or by Enable(). A disabled span costs a call and a relaxed atomic load.
+bool Enabled();
+void Enable(bool enabled = true);
+
+// Append a finished span to the ring buffer of the calling thread. name and detail must have
+// static storage duration (string literals, typeid names), they are stored by pointer.
+void Record(const char *name, const char *detail, uint64_t begin_ns, uint64_t end_ns);
+
+// RAII span covering its enclosing scope
+class Span {
+ public:
+  explicit Span(const char *name, const char *detail = nullptr)
+      : name_(name), detail_(detail), begin_ns_(Enabled() ? Now() : 0) {}
+  Span(const Span &) = delete;
+  Span &operator=(const Span &) = delete;
+  ~Span() {
+    if (begin_ns_ != 0) {
+      Record(name_, detail_, begin_ns_, Now());
+    }
+  }
+
+ private:
+  const char *name_;
+  const char *detail_;
+  uint64_t begin_ns_;
+};
+
+// Track of the process in the trace viewer: MPI programs pass their rank, so every rank gets
+// its own track and its own trace file
+void SetProcess(int id, const std::string &name);
+// Name of the calling thread's track
+void SetThreadName(const std::string &name);
+
+// Chrome trace-event JSON of every span recorded so far, opened by chrome://tracing and Perfetto.
+// Buffers are read without stopping their threads, so export when parallel work is finished.
+std::string ExportChromeJson();
+// Write ExportChromeJson() to path, false if the file cannot be written
+bool WriteChromeTrace(const std::string &path);
+// Drop every recorded span
+void Clear();
+
+}  // namespace ppc::core::trace
+
+// Scoped span macros are compiled out unless the build enables tracing (-DUSE_TRACING=ON)
+#define PPC_TRACE_CONCAT_IMPL(a, b) a##b
+#define PPC_TRACE_CONCAT(a, b) PPC_TRACE_CONCAT_IMPL(a, b)
+#ifdef PPC_ENABLE_TRACING
+#define PPC_TRACE_SCOPE(name) ppc::core::trace::Span PPC_TRACE_CONCAT(ppc_trace_span_, __LINE__)(name)
+#define PPC_TRACE_SCOPE_DETAIL(name, detail) \
+  ppc::core::trace::Span PPC_TRACE_CONCAT(ppc_trace_span_, __LINE__)(name, detail)
+#else
+#define PPC_TRACE_SCOPE(name) static_cast<void>(0)
+#define PPC_TRACE_SCOPE_DETAIL(name, detail) static_cast<void>(0)
+#endif
@@ -0,0 +1,217 @@
+#include "core/trace/include/trace.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__GNUC__)
+#include <cxxabi.h>
+#endif
+
+namespace {
+
+// Spans kept per thread, older ones are overwritten
+constexpr size_t kRingCapacity = size_t{1} << 15;
+
+struct Event {
+  const char *name;
+  const char *detail;
+  uint64_t begin_ns;
+  uint64_t end_ns;
+};
+
+// Single-producer ring: only the owning thread writes events and head, exporters read them
+struct ThreadBuffer {
+  std::unique_ptr<Event[]> events = std::make_unique<Event[]>(kRingCapacity);
+  std::atomic<uint64_t> head{0};
+  // first event not dropped by Clear()
+  std::atomic<uint64_t> tail{0};
+  int tid = 0;
+  std::string name;
+};
+
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+  int next_tid = 0;
+  int pid = 0;
+  bool process_set = false;
+  std::string process_name = "ppc";
+  std::string output_path;
+
+  Registry();
+  Registry(const Registry &) = delete;
+  Registry &operator=(const Registry &) = delete;
+  ~Registry();
+};
+
+std::atomic<bool> enabled{false};
+
+Registry &GetRegistry() {
+  static Registry registry;
+  return registry;
+}
+
+Registry::Registry() {
+  const char *path = std::getenv("PPC_TRACE");  // NOLINT(concurrency-mt-unsafe)
+  if (path != nullptr && *path != '\0') {
+    output_path = path;
+    enabled.store(true, std::memory_order_relaxed);
+  }
+}
+
+// Reading PPC_TRACE at startup turns tracing on before the first span
+const bool kRegistryInitialized = (GetRegistry(), true);
+
+ThreadBuffer &GetThreadBuffer() {
+  thread_local std::shared_ptr<ThreadBuffer> buffer = [] {
+    auto created = std::make_shared<ThreadBuffer>();
+    auto &registry = GetRegistry();
+    std::lock_guard lock(registry.mutex);
+    created->tid = registry.next_tid++;
+    created->name = "thread " + std::to_string(created->tid);
+    registry.buffers.push_back(created);
+    return created;
+  }();
+  return *buffer;
+}
+
+std::string JsonString(const std::string &value) {
+  std::string out = "\"";
+  for (char c : value) {
+    if (c == '"' || c == '\\') {
+      out += '\\';
+    }
+    out += c;
+  }
+  out += '"';
+  return out;
+}
+
+std::string Demangle(const char *name) {
+#if defined(__GNUC__)
+  int status = 0;
+  std::unique_ptr<char, decltype(&std::free)> demangled(abi::__cxa_demangle(name, nullptr, nullptr, &status),
+                                                        &std::free);
+  if (status == 0 && demangled) {
+    return demangled.get();
+  }
+#endif
+  return name;
+}
+
+std::string ExportLocked(Registry &registry) {
+  std::stringstream out;
+  out << std::fixed << std::setprecision(3);
+  out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << registry.pid
+      << ",\"tid\":0,\"args\":{\"name\":" << JsonString(registry.process_name) << "}}";
+  for (const auto &buffer : registry.buffers) {
+    out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << registry.pid << ",\"tid\":" << buffer->tid
+        << ",\"args\":{\"name\":" << JsonString(buffer->name) << "}}";
+
+    const uint64_t head = buffer->head.load(std::memory_order_acquire);
+    uint64_t first = buffer->tail.load(std::memory_order_relaxed);
+    if (head - first > kRingCapacity) {
+      first = head - kRingCapacity;
+    }
+    for (uint64_t index = first; index < head; index++) {
+      const Event &event = buffer->events[index % kRingCapacity];
+      // Complete events ("X") in microseconds
+      out << ",\n{\"name\":" << JsonString(event.name) << ",\"cat\":\"ppc\",\"ph\":\"X\",\"ts\":"
+          << static_cast<double>(event.begin_ns) * 1e-3
+          << ",\"dur\":" << static_cast<double>(event.end_ns - event.begin_ns) * 1e-3 << ",\"pid\":" << registry.pid
+          << ",\"tid\":" << buffer->tid;
+      if (event.detail != nullptr) {
+        out << ",\"args\":{\"detail\":" << JsonString(Demangle(event.detail)) << "}";
+      }
+      out << "}";
+    }
+  }
+  out << "]}\n";
+  return out.str();
+}
+
+// Every process of an MPI run writes its own file: trace.json becomes trace.<rank>.json
+std::string OutputFile(const Registry &registry, const std::string &path) {
+  if (!registry.process_set) {
+    return path;
+  }
+  const std::filesystem::path file(path);
+  auto name = file.stem().string();
+  name.append(".").append(std::to_string(registry.pid)).append(file.extension().string());
+  return (file.parent_path() / name).string();
+}
+
+bool WriteLocked(Registry &registry, const std::string &path) {
+  std::ofstream file(OutputFile(registry, path));
+  if (!file) {
+    return false;
+  }
+  file << ExportLocked(registry);
+  return static_cast<bool>(file);
+}
+
+Registry::~Registry() {
+  if (!output_path.empty()) {
+    std::lock_guard lock(mutex);
+    WriteLocked(*this, output_path);
+  }
+}
+
+}  // namespace
+
+bool ppc::core::trace::Enabled() { return enabled.load(std::memory_order_relaxed); }
+
+void ppc::core::trace::Enable(bool on) { enabled.store(on, std::memory_order_relaxed); }
+
+void ppc::core::trace::Record(const char *name, const char *detail, uint64_t begin_ns, uint64_t end_ns) {
+  auto &buffer = GetThreadBuffer();
+  const uint64_t head = buffer.head.load(std::memory_order_relaxed);
+  buffer.events[head % kRingCapacity] = Event{.name = name, .detail = detail, .begin_ns = begin_ns, .end_ns = end_ns};
+  buffer.head.store(head + 1, std::memory_order_release);
+}
+
+void ppc::core::trace::SetProcess(int id, const std::string &name) {
+  auto &registry = GetRegistry();
+  std::lock_guard lock(registry.mutex);
+  registry.pid = id;
+  registry.process_name = name;
+  registry.process_set = true;
+}
+
+void ppc::core::trace::SetThreadName(const std::string &name) {
+  auto &buffer = GetThreadBuffer();
+  auto &registry = GetRegistry();
+  std::lock_guard lock(registry.mutex);
+  buffer.name = name;
+}
+
+std::string ppc::core::trace::ExportChromeJson() {
+  auto &registry = GetRegistry();
+  std::lock_guard lock(registry.mutex);
+  return ExportLocked(registry);
+}
+
+bool ppc::core::trace::WriteChromeTrace(const std::string &path) {
+  auto &registry = GetRegistry();
+  std::lock_guard lock(registry.mutex);
+  return WriteLocked(registry, path);
+}
+
+void ppc::core::trace::Clear() {
+  auto &registry = GetRegistry();
+  std::lock_guard lock(registry.mutex);
+  for (const auto &buffer : registry.buffers) {
+    buffer->tail.store(buffer->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+  }
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "core/util/include/file_io.hpp"
+
+namespace {
+
+std::vector<std::byte> Counting(size_t n) {
+  std::vector<std::byte> bytes(n);
+  for (size_t i = 0; i < n; i++) {
+    bytes[i] = static_cast<std::byte>(i % 251);
+  }
+  return bytes;
+}
+
+}  // namespace
+
+TEST(file_io_tests, written_file_reads_back) {
+  ppc::util::ScratchDirectory directory;
+  const auto path = directory.NewFile();
+  const auto bytes = Counting(300000);
+  ppc::util::FileWriter writer(path);
+  writer.Write(std::span(bytes).first(1000));
+  writer.Write(std::span(bytes).subspan(1000));
+  writer.Close();
+  EXPECT_EQ(writer.BytesWritten(), bytes.size());
+
+  const ppc::util::MappedFile mapped(path);
+  ASSERT_EQ(mapped.Size(), bytes.size());
+  EXPECT_TRUE(std::ranges::equal(mapped.Bytes(), bytes));
+  mapped.Release(0, 200000);
+  EXPECT_TRUE(std::ranges::equal(mapped.Bytes(), bytes));
+
+  const ppc::util::FileReader reader(path);
+  std::vector<std::byte> block(5000);
+  reader.ReadAt(123457, block);
+  EXPECT_TRUE(std::ranges::equal(block, std::span(bytes).subspan(123457, 5000)));
+  EXPECT_THROW(reader.ReadAt(bytes.size() - 10, block), std::out_of_range);
+}
+
+TEST(file_io_tests, empty_file_maps_to_nothing) {
+  ppc::util::ScratchDirectory directory;
+  const auto path = directory.NewFile();
+  ppc::util::FileWriter(path).Close();
+  const ppc::util::MappedFile mapped(path);
+  EXPECT_EQ(mapped.Size(), 0U);
+  EXPECT_TRUE(mapped.Bytes().empty());
+}
+
+TEST(file_io_tests, scratch_directory_is_removed_with_its_files) {
+  std::filesystem::path path;
+  {
+    ppc::util::ScratchDirectory directory;
+    path = directory.Path();
+    const auto first = directory.NewFile();
+    const auto second = directory.NewFile();
+    EXPECT_NE(first, second);
+    ppc::util::FileWriter(first).Close();
+    ASSERT_TRUE(std::filesystem::exists(first));
+  }
+  EXPECT_FALSE(std::filesystem::exists(path));
+}
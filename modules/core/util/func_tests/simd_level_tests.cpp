@@ -0,0 +1,20 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include "core/util/include/simd_level.hpp"
+
+TEST(simd_level_tests, level_names_round_trip) {
+  for (auto level : {ppc::util::SimdLevel::kScalar, ppc::util::SimdLevel::kAvx2, ppc::util::SimdLevel::kAvx512}) {
+    EXPECT_EQ(ppc::util::ParseSimdLevel(ppc::util::SimdLevelName(level)), level);
+  }
+  EXPECT_THROW(ppc::util::ParseSimdLevel("sse"), std::invalid_argument);
+}
+
+TEST(simd_level_tests, set_level_is_capped_by_the_cpu) {
+  const auto widest = ppc::util::DetectSimdLevel();
+  EXPECT_EQ(ppc::util::SetSimdLevel(ppc::util::SimdLevel::kAvx512), widest);
+  EXPECT_EQ(ppc::util::SetSimdLevel(ppc::util::SimdLevel::kScalar), ppc::util::SimdLevel::kScalar);
+  EXPECT_EQ(ppc::util::ActiveSimdLevel(), ppc::util::SimdLevel::kScalar);
+  ppc::util::SetSimdLevel(widest);
+}
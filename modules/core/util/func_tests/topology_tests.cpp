@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/util/include/topology.hpp"
+
+namespace {
+
+void WriteFile(const std::filesystem::path &path, const std::string &content) {
+  std::filesystem::create_directories(path.parent_path());
+  std::ofstream(path) << content << '\n';
+}
+
+// Two packages with two cores of two hardware threads each, numbered the way Intel servers
+// do it: the first hardware threads of all cores come first, their siblings follow
+std::filesystem::path MakeDualSocketSysfs() {
+  const auto root = std::filesystem::temp_directory_path() / "ppc_topology_tests";
+  std::filesystem::remove_all(root);
+  WriteFile(root / "cpu/online", "0-7");
+  for (int id = 0; id < 8; id++) {
+    const auto dir = root / "cpu" / ("cpu" + std::to_string(id));
+    const int first = id % 4;
+    WriteFile(dir / "topology/core_id", std::to_string(first % 2));
+    WriteFile(dir / "topology/physical_package_id", std::to_string(first / 2));
+    WriteFile(dir / "topology/thread_siblings_list", std::to_string(first) + "," + std::to_string(first + 4));
+    WriteFile(dir / "cache/index0/level", "1");
+    WriteFile(dir / "cache/index0/type", "Data");
+    WriteFile(dir / "cache/index0/size", "48K");
+    WriteFile(dir / "cache/index0/shared_cpu_list", std::to_string(first) + "," + std::to_string(first + 4));
+    WriteFile(dir / "cache/index1/level", "3");
+    WriteFile(dir / "cache/index1/type", "Unified");
+    WriteFile(dir / "cache/index1/size", "32M");
+    WriteFile(dir / "cache/index1/shared_cpu_list", first / 2 == 0 ? "0-1,4-5" : "2-3,6-7");
+  }
+  WriteFile(root / "node/node0/cpulist", "0-1,4-5");
+  WriteFile(root / "node/node1/cpulist", "2-3,6-7");
+  return root;
+}
+
+}  // namespace
+
+TEST(topology_tests, discovers_fake_dual_socket_machine) {
+  const auto topology = ppc::util::Topology::Discover(MakeDualSocketSysfs().string());
+
+  EXPECT_EQ(topology.NumCpus(), 8);
+  EXPECT_EQ(topology.NumCores(), 4);
+  EXPECT_EQ(topology.NumPackages(), 2);
+  EXPECT_EQ(topology.NumNumaNodes(), 2);
+  EXPECT_EQ(topology.Cpus()[6].package_id, 1);
+  EXPECT_EQ(topology.Cpus()[6].numa_node, 1);
+  EXPECT_EQ(topology.Cpus()[6].smt_index, 1);
+
+  // Four L1 caches (one per core) and two L3 caches (one per package)
+  ASSERT_EQ(topology.Caches().size(), 6U);
+  int l3_caches = 0;
+  for (const auto &cache : topology.Caches()) {
+    if (cache.level == 3) {
+      l3_caches++;
+      EXPECT_EQ(cache.size_bytes, 32U << 20);
+      EXPECT_EQ(cache.shared_cpus.size(), 4U);
+    }
+  }
+  EXPECT_EQ(l3_caches, 2);
+}
+
+TEST(topology_tests, affinity_orders_follow_policies) {
+  const auto topology = ppc::util::Topology::Discover(MakeDualSocketSysfs().string());
+
+  EXPECT_TRUE(ppc::util::AffinityOrder(topology, ppc::util::AffinityPolicy::kNone).empty());
+  EXPECT_EQ(ppc::util::AffinityOrder(topology, ppc::util::AffinityPolicy::kCompact),
+            (std::vector<int>{0, 4, 1, 5, 2, 6, 3, 7}));
+  EXPECT_EQ(ppc::util::AffinityOrder(topology, ppc::util::AffinityPolicy::kScatter),
+            (std::vector<int>{0, 2, 1, 3, 4, 6, 5, 7}));
+  EXPECT_EQ(ppc::util::AffinityOrder(topology, ppc::util::AffinityPolicy::kPhysicalCores),
+            (std::vector<int>{0, 2, 1, 3}));
+}
+
+TEST(topology_tests, parses_policy_names) {
+  EXPECT_EQ(ppc::util::ParseAffinityPolicy(""), ppc::util::AffinityPolicy::kNone);
+  EXPECT_EQ(ppc::util::ParseAffinityPolicy("compact"), ppc::util::AffinityPolicy::kCompact);
+  EXPECT_EQ(ppc::util::ParseAffinityPolicy("scatter"), ppc::util::AffinityPolicy::kScatter);
+  EXPECT_EQ(ppc::util::ParseAffinityPolicy("physical"), ppc::util::AffinityPolicy::kPhysicalCores);
+  EXPECT_EQ(ppc::util::AffinityPolicyName(ppc::util::AffinityPolicy::kPhysicalCores), "cores");
+  EXPECT_THROW(ppc::util::ParseAffinityPolicy("everywhere"), std::invalid_argument);
+}
+
+TEST(topology_tests, unknown_policy_falls_back_to_none) {
+#ifndef _WIN32
+  setenv("PPC_AFFINITY", "everywhere", 1);  // NOLINT(misc-include-cleaner)
+  EXPECT_EQ(ppc::util::GetAffinityPolicy(), ppc::util::AffinityPolicy::kNone);
+  EXPECT_FALSE(ppc::util::PinCurrentThreadToSlot(0));
+  unsetenv("PPC_AFFINITY");  // NOLINT(misc-include-cleaner)
+#else
+  GTEST_SKIP();
+#endif
+}
+
+TEST(topology_tests, pins_thread_to_host_cpu) {
+  const auto &host = ppc::util::Topology::Host();
+  if (host.NumCpus() == 0) {
+    GTEST_SKIP() << "sysfs is not available";
+  }
+  const int cpu = host.Cpus().back().id;
+  bool pinned = false;
+  std::thread([&] { pinned = ppc::util::PinCurrentThread(cpu); }).join();
+  EXPECT_TRUE(pinned);
+}
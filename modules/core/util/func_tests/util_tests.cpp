@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <cstdlib>
+#include <memory>
 #include <string>
 #include <thread>
 
@@ -34,3 +35,35 @@ TEST(util_tests, check_set_env) {
   GTEST_SKIP();
 #endif
 }
+
+TEST(util_tests, check_set_num_threads_notifies_handlers) {
+  int save_var = ppc::util::GetPPCNumThreads();
+
+  // Handlers live until the end of the program, so the state must outlive the test
+  auto notified = std::make_shared<int>(0);
+  ppc::util::AddNumThreadsHandler([notified](int num_threads) { *notified = num_threads; });
+  ppc::util::SetPPCNumThreads(3);
+
+  EXPECT_EQ(ppc::util::GetPPCNumThreads(), 3);
+  EXPECT_EQ(*notified, 3);
+
+  ppc::util::SetPPCNumThreads(save_var);
+  EXPECT_EQ(*notified, save_var);
+}
+
+TEST(util_tests, check_handler_can_register_handler) {
+  int save_var = ppc::util::GetPPCNumThreads();
+
+  auto nested = std::make_shared<int>(0);
+  auto registered = std::make_shared<bool>(false);
+  ppc::util::AddNumThreadsHandler([nested, registered](int) {
+    if (!*registered) {
+      *registered = true;
+      ppc::util::AddNumThreadsHandler([nested](int num_threads) { *nested = num_threads; });
+    }
+  });
+  ppc::util::SetPPCNumThreads(2);
+  EXPECT_TRUE(*registered);
+  ppc::util::SetPPCNumThreads(save_var);
+  EXPECT_EQ(*nested, save_var);
+}
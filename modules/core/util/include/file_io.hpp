@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <vector>
+
+namespace ppc::util {
+
+// Read-only view of a whole file. Mapped with mmap where the OS has it, so pages are read on
+// first touch and can be dropped again under memory pressure; read into memory otherwise.
+class MappedFile {
+ public:
+  explicit MappedFile(const std::filesystem::path &path);
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  ~MappedFile();
+
+  [[nodiscard]] std::span<const std::byte> Bytes() const { return {data_, size_}; }
+  [[nodiscard]] size_t Size() const { return size_; }
+
+  // [offset, offset + size) will not be read again: its pages may be dropped first
+  void Release(size_t offset, size_t size) const;
+
+ private:
+  const std::byte *data_ = nullptr;
+  size_t size_ = 0;
+  bool mapped_ = false;
+  // Contents when the file could not be mapped
+  std::vector<std::byte> copy_;
+};
+
+// Positional reads of a file (pread), safe to issue from several threads at once
+class FileReader {
+ public:
+  explicit FileReader(const std::filesystem::path &path);
+  FileReader(const FileReader &) = delete;
+  FileReader &operator=(const FileReader &) = delete;
+  ~FileReader();
+
+  [[nodiscard]] size_t Size() const { return size_; }
+
+  // Fill buffer with the bytes at offset, throws when the file ends before
+  void ReadAt(size_t offset, std::span<std::byte> buffer) const;
+
+ private:
+  std::filesystem::path path_;
+  size_t size_ = 0;
+  int fd_ = -1;
+};
+
+// Sequential writer of a new file, meant for large blocks
+class FileWriter {
+ public:
+  explicit FileWriter(const std::filesystem::path &path);
+
+  void Write(std::span<const std::byte> bytes);
+  // Flush and close, throws when the data did not reach the file
+  void Close();
+
+  [[nodiscard]] size_t BytesWritten() const { return written_; }
+
+ private:
+  std::filesystem::path path_;
+  std::ofstream stream_;
+  size_t written_ = 0;
+};
+
+// Fresh directory under parent (the system temp directory when empty), removed with
+// everything in it when the object goes away
+class ScratchDirectory {
+ public:
+  explicit ScratchDirectory(const std::filesystem::path &parent = {});
+  ScratchDirectory(const ScratchDirectory &) = delete;
+  ScratchDirectory &operator=(const ScratchDirectory &) = delete;
+  ~ScratchDirectory();
+
+  [[nodiscard]] const std::filesystem::path &Path() const { return path_; }
+  // Path of a file that does not exist yet inside the directory
+  std::filesystem::path NewFile();
+
+ private:
+  std::filesystem::path path_;
+  size_t files_ = 0;
+};
+
+}  // namespace ppc::util
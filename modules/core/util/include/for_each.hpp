@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ppc::util {
+
+// ForEach backend of the core algorithms that runs body(i) for i in [0, count) on the calling
+// thread. Parallel variants only have to provide the same call operator: OmpForEach
+// (omp_adapters.hpp), TbbForEach (tbb_adapters.hpp) or PoolForEach (thread_pool.hpp).
+struct SequentialForEach {
+  template <class Body>
+  void operator()(size_t count, const Body &body) const {
+    for (size_t i = 0; i < count; i++) {
+      body(i);
+    }
+  }
+};
+
+}  // namespace ppc::util
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <omp.h>
+
+#include "core/util/include/topology.hpp"
+
+namespace ppc::util {
+
+// Pins the threads of an OpenMP team of num_threads to their slots under GetAffinityPolicy().
+// OpenMP keeps its team threads alive between parallel regions, so pinning them once per
+// thread count is enough. Thread 0 is the main thread, which stays unpinned so the raw
+// threads tasks start from it can use every CPU.
+inline void PinOpenMPThreads(int num_threads) {
+  if (GetAffinityPolicy() == AffinityPolicy::kNone) {
+    return;
+  }
+#pragma omp parallel num_threads(num_threads)
+  if (omp_get_thread_num() != 0) {
+    PinCurrentThreadToSlot(omp_get_thread_num());
+  }
+}
+
+}  // namespace ppc::util
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string>
+
+namespace ppc::util {
+
+enum class SimdLevel {
+  // plain C++
+  kScalar,
+  // 256-bit AVX2 kernels
+  kAvx2,
+  // 512-bit AVX-512 kernels
+  kAvx512,
+};
+
+// Accepts "scalar", "avx2" and "avx512", throws on anything else
+SimdLevel ParseSimdLevel(const std::string &name);
+std::string SimdLevelName(SimdLevel level);
+// Widest level both the build and the CPU support
+SimdLevel DetectSimdLevel();
+// Level the SIMD kernels of the core modules dispatch to: DetectSimdLevel() capped by PPC_SIMD when it is set
+SimdLevel ActiveSimdLevel();
+// Caps the active level (for tests and benchmarks), returns the level actually in use
+SimdLevel SetSimdLevel(SimdLevel level);
+
+}  // namespace ppc::util
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <oneapi/tbb/task_arena.h>
+#include <oneapi/tbb/task_scheduler_observer.h>
+
+#include <memory>
+
+#include "core/util/include/topology.hpp"
+
+namespace ppc::util {
+
+// Pins every worker joining the default TBB arena to the slot of its arena index.
+// The main thread is left unpinned, the threads tasks start from it inherit its mask.
+class TbbAffinityObserver : public oneapi::tbb::task_scheduler_observer {
+ public:
+  TbbAffinityObserver() { observe(true); }
+  TbbAffinityObserver(const TbbAffinityObserver &) = delete;
+  TbbAffinityObserver &operator=(const TbbAffinityObserver &) = delete;
+  ~TbbAffinityObserver() override { observe(false); }
+
+  void on_scheduler_entry(bool is_worker) override {
+    if (is_worker) {
+      PinCurrentThreadToSlot(oneapi::tbb::this_task_arena::current_thread_index());
+    }
+  }
+};
+
+// Observer pinning the TBB workers, nullptr when GetAffinityPolicy() leaves threads unpinned
+inline std::unique_ptr<TbbAffinityObserver> MakeTbbAffinityObserver() {
+  if (GetAffinityPolicy() == AffinityPolicy::kNone) {
+    return nullptr;
+  }
+  return std::make_unique<TbbAffinityObserver>();
+}
+
+}  // namespace ppc::util
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ppc::util {
+
+// One hardware thread (logical CPU) as the kernel sees it
+struct CpuInfo {
+  int id = 0;
+  int core_id = 0;
+  int package_id = 0;
+  int numa_node = 0;
+  // position among the SMT siblings of the core, 0 for the first hardware thread
+  int smt_index = 0;
+};
+
+struct CacheInfo {
+  int level = 0;
+  // "Data", "Instruction" or "Unified"
+  std::string type;
+  size_t size_bytes = 0;
+  std::vector<int> shared_cpus;
+};
+
+// Machine layout read from sysfs. Only CPUs the process may run on are listed, so the
+// topology respects taskset and cgroup cpusets.
+class Topology {
+ public:
+  // sysfs_root is the directory containing cpu/ and node/, overridable for tests
+  static Topology Discover(const std::string &sysfs_root = "/sys/devices/system");
+  // Topology of the host, discovered once
+  static const Topology &Host();
+
+  [[nodiscard]] const std::vector<CpuInfo> &Cpus() const { return cpus_; }
+  [[nodiscard]] const std::vector<CacheInfo> &Caches() const { return caches_; }
+  [[nodiscard]] int NumCpus() const { return static_cast<int>(cpus_.size()); }
+  [[nodiscard]] int NumCores() const;
+  [[nodiscard]] int NumPackages() const;
+  [[nodiscard]] int NumNumaNodes() const;
+
+ private:
+  std::vector<CpuInfo> cpus_;
+  std::vector<CacheInfo> caches_;
+};
+
+enum class AffinityPolicy {
+  // threads are left to the OS scheduler
+  kNone,
+  // fill one core after another, SMT siblings first, then the next package
+  kCompact,
+  // spread threads round-robin across packages and cores, SMT siblings last
+  kScatter,
+  // one thread per physical core spread like scatter, SMT siblings are never used
+  kPhysicalCores,
+};
+
+// Accepts "none", "compact", "scatter" and "cores" (or "physical"), throws on anything else
+AffinityPolicy ParseAffinityPolicy(const std::string &name);
+std::string AffinityPolicyName(AffinityPolicy policy);
+
+// Policy selected with the PPC_AFFINITY environment variable, kNone when it is unset. An unknown
+// value is reported once on stderr and also leaves threads unpinned.
+AffinityPolicy GetAffinityPolicy();
+
+// CPU ids in the order thread slots 0, 1, 2, ... are placed by the policy, empty for kNone
+std::vector<int> AffinityOrder(const Topology &topology, AffinityPolicy policy);
+
+// Pin the calling thread to one CPU, false when the OS refused or does not support it
+bool PinCurrentThread(int cpu);
+
+// Pin the calling thread as thread number slot of a parallel team according to
+// GetAffinityPolicy() on the host topology. Slots beyond the number of CPUs wrap around.
+// Every technology (OpenMP, TBB, std::thread) numbers its threads from 0, with 0 being the
+// thread that starts the parallel work, so all of them get the same placement. Slot 0 is
+// never pinned by the runners: threads it spawns would inherit a single-CPU mask.
+bool PinCurrentThreadToSlot(int slot);
+
+// Shift added to every slot, so several MPI processes on one node get disjoint CPUs
+// (process k of a node uses offset k * threads per process)
+void SetAffinitySlotOffset(int offset);
+
+}  // namespace ppc::util
@@ -1,4 +1,5 @@
 #pragma once
+#include <functional>
 #include <string>
 
 namespace ppc::util {
@@ -6,4 +7,9 @@ namespace ppc::util {
 std::string GetAbsolutePath(const std::string &relative_path);
 int GetPPCNumThreads();
 
+// Change the thread count seen by GetPPCNumThreads() and notify every technology runtime
+// registered with AddNumThreadsHandler (OpenMP, TBB), so all consumers use the same count
+void SetPPCNumThreads(int num_threads);
+void AddNumThreadsHandler(const std::function<void(int)> &handler);
+
 }  // namespace ppc::util
@@ -0,0 +1,170 @@
+#include "core/util/include/file_io.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
+namespace {
+
+[[noreturn]] void ThrowIoError(const std::string &what, const std::filesystem::path &path) {
+#ifndef _WIN32
+  throw std::system_error(errno, std::generic_category(), what + ": " + path.string());
+#else
+  throw std::runtime_error(what + ": " + path.string());
+#endif
+}
+
+}  // namespace
+
+ppc::util::MappedFile::MappedFile(const std::filesystem::path &path) {
+  size_ = static_cast<size_t>(std::filesystem::file_size(path));
+  if (size_ == 0) {
+    return;
+  }
+#ifndef _WIN32
+  const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    ThrowIoError("Unable to open file", path);
+  }
+  void *raw = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping keeps its own reference to the file
+  close(fd);
+  if (raw != MAP_FAILED) {
+    madvise(raw, size_, MADV_SEQUENTIAL);
+    data_ = static_cast<const std::byte *>(raw);
+    mapped_ = true;
+    return;
+  }
+#endif
+  copy_.resize(size_);
+  std::ifstream stream(path, std::ios::binary);
+  if (!stream.read(reinterpret_cast<char *>(copy_.data()), static_cast<std::streamsize>(size_))) {
+    ThrowIoError("Unable to read file", path);
+  }
+  data_ = copy_.data();
+}
+
+ppc::util::MappedFile::~MappedFile() {
+#ifndef _WIN32
+  if (mapped_) {
+    munmap(const_cast<std::byte *>(data_), size_);
+  }
+#endif
+}
+
+void ppc::util::MappedFile::Release(size_t offset, size_t size) const {
+#ifndef _WIN32
+  if (!mapped_) {
+    return;
+  }
+  // madvise works on whole pages inside the range
+  const auto page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const size_t begin = (offset + page - 1) / page * page;
+  const size_t end = std::min(offset + size, size_) / page * page;
+  if (begin < end) {
+    madvise(const_cast<std::byte *>(data_) + begin, end - begin, MADV_DONTNEED);
+  }
+#else
+  (void)offset;
+  (void)size;
+#endif
+}
+
+ppc::util::FileReader::FileReader(const std::filesystem::path &path)
+    : path_(path), size_(static_cast<size_t>(std::filesystem::file_size(path))) {
+#ifndef _WIN32
+  fd_ = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd_ < 0) {
+    ThrowIoError("Unable to open file", path);
+  }
+  posix_fadvise(fd_, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+}
+
+ppc::util::FileReader::~FileReader() {
+#ifndef _WIN32
+  if (fd_ >= 0) {
+    close(fd_);
+  }
+#endif
+}
+
+void ppc::util::FileReader::ReadAt(size_t offset, std::span<std::byte> buffer) const {
+  if (offset + buffer.size() > size_) {
+    throw std::out_of_range("FileReader: read past the end of " + path_.string());
+  }
+#ifndef _WIN32
+  size_t done = 0;
+  while (done < buffer.size()) {
+    const ssize_t got = pread(fd_, buffer.data() + done, buffer.size() - done, static_cast<off_t>(offset + done));
+    if (got < 0 && errno == EINTR) {
+      continue;
+    }
+    if (got <= 0) {
+      ThrowIoError("Unable to read file", path_);
+    }
+    done += static_cast<size_t>(got);
+  }
+#else
+  // No positional reads: a stream per call keeps concurrent readers independent
+  std::ifstream stream(path_, std::ios::binary);
+  stream.seekg(static_cast<std::streamoff>(offset));
+  if (!stream.read(reinterpret_cast<char *>(buffer.data()), static_cast<std::streamsize>(buffer.size()))) {
+    ThrowIoError("Unable to read file", path_);
+  }
+#endif
+}
+
+ppc::util::FileWriter::FileWriter(const std::filesystem::path &path)
+    : path_(path), stream_(path, std::ios::binary | std::ios::trunc) {
+  if (!stream_) {
+    ThrowIoError("Unable to create file", path);
+  }
+}
+
+void ppc::util::FileWriter::Write(std::span<const std::byte> bytes) {
+  if (!stream_.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()))) {
+    ThrowIoError("Unable to write file", path_);
+  }
+  written_ += bytes.size();
+}
+
+void ppc::util::FileWriter::Close() {
+  stream_.close();
+  if (!stream_) {
+    ThrowIoError("Unable to write file", path_);
+  }
+}
+
+ppc::util::ScratchDirectory::ScratchDirectory(const std::filesystem::path &parent) {
+  const auto base = parent.empty() ? std::filesystem::temp_directory_path() : parent;
+  std::random_device random;
+  // create_directories reports false when the name is taken, another name is tried then
+  do {
+    path_ = base / ("ppc-scratch-" + std::to_string(random()));
+  } while (!std::filesystem::create_directories(path_));
+}
+
+ppc::util::ScratchDirectory::~ScratchDirectory() {
+  std::error_code error;
+  std::filesystem::remove_all(path_, error);
+}
+
+std::filesystem::path ppc::util::ScratchDirectory::NewFile() {
+  return path_ / ("file-" + std::to_string(files_++) + ".bin");
+}
@@ -0,0 +1,68 @@
+#include "core/util/include/simd_level.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+std::atomic<ppc::util::SimdLevel> &ActiveLevel() {
+  static std::atomic<ppc::util::SimdLevel> level = [] {
+    const auto detected = ppc::util::DetectSimdLevel();
+    const char *env = std::getenv("PPC_SIMD");  // NOLINT(concurrency-mt-unsafe)
+    if (env == nullptr || *env == '\0') {
+      return detected;
+    }
+    return std::min(ppc::util::ParseSimdLevel(env), detected);
+  }();
+  return level;
+}
+
+}  // namespace
+
+ppc::util::SimdLevel ppc::util::ParseSimdLevel(const std::string &name) {
+  if (name == "scalar") {
+    return SimdLevel::kScalar;
+  }
+  if (name == "avx2") {
+    return SimdLevel::kAvx2;
+  }
+  if (name == "avx512") {
+    return SimdLevel::kAvx512;
+  }
+  throw std::invalid_argument("Unknown SIMD level: " + name);
+}
+
+std::string ppc::util::SimdLevelName(SimdLevel level) {
+  switch (level) {
+    case SimdLevel::kAvx2:
+      return "avx2";
+    case SimdLevel::kAvx512:
+      return "avx512";
+    case SimdLevel::kScalar:
+      break;
+  }
+  return "scalar";
+}
+
+ppc::util::SimdLevel ppc::util::DetectSimdLevel() {
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+  if (__builtin_cpu_supports("avx512f")) {
+    return SimdLevel::kAvx512;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return SimdLevel::kAvx2;
+  }
+#endif
+  return SimdLevel::kScalar;
+}
+
+ppc::util::SimdLevel ppc::util::ActiveSimdLevel() { return ActiveLevel().load(std::memory_order_relaxed); }
+
+ppc::util::SimdLevel ppc::util::SetSimdLevel(SimdLevel level) {
+  const auto active = std::min(level, DetectSimdLevel());
+  ActiveLevel().store(active, std::memory_order_relaxed);
+  return active;
+}
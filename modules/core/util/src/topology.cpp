@@ -0,0 +1,311 @@
+#include "core/util/include/topology.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+
+constexpr const char *kHostSysfsRoot = "/sys/devices/system";
+
+std::optional<std::string> ReadLine(const std::string &path) {
+  std::ifstream file(path);
+  std::string line;
+  if (!file || !std::getline(file, line)) {
+    return std::nullopt;
+  }
+  return line;
+}
+
+int ReadInt(const std::string &path, int fallback) {
+  const auto line = ReadLine(path);
+  if (!line || line->empty()) {
+    return fallback;
+  }
+  return std::atoi(line->c_str());
+}
+
+// Kernel cpu list format: "0-3,8,10-11"
+std::vector<int> ParseCpuList(const std::string &list) {
+  std::vector<int> cpus;
+  std::stringstream stream(list);
+  std::string range;
+  while (std::getline(stream, range, ',')) {
+    if (range.empty()) {
+      continue;
+    }
+    const auto dash = range.find('-');
+    const int first = std::atoi(range.substr(0, dash).c_str());
+    const int last = dash == std::string::npos ? first : std::atoi(range.substr(dash + 1).c_str());
+    for (int cpu = first; cpu <= last; cpu++) {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+
+// Cache sizes look like "48K" or "2M"
+size_t ParseSize(const std::string &text) {
+  size_t value = std::strtoull(text.c_str(), nullptr, 10);
+  if (text.find('K') != std::string::npos) {
+    value <<= 10;
+  } else if (text.find('M') != std::string::npos) {
+    value <<= 20;
+  } else if (text.find('G') != std::string::npos) {
+    value <<= 30;
+  }
+  return value;
+}
+
+std::atomic<int> slot_offset{0};
+
+std::set<int> AllowedCpus() {
+  std::set<int> allowed;
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+      if (CPU_ISSET(cpu, &set)) {
+        allowed.insert(cpu);
+      }
+    }
+  }
+#endif
+  return allowed;
+}
+
+}  // namespace
+
+ppc::util::Topology ppc::util::Topology::Discover(const std::string &sysfs_root) {
+  Topology topology;
+  const std::string cpu_root = sysfs_root + "/cpu";
+  const auto online = ReadLine(cpu_root + "/online");
+  if (!online) {
+    return topology;
+  }
+
+  // The affinity mask only describes the host, not trees given for tests
+  const std::set<int> allowed = sysfs_root == kHostSysfsRoot ? AllowedCpus() : std::set<int>{};
+  for (const int id : ParseCpuList(*online)) {
+    if (!allowed.empty() && !allowed.contains(id)) {
+      continue;
+    }
+    const std::string dir = cpu_root + "/cpu" + std::to_string(id);
+    CpuInfo cpu;
+    cpu.id = id;
+    cpu.core_id = ReadInt(dir + "/topology/core_id", id);
+    cpu.package_id = ReadInt(dir + "/topology/physical_package_id", 0);
+    const auto siblings = ParseCpuList(ReadLine(dir + "/topology/thread_siblings_list").value_or(""));
+    const auto position = std::ranges::find(siblings, id);
+    cpu.smt_index = position == siblings.end() ? 0 : static_cast<int>(position - siblings.begin());
+    topology.cpus_.push_back(cpu);
+  }
+
+  for (int node = 0;; node++) {
+    const auto cpulist = ReadLine(sysfs_root + "/node/node" + std::to_string(node) + "/cpulist");
+    if (!cpulist) {
+      break;
+    }
+    for (const int id : ParseCpuList(*cpulist)) {
+      for (auto &cpu : topology.cpus_) {
+        if (cpu.id == id) {
+          cpu.numa_node = node;
+        }
+      }
+    }
+  }
+
+  // Every cache is listed by each CPU sharing it, keep one entry per cache instance
+  std::set<std::tuple<int, std::string, std::vector<int>>> seen;
+  for (const auto &cpu : topology.cpus_) {
+    const std::string dir = cpu_root + "/cpu" + std::to_string(cpu.id) + "/cache/index";
+    for (int index = 0;; index++) {
+      const std::string cache_dir = dir + std::to_string(index);
+      const auto level = ReadLine(cache_dir + "/level");
+      if (!level) {
+        break;
+      }
+      CacheInfo cache;
+      cache.level = std::atoi(level->c_str());
+      cache.type = ReadLine(cache_dir + "/type").value_or("Unified");
+      cache.size_bytes = ParseSize(ReadLine(cache_dir + "/size").value_or("0"));
+      cache.shared_cpus = ParseCpuList(ReadLine(cache_dir + "/shared_cpu_list").value_or(""));
+      if (seen.emplace(cache.level, cache.type, cache.shared_cpus).second) {
+        topology.caches_.push_back(std::move(cache));
+      }
+    }
+  }
+  return topology;
+}
+
+const ppc::util::Topology &ppc::util::Topology::Host() {
+  static const Topology kHost = Discover();
+  return kHost;
+}
+
+int ppc::util::Topology::NumCores() const {
+  std::set<std::pair<int, int>> cores;
+  for (const auto &cpu : cpus_) {
+    cores.emplace(cpu.package_id, cpu.core_id);
+  }
+  return static_cast<int>(cores.size());
+}
+
+int ppc::util::Topology::NumPackages() const {
+  std::set<int> packages;
+  for (const auto &cpu : cpus_) {
+    packages.insert(cpu.package_id);
+  }
+  return static_cast<int>(packages.size());
+}
+
+int ppc::util::Topology::NumNumaNodes() const {
+  std::set<int> nodes;
+  for (const auto &cpu : cpus_) {
+    nodes.insert(cpu.numa_node);
+  }
+  return static_cast<int>(nodes.size());
+}
+
+ppc::util::AffinityPolicy ppc::util::ParseAffinityPolicy(const std::string &name) {
+  if (name.empty() || name == "none") {
+    return AffinityPolicy::kNone;
+  }
+  if (name == "compact") {
+    return AffinityPolicy::kCompact;
+  }
+  if (name == "scatter") {
+    return AffinityPolicy::kScatter;
+  }
+  if (name == "cores" || name == "physical") {
+    return AffinityPolicy::kPhysicalCores;
+  }
+  throw std::invalid_argument("Unknown affinity policy: " + name);
+}
+
+std::string ppc::util::AffinityPolicyName(AffinityPolicy policy) {
+  switch (policy) {
+    case AffinityPolicy::kCompact:
+      return "compact";
+    case AffinityPolicy::kScatter:
+      return "scatter";
+    case AffinityPolicy::kPhysicalCores:
+      return "cores";
+    case AffinityPolicy::kNone:
+      break;
+  }
+  return "none";
+}
+
+ppc::util::AffinityPolicy ppc::util::GetAffinityPolicy() {
+  const char *env = std::getenv("PPC_AFFINITY");  // NOLINT(concurrency-mt-unsafe)
+  try {
+    return ParseAffinityPolicy(env != nullptr ? env : "");
+  } catch (const std::invalid_argument &error) {
+    // Pool and OpenMP workers call this too, so a typo must not terminate them
+    static std::once_flag reported;
+    std::call_once(reported, [&] {
+      std::cerr << "PPC_AFFINITY: " << error.what()
+                << " (expected none, compact, scatter or cores), threads are not pinned\n";
+    });
+    return AffinityPolicy::kNone;
+  }
+}
+
+std::vector<int> ppc::util::AffinityOrder(const Topology &topology, AffinityPolicy policy) {
+  if (policy == AffinityPolicy::kNone) {
+    return {};
+  }
+
+  // Rank of every core inside its package, so scatter can interleave packages of different numbering
+  std::map<std::pair<int, int>, int> core_rank;
+  for (const auto &cpu : topology.Cpus()) {
+    core_rank.emplace(std::make_pair(cpu.package_id, cpu.core_id), 0);
+  }
+  std::map<int, int> next_rank;
+  for (auto &[core, rank] : core_rank) {
+    rank = next_rank[core.first]++;
+  }
+
+  std::vector<CpuInfo> cpus = topology.Cpus();
+  if (policy == AffinityPolicy::kPhysicalCores) {
+    std::erase_if(cpus, [](const CpuInfo &cpu) { return cpu.smt_index != 0; });
+  }
+  const auto compact_key = [&](const CpuInfo &cpu) {
+    return std::make_tuple(cpu.package_id, core_rank[{cpu.package_id, cpu.core_id}], cpu.smt_index, cpu.id);
+  };
+  const auto scatter_key = [&](const CpuInfo &cpu) {
+    return std::make_tuple(cpu.smt_index, core_rank[{cpu.package_id, cpu.core_id}], cpu.package_id, cpu.id);
+  };
+  std::ranges::sort(cpus, [&](const CpuInfo &a, const CpuInfo &b) {
+    return policy == AffinityPolicy::kCompact ? compact_key(a) < compact_key(b) : scatter_key(a) < scatter_key(b);
+  });
+
+  std::vector<int> order;
+  order.reserve(cpus.size());
+  for (const auto &cpu : cpus) {
+    order.push_back(cpu.id);
+  }
+  return order;
+}
+
+bool ppc::util::PinCurrentThread(int cpu) {
+#ifdef __linux__
+  if (cpu < 0 || cpu >= CPU_SETSIZE) {
+    return false;
+  }
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+  (void)cpu;
+  return false;
+#endif
+}
+
+bool ppc::util::PinCurrentThreadToSlot(int slot) {
+  const AffinityPolicy policy = GetAffinityPolicy();
+  if (policy == AffinityPolicy::kNone || slot < 0) {
+    return false;
+  }
+
+  static std::mutex mutex;
+  static std::array<std::optional<std::vector<int>>, 4> orders;
+  std::vector<int> *order = nullptr;
+  {
+    std::lock_guard lock(mutex);
+    auto &cached = orders[static_cast<size_t>(policy)];
+    if (!cached) {
+      cached = AffinityOrder(Topology::Host(), policy);
+    }
+    order = &*cached;
+  }
+  if (order->empty()) {
+    return false;
+  }
+  const auto index = static_cast<size_t>(slot + slot_offset.load(std::memory_order_relaxed));
+  return PinCurrentThread((*order)[index % order->size()]);
+}
+
+void ppc::util::SetAffinitySlotOffset(int offset) { slot_offset.store(offset, std::memory_order_relaxed); }
@@ -5,11 +5,27 @@
 #include <cstdint>
 #include <iostream>
 #include <memory>
-#include <vector>
 #endif
 
 #include <filesystem>
+#include <functional>
+#include <mutex>
 #include <string>
+#include <vector>
+
+namespace {
+
+struct NumThreadsHandlers {
+  std::mutex mutex;
+  std::vector<std::function<void(int)>> handlers;
+};
+
+NumThreadsHandlers &GetNumThreadsHandlers() {
+  static NumThreadsHandlers handlers;
+  return handlers;
+}
+
+}  // namespace
 
 std::string ppc::util::GetAbsolutePath(const std::string &relative_path) {
   const std::filesystem::path path = std::string(PPC_PATH_TO_PROJECT) + "/tasks/" + relative_path;
@@ -30,3 +46,28 @@ int ppc::util::GetPPCNumThreads() {
   int num_threads = (omp_env != nullptr) ? std::atoi(omp_env) : 1;
   return num_threads;
 }
+
+void ppc::util::SetPPCNumThreads(int num_threads) {
+  const std::string value = std::to_string(num_threads);
+#ifdef _WIN32
+  _putenv_s("OMP_NUM_THREADS", value.c_str());
+#else
+  setenv("OMP_NUM_THREADS", value.c_str(), 1);  // NOLINT(misc-include-cleaner)
+#endif
+  // Handlers run outside the lock, so one of them may register another handler
+  std::vector<std::function<void(int)>> handlers;
+  {
+    auto &registry = GetNumThreadsHandlers();
+    std::lock_guard lock(registry.mutex);
+    handlers = registry.handlers;
+  }
+  for (const auto &handler : handlers) {
+    handler(num_threads);
+  }
+}
+
+void ppc::util::AddNumThreadsHandler(const std::function<void(int)> &handler) {
+  auto &registry = GetNumThreadsHandlers();
+  std::lock_guard lock(registry.mutex);
+  registry.handlers.push_back(handler);
+}
@@ -1,10 +1,12 @@
 import argparse
+import json
 import os
 import re
 import xlsxwriter
 
 parser = argparse.ArgumentParser()
-parser.add_argument('-i', '--input', help='Input file path (logs of perf tests, .txt)', required=True)
+parser.add_argument('-i', '--input', required=True,
+                    help='Input file path (logs of perf tests, .txt, or perf result sink records, .jsonl)')
 parser.add_argument('-o', '--output', help='Output file path (path to .xlsx table)', required=True)
 args = parser.parse_args()
 logs_path = os.path.abspath(args.input)
@@ -15,32 +17,52 @@ list_of_type_of_tasks = ["all", "mpi", "omp", "seq", "stl", "tbb"]
 result_tables = {"pipeline": {}, "task_run": {}}
 set_of_task_name = []
 
-logs_file = open(logs_path, "r")
-logs_lines = logs_file.readlines()
-for line in logs_lines:
-    pattern = r'tasks[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)'
-    result = re.findall(pattern, line)
-    if len(result):
-        task_name = result[0][1]
-        perf_type = result[0][2]
-        set_of_task_name.append(task_name)
-        result_tables[perf_type][task_name] = {}
-
-        for ttype in list_of_type_of_tasks:
-            result_tables[perf_type][task_name][ttype] = -1.0
-
-for line in logs_lines:
-    pattern = r'tasks[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)'
-    result = re.findall(pattern, line)
-    if len(result):
-        task_type = result[0][0]
-        task_name = result[0][1]
-        perf_type = result[0][2]
-        perf_time = float(result[0][3])
-        if perf_time < 0.05:
-            msg = f"Performance time = {perf_time} < 0.05 second : for {task_type} - {task_name} - {perf_type} \n"
-            raise Exception(msg)
-        result_tables[perf_type][task_name][task_type] = perf_time
+def read_log_results(path):
+    # Compatibility view: "tasks/<type>/<name>:<perf_type>:<time>" lines of the perf tests output
+    results = []
+    with open(path, "r") as logs_file:
+        for line in logs_file.readlines():
+            pattern = r'tasks[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)'
+            result = re.findall(pattern, line)
+            if len(result):
+                results.append((result[0][0], result[0][1], result[0][2], float(result[0][3])))
+    return results
+
+
+def read_jsonl_results(path):
+    # Records appended by the perf result sink (PPC_PERF_RESULTS=<file>.jsonl)
+    results = []
+    with open(path, "r") as records_file:
+        for line in records_file:
+            if not line.strip():
+                continue
+            record = json.loads(line)
+            task_type, _, task_name = record["task"].partition("/")
+            results.append((task_type, task_name, record["type_of_running"], float(record["time_sec"])))
+    return results
+
+
+if logs_path.endswith(".jsonl"):
+    perf_results = read_jsonl_results(logs_path)
+else:
+    perf_results = read_log_results(logs_path)
+
+for task_type, task_name, perf_type, perf_time in perf_results:
+    if perf_type not in result_tables:
+        continue
+    set_of_task_name.append(task_name)
+    result_tables[perf_type][task_name] = {}
+
+    for ttype in list_of_type_of_tasks:
+        result_tables[perf_type][task_name][ttype] = -1.0
+
+for task_type, task_name, perf_type, perf_time in perf_results:
+    if perf_type not in result_tables:
+        continue
+    if perf_time < 0.05:
+        msg = f"Performance time = {perf_time} < 0.05 second : for {task_type} - {task_name} - {perf_type} \n"
+        raise Exception(msg)
+    result_tables[perf_type][task_name][task_type] = perf_time
 
 
 for table_name in result_tables:
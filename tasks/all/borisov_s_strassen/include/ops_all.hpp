@@ -26,7 +26,10 @@ class ParallelStrassenMpiStl : public ppc::core::Task {
   int colsA_ = 0;
   int rowsB_ = 0;
   int colsB_ = 0;
+  // Operand sizes rounded up to even for the top-level split
   int m_ = 0;
+  int k_ = 0;
+  int n_ = 0;
 
   boost::mpi::communicator world_;
 };
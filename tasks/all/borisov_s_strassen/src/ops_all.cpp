@@ -3,130 +3,62 @@
 #include <algorithm>
 #include <boost/serialization/vector.hpp>  // NOLINT(*-include-cleaner)
 #include <cstddef>
-#include <thread>
 #include <utility>
 #include <vector>
 
 #include "boost/mpi/collectives/broadcast.hpp"
+#include "core/gemm/include/strassen.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 
 namespace borisov_s_strassen_all {
 namespace {
 
-std::vector<double> MultiplyNaive(const std::vector<double>& a, const std::vector<double>& b, int n) {
-  std::vector<double> c(n * n, 0.0);
-  for (int i = 0; i < n; ++i) {
-    for (int j = 0; j < n; ++j) {
-      double s = 0.0;
-      for (int k = 0; k < n; ++k) {
-        s += a[(i * n) + k] * b[(k * n) + j];
-      }
-      c[(i * n) + j] = s;
-    }
-  }
-  return c;
-}
-
-std::vector<double> AddMatr(const std::vector<double>& a, const std::vector<double>& b, int n) {
-  std::vector<double> c(n * n);
-  for (int i = 0; i < n * n; ++i) {
+std::vector<double> AddMatr(const std::vector<double>& a, const std::vector<double>& b) {
+  std::vector<double> c(a.size());
+  for (size_t i = 0; i < a.size(); ++i) {
     c[i] = a[i] + b[i];
   }
   return c;
 }
 
-std::vector<double> SubMatr(const std::vector<double>& a, const std::vector<double>& b, int n) {
-  std::vector<double> c(n * n);
-  for (int i = 0; i < n * n; ++i) {
+std::vector<double> SubMatr(const std::vector<double>& a, const std::vector<double>& b) {
+  std::vector<double> c(a.size());
+  for (size_t i = 0; i < a.size(); ++i) {
     c[i] = a[i] - b[i];
   }
   return c;
 }
 
-std::vector<double> SubMatrix(const std::vector<double>& m, int n, int row, int col, int size) {
-  std::vector<double> sub_matr(size * size);
-  for (int i = 0; i < size; ++i) {
-    std::copy(m.begin() + (row + i) * n + col, m.begin() + (row + i) * n + col + size, sub_matr.begin() + i * size);
+std::vector<double> SubMatrix(const std::vector<double>& m, int ld, int row, int col, int rows, int cols) {
+  std::vector<double> sub_matr(rows * cols);
+  for (int i = 0; i < rows; ++i) {
+    std::copy(m.begin() + ((row + i) * ld) + col, m.begin() + ((row + i) * ld) + col + cols,
+              sub_matr.begin() + (i * cols));
   }
   return sub_matr;
 }
 
-void SetSubMatrix(std::vector<double>& m, const std::vector<double>& sub_matr, int n, int row, int col, int size) {
-  for (int i = 0; i < size; ++i) {
-    std::copy(sub_matr.begin() + i * size, sub_matr.begin() + (i + 1) * size, m.begin() + (row + i) * n + col);
-  }
-}
-
-int NextPowerOfTwo(int n) {
-  int r = 1;
-  while (r < n) {
-    r <<= 1;
+void SetSubMatrix(std::vector<double>& m, const std::vector<double>& sub_matr, int ld, int row, int col, int rows,
+                  int cols) {
+  for (int i = 0; i < rows; ++i) {
+    std::copy(sub_matr.begin() + (i * cols), sub_matr.begin() + ((i + 1) * cols), m.begin() + ((row + i) * ld) + col);
   }
-  return r;
 }
 
-std::vector<double> StrassenRecursive(const std::vector<double>& a, const std::vector<double>& b, int n,
-                                      int depth = 0) {
-  const int parallel_depth = 2;
-  if (n <= 128) {
-    return MultiplyNaive(a, b, n);
-  }
-
-  int k = n / 2;
-  auto a11 = SubMatrix(a, n, 0, 0, k);
-  auto a12 = SubMatrix(a, n, 0, k, k);
-  auto a21 = SubMatrix(a, n, k, 0, k);
-  auto a22 = SubMatrix(a, n, k, k, k);
-  auto b11 = SubMatrix(b, n, 0, 0, k);
-  auto b12 = SubMatrix(b, n, 0, k, k);
-  auto b21 = SubMatrix(b, n, k, 0, k);
-  auto b22 = SubMatrix(b, n, k, k, k);
-
-  std::vector<double> m1;
-  std::vector<double> m2;
-  std::vector<double> m3;
-  std::vector<double> m4;
-  std::vector<double> m5;
-  std::vector<double> m6;
-  std::vector<double> m7;
-
-  if (depth < parallel_depth) {
-    std::thread t1([&] { m1 = StrassenRecursive(AddMatr(a11, a22, k), AddMatr(b11, b22, k), k, depth + 1); });
-    std::thread t2([&] { m2 = StrassenRecursive(AddMatr(a21, a22, k), b11, k, depth + 1); });
-    std::thread t3([&] { m3 = StrassenRecursive(a11, SubMatr(b12, b22, k), k, depth + 1); });
-    std::thread t4([&] { m4 = StrassenRecursive(a22, SubMatr(b21, b11, k), k, depth + 1); });
-    std::thread t5([&] { m5 = StrassenRecursive(AddMatr(a11, a12, k), b22, k, depth + 1); });
-    std::thread t6([&] { m6 = StrassenRecursive(SubMatr(a21, a11, k), AddMatr(b11, b12, k), k, depth + 1); });
-    std::thread t7([&] { m7 = StrassenRecursive(SubMatr(a12, a22, k), AddMatr(b21, b22, k), k, depth + 1); });
-    t1.join();
-    t2.join();
-    t3.join();
-    t4.join();
-    t5.join();
-    t6.join();
-    t7.join();
-  } else {
-    m1 = StrassenRecursive(AddMatr(a11, a22, k), AddMatr(b11, b22, k), k, depth + 1);
-    m2 = StrassenRecursive(AddMatr(a21, a22, k), b11, k, depth + 1);
-    m3 = StrassenRecursive(a11, SubMatr(b12, b22, k), k, depth + 1);
-    m4 = StrassenRecursive(a22, SubMatr(b21, b11, k), k, depth + 1);
-    m5 = StrassenRecursive(AddMatr(a11, a12, k), b22, k, depth + 1);
-    m6 = StrassenRecursive(SubMatr(a21, a11, k), AddMatr(b11, b12, k), k, depth + 1);
-    m7 = StrassenRecursive(SubMatr(a12, a22, k), AddMatr(b21, b22, k), k, depth + 1);
-  }
-
-  std::vector<double> c(n * n, 0.0);
-  auto c11 = AddMatr(SubMatr(AddMatr(m1, m4, k), m5, k), m7, k);
-  auto c12 = AddMatr(m3, m5, k);
-  auto c21 = AddMatr(m2, m4, k);
-  auto c22 = AddMatr(SubMatr(AddMatr(m1, m3, k), m2, k), m6, k);
-
-  SetSubMatrix(c, c11, n, 0, 0, k);
-  SetSubMatrix(c, c12, n, 0, k, k);
-  SetSubMatrix(c, c21, n, k, 0, k);
-  SetSubMatrix(c, c22, n, k, k, k);
+// One of the seven top-level products on this process, by the shared Strassen engine
+std::vector<double> Multiply(const std::vector<double>& a, const std::vector<double>& b, int rows, int cols,
+                             int inner) {
+  const auto m = static_cast<size_t>(rows);
+  const auto n = static_cast<size_t>(cols);
+  const auto k = static_cast<size_t>(inner);
+  std::vector<double> c(m * n);
+  std::vector<double> workspace(ppc::core::StrassenWorkspaceSize(m, n, k));
+  ppc::core::StrassenMultiply(m, n, k, a.data(), k, b.data(), n, c.data(), n, workspace, ppc::core::PoolForEach{});
   return c;
 }
 
+int RoundUpToEven(int n) { return n + (n % 2); }
+
 }  // namespace
 
 bool ParallelStrassenMpiStl::PreProcessingImpl() {
@@ -140,31 +72,21 @@ bool ParallelStrassenMpiStl::PreProcessingImpl() {
     rowsB_ = static_cast<int>(input_[2]);
     colsB_ = static_cast<int>(input_[3]);
 
-    int max_dim = std::max({rowsA_, colsA_, colsB_});
-    m_ = NextPowerOfTwo(max_dim);
-
-    std::vector<double> a(rowsA_ * colsA_);
-    std::vector<double> b(rowsB_ * colsB_);
-    size_t off = 4;
-    for (int i = 0; i < rowsA_ * colsA_; ++i) {
-      a[i] = input_[off + i];
-    }
-    off += rowsA_ * colsA_;
-    for (int i = 0; i < rowsB_ * colsB_; ++i) {
-      b[i] = input_[off + i];
-    }
+    // Only the top level is split across processes, so each odd dimension gets one zero row or
+    // column; the engine peels odd sizes below it
+    m_ = RoundUpToEven(rowsA_);
+    k_ = RoundUpToEven(colsA_);
+    n_ = RoundUpToEven(colsB_);
 
-    a_pad_.assign(m_ * m_, 0.0);
-    b_pad_.assign(m_ * m_, 0.0);
+    const auto a = input_.begin() + 4;
+    const auto b = a + (rowsA_ * colsA_);
+    a_pad_.assign(m_ * k_, 0.0);
+    b_pad_.assign(k_ * n_, 0.0);
     for (int i = 0; i < rowsA_; ++i) {
-      for (int j = 0; j < colsA_; ++j) {
-        a_pad_[(i * m_) + j] = a[(i * colsA_) + j];
-      }
+      std::copy(a + (i * colsA_), a + ((i + 1) * colsA_), a_pad_.begin() + (i * k_));
     }
     for (int i = 0; i < rowsB_; ++i) {
-      for (int j = 0; j < colsB_; ++j) {
-        b_pad_[(i * m_) + j] = b[(i * colsB_) + j];
-      }
+      std::copy(b + (i * colsB_), b + ((i + 1) * colsB_), b_pad_.begin() + (i * n_));
     }
 
     output_.resize(2 + (rowsA_ * colsB_));
@@ -187,58 +109,52 @@ bool ParallelStrassenMpiStl::RunImpl() {
   boost::mpi::broadcast(world_, rowsB_, 0);
   boost::mpi::broadcast(world_, colsB_, 0);
   boost::mpi::broadcast(world_, m_, 0);
+  boost::mpi::broadcast(world_, k_, 0);
+  boost::mpi::broadcast(world_, n_, 0);
 
   if (world_.rank() != 0) {
-    a_pad_.resize(m_ * m_);
-    b_pad_.resize(m_ * m_);
+    a_pad_.resize(m_ * k_);
+    b_pad_.resize(k_ * n_);
   }
   boost::mpi::broadcast(world_, a_pad_, 0);
   boost::mpi::broadcast(world_, b_pad_, 0);
 
-  if (m_ == 1) {
-    if (world_.rank() == 0) {
-      output_[0] = static_cast<double>(rowsA_);
-      output_[1] = static_cast<double>(colsB_);
-      output_[2] = a_pad_[0] * b_pad_[0];
-    }
-    world_.barrier();
-    return true;
-  }
-
   constexpr int kNumP = 7;
-  int half = m_ / 2;
-  auto a11 = SubMatrix(a_pad_, m_, 0, 0, half);
-  auto a12 = SubMatrix(a_pad_, m_, 0, half, half);
-  auto a21 = SubMatrix(a_pad_, m_, half, 0, half);
-  auto a22 = SubMatrix(a_pad_, m_, half, half, half);
-  auto b11 = SubMatrix(b_pad_, m_, 0, 0, half);
-  auto b12 = SubMatrix(b_pad_, m_, 0, half, half);
-  auto b21 = SubMatrix(b_pad_, m_, half, 0, half);
-  auto b22 = SubMatrix(b_pad_, m_, half, half, half);
+  const int hm = m_ / 2;
+  const int hk = k_ / 2;
+  const int hn = n_ / 2;
+  auto a11 = SubMatrix(a_pad_, k_, 0, 0, hm, hk);
+  auto a12 = SubMatrix(a_pad_, k_, 0, hk, hm, hk);
+  auto a21 = SubMatrix(a_pad_, k_, hm, 0, hm, hk);
+  auto a22 = SubMatrix(a_pad_, k_, hm, hk, hm, hk);
+  auto b11 = SubMatrix(b_pad_, n_, 0, 0, hk, hn);
+  auto b12 = SubMatrix(b_pad_, n_, 0, hn, hk, hn);
+  auto b21 = SubMatrix(b_pad_, n_, hk, 0, hk, hn);
+  auto b22 = SubMatrix(b_pad_, n_, hk, hn, hk, hn);
 
   std::vector<std::vector<double>> local_p(kNumP);
   for (int p = world_.rank(); p < kNumP; p += world_.size()) {
     switch (p) {
       case 0:
-        local_p[p] = StrassenRecursive(AddMatr(a11, a22, half), AddMatr(b11, b22, half), half);
+        local_p[p] = Multiply(AddMatr(a11, a22), AddMatr(b11, b22), hm, hn, hk);
         break;
       case 1:
-        local_p[p] = StrassenRecursive(AddMatr(a21, a22, half), b11, half);
+        local_p[p] = Multiply(AddMatr(a21, a22), b11, hm, hn, hk);
         break;
       case 2:
-        local_p[p] = StrassenRecursive(a11, SubMatr(b12, b22, half), half);
+        local_p[p] = Multiply(a11, SubMatr(b12, b22), hm, hn, hk);
         break;
       case 3:
-        local_p[p] = StrassenRecursive(a22, SubMatr(b21, b11, half), half);
+        local_p[p] = Multiply(a22, SubMatr(b21, b11), hm, hn, hk);
         break;
       case 4:
-        local_p[p] = StrassenRecursive(AddMatr(a11, a12, half), b22, half);
+        local_p[p] = Multiply(AddMatr(a11, a12), b22, hm, hn, hk);
         break;
       case 5:
-        local_p[p] = StrassenRecursive(SubMatr(a21, a11, half), AddMatr(b11, b12, half), half);
+        local_p[p] = Multiply(SubMatr(a21, a11), AddMatr(b11, b12), hm, hn, hk);
         break;
       case 6:
-        local_p[p] = StrassenRecursive(SubMatr(a12, a22, half), AddMatr(b21, b22, half), half);
+        local_p[p] = Multiply(SubMatr(a12, a22), AddMatr(b21, b22), hm, hn, hk);
         break;
       default:
         break;
@@ -256,22 +172,20 @@ bool ParallelStrassenMpiStl::RunImpl() {
       }
     }
 
-    std::vector<double> c_pad(m_ * m_, 0.0);
-    auto c11 = AddMatr(SubMatr(AddMatr(p[0], p[3], half), p[4], half), p[6], half);
-    auto c12 = AddMatr(p[2], p[4], half);
-    auto c21 = AddMatr(p[1], p[3], half);
-    auto c22 = AddMatr(SubMatr(AddMatr(p[0], p[2], half), p[1], half), p[5], half);
-    SetSubMatrix(c_pad, c11, m_, 0, 0, half);
-    SetSubMatrix(c_pad, c12, m_, 0, half, half);
-    SetSubMatrix(c_pad, c21, m_, half, 0, half);
-    SetSubMatrix(c_pad, c22, m_, half, half, half);
+    std::vector<double> c_pad(m_ * n_, 0.0);
+    auto c11 = AddMatr(SubMatr(AddMatr(p[0], p[3]), p[4]), p[6]);
+    auto c12 = AddMatr(p[2], p[4]);
+    auto c21 = AddMatr(p[1], p[3]);
+    auto c22 = AddMatr(SubMatr(AddMatr(p[0], p[2]), p[1]), p[5]);
+    SetSubMatrix(c_pad, c11, n_, 0, 0, hm, hn);
+    SetSubMatrix(c_pad, c12, n_, 0, hn, hm, hn);
+    SetSubMatrix(c_pad, c21, n_, hm, 0, hm, hn);
+    SetSubMatrix(c_pad, c22, n_, hm, hn, hm, hn);
 
     output_[0] = static_cast<double>(rowsA_);
     output_[1] = static_cast<double>(colsB_);
     for (int i = 0; i < rowsA_; ++i) {
-      for (int j = 0; j < colsB_; ++j) {
-        output_[2 + (i * colsB_) + j] = c_pad[(i * m_) + j];
-      }
+      std::copy(c_pad.begin() + (i * n_), c_pad.begin() + (i * n_) + colsB_, output_.begin() + 2 + (i * colsB_));
     }
   } else {
     for (int p = world_.rank(); p < kNumP; p += world_.size()) {
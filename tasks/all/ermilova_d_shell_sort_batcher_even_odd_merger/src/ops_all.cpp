@@ -6,81 +6,29 @@
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
 #include <cstddef>
+#include <span>
+#include <utility>
 #include <vector>
 
-namespace {
-
-std::vector<int> CreateSedgwickSequence(int n) {
-  std::vector<int> gaps;
-  int k = 0;
-  while (true) {
-    int gap =
-        (k % 2 == 0) ? (9 * (1 << (2 * k))) - (9 * (1 << k)) + 1 : (8 * (1 << k)) - (6 * (1 << ((k + 1) / 2))) + 1;
+#include "core/sort/include/sorting_network.hpp"
 
-    if (gap > n / 2) {
-      break;
-    }
-
-    gaps.push_back(gap);
-    k++;
-  }
-
-  if (gaps.empty() || gaps.back() != 1) {
-    gaps.push_back(1);
-  }
-
-  std::ranges::reverse(gaps);
-  return gaps;
-}
+namespace {
 
-void ShellSort(std::vector<int> &data, size_t start, size_t end) {
-  auto partition_size = static_cast<int>(end - start + 1);
-  auto gaps = CreateSedgwickSequence(partition_size);
-
-  for (int gap : gaps) {
-    for (size_t i = start + gap; i <= end; i++) {
-      int temp = data[i];
-      size_t j = i;
-      while (j >= start + gap && data[j - gap] > temp) {
-        data[j] = data[j - gap];
-        j -= gap;
-      }
-      data[j] = temp;
-    }
-  }
+// Leaf sort of data[start..end] through the vectorized sorting network
+void SortBlock(std::vector<int> &data, size_t start, size_t end) {
+  ppc::core::NetworkSort(std::span<int>(data).subspan(start, end - start + 1));
 }
 
-void BatcherMerge(std::vector<int> &data, size_t start, size_t mid, size_t end) {
-  std::vector<int> left(data.begin() + static_cast<std::ptrdiff_t>(start),
-                        data.begin() + static_cast<std::ptrdiff_t>(mid));
-
-  std::vector<int> right(data.begin() + static_cast<std::ptrdiff_t>(mid),
-                         data.begin() + static_cast<std::ptrdiff_t>(end));
-  size_t left_index = 0;
-  size_t right_index = 0;
-  size_t data_offset = start;
-
-  size_t left_size = mid - start;
-  size_t right_size = end - mid;
-
-  for (size_t i = start; i < end; ++i) {
-    if (i % 2 == 0) {
-      if (left_index < left_size && (right_index >= right_size || left[left_index] <= right[right_index])) {
-        data[data_offset++] = left[left_index++];
-      } else {
-        data[data_offset++] = right[right_index++];
-      }
-    } else {
-      if (right_index < right_size && (left_index >= left_size || right[right_index] <= left[left_index])) {
-        data[data_offset++] = right[right_index++];
-      } else {
-        data[data_offset++] = left[left_index++];
-      }
-    }
-  }
+// Merges the sorted runs src[start, mid) and src[mid, end) into dst[start, end) with the SIMD bitonic merge
+// network; an empty second run copies the first one
+void BatcherMerge(const std::vector<int> &src, std::vector<int> &dst, size_t start, size_t mid, size_t end) {
+  const std::span<const int> runs(src);
+  ppc::core::BitonicMerge<int>(runs.subspan(start, mid - start), runs.subspan(mid, end - mid),
+                               std::span<int>(dst).subspan(start, end - start));
 }
 
-void ParallelShellSortWithBatcherMerge(std::vector<int> &data) {
+// Merge rounds alternate between data and scratch, which keeps its capacity from run to run
+void ParallelShellSortWithBatcherMerge(std::vector<int> &data, std::vector<int> &scratch) {
   size_t elements_count = data.size();
   if (elements_count <= 1) {
     return;
@@ -96,19 +44,19 @@ void ParallelShellSortWithBatcherMerge(std::vector<int> &data) {
     size_t start_block_index = static_cast<size_t>(thread_number) * block_size;
     size_t end_block_index = std::min(start_block_index + block_size, elements_count) - 1;
     if (start_block_index < elements_count) {
-      ShellSort(data, start_block_index, end_block_index);
+      SortBlock(data, start_block_index, end_block_index);
     }
   }
 
+  scratch.resize(elements_count);
   for (size_t merge_size = block_size; merge_size < elements_count; merge_size *= 2) {
 #pragma omp parallel for schedule(static)
     for (int i = 0; i < static_cast<int>(elements_count); i += static_cast<int>(2 * merge_size)) {
       size_t mid = std::min(i + merge_size, elements_count);
       size_t end = std::min(i + (2 * merge_size), elements_count);
-      if (mid < end) {
-        BatcherMerge(data, i, mid, end);
-      }
+      BatcherMerge(data, scratch, i, mid, end);
     }
+    data.swap(scratch);
   }
 }
 }  // namespace
@@ -170,7 +118,7 @@ bool ermilova_d_shell_sort_batcher_even_odd_merger_all::AllTask::RunImpl() {
     world.recv(0, 0, local_chunk);
   }
 
-  ParallelShellSortWithBatcherMerge(local_chunk);
+  ParallelShellSortWithBatcherMerge(local_chunk, scratch_);
 
   if (rank != 0) {
     world.send(0, 1, local_chunk);
@@ -186,17 +134,18 @@ bool ermilova_d_shell_sort_batcher_even_odd_merger_all::AllTask::RunImpl() {
       std::ranges::copy(tmp, result.begin() + displs[i]);
     }
 
-    data_ = result;
+    data_ = std::move(result);
+    scratch_.resize(data_.size());
 
     for (int merge_step = 1; merge_step < size; merge_step *= 2) {
-      int loop_end = size - merge_step;
 #pragma omp parallel for schedule(static)
-      for (int i = 0; i < loop_end; i += 2 * merge_step) {
+      for (int i = 0; i < size; i += 2 * merge_step) {
         size_t left_start = displs[i];
-        size_t mid = displs[i + merge_step];
+        size_t mid = (i + merge_step < size) ? displs[i + merge_step] : data_.size();
         size_t right_end = (i + 2 * merge_step < size) ? displs[i + (2 * merge_step)] : data_.size();
-        BatcherMerge(data_, left_start, mid, right_end);
+        BatcherMerge(data_, scratch_, left_start, mid, right_end);
       }
+      data_.swap(scratch_);
     }
   }
 
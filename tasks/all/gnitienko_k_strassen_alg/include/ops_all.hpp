@@ -1,7 +1,6 @@
 #pragma once
 
 #include <boost/mpi/communicator.hpp>
-#include <functional>
 #include <utility>
 #include <vector>
 
@@ -22,21 +21,15 @@ class StrassenAlgAll : public ppc::core::Task {
   std::vector<double> input_2_;
   std::vector<double> output_;
   int size_{};
-  int TRIVIAL_MULTIPLICATION_BOUND_ = 32;
   int extend_ = 0;
+  std::vector<double> workspace_;
   boost::mpi::communicator world_;
 
-  static void TrivialMultiply(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c,
-                              int size);
-  void StrassenMultiply(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c, int size,
-                        int avaliable_threads);
-  static void AddMatrix(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c, int size);
-  static void SubMatrix(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c, int size);
-  void MPILogic(int rank, int half_size, int size_proc, int max_threads);
-  void MainProcessRun(int size, int size_proc, int max_threads);
-  void WorkerProcessRun(int size, int max_threads);
+  void MultiplyBlock(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c,
+                     int half_size);
+  void MPILogic(int rank, int half_size, int size_proc);
+  void MainProcessRun(int size, int size_proc);
+  void WorkerProcessRun(int size);
 };
 
-void ParallelizeTasks(const std::vector<std::function<void(int)>>& tasks, int avaliable_threads);
-
 }  // namespace gnitienko_k_strassen_algorithm_all
\ No newline at end of file
@@ -8,13 +8,13 @@
 #include <boost/mpi/nonblocking.hpp>
 #include <boost/mpi/request.hpp>
 #include <cmath>
-#include <core/util/include/util.hpp>
 #include <cstddef>
-#include <functional>
-#include <thread>
 #include <utility>
 #include <vector>
 
+#include "core/gemm/include/strassen.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
 bool gnitienko_k_strassen_algorithm_all::StrassenAlgAll::PreProcessingImpl() {
   if (world_.rank() == 0) {
     size_t input_size = task_data->inputs_count[0];
@@ -29,18 +29,19 @@ bool gnitienko_k_strassen_algorithm_all::StrassenAlgAll::PreProcessingImpl() {
 
     size_ = static_cast<int>(std::sqrt(input_size));
 
-    if ((input_size <= 0) || (input_size & (input_size - 1)) != 0) {
-      int new_size = static_cast<int>(std::pow(2, std::ceil(std::log2(size_))));
+    // Only the top level is split across processes, so an odd size is padded by one row and column;
+    // the engine peels odd sizes further down
+    if (size_ % 2 != 0) {
+      int new_size = size_ + 1;
       std::vector<double> extended_input_1(new_size * new_size, 0.0);
       std::vector<double> extended_input_2(new_size * new_size, 0.0);
-      output_.resize(new_size * new_size);
-      extend_ = new_size - size_;
+      extend_ = 1;
 
       for (int i = 0; i < size_; ++i) {
-        for (int j = 0; j < size_; ++j) {
-          extended_input_1[(i * new_size) + j] = input_1_[(i * size_) + j];
-          extended_input_2[(i * new_size) + j] = input_2_[(i * size_) + j];
-        }
+        std::copy(input_1_.begin() + (i * size_), input_1_.begin() + ((i + 1) * size_),
+                  extended_input_1.begin() + (i * new_size));
+        std::copy(input_2_.begin() + (i * size_), input_2_.begin() + ((i + 1) * size_),
+                  extended_input_2.begin() + (i * new_size));
       }
 
       input_1_ = std::move(extended_input_1);
@@ -56,190 +57,16 @@ bool gnitienko_k_strassen_algorithm_all::StrassenAlgAll::ValidationImpl() {
   return world_.rank() == 0 ? task_data->inputs_count[0] == task_data->outputs_count[0] : true;
 }
 
-void gnitienko_k_strassen_algorithm_all::StrassenAlgAll::AddMatrix(const std::vector<double>& a,
-                                                                   const std::vector<double>& b, std::vector<double>& c,
-                                                                   int size) {
-  for (int i = 0; i < size * size; ++i) {
-    c[i] = a[i] + b[i];
-  }
-}
-
-void gnitienko_k_strassen_algorithm_all::StrassenAlgAll::SubMatrix(const std::vector<double>& a,
-                                                                   const std::vector<double>& b, std::vector<double>& c,
-                                                                   int size) {
-  for (int i = 0; i < size * size; ++i) {
-    c[i] = a[i] - b[i];
-  }
-}
-
-void gnitienko_k_strassen_algorithm_all::StrassenAlgAll::TrivialMultiply(const std::vector<double>& a,
-                                                                         const std::vector<double>& b,
-                                                                         std::vector<double>& c, int size) {
-  for (int i = 0; i < size; ++i) {
-    for (int j = 0; j < size; ++j) {
-      c[(i * size) + j] = 0;
-      for (int k = 0; k < size; ++k) {
-        c[(i * size) + j] += a[(i * size) + k] * b[(k * size) + j];
-      }
-    }
-  }
-}
-
-void gnitienko_k_strassen_algorithm_all::ParallelizeTasks(const std::vector<std::function<void(int)>>& tasks,
-                                                          int avaliable_threads) {
-  int total_tasks = (int)tasks.size();
-  int current_threads = std::min(avaliable_threads, total_tasks);
-  int remaining_threads = std::max(avaliable_threads - current_threads, 0);
-
-  std::vector<std::thread> threads;
-  std::vector<int> threads_for_subtask(total_tasks, 0);
-
-  for (int i = 0; i < total_tasks; ++i) {
-    threads_for_subtask[i] = (i < remaining_threads) ? 1 : 0;
-  }
-
-  for (int i = 0; i < current_threads; ++i) {
-    int sub_threads = threads_for_subtask[i];
-    threads.emplace_back([&, i, sub_threads]() { tasks[i](sub_threads); });
-  }
-
-  for (int i = current_threads; i < total_tasks; ++i) {
-    tasks[i](0);
-  }
-
-  for (auto& t : threads) {
-    t.join();
-  }
-}
-
-void gnitienko_k_strassen_algorithm_all::StrassenAlgAll::StrassenMultiply(const std::vector<double>& a,
-                                                                          const std::vector<double>& b,
-                                                                          std::vector<double>& c, int size,
-                                                                          int avaliable_threads) {
-  if (size <= TRIVIAL_MULTIPLICATION_BOUND_) {
-    TrivialMultiply(a, b, c, size);
-    return;
-  }
-
-  int half_size = size / 2;
-
-  std::vector<double> a11(half_size * half_size);
-  std::vector<double> a12(half_size * half_size);
-  std::vector<double> a21(half_size * half_size);
-  std::vector<double> a22(half_size * half_size);
-  std::vector<double> b11(half_size * half_size);
-  std::vector<double> b12(half_size * half_size);
-  std::vector<double> b21(half_size * half_size);
-  std::vector<double> b22(half_size * half_size);
-
-  for (int i = 0; i < half_size; ++i) {
-    for (int j = 0; j < half_size; ++j) {
-      a11[(i * half_size) + j] = a[(i * size) + j];
-      a12[(i * half_size) + j] = a[(i * size) + j + half_size];
-      a21[(i * half_size) + j] = a[((i + half_size) * size) + j];
-      a22[(i * half_size) + j] = a[((i + half_size) * size) + j + half_size];
-
-      b11[(i * half_size) + j] = b[(i * size) + j];
-      b12[(i * half_size) + j] = b[(i * size) + j + half_size];
-      b21[(i * half_size) + j] = b[((i + half_size) * size) + j];
-      b22[(i * half_size) + j] = b[((i + half_size) * size) + j + half_size];
-    }
-  }
-
-  std::vector<double> d(half_size * half_size);
-  std::vector<double> d1(half_size * half_size);
-  std::vector<double> d2(half_size * half_size);
-  std::vector<double> h1(half_size * half_size);
-  std::vector<double> h2(half_size * half_size);
-  std::vector<double> v1(half_size * half_size);
-  std::vector<double> v2(half_size * half_size);
-
-  auto compute_d = [&](int avaliable_threads = 0) {
-    std::vector<double> temp_a(half_size * half_size);
-    std::vector<double> temp_b(half_size * half_size);
-    AddMatrix(a11, a22, temp_a, half_size);
-    AddMatrix(b11, b22, temp_b, half_size);
-    StrassenMultiply(temp_a, temp_b, d, half_size, avaliable_threads);
-  };
-
-  auto compute_d1 = [&](int avaliable_threads = 0) {
-    std::vector<double> temp_a(half_size * half_size);
-    std::vector<double> temp_b(half_size * half_size);
-    SubMatrix(a12, a22, temp_a, half_size);
-    AddMatrix(b21, b22, temp_b, half_size);
-    StrassenMultiply(temp_a, temp_b, d1, half_size, avaliable_threads);
-  };
-
-  auto compute_d2 = [&](int avaliable_threads = 0) {
-    std::vector<double> temp_a(half_size * half_size);
-    std::vector<double> temp_b(half_size * half_size);
-    SubMatrix(a21, a11, temp_a, half_size);
-    AddMatrix(b11, b12, temp_b, half_size);
-    StrassenMultiply(temp_a, temp_b, d2, half_size, avaliable_threads);
-  };
-
-  auto compute_h1 = [&](int avaliable_threads = 0) {
-    std::vector<double> temp_a(half_size * half_size);
-    std::vector<double> temp_b(half_size * half_size);
-    AddMatrix(a11, a12, temp_a, half_size);
-    StrassenMultiply(temp_a, b22, h1, half_size, avaliable_threads);
-  };
-
-  auto compute_h2 = [&](int avaliable_threads = 0) {
-    std::vector<double> temp_a(half_size * half_size);
-    std::vector<double> temp_b(half_size * half_size);
-    AddMatrix(a21, a22, temp_a, half_size);
-    StrassenMultiply(temp_a, b11, h2, half_size, avaliable_threads);
-  };
-
-  auto compute_v1 = [&](int avaliable_threads = 0) {
-    std::vector<double> temp_a(half_size * half_size);
-    std::vector<double> temp_b(half_size * half_size);
-    SubMatrix(b21, b11, temp_b, half_size);
-    StrassenMultiply(a22, temp_b, v1, half_size, avaliable_threads);
-  };
-
-  auto compute_v2 = [&](int avaliable_threads = 0) {
-    std::vector<double> temp_a(half_size * half_size);
-    std::vector<double> temp_b(half_size * half_size);
-    SubMatrix(b12, b22, temp_b, half_size);
-    StrassenMultiply(a11, temp_b, v2, half_size, avaliable_threads);
-  };
-
-  std::vector<std::function<void(int)>> tasks = {compute_d,  compute_d1, compute_d2, compute_h1,
-                                                 compute_h2, compute_v1, compute_v2};
-
-  ParallelizeTasks(tasks, avaliable_threads);
-
-  std::vector<double> c11(half_size * half_size);
-  std::vector<double> c12(half_size * half_size);
-  std::vector<double> c21(half_size * half_size);
-  std::vector<double> c22(half_size * half_size);
-
-  AddMatrix(d, d1, c11, half_size);
-  AddMatrix(c11, v1, c11, half_size);
-  SubMatrix(c11, h1, c11, half_size);
-
-  AddMatrix(v2, h1, c12, half_size);
-  AddMatrix(v1, h2, c21, half_size);
-
-  AddMatrix(d, d2, c22, half_size);
-  AddMatrix(c22, v2, c22, half_size);
-  SubMatrix(c22, h2, c22, half_size);
-
-  for (int i = 0; i < half_size; ++i) {
-    for (int j = 0; j < half_size; ++j) {
-      c[(i * size) + j] = c11[(i * half_size) + j];
-      c[(i * size) + j + half_size] = c12[(i * half_size) + j];
-      c[((i + half_size) * size) + j] = c21[(i * half_size) + j];
-      c[((i + half_size) * size) + j + half_size] = c22[(i * half_size) + j];
-    }
-  }
+void gnitienko_k_strassen_algorithm_all::StrassenAlgAll::MultiplyBlock(const std::vector<double>& a,
+                                                                       const std::vector<double>& b,
+                                                                       std::vector<double>& c, int half_size) {
+  const auto n = static_cast<size_t>(half_size);
+  ppc::core::StrassenMultiply(n, n, n, a.data(), n, b.data(), n, c.data(), n, workspace_, ppc::core::PoolForEach{});
 }
 
 // NOLINTBEGIN(clang-analyzer-optin.mpi.MPI-Checker)
 // NOLINTBEGIN(clang-analyzer-optin.cplusplus.UninitializedObject)
-void gnitienko_k_strassen_algorithm_all::StrassenAlgAll::MainProcessRun(int half_size, int size_proc, int max_threads) {
+void gnitienko_k_strassen_algorithm_all::StrassenAlgAll::MainProcessRun(int half_size, int size_proc) {
   const int block_size = half_size * half_size;
   output_.resize(size_ * size_);
 
@@ -269,20 +96,22 @@ void gnitienko_k_strassen_algorithm_all::StrassenAlgAll::MainProcessRun(int half
   std::vector<std::vector<double>> as(7, std::vector<double>(block_size));
   std::vector<std::vector<double>> bs(7, std::vector<double>(block_size));
 
-  AddMatrix(a11, a22, as[0], half_size);
-  AddMatrix(b11, b22, bs[0], half_size);
-  AddMatrix(a21, a22, as[1], half_size);
+  for (int i = 0; i < block_size; ++i) {
+    as[0][i] = a11[i] + a22[i];
+    bs[0][i] = b11[i] + b22[i];
+    as[1][i] = a21[i] + a22[i];
+    bs[2][i] = b12[i] - b22[i];
+    bs[3][i] = b21[i] - b11[i];
+    as[4][i] = a11[i] + a12[i];
+    as[5][i] = a21[i] - a11[i];
+    bs[5][i] = b11[i] + b12[i];
+    as[6][i] = a12[i] - a22[i];
+    bs[6][i] = b21[i] + b22[i];
+  }
   bs[1] = b11;
   as[2] = a11;
-  SubMatrix(b12, b22, bs[2], half_size);
   as[3] = a22;
-  SubMatrix(b21, b11, bs[3], half_size);
-  AddMatrix(a11, a12, as[4], half_size);
   bs[4] = b22;
-  SubMatrix(a21, a11, as[5], half_size);
-  AddMatrix(b11, b12, bs[5], half_size);
-  SubMatrix(a12, a22, as[6], half_size);
-  AddMatrix(b21, b22, bs[6], half_size);
 
   std::vector<std::vector<double>> mul_res(7, std::vector<double>(block_size));
 
@@ -309,7 +138,7 @@ void gnitienko_k_strassen_algorithm_all::StrassenAlgAll::MainProcessRun(int half
   boost::mpi::wait_all(reqs_send.begin(), reqs_send.end());
 
   for (int t : tasks_for_procs[0]) {
-    StrassenMultiply(as[t], bs[t], mul_res[t], half_size, max_threads);
+    MultiplyBlock(as[t], bs[t], mul_res[t], half_size);
   }
 
   for (int proc = 1; proc < std::min(size_proc, 7); ++proc) {
@@ -351,7 +180,7 @@ void gnitienko_k_strassen_algorithm_all::StrassenAlgAll::MainProcessRun(int half
   }
 }
 
-void gnitienko_k_strassen_algorithm_all::StrassenAlgAll::WorkerProcessRun(int half_size, int max_threads) {
+void gnitienko_k_strassen_algorithm_all::StrassenAlgAll::WorkerProcessRun(int half_size) {
   const int block_size = half_size * half_size;
   int num_tasks = 0;
   world_.recv(0, 0, num_tasks);
@@ -376,33 +205,32 @@ void gnitienko_k_strassen_algorithm_all::StrassenAlgAll::WorkerProcessRun(int ha
   std::vector<std::vector<double>> c_local(num_tasks, std::vector<double>(block_size));
   for (int i = 0; i < num_tasks; ++i) {
     int t = tasks[i];
-    StrassenMultiply(a_local[i], b_local[i], c_local[i], half_size, max_threads);
+    MultiplyBlock(a_local[i], b_local[i], c_local[i], half_size);
     send_reqs.push_back(world_.isend(0, t + 2, c_local[i]));
   }
 
   boost::mpi::wait_all(send_reqs.begin(), send_reqs.end());
 }
 
-void gnitienko_k_strassen_algorithm_all::StrassenAlgAll::MPILogic(int rank, int half_size, int size_proc,
-                                                                  int max_threads) {
+void gnitienko_k_strassen_algorithm_all::StrassenAlgAll::MPILogic(int rank, int half_size, int size_proc) {
   if (rank == 0) {
-    MainProcessRun(half_size, size_proc, max_threads);
+    MainProcessRun(half_size, size_proc);
 
   } else if (rank < std::min(size_proc, 7) && rank != 0) {
-    WorkerProcessRun(half_size, max_threads);
+    WorkerProcessRun(half_size);
   }
 }
 
 bool gnitienko_k_strassen_algorithm_all::StrassenAlgAll::RunImpl() {
   int rank = world_.rank();
   int size_proc = world_.size();
-  int max_threads = ppc::util::GetPPCNumThreads();
 
   boost::mpi::broadcast(world_, size_, 0);
 
   const int half_size = size_ / 2;
+  workspace_.resize(ppc::core::StrassenWorkspaceSize(half_size, half_size, half_size));
 
-  MPILogic(rank, half_size, size_proc, max_threads);
+  MPILogic(rank, half_size, size_proc);
 
   world_.barrier();
 
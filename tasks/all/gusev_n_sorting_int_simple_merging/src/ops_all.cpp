@@ -21,6 +21,8 @@
 #include <utility>
 #include <vector>
 
+#include "core/trace/include/trace.hpp"
+
 void gusev_n_sorting_int_simple_merging_all::SortingIntSimpleMergingALL::SplitBySign(const std::vector<int>& arr,
                                                                                      std::vector<int>& negatives,
                                                                                      std::vector<int>& positives) {
@@ -99,6 +101,7 @@ void gusev_n_sorting_int_simple_merging_all::SortingIntSimpleMergingALL::Distrib
 
   std::vector<int> my_chunk;
   if (size > 1) {
+    PPC_TRACE_SCOPE("scatter");
     if (rank == 0) {
       boost::mpi::scatter(world, chunks, my_chunk, 0);
     } else {
@@ -109,6 +112,7 @@ void gusev_n_sorting_int_simple_merging_all::SortingIntSimpleMergingALL::Distrib
   }
 
   if (!my_chunk.empty()) {
+    PPC_TRACE_SCOPE("sort chunk");
     RadixSortForNonNegative(my_chunk);
   }
 
@@ -124,7 +128,10 @@ std::vector<int> gusev_n_sorting_int_simple_merging_all::SortingIntSimpleMerging
   }
 
   std::vector<std::vector<int>> gathered_chunks;
-  boost::mpi::gather(world, my_chunk, gathered_chunks, 0);
+  {
+    PPC_TRACE_SCOPE("gather");
+    boost::mpi::gather(world, my_chunk, gathered_chunks, 0);
+  }
 
   if (rank == 0) {
     return MergeSortedArrays(gathered_chunks);
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kalyakina_a_shell_with_simple_merge_all {
@@ -21,11 +22,14 @@ class ShellSortALL : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
+  // Order of this rank's piece as the pre-pass measured it, and the path its sort took
+  [[nodiscard]] const ppc::core::PresortStats& GetPresortStats() const { return presort_stats_; }
 
  private:
   std::vector<int> input_;
   std::vector<int> output_;
   std::vector<unsigned int> Sedgwick_sequence_;
+  ppc::core::PresortStats presort_stats_;
   boost::mpi::communicator world_;
 };
 
@@ -5,8 +5,13 @@
 #include <boost/mpi/collectives/scatterv.hpp>
 #include <boost/serialization/vector.hpp>  // NOLINT(*-include-cleaner)
 #include <cmath>
+#include <cstddef>
+#include <functional>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
+#include "core/sort/include/tbb_adapters.hpp"
 #include "core/util/include/util.hpp"
 #include "oneapi/tbb/parallel_for.h"
 #include "oneapi/tbb/task_arena.h"
@@ -109,7 +114,9 @@ bool kalyakina_a_shell_with_simple_merge_all::ShellSortALL::RunImpl() {
 
   boost::mpi::scatterv(world_, input_.data(), distr, displ, local_res.data(), distr[world_.rank()], 0);
 
-  ShellSort(local_res);
+  presort_stats_ = ppc::core::AdaptiveSort(
+      std::span<int>(local_res), [&](std::span<int> /*data*/) { ShellSort(local_res); },
+      static_cast<size_t>(ppc::util::GetPPCNumThreads()), std::less<>(), ppc::core::TbbForEach{});
 
   unsigned int step = 1;
   while (step <= num) {
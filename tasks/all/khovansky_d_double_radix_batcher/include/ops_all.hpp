@@ -2,6 +2,7 @@
 
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -19,7 +20,8 @@ class RadixAll : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<double> input_, output_;
+  // Radix keys of this rank's part before and after the sort
+  std::vector<uint64_t> input_, output_;
   boost::mpi::communicator world_;
 };
 }  // namespace khovansky_d_double_radix_batcher_all
\ No newline at end of file
@@ -10,40 +10,21 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <cstring>
 #include <iterator>
 #include <limits>
 #include <ranges>
+#include <span>
 #include <thread>
+#include <utility>
 #include <vector>
 
+#include "core/sort/include/key_transform.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 namespace khovansky_d_double_radix_batcher_all {
 namespace {
 
-uint64_t EncodeDoubleToUint64(double value) {
-  uint64_t bit_representation = 0;
-  std::memcpy(&bit_representation, &value, sizeof(value));
-
-  if ((bit_representation >> 63) != 0) {
-    return ~bit_representation;
-  }
-  return bit_representation ^ (1ULL << 63);
-}
-
-double DecodeUint64ToDouble(uint64_t transformed_data) {
-  if ((transformed_data >> 63) != 0) {
-    transformed_data ^= (1ULL << 63);
-  } else {
-    transformed_data = ~transformed_data;
-  }
-
-  double result = 0.0;
-  std::memcpy(&result, &transformed_data, sizeof(result));
-  return result;
-}
-
 void RadixSort(std::vector<uint64_t>& array, int thread_count) {
   const int bits_in_byte = 8;
   const int total_bits = 64;
@@ -102,9 +83,11 @@ bool khovansky_d_double_radix_batcher_all::RadixAll::PreProcessingImpl() {
   if (rank == 0) {
     size_t total = task_data->inputs_count[0];
     size_t per_proc = (total + size - 1) / size;
-    input_.resize(per_proc * size, std::numeric_limits<double>::max());
+    // Padding gets the largest key, it sorts after every value and is cut off at the end
+    input_.resize(per_proc * size, std::numeric_limits<uint64_t>::max());
     auto* src = reinterpret_cast<double*>(task_data->inputs[0]);
-    std::copy(src, src + total, input_.begin());
+    ppc::core::ToRadixKeys(std::span<const double>(src, total), std::span<uint64_t>(input_).first(total),
+                           ppc::core::PoolForEach{});
   }
 
   size_t per_proc = 0;
@@ -113,7 +96,7 @@ bool khovansky_d_double_radix_batcher_all::RadixAll::PreProcessingImpl() {
   }
   boost::mpi::broadcast(world_, per_proc, 0);
 
-  std::vector<double> local(per_proc);
+  std::vector<uint64_t> local(per_proc);
   boost::mpi::scatter(world_, input_, local.data(), static_cast<int>(per_proc), 0);
   input_.swap(local);
 
@@ -148,11 +131,7 @@ bool khovansky_d_double_radix_batcher_all::RadixAll::RunImpl() {
   int rank = world_.rank();
   int size = world_.size();
 
-  std::vector<uint64_t> local;
-  local.reserve(input_.size());
-  for (auto d : input_) {
-    local.push_back(EncodeDoubleToUint64(d));
-  }
+  std::vector<uint64_t> local = input_;
   size_t n = local.size();
   const int thread_count = std::max(1, std::min(static_cast<int>(n), ppc::util::GetPPCNumThreads()));
   RadixSort(local, thread_count);
@@ -194,10 +173,7 @@ bool khovansky_d_double_radix_batcher_all::RadixAll::RunImpl() {
     world_.barrier();
   }
 
-  output_.resize(local.size());
-  for (size_t i = 0; i < local.size(); ++i) {
-    output_[i] = DecodeUint64ToDouble(local[i]);
-  }
+  output_ = std::move(local);
 
   return true;
 }
@@ -207,7 +183,7 @@ bool khovansky_d_double_radix_batcher_all::RadixAll::PostProcessingImpl() {
   int size = world_.size();
   const int local_size = static_cast<int>(output_.size());
 
-  std::vector<double> gathered;
+  std::vector<uint64_t> gathered;
 
   if (rank == 0) {
     gathered.resize(local_size * size);
@@ -216,13 +192,12 @@ bool khovansky_d_double_radix_batcher_all::RadixAll::PostProcessingImpl() {
   boost::mpi::gather(world_, output_.data(), local_size, gathered.data(), 0);
 
   if (rank == 0) {
-    auto removed = std::ranges::remove(gathered, std::numeric_limits<double>::max());
-    gathered.erase(removed.begin(), removed.end());
-
     std::ranges::sort(gathered);
+    gathered.resize(task_data->inputs_count[0]);
 
     auto* out_ptr = reinterpret_cast<double*>(task_data->outputs[0]);
-    std::ranges::copy(gathered, out_ptr);
+    ppc::core::FromRadixKeys(std::span<const uint64_t>(gathered), std::span<double>(out_ptr, gathered.size()),
+                             ppc::core::PoolForEach{});
   }
 
   return true;
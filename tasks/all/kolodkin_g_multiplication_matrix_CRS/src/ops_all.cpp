@@ -5,14 +5,15 @@
 #include <algorithm>
 #include <cmath>
 #include <complex>
-#include <core/util/include/util.hpp>
 #include <cstddef>
 #include <iostream>
-#include <map>
-#include <thread>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/spgemm.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
 void kolodkin_g_multiplication_matrix_all::SparseMatrixCRS::AddValue(int row, Complex value, int col) {
   for (int j = rowPtr[row]; j < rowPtr[row + 1]; ++j) {
     if (colIndices[j] == col) {
@@ -117,35 +118,21 @@ kolodkin_g_multiplication_matrix_all::SparseMatrixCRS kolodkin_g_multiplication_
 
 kolodkin_g_multiplication_matrix_all::SparseMatrixCRS kolodkin_g_multiplication_matrix_all::BuildResultMatrix(
     const std::vector<kolodkin_g_multiplication_matrix_all::CoordVal>& all_results, int a_num_rows, int b_num_cols) {
+  // Every process sends the finished rows of its block, so entries are unique and only need placing
   kolodkin_g_multiplication_matrix_all::SparseMatrixCRS c(a_num_rows, b_num_cols);
-  std::map<std::pair<int, int>, Complex> result_map;
-
   for (const auto& rv : all_results) {
-    result_map[{rv.row, rv.col}] += rv.value;
+    c.rowPtr[rv.row + 1]++;
   }
-
-  c.rowPtr.resize(a_num_rows + 1);
-  c.values.reserve(result_map.size());
-  c.colIndices.reserve(result_map.size());
-
-  c.rowPtr[0] = 0;
-
   for (int i = 0; i < a_num_rows; ++i) {
-    for (auto& kv : result_map) {
-      if (kv.first.first == i && kv.second != Complex(0)) {
-        c.colIndices.push_back(kv.first.second);
-        c.values.push_back(kv.second);
-      }
-    }
-    c.rowPtr[i + 1] = static_cast<int>(c.colIndices.size());
-
-    for (auto it = result_map.begin(); it != result_map.end();) {
-      if (it->first.first == i) {
-        it = result_map.erase(it);
-      } else {
-        ++it;
-      }
-    }
+    c.rowPtr[i + 1] += c.rowPtr[i];
+  }
+  c.values.resize(all_results.size());
+  c.colIndices.resize(all_results.size());
+  std::vector<int> next(c.rowPtr.begin(), c.rowPtr.end() - 1);
+  for (const auto& rv : all_results) {
+    const int pos = next[rv.row]++;
+    c.colIndices[pos] = rv.col;
+    c.values[pos] = rv.value;
   }
   return c;
 }
@@ -176,8 +163,12 @@ bool kolodkin_g_multiplication_matrix_all::TestTaskALL::ValidationImpl() {
     // Check equality of counts elements
     unsigned int input_size = task_data->inputs_count[0];
     auto* in_ptr = reinterpret_cast<Complex*>(task_data->inputs[0]);
+    if (input_size < 5) {
+      return false;
+    }
     std::vector<Complex> vec = std::vector<Complex>(in_ptr, in_ptr + input_size);
-    return !(vec[1] != vec[5 + (int)(vec[2].real() + vec[3].real() + vec[4].real())].real());
+    auto b_offset = 5 + (unsigned int)(vec[2].real() + vec[3].real() + vec[4].real());
+    return b_offset < input_size && vec[1] == vec[b_offset].real();
   }
   return true;
 }
@@ -203,42 +194,29 @@ bool kolodkin_g_multiplication_matrix_all::TestTaskALL::RunImpl() {
   int start_row = (rank * row_per_proc) + std::min(rank, remainder);
   int end_row = start_row + row_per_proc + (rank < remainder ? 1 : 0);
 
-  std::vector<CoordVal> local_results;
-
-  int num_threads = ppc::util::GetPPCNumThreads();
-
-  std::vector<std::thread> threads(num_threads);
-  std::vector<std::vector<CoordVal>> thread_results(num_threads);
-  int chunk_size = (end_row - start_row) / num_threads;
-  int current_start = start_row;
-
-  auto process_part = [&](int start_i, int end_i, int thread_index) {
-    std::vector<CoordVal>& local_thread_results = thread_results[thread_index];
-    for (int i = start_i; i < end_i; ++i) {
-      for (int j_idx = A_.rowPtr[i]; j_idx < A_.rowPtr[i + 1]; ++j_idx) {
-        int col_a = A_.colIndices[j_idx];
-        Complex value_a = A_.values[j_idx];
-
-        for (int k_idx = B_.rowPtr[col_a]; k_idx < B_.rowPtr[col_a + 1]; ++k_idx) {
-          int col_b = B_.colIndices[k_idx];
-          Complex value_b = B_.values[k_idx];
+  // Rows [start_row, end_row) of A keep their global row pointers; the rows of A * B are the
+  // columns of B^T A^T, so the compressed rows multiply with the operands swapped
+  const ppc::core::CompressedView<Complex> a{
+      .lines = static_cast<size_t>(end_row - start_row),
+      .extent = static_cast<size_t>(a_num_cols),
+      .ptr = std::span<const int>(A_.rowPtr).subspan(static_cast<size_t>(start_row),
+                                                     static_cast<size_t>(end_row - start_row) + 1),
+      .idx = A_.colIndices,
+      .val = A_.values};
+  const ppc::core::CompressedView<Complex> b{.lines = static_cast<size_t>(b_num_rows),
+                                             .extent = static_cast<size_t>(b_num_cols),
+                                             .ptr = B_.rowPtr,
+                                             .idx = B_.colIndices,
+                                             .val = B_.values};
+  const auto block = ppc::core::SpGemm(b, a, ppc::core::PoolForEach{},
+                                       [](const Complex& value) { return value != Complex(0); });
 
-          AddResult(local_thread_results, i, col_b, value_a * value_b);
-        }
-      }
+  std::vector<CoordVal> local_results;
+  local_results.reserve(block.val.size());
+  for (int i = 0; i < end_row - start_row; ++i) {
+    for (int p = block.ptr[i]; p < block.ptr[i + 1]; ++p) {
+      AddResult(local_results, start_row + i, block.idx[p], block.val[p]);
     }
-  };
-
-  for (int t = 0; t < num_threads; ++t) {
-    int thread_start = current_start + (chunk_size * t);
-    int thread_end = (t == num_threads - 1) ? end_row : thread_start + chunk_size;
-    threads[t] = std::thread(process_part, thread_start, thread_end, t);
-  }
-  for (auto& th : threads) {
-    th.join();
-  }
-  for (const auto& vec : thread_results) {
-    local_results.insert(local_results.end(), vec.begin(), vec.end());
   }
 
   int local_size_bytes = static_cast<int>(local_results.size() * sizeof(CoordVal));
@@ -19,6 +19,8 @@
 #include <boost/serialization/vector.hpp>
 // NOLINTEND(misc-include-cleaner)
 
+#include "core/sparse/include/spgemm.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 bool kondratev_ya_ccs_complex_multiplication_all::IsZero(const std::complex<double> &value) {
@@ -218,35 +220,22 @@ bool kondratev_ya_ccs_complex_multiplication_all::TestTaskALL::PostProcessingImp
 
 kondratev_ya_ccs_complex_multiplication_all::CCSMatrix
 kondratev_ya_ccs_complex_multiplication_all::CCSMatrix::operator*(const CCSMatrix &other) const {
-  CCSMatrix result({rows, other.cols});
-  result.values.reserve(std::min(rows * other.cols, static_cast<int>(values.size() * other.values.size())));
-  result.row_index.reserve(result.values.capacity());
-
-  std::vector<std::complex<double>> temp_col(rows, std::complex<double>(0.0, 0.0));
-
-  for (int result_col = 0; result_col < other.cols; result_col++) {
-    for (int k = other.col_ptrs[result_col]; k < other.col_ptrs[result_col + 1]; k++) {
-      int row_other = other.row_index[k];
-      std::complex<double> val_other = other.values[k];
-
-      for (int i = col_ptrs[row_other]; i < col_ptrs[row_other + 1]; i++) {
-        int row_this = row_index[i];
-        temp_col[row_this] += values[i] * val_other;
-      }
-    }
-
-    result.col_ptrs[result_col] = static_cast<int>(result.values.size());
-    for (int i = 0; i < rows; i++) {
-      if (!IsZero(temp_col[i])) {
-        result.values.emplace_back(temp_col[i]);
-        result.row_index.emplace_back(i);
-
-        temp_col[i] = std::complex<double>(0.0, 0.0);
-      }
-    }
-  }
-
-  result.col_ptrs[other.cols] = static_cast<int>(result.values.size());
+  const ppc::core::CompressedView<std::complex<double>> a{.lines = static_cast<size_t>(cols),
+                                                          .extent = static_cast<size_t>(rows),
+                                                          .ptr = col_ptrs,
+                                                          .idx = row_index,
+                                                          .val = values};
+  const ppc::core::CompressedView<std::complex<double>> b{.lines = static_cast<size_t>(other.cols),
+                                                          .extent = static_cast<size_t>(other.rows),
+                                                          .ptr = other.col_ptrs,
+                                                          .idx = other.row_index,
+                                                          .val = other.values};
+  auto product = ppc::core::SpGemm(a, b, ppc::core::PoolForEach{},
+                                   [](const std::complex<double> &value) { return !IsZero(value); });
 
+  CCSMatrix result({rows, other.cols});
+  result.values = std::move(product.val);
+  result.row_index = std::move(product.idx);
+  result.col_ptrs = std::move(product.ptr);
   return result;
 }
\ No newline at end of file
@@ -9,15 +9,17 @@
 #include <cstddef>
 #include <functional>
 #include <numeric>
-#include <thread>
+#include <span>
 #include <utility>
 #include <vector>
 
-#include "core/util/include/util.hpp"
+#include "core/sparse/include/spgemm.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 
 namespace korneeva_e_sparse_matrix_mult_complex_ccs_all {
 
 namespace {
+
 void DistributeColumns(int rank, int size, int total_cols, int& start_col, int& end_col) {
   if (size <= 0) {
     start_col = total_cols;
@@ -64,62 +66,9 @@ bool SparseMatrixMultComplexCCS::ValidationImpl() {
   return true;
 }
 
-void SparseMatrixMultComplexCCS::ProcessColumnRange(int start_col, int end_col,
-                                                    std::vector<std::vector<std::pair<Complex, int>>>& column_results,
-                                                    const std::vector<int>& col_indices) {
-  int num_threads = std::max(1, std::min(ppc::util::GetPPCNumThreads(), end_col - start_col));
-  if ((end_col - start_col) < num_threads * 2) {
-    for (int j = start_col; j < end_col; ++j) {
-      ComputeColumn(col_indices[j - start_col], column_results[j - start_col]);
-    }
-  } else {
-    std::vector<std::thread> threads;
-    threads.reserve(num_threads);
-    int cols_per_thread = (end_col - start_col) / num_threads;
-    int remaining_thread_cols = (end_col - start_col) % num_threads;
-    int thread_start = start_col;
-
-    auto compute_range = [&](int thread_start, int thread_end) {
-      for (int j = thread_start; j < thread_end; ++j) {
-        ComputeColumn(col_indices[j - start_col], column_results[j - start_col]);
-      }
-    };
-
-    for (int i = 0; i < num_threads; ++i) {
-      int cols = cols_per_thread + (i < remaining_thread_cols ? 1 : 0);
-      int thread_end = thread_start + cols;
-      threads.emplace_back(compute_range, thread_start, thread_end);
-      thread_start = thread_end;
-    }
-    for (auto& thread : threads) {
-      thread.join();
-    }
-  }
-}
-
-void SparseMatrixMultComplexCCS::CollectLocalResults(
-    const std::vector<std::vector<std::pair<Complex, int>>>& column_results, int start_col, int end_col,
-    std::vector<Complex>& local_values, std::vector<int>& local_row_indices, std::vector<int>& local_col_offsets,
-    int& local_nnz) {
-  local_nnz = 0;
-  local_values.clear();
-  local_row_indices.clear();
-  local_col_offsets.assign(end_col - start_col + 1, 0);
-  for (int j = 0; j < end_col - start_col; ++j) {
-    const auto& col_data = column_results[j];
-    for (const auto& [value, row_idx] : col_data) {
-      local_values.push_back(value);
-      local_row_indices.push_back(row_idx);
-    }
-    local_nnz += static_cast<int>(col_data.size());
-    local_col_offsets[j + 1] = local_nnz;
-  }
-}
-
 void SparseMatrixMultComplexCCS::GatherGlobalResults(
     int rank, int size, int total_cols, int local_nnz, const std::vector<Complex>& local_values,
-    const std::vector<int>& local_row_indices, const std::vector<std::vector<std::pair<Complex, int>>>& column_results,
-    int start_col, int end_col) {
+    const std::vector<int>& local_row_indices, const std::vector<int>& local_col_offsets, int start_col, int end_col) {
   std::vector<int> all_nnz;
   boost::mpi::all_gather(world_, local_nnz, all_nnz);
   int total_nnz = std::accumulate(all_nnz.begin(), all_nnz.end(), 0);
@@ -144,7 +93,7 @@ void SparseMatrixMultComplexCCS::GatherGlobalResults(
 
   std::vector<int> local_col_counts(total_cols, 0);
   for (int j = 0; j < end_col - start_col; ++j) {
-    local_col_counts[start_col + j] = static_cast<int>(column_results[j].size());
+    local_col_counts[start_col + j] = local_col_offsets[j + 1] - local_col_offsets[j];
   }
 
   std::vector<int> global_col_counts(total_cols);
@@ -173,76 +122,31 @@ bool SparseMatrixMultComplexCCS::RunImpl() {
   int end_col = 0;
   DistributeColumns(rank, size, total_cols, start_col, end_col);
 
-  std::vector<std::vector<std::pair<Complex, int>>> column_results(end_col - start_col);
-  std::vector<int> col_indices(end_col - start_col);
-  std::iota(col_indices.begin(), col_indices.end(), start_col);
-
-  if (end_col > start_col) {
-    ProcessColumnRange(start_col, end_col, column_results, col_indices);
-  }
-
-  std::vector<Complex> local_values;
-  std::vector<int> local_row_indices;
-  std::vector<int> local_col_offsets;
-  int local_nnz = 0;
-  CollectLocalResults(column_results, start_col, end_col, local_values, local_row_indices, local_col_offsets,
-                      local_nnz);
-
-  GatherGlobalResults(rank, size, total_cols, local_nnz, local_values, local_row_indices, column_results, start_col,
-                      end_col);
+  // The local columns of matrix2 keep their global offsets, which index its full arrays
+  const auto local_offsets = std::span<const int>(matrix2_->col_offsets)
+                                 .subspan(static_cast<size_t>(start_col), static_cast<size_t>(end_col - start_col) + 1);
+  const ppc::core::CompressedView<Complex> a{.lines = static_cast<size_t>(matrix1_->cols),
+                                             .extent = static_cast<size_t>(matrix1_->rows),
+                                             .ptr = matrix1_->col_offsets,
+                                             .idx = matrix1_->row_indices,
+                                             .val = matrix1_->values};
+  const ppc::core::CompressedView<Complex> b{.lines = static_cast<size_t>(end_col - start_col),
+                                             .extent = static_cast<size_t>(matrix2_->rows),
+                                             .ptr = local_offsets,
+                                             .idx = matrix2_->row_indices,
+                                             .val = matrix2_->values};
+  auto local = ppc::core::SpGemm(a, b, ppc::core::PoolForEach{}, [](const Complex& value) {
+    return std::abs(value.real()) > 1e-10 || std::abs(value.imag()) > 1e-10;
+  });
+  const int local_nnz = static_cast<int>(local.val.size());
+
+  GatherGlobalResults(rank, size, total_cols, local_nnz, local.val, local.idx, local.ptr, start_col, end_col);
 
   boost::mpi::broadcast(world_, result_, 0);
 
   return true;
 }
 
-Complex SparseMatrixMultComplexCCS::ComputeElement(int row_idx, int col_start2, int col_end2) {
-  Complex sum(0.0, 0.0);
-  for (int k = 0; k < matrix1_->cols; ++k) {
-    int col_start1 = matrix1_->col_offsets[k];
-    int col_end1 = matrix1_->col_offsets[k + 1];
-    sum += ComputeContribution(row_idx, k, col_start1, col_end1, col_start2, col_end2);
-  }
-  return sum;
-}
-
-Complex SparseMatrixMultComplexCCS::ComputeContribution(int row_idx, int k, int col_start1, int col_end1,
-                                                        int col_start2, int col_end2) {
-  Complex contribution(0.0, 0.0);
-  for (int p = col_start1; p < col_end1; ++p) {
-    if (matrix1_->row_indices[p] != row_idx) {
-      continue;
-    }
-    for (int q = col_start2; q < col_end2; ++q) {
-      if (matrix2_->row_indices[q] != k) {
-        continue;
-      }
-      contribution += matrix1_->values[p] * matrix2_->values[q];
-    }
-  }
-  return contribution;
-}
-
-void SparseMatrixMultComplexCCS::ComputeColumn(int col_idx, std::vector<std::pair<Complex, int>>& column_data) {
-  if (col_idx >= matrix2_->cols) {
-    return;
-  }
-  int col_start2 = matrix2_->col_offsets[col_idx];
-  int col_end2 = matrix2_->col_offsets[col_idx + 1];
-  if (col_start2 < 0 || col_end2 > matrix2_->nnz || col_start2 > col_end2) {
-    return;
-  }
-
-  column_data.resize(0);
-  column_data.reserve(std::min(matrix1_->rows, matrix2_->nnz));
-  for (int i = 0; i < matrix1_->rows; ++i) {
-    Complex sum = ComputeElement(i, col_start2, col_end2);
-    if (std::abs(sum.real()) > 1e-10 || std::abs(sum.imag()) > 1e-10) {
-      column_data.emplace_back(sum, i);
-    }
-  }
-}
-
 bool SparseMatrixMultComplexCCS::PostProcessingImpl() {
   if (world_.rank() == 0) {
     *reinterpret_cast<SparseMatrixCCS*>(task_data->outputs[0]) = result_;
@@ -1,6 +1,7 @@
 #include <vector>
 
 #include "boost/mpi/communicator.hpp"
+#include "core/sort/include/presortedness.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kovalchuk_a_shell_sort_all {
@@ -12,11 +13,14 @@ class ShellSortAll : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
+  // Order of this rank's piece as the pre-pass measured it, and the path its sort took
+  [[nodiscard]] const ppc::core::PresortStats& GetPresortStats() const { return presort_stats_; }
 
  private:
   void SimpleMerge(int num_procs, const std::vector<int>& gathered, const std::vector<int>& displs, int total_size);
   std::vector<int> input_, counts_, result_;
   boost::mpi::communicator world_, group_;
+  ppc::core::PresortStats presort_stats_;
 };
 
 }  // namespace kovalchuk_a_shell_sort_all
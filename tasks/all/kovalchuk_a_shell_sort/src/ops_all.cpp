@@ -3,7 +3,10 @@
 #include <tbb/parallel_for.h>
 
 #include <algorithm>
+#include <cstddef>
+#include <functional>
 #include <queue>
+#include <span>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -11,7 +14,10 @@
 #include "boost/mpi/collectives/broadcast.hpp"
 #include "boost/mpi/collectives/gatherv.hpp"
 #include "boost/mpi/collectives/scatterv.hpp"
+#include "core/sort/include/presortedness.hpp"
+#include "core/sort/include/tbb_adapters.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
 #include "oneapi/tbb/parallel_for.h"
 
 namespace kovalchuk_a_shell_sort_all {
@@ -59,19 +65,24 @@ bool ShellSortAll::RunImpl() {
   std::vector<int> buffer(n);
   boost::mpi::scatterv(group_, input_.data(), counts_, displs, buffer.data(), n, 0);
 
-  for (int gap = n / 2; gap > 0; gap /= 2) {
-    tbb::parallel_for(0, gap, [&](int k) {
-      for (int i = k + gap; i < n; i += gap) {
-        int temp = buffer[i];
-        int j = i;
-        while (j >= gap && buffer[j - gap] > temp) {
-          buffer[j] = buffer[j - gap];
-          j -= gap;
+  auto shell_sort = [&](std::span<int> /*data*/) {
+    for (int gap = n / 2; gap > 0; gap /= 2) {
+      tbb::parallel_for(0, gap, [&](int k) {
+        for (int i = k + gap; i < n; i += gap) {
+          int temp = buffer[i];
+          int j = i;
+          while (j >= gap && buffer[j - gap] > temp) {
+            buffer[j] = buffer[j - gap];
+            j -= gap;
+          }
+          buffer[j] = temp;
         }
-        buffer[j] = temp;
-      }
-    });
-  }
+      });
+    }
+  };
+  presort_stats_ = ppc::core::AdaptiveSort(std::span<int>(buffer), shell_sort,
+                                           static_cast<size_t>(ppc::util::GetPPCNumThreads()), std::less<>(),
+                                           ppc::core::TbbForEach{});
   input_ = buffer;
 
   std::vector<int> gathered;
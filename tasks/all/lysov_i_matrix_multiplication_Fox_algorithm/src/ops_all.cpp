@@ -17,6 +17,7 @@
 #include "boost/mpi/collectives/broadcast.hpp"
 #include "boost/mpi/collectives/gather.hpp"
 #include "boost/mpi/collectives/scatter.hpp"
+#include "core/gemm/include/gemm.hpp"
 #include "oneapi/tbb/parallel_for.h"
 #include "oneapi/tbb/task_arena.h"
 int lysov_i_matrix_multiplication_fox_algorithm_mpi_tbb::ComputeProcessGrid(int world_size, std::size_t n) {
@@ -39,20 +40,15 @@ void lysov_i_matrix_multiplication_fox_algorithm_mpi_tbb::ExtractSubmatrixBlock(
 
 void lysov_i_matrix_multiplication_fox_algorithm_mpi_tbb::MultiplyMatrixBlocks(const double* a, const double* b,
                                                                                double* c, int block_size) {
+  // Each task multiplies a strip of rows with the packed GEMM; the grain keeps strips tall enough
+  // to repay packing
+  constexpr int kStripRows = 48;
   tbb::parallel_for(
-      tbb::blocked_range<int>(0, block_size),
+      tbb::blocked_range<int>(0, block_size, kStripRows),
       [&](const tbb::blocked_range<int>& r) {
-        for (int i = r.begin(); i < r.end(); ++i) {
-          const double* ai = a + (i * block_size);
-          double* ci = c + (i * block_size);
-          for (int k = 0; k < block_size; ++k) {
-            double aik = ai[k];
-            const double* bk = b + (k * block_size);
-            for (int j = 0; j < block_size; ++j) {
-              ci[j] += aik * bk[j];
-            }
-          }
-        }
+        const auto offset = static_cast<std::size_t>(r.begin()) * block_size;
+        ppc::core::Gemm(r.size(), block_size, block_size, a + offset, block_size, b, block_size, c + offset,
+                        block_size);
       },
       tbb::auto_partitioner());
 }
@@ -5,8 +5,11 @@
 #include <boost/mpi/communicator.hpp>
 #include <boost/serialization/vector.hpp>  // NOLINT
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 bool moiseev_a_mult_mat_mpi::MultMatMPI::PreProcessingImpl() {
   unsigned input_size_a = task_data->inputs_count[0];
   unsigned input_size_b = task_data->inputs_count[1];
@@ -130,15 +133,15 @@ void moiseev_a_mult_mat_mpi::MultMatMPI::ComputeLocalBlock(boost::mpi::communica
     int root = (my_row + step) % p;
     boost::mpi::broadcast(row_comm, a_block, root);
 
+    // Threads take strips of rows of the local block, each a packed GEMM of its own
+    constexpr int kStripRows = 48;
+    const int strips = (block + kStripRows - 1) / kStripRows;
 #pragma omp parallel for
-    for (int i = 0; i < block; ++i) {
-      for (int j = 0; j < block; ++j) {
-        double sum = 0;
-        for (int k = 0; k < block; ++k) {
-          sum += a_block[(i * block) + k] * b_block[(k * block) + j];
-        }
-        c_block[(i * block) + j] += sum;
-      }
+    for (int strip = 0; strip < strips; ++strip) {
+      const int row = strip * kStripRows;
+      const size_t offset = static_cast<size_t>(row) * block;
+      ppc::core::Gemm(std::min(kStripRows, block - row), block, block, &a_block[offset], block, b_block.data(), block,
+                      &c_block[offset], block);
     }
 
     int prev = (my_row - 1 + p) % p;
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -26,18 +25,17 @@ class StrassenAll : public ppc::core::Task {
                           int parent_size);
   static void MergeMatrix(std::vector<double>& parent, const std::vector<double>& child, int row_start, int col_start,
                           int parent_size);
-  static std::vector<double> PadMatrixToPowerOfTwo(const std::vector<double>& matrix, int original_size);
+  static std::vector<double> PadMatrixToEvenSize(const std::vector<double>& matrix, int original_size);
   static std::vector<double> TrimMatrixToOriginalSize(const std::vector<double>& matrix, int original_size,
                                                       int padded_size);
-  static std::vector<double> StrassenMultiply(const std::vector<double>& a, const std::vector<double>& b, int size);
-  static void StrassenWorker(int prod_idx, const std::vector<double>& a, const std::vector<double>& b, int size,
-                             std::vector<double>& result, std::mutex& mtx);
+  std::vector<double> MultiplyBlock(const std::vector<double>& a, const std::vector<double>& b, int size);
 
   std::vector<double> input_matrix_a_;
   std::vector<double> input_matrix_b_;
   std::vector<double> output_matrix_;
   int matrix_size_{};
   int original_size_{};
+  std::vector<double> workspace_;
   boost::mpi::communicator world_;
 };
 
@@ -6,13 +6,12 @@
 #include <cstddef>
 #include <functional>
 #include <limits>
-#include <mutex>
 #include <stdexcept>
-#include <thread>
 #include <vector>
 
 #include "boost/mpi/collectives/broadcast.hpp"
-#include "core/util/include/util.hpp"
+#include "core/gemm/include/strassen.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 
 namespace nasedkin_e_strassen_algorithm_all {
 
@@ -29,10 +28,12 @@ bool StrassenAll::PreProcessingImpl() {
     std::ranges::copy(in_ptr_a, in_ptr_a + input_size, input_matrix_a_.begin());
     std::ranges::copy(in_ptr_b, in_ptr_b + input_size, input_matrix_b_.begin());
 
-    if ((matrix_size_ & (matrix_size_ - 1)) != 0) {
+    // Only the top level is split across processes, so an odd size is padded by one row and
+    // column; the engine peels odd sizes below it
+    if (matrix_size_ % 2 != 0) {
       original_size_ = matrix_size_;
-      input_matrix_a_ = PadMatrixToPowerOfTwo(input_matrix_a_, matrix_size_);
-      input_matrix_b_ = PadMatrixToPowerOfTwo(input_matrix_b_, matrix_size_);
+      input_matrix_a_ = PadMatrixToEvenSize(input_matrix_a_, matrix_size_);
+      input_matrix_b_ = PadMatrixToEvenSize(input_matrix_b_, matrix_size_);
       matrix_size_ = static_cast<int>(std::sqrt(input_matrix_a_.size()));
     } else {
       original_size_ = matrix_size_;
@@ -94,16 +95,34 @@ bool StrassenAll::RunImpl() {
   SplitMatrix(input_matrix_b_, b21, half_size, 0, matrix_size_);
   SplitMatrix(input_matrix_b_, b22, half_size, half_size, matrix_size_);
 
-  std::vector<std::vector<double>> products(kNumProds, std::vector<double>(half_size * half_size));
-  std::mutex mtx;
-  std::vector<std::thread> threads;
-
+  std::vector<std::vector<double>> products(kNumProds);
+  workspace_.resize(ppc::core::StrassenWorkspaceSize(half_size, half_size, half_size));
   for (size_t i = world_.rank(); i < kNumProds; i += world_.size()) {
-    threads.emplace_back(&StrassenAll::StrassenWorker, i, std::cref(input_matrix_a_), std::cref(input_matrix_b_),
-                         matrix_size_, std::ref(products[i]), std::ref(mtx));
-  }
-  for (auto &t : threads) {
-    t.join();
+    switch (i) {
+      case 0:
+        products[i] = MultiplyBlock(AddMatrices(a11, a22, half_size), AddMatrices(b11, b22, half_size), half_size);
+        break;
+      case 1:
+        products[i] = MultiplyBlock(AddMatrices(a21, a22, half_size), b11, half_size);
+        break;
+      case 2:
+        products[i] = MultiplyBlock(a11, SubtractMatrices(b12, b22, half_size), half_size);
+        break;
+      case 3:
+        products[i] = MultiplyBlock(a22, SubtractMatrices(b21, b11, half_size), half_size);
+        break;
+      case 4:
+        products[i] = MultiplyBlock(AddMatrices(a11, a12, half_size), b22, half_size);
+        break;
+      case 5:
+        products[i] = MultiplyBlock(SubtractMatrices(a21, a11, half_size), AddMatrices(b11, b12, half_size), half_size);
+        break;
+      case 6:
+        products[i] = MultiplyBlock(SubtractMatrices(a12, a22, half_size), AddMatrices(b21, b22, half_size), half_size);
+        break;
+      default:
+        break;
+    }
   }
 
   if (world_.rank() == 0) {
@@ -147,89 +166,13 @@ bool StrassenAll::RunImpl() {
   return true;
 }
 
-void StrassenAll::StrassenWorker(int prod_idx, const std::vector<double> &a, const std::vector<double> &b, int size,
-                                 std::vector<double> &result, std::mutex &mtx) {
-  std::vector<double> local_result;
-  if (size <= 32) {
-    local_result = StandardMultiply(a, b, size);
-  } else {
-    int half_size = size / 2;
-    std::vector<double> a11(half_size * half_size);
-    std::vector<double> a12(half_size * half_size);
-    std::vector<double> a21(half_size * half_size);
-    std::vector<double> a22(half_size * half_size);
-    std::vector<double> b11(half_size * half_size);
-    std::vector<double> b12(half_size * half_size);
-    std::vector<double> b21(half_size * half_size);
-    std::vector<double> b22(half_size * half_size);
-
-    SplitMatrix(a, a11, 0, 0, size);
-    SplitMatrix(a, a12, 0, half_size, size);
-    SplitMatrix(a, a21, half_size, 0, size);
-    SplitMatrix(a, a22, half_size, half_size, size);
-    SplitMatrix(b, b11, 0, 0, size);
-    SplitMatrix(b, b12, 0, half_size, size);
-    SplitMatrix(b, b21, half_size, 0, size);
-    SplitMatrix(b, b22, half_size, half_size, size);
-
-    std::vector<std::vector<double>> inputs_a(7);
-    std::vector<std::vector<double>> inputs_b(7);
-    switch (prod_idx) {
-      case 0:
-        inputs_a[0] = AddMatrices(a11, a22, half_size);
-        inputs_b[0] = AddMatrices(b11, b22, half_size);
-        break;
-      case 1:
-        inputs_a[1] = AddMatrices(a21, a22, half_size);
-        inputs_b[1] = b11;
-        break;
-      case 2:
-        inputs_a[2] = a11;
-        inputs_b[2] = SubtractMatrices(b12, b22, half_size);
-        break;
-      case 3:
-        inputs_a[3] = a22;
-        inputs_b[3] = SubtractMatrices(b21, b11, half_size);
-        break;
-      case 4:
-        inputs_a[4] = AddMatrices(a11, a12, half_size);
-        inputs_b[4] = b22;
-        break;
-      case 5:
-        inputs_a[5] = SubtractMatrices(a21, a11, half_size);
-        inputs_b[5] = AddMatrices(b11, b12, half_size);
-        break;
-      case 6:
-        inputs_a[6] = SubtractMatrices(a12, a22, half_size);
-        inputs_b[6] = AddMatrices(b21, b22, half_size);
-        break;
-      default:
-        break;
-    }
-
-    local_result.resize(half_size * half_size);
-    if (size <= 32) {
-      local_result = StandardMultiply(inputs_a[prod_idx], inputs_b[prod_idx], half_size);
-    } else {
-      std::vector<std::thread> threads;
-      size_t num_threads = ppc::util::GetPPCNumThreads();
-      threads.reserve(num_threads);
-      std::mutex local_mtx;
-      for (size_t t = 0; t < num_threads; ++t) {
-        threads.emplace_back([&inputs_a, &inputs_b, prod_idx, half_size, &local_result, &local_mtx]() {
-          auto temp = StrassenMultiply(inputs_a[prod_idx], inputs_b[prod_idx], half_size);
-          std::lock_guard<std::mutex> lock(local_mtx);
-          local_result = temp;
-        });
-      }
-      for (auto &t : threads) {
-        t.join();
-      }
-    }
-  }
-
-  std::lock_guard<std::mutex> lock(mtx);
-  result = local_result;
+std::vector<double> StrassenAll::MultiplyBlock(const std::vector<double> &a, const std::vector<double> &b,
+                                               int size) {
+  const auto n = static_cast<size_t>(size);
+  std::vector<double> result(n * n);
+  ppc::core::StrassenMultiply(n, n, n, a.data(), n, b.data(), n, result.data(), n, workspace_,
+                              ppc::core::PoolForEach{});
+  return result;
 }
 
 bool StrassenAll::PostProcessingImpl() {
@@ -268,11 +211,8 @@ std::vector<double> StandardMultiply(const std::vector<double> &a, const std::ve
   return result;
 }
 
-std::vector<double> StrassenAll::PadMatrixToPowerOfTwo(const std::vector<double> &matrix, int original_size) {
-  int new_size = 1;
-  while (new_size < original_size) {
-    new_size *= 2;
-  }
+std::vector<double> StrassenAll::PadMatrixToEvenSize(const std::vector<double> &matrix, int original_size) {
+  int new_size = original_size + (original_size % 2);
   std::vector<double> padded_matrix(new_size * new_size, 0);
   for (int i = 0; i < original_size; ++i) {
     std::ranges::copy(matrix.begin() + i * original_size, matrix.begin() + (i + 1) * original_size,
@@ -291,58 +231,6 @@ std::vector<double> StrassenAll::TrimMatrixToOriginalSize(const std::vector<doub
   return trimmed_matrix;
 }
 
-std::vector<double> StrassenAll::StrassenMultiply(const std::vector<double> &a, const std::vector<double> &b,
-                                                  int size) {
-  if (size <= 32) {
-    return StandardMultiply(a, b, size);
-  }
-
-  int half_size = size / 2;
-  int half_size_squared = half_size * half_size;
-
-  std::vector<double> a11(half_size_squared);
-  std::vector<double> a12(half_size_squared);
-  std::vector<double> a21(half_size_squared);
-  std::vector<double> a22(half_size_squared);
-  std::vector<double> b11(half_size_squared);
-  std::vector<double> b12(half_size_squared);
-  std::vector<double> b21(half_size_squared);
-  std::vector<double> b22(half_size_squared);
-
-  SplitMatrix(a, a11, 0, 0, size);
-  SplitMatrix(a, a12, 0, half_size, size);
-  SplitMatrix(a, a21, half_size, 0, size);
-  SplitMatrix(a, a22, half_size, half_size, size);
-  SplitMatrix(b, b11, 0, 0, size);
-  SplitMatrix(b, b12, 0, half_size, size);
-  SplitMatrix(b, b21, half_size, 0, size);
-  SplitMatrix(b, b22, half_size, half_size, size);
-
-  std::vector<double> p1 =
-      StrassenMultiply(AddMatrices(a11, a22, half_size), AddMatrices(b11, b22, half_size), half_size);
-  std::vector<double> p2 = StrassenMultiply(AddMatrices(a21, a22, half_size), b11, half_size);
-  std::vector<double> p3 = StrassenMultiply(a11, SubtractMatrices(b12, b22, half_size), half_size);
-  std::vector<double> p4 = StrassenMultiply(a22, SubtractMatrices(b21, b11, half_size), half_size);
-  std::vector<double> p5 = StrassenMultiply(AddMatrices(a11, a12, half_size), b22, half_size);
-  std::vector<double> p6 =
-      StrassenMultiply(SubtractMatrices(a21, a11, half_size), AddMatrices(b11, b12, half_size), half_size);
-  std::vector<double> p7 =
-      StrassenMultiply(SubtractMatrices(a12, a22, half_size), AddMatrices(b21, b22, half_size), half_size);
-
-  std::vector<double> c11 = AddMatrices(SubtractMatrices(AddMatrices(p1, p4, half_size), p5, half_size), p7, half_size);
-  std::vector<double> c12 = AddMatrices(p3, p5, half_size);
-  std::vector<double> c21 = AddMatrices(p2, p4, half_size);
-  std::vector<double> c22 = AddMatrices(SubtractMatrices(AddMatrices(p1, p3, half_size), p2, half_size), p6, half_size);
-
-  std::vector<double> result(size * size);
-  MergeMatrix(result, c11, 0, 0, size);
-  MergeMatrix(result, c12, 0, half_size, size);
-  MergeMatrix(result, c21, half_size, 0, size);
-  MergeMatrix(result, c22, half_size, half_size, size);
-
-  return result;
-}
-
 void StrassenAll::SplitMatrix(const std::vector<double> &parent, std::vector<double> &child, int row_start,
                               int col_start, int parent_size) {
   int child_size = static_cast<int>(std::sqrt(child.size()));
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <span>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -21,8 +21,8 @@ class TestTaskParallelOmpMpi : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::span<double> in_;
-  std::vector<double> res_;
+  // Inputs as radix keys on rank 0, sorted in place
+  std::vector<uint64_t> keys_;
   int global_rank_;
 };
 
@@ -16,26 +16,21 @@
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/key_transform.hpp"
+#include "core/sort/include/omp_adapters.hpp"
 #include "core/util/include/util.hpp"
 #include "mpi.h"
 
 namespace {
-auto Translate(double e, std::size_t i) {
-  const uint64_t mask = 1ULL << ((sizeof(uint64_t) * 8) - 1);
-  const union {
-    double dbl;
-    uint64_t uint64;
-  } uni{.dbl = e};
-  const uint64_t u = ((uni.uint64 & mask) == 0U) ? (uni.uint64 | mask) : (~uni.uint64);
-  return (u >> (i * 8)) & 0xFF;
-}
+// Keys come from ppc::core::ToRadixKeys, so a byte of the key is a radix digit as it is
+auto Translate(uint64_t e, std::size_t i) { return (e >> (i * 8)) & 0xFF; }
 
-void Radix(double *p, int len) {
-  std::vector<double> tmpb(len);
-  double *tmp = tmpb.data();
+void Radix(uint64_t *p, int len) {
+  std::vector<uint64_t> tmpb(len);
+  uint64_t *tmp = tmpb.data();
   std::vector<std::size_t> cnt(1 << 8, 0);
 
-  for (std::size_t i = 0; i < sizeof(double); ++i) {
+  for (std::size_t i = 0; i < sizeof(uint64_t); ++i) {
     for (auto &c : cnt) {
       c = 0;
     }
@@ -54,12 +49,12 @@ void Radix(double *p, int len) {
   }
 }
 
-void OddEvenBatcherMergeBlocksStep(std::pair<double *, int> &left, std::pair<double *, int> &right) {
+void OddEvenBatcherMergeBlocksStep(std::pair<uint64_t *, int> &left, std::pair<uint64_t *, int> &right) {
   std::inplace_merge(left.first, right.first, right.first + right.second);
   left.second += right.second;
 }
 
-void ParallelOddEvenBatcherMerge(int bsz, std::vector<std::pair<double *, int>> &vb, int par_if_greater) {
+void ParallelOddEvenBatcherMerge(int bsz, std::vector<std::pair<uint64_t *, int>> &vb, int par_if_greater) {
   for (int step = 1, pack = int(vb.size()); pack > 1; step *= 2, pack /= 2) {
 #pragma omp parallel for if ((bsz / step) > par_if_greater)
     for (int off = 0; off < pack / 2; ++off) {
@@ -73,14 +68,14 @@ void ParallelOddEvenBatcherMerge(int bsz, std::vector<std::pair<double *, int>>
   }
 }
 
-void ParallelIntraprocessSort(std::span<double> arr) {
+void ParallelIntraprocessSort(std::span<uint64_t> arr) {
   const int sz = static_cast<int>(arr.size());
   const int thr = std::min(sz, ppc::util::GetPPCNumThreads());
 
   const int bsz = sz / thr;
   const int bex = sz % thr;
 
-  std::vector<std::pair<double *, int>> vb(thr);
+  std::vector<std::pair<uint64_t *, int>> vb(thr);
   for (int i = 0; i < thr; i++) {
     vb[i] = std::make_pair(arr.data() + (i * bsz), bsz);  // NOLINT(*narrow*)
   }
@@ -95,7 +90,7 @@ void ParallelIntraprocessSort(std::span<double> arr) {
   ParallelOddEvenBatcherMerge(bsz, vb, 33);
 }
 
-bool ParallelInterprocessScatter(std::span<double> arr, MPI_Comm *newcomm, std::vector<double> *outv) {
+bool ParallelInterprocessScatter(std::span<uint64_t> arr, MPI_Comm *newcomm, std::vector<uint64_t> *outv) {
   int processes{};
   int rank{};
   MPI_Comm_size(MPI_COMM_WORLD, &processes);
@@ -122,7 +117,7 @@ bool ParallelInterprocessScatter(std::span<double> arr, MPI_Comm *newcomm, std::
     const int bsz = sz / thr;
     const int bex = sz % thr;
 
-    std::vector<std::pair<double *, int>> vb(thr);
+    std::vector<std::pair<uint64_t *, int>> vb(thr);
     for (int i = 0; i < thr; i++) {
       vb[i] = std::make_pair(arr.data() + (i * bsz), bsz);  // NOLINT(*narrow*)
     }
@@ -137,18 +132,18 @@ bool ParallelInterprocessScatter(std::span<double> arr, MPI_Comm *newcomm, std::
     for (int r = 1; r < thr; r++) {
       const auto &[ptr, ptrsz] = vb[r];
       MPI_Send(&ptrsz, 1, MPI_INT, r, 0, *newcomm);
-      MPI_Send(ptr, ptrsz, MPI_DOUBLE, r, 0, *newcomm);
+      MPI_Send(ptr, ptrsz, MPI_UINT64_T, r, 0, *newcomm);
     }
   } else {
     int recvsz{};
     MPI_Recv(&recvsz, 1, MPI_INT, 0, 0, *newcomm, MPI_STATUS_IGNORE);
     outv->resize(recvsz);
-    MPI_Recv(outv->data(), recvsz, MPI_DOUBLE, 0, 0, *newcomm, MPI_STATUS_IGNORE);
+    MPI_Recv(outv->data(), recvsz, MPI_UINT64_T, 0, 0, *newcomm, MPI_STATUS_IGNORE);
   }
 
   return true;
 }
-void ParallelInterprocessGather(MPI_Comm *comm, std::vector<double> &arr) {
+void ParallelInterprocessGather(MPI_Comm *comm, std::vector<uint64_t> &arr) {
   int processes{};
   int rank{};
   MPI_Comm_size(*comm, &processes);
@@ -162,13 +157,13 @@ void ParallelInterprocessGather(MPI_Comm *comm, std::vector<double> &arr) {
         MPI_Recv(&arrs, 1, MPI_UINT64_T, transmitter_rank, 0, *comm, MPI_STATUS_IGNORE);
         const auto insert_pos = std::uint64_t{arr.size()};
         arr.resize(insert_pos + arrs);
-        MPI_Recv(arr.data() + insert_pos, int(arrs), MPI_DOUBLE, transmitter_rank, 0, *comm, MPI_STATUS_IGNORE);
+        MPI_Recv(arr.data() + insert_pos, int(arrs), MPI_UINT64_T, transmitter_rank, 0, *comm, MPI_STATUS_IGNORE);
         std::ranges::inplace_merge(arr, arr.begin() + int(insert_pos));
       }
     } else if ((rank % i) == 0) {
       const std::uint64_t arrs = arr.size();
       MPI_Send(&arrs, 1, MPI_UINT64_T, rank - i, 0, *comm);
-      MPI_Send(arr.data(), int(arrs), MPI_DOUBLE, rank - i, 0, *comm);
+      MPI_Send(arr.data(), int(arrs), MPI_UINT64_T, rank - i, 0, *comm);
       break;
     }
   }
@@ -181,17 +176,18 @@ bool petrov_a_radix_double_batcher_all::TestTaskParallelOmpMpi::ValidationImpl()
 
 bool petrov_a_radix_double_batcher_all::TestTaskParallelOmpMpi::PreProcessingImpl() {
   if (global_rank_ == 0) {
-    in_ = {reinterpret_cast<double *>(task_data->inputs[0]),
-           reinterpret_cast<double *>(task_data->inputs[0]) + task_data->inputs_count[0]};
+    const std::span<const double> in(reinterpret_cast<double *>(task_data->inputs[0]), task_data->inputs_count[0]);
+    keys_.resize(in.size());
+    ppc::core::ToRadixKeys(in, std::span<uint64_t>(keys_), ppc::core::OmpForEach{.dynamic = false});
   }
   return true;
 }
 
 bool petrov_a_radix_double_batcher_all::TestTaskParallelOmpMpi::RunImpl() {
   MPI_Comm comm{};
-  std::vector<double> part;
+  std::vector<uint64_t> part;
 
-  if (!ParallelInterprocessScatter(in_, &comm, &part)) {
+  if (!ParallelInterprocessScatter(keys_, &comm, &part)) {
     MPI_Comm_free(&comm);
     return true;
   }
@@ -201,7 +197,7 @@ bool petrov_a_radix_double_batcher_all::TestTaskParallelOmpMpi::RunImpl() {
   MPI_Comm_free(&comm);
 
   if (global_rank_ == 0) {
-    res_ = std::move(part);
+    keys_ = std::move(part);
   }
 
   return true;
@@ -209,7 +205,9 @@ bool petrov_a_radix_double_batcher_all::TestTaskParallelOmpMpi::RunImpl() {
 
 bool petrov_a_radix_double_batcher_all::TestTaskParallelOmpMpi::PostProcessingImpl() {
   if (global_rank_ == 0) {
-    std::ranges::copy(res_, reinterpret_cast<double *>(task_data->outputs[0]));
+    ppc::core::FromRadixKeys(std::span<const uint64_t>(keys_),
+                             std::span<double>(reinterpret_cast<double *>(task_data->outputs[0]), keys_.size()),
+                             ppc::core::OmpForEach{.dynamic = false});
   }
   return true;
 }
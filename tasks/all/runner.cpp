@@ -1,4 +1,6 @@
 #include <gtest/gtest.h>
+#include <mpi.h>
+#include <omp.h>
 #include <tbb/global_control.h>
 
 #include <boost/mpi/communicator.hpp>
@@ -9,6 +11,10 @@
 #include <string>
 #include <utility>
 
+#include "core/trace/include/trace.hpp"
+#include "core/util/include/omp_affinity.hpp"
+#include "core/util/include/tbb_affinity.hpp"
+#include "core/util/include/topology.hpp"
 #include "core/util/include/util.hpp"
 #include "oneapi/tbb/global_control.h"
 
@@ -63,9 +69,29 @@ class WorkerTestFailurePrinter : public ::testing::EmptyTestEventListener {
 int main(int argc, char** argv) {
   boost::mpi::environment env(argc, argv);
   boost::mpi::communicator world;
+  // One trace track and one trace file per process
+  ppc::core::trace::SetProcess(world.rank(), "rank " + std::to_string(world.rank()));
+
+  // Processes sharing a node take consecutive ranges of affinity slots
+  MPI_Comm node_comm = MPI_COMM_NULL;
+  MPI_Comm_split_type(world, MPI_COMM_TYPE_SHARED, world.rank(), MPI_INFO_NULL, &node_comm);
+  const boost::mpi::communicator node(node_comm, boost::mpi::comm_take_ownership);
+  ppc::util::SetAffinitySlotOffset(node.rank() * ppc::util::GetPPCNumThreads());
+  const auto affinity = ppc::util::MakeTbbAffinityObserver();
+  ppc::util::PinOpenMPThreads(omp_get_max_threads());
 
   // Limit the number of threads in TBB
-  tbb::global_control control(tbb::global_control::max_allowed_parallelism, ppc::util::GetPPCNumThreads());
+  auto control = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism,
+                                                       ppc::util::GetPPCNumThreads());
+  ppc::util::AddNumThreadsHandler([&control](int num_threads) {
+    // The most restrictive active control wins, so the previous one is released first
+    control.reset();
+    control = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism, num_threads);
+  });
+  ppc::util::AddNumThreadsHandler([](int num_threads) {
+    omp_set_num_threads(num_threads);
+    ppc::util::PinOpenMPThreads(num_threads);
+  });
 
   ::testing::InitGoogleTest(&argc, argv);
 
@@ -7,8 +7,11 @@
 #include <cmath>
 #include <cstddef>
 #include <optional>
+#include <utility>
 #include <vector>
 
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 #include "oneapi/tbb/parallel_for.h"
 
@@ -20,28 +23,20 @@ void SparseMatrix::SetMatrixData(const MatrixComponents& components, int rows_co
   m_columnsCount_ = columns_count;
 }
 SparseMatrix SparseMatrix::Transpose(const SparseMatrix& matrix) {
-  MatrixComponents components;
-  auto max_size = std::max(matrix.GetRowsCount(), matrix.GetColumnsCount());
-  std::vector<std::vector<double>> intermediate_values(max_size);
-  std::vector<std::vector<int>> intermediate_indexes(max_size);
-  int counter = 0;
-  for (size_t i = 0; i < matrix.GetElementsSum().size(); ++i) {
-    auto limit = i == 0 ? matrix.GetElementsSum()[0] : matrix.GetElementsSum()[i] - matrix.GetElementsSum()[i - 1];
-    for (int j = 0; j < limit; ++j) {
-      intermediate_values[matrix.GetRows()[counter]].emplace_back(matrix.GetValues()[counter]);
-      intermediate_indexes[matrix.GetRows()[counter]].emplace_back(i);
-      counter++;
-    }
-  }
-  for (size_t i = 0; i < intermediate_values.size(); ++i) {
-    for (size_t j = 0; j < intermediate_values[i].size(); ++j) {
-      components.m_values.emplace_back(intermediate_values[i][j]);
-      components.m_rows.emplace_back(intermediate_indexes[i][j]);
-    }
-    i == 0 ? components.m_elementsSum.emplace_back(intermediate_values[i].size())
-           : components.m_elementsSum.emplace_back(intermediate_values[i].size() + components.m_elementsSum[i - 1]);
-  }
-  return {matrix.GetColumnsCount(), matrix.GetRowsCount(), components};
+  // The element sums are the column pointers without their leading zero
+  const auto& elements_sum = matrix.GetElementsSum();
+  std::vector<int> ptr(elements_sum.size() + 1, 0);
+  std::ranges::copy(elements_sum, ptr.begin() + 1);
+  const ppc::core::CompressedView<double> columns{.lines = elements_sum.size(),
+                                                  .extent = static_cast<size_t>(matrix.GetRowsCount()),
+                                                  .ptr = ptr,
+                                                  .idx = matrix.GetRows(),
+                                                  .val = matrix.GetValues()};
+  auto rows = ppc::core::Transpose(columns, ppc::core::PoolForEach{});
+  rows.ptr.erase(rows.ptr.begin());
+  return {matrix.GetColumnsCount(), matrix.GetRowsCount(),
+          MatrixComponents{.m_values = std::move(rows.val), .m_rows = std::move(rows.idx),
+                           .m_elementsSum = std::move(rows.ptr)}};
 }
 double SparseMatrix::CalculateSum(const SparseMatrix& fmatrix, const SparseMatrix& smatrix,
                                   const std::vector<int>& felements_sum, const std::vector<int>& selements_sum,
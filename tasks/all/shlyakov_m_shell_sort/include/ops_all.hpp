@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
 #include "core/task/include/task.hpp"
 
 namespace shlyakov_m_shell_sort_all {
@@ -19,11 +20,14 @@ class TestTaskALL : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
+  // Order of this rank's piece as the pre-pass measured it, and the path its sort took
+  [[nodiscard]] const ppc::core::PresortStats& GetPresortStats() const { return presort_stats_; }
 
  private:
   std::vector<int> input_;
   std::vector<int> output_;
   boost::mpi::communicator world_;
+  ppc::core::PresortStats presort_stats_;
 };
 
 }  // namespace shlyakov_m_shell_sort_all
@@ -10,8 +10,13 @@
 #include <boost/serialization/vector.hpp>  // NOLINT(misc-include-cleaner)
 #include <core/util/include/util.hpp>
 #include <cstddef>
+#include <functional>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
+#include "core/sort/include/tbb_adapters.hpp"
+
 namespace shlyakov_m_shell_sort_all {
 
 bool TestTaskALL::PreProcessingImpl() {
@@ -58,7 +63,7 @@ bool TestTaskALL::RunImpl() {
   }
 
   int n = static_cast<int>(local_data.size());
-  if (n > 1) {
+  auto sort_and_merge = [&](std::span<int> /*data*/) {
     int max_threads = ppc::util::GetPPCNumThreads();
     int threads = std::min(max_threads, n);
     int seg_size = (n + threads - 1) / threads;
@@ -81,7 +86,10 @@ bool TestTaskALL::RunImpl() {
         end = r;
       }
     });
-  }
+  };
+  presort_stats_ = ppc::core::AdaptiveSort(std::span<int>(local_data), sort_and_merge,
+                                           static_cast<size_t>(ppc::util::GetPPCNumThreads()), std::less<>(),
+                                           ppc::core::TbbForEach{});
 
   std::vector<std::vector<int>> gathered;
   boost::mpi::gather(world_, local_data, gathered, 0);
@@ -5,76 +5,27 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <memory>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/omp_adapters.hpp"
+#include "core/sort/include/parallel_quicksort.hpp"
 #include "core/task/include/task.hpp"
 
 namespace shuravina_o_hoare_simple_merger {
 
 TestTaskALL::TestTaskALL(std::shared_ptr<ppc::core::TaskData> task_data) : Task(std::move(task_data)) {}
 
-void TestTaskALL::QuickSort(std::vector<int>& arr, int low, int high) {
-  if (low >= high) {
-    return;
-  }
-
-  int pivot = arr[high];
-  int i = low - 1;
-
-  for (int j = low; j < high; ++j) {
-    if (arr[j] <= pivot) {
-      std::swap(arr[++i], arr[j]);
-    }
-  }
-  std::swap(arr[i + 1], arr[high]);
-
-  const int pi = i + 1;
-
-  if (high - low > 1000) {
-#pragma omp parallel sections
-    {
-#pragma omp section
-      { QuickSort(arr, low, pi - 1); }
-#pragma omp section
-      { QuickSort(arr, pi + 1, high); }
-    }
-  } else {
-    QuickSort(arr, low, pi - 1);
-    QuickSort(arr, pi + 1, high);
-  }
-}
-
-void TestTaskALL::Merge(std::vector<int>& arr, int low, int mid, int high) {
-  std::vector<int> temp(high - low + 1);
-  int i = low;
-  int j = mid + 1;
-  int k = 0;
-
-  while (i <= mid && j <= high) {
-    if (arr[i] <= arr[j]) {
-      temp[k++] = arr[i++];
-    } else {
-      temp[k++] = arr[j++];
-    }
-  }
-
-  while (i <= mid) {
-    temp[k++] = arr[i++];
-  }
-  while (j <= high) {
-    temp[k++] = arr[j++];
-  }
-
-  for (i = low, k = 0; i <= high; ++i, ++k) {
-    arr[i] = temp[k];
-  }
-}
-
 void TestTaskALL::ParallelQuickSort(std::vector<int>& arr) {
-  if (!arr.empty()) {
-    QuickSort(arr, 0, static_cast<int>(arr.size()) - 1);
+  const int num_threads = omp_get_max_threads();
+#pragma omp parallel num_threads(num_threads)
+  {
+#pragma omp single
+    ppc::core::ParallelQuickSort(std::span<int>(arr), num_threads, std::less<>(), ppc::core::OmpInvoke{},
+                                 ppc::core::OmpTaskForEach{});
   }
 }
 
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <mpi.h>
 
 #include <algorithm>
 #include <boost/mpi/communicator.hpp>
@@ -6,11 +7,42 @@
 #include <cstdint>
 #include <memory>
 #include <random>
+#include <span>
+#include <string>
 #include <vector>
 
 #include "all/smirnov_i_radix_sort_simple_merge/include/ops_all.hpp"
+#include "core/sort/include/mpi_sample_sort.hpp"
 #include "core/task/include/task.hpp"
 
+namespace {
+
+// Piece of a distributed input held by rank; every rank can rebuild all pieces
+std::vector<int> RankPiece(const std::string &kind, int rank, int size) {
+  std::mt19937 gen(static_cast<unsigned>(rank + 1));
+  size_t n = 5000 + (static_cast<size_t>(rank) * 777);
+  if (kind == "all_on_rank_0") {
+    n = rank == 0 ? 20000 : 0;
+  }
+  std::vector<int> piece(n);
+  for (size_t i = 0; i < n; i++) {
+    if (kind == "few_values") {
+      piece[i] = static_cast<int>(gen() % 3);
+    } else if (kind == "equal") {
+      piece[i] = 42;
+    } else if (kind == "sorted") {
+      piece[i] = (rank * 100000) + static_cast<int>(i);
+    } else if (kind == "reverse") {
+      piece[i] = ((size - rank) * 100000) - static_cast<int>(i);
+    } else {
+      piece[i] = static_cast<int>(gen());
+    }
+  }
+  return piece;
+}
+
+}  // namespace
+
 TEST(smirnov_i_radix_sort_simple_merge_all, test_wrong_size) {
   // Create data
   std::vector<int> in(2, 0);
@@ -263,4 +295,49 @@ TEST(smirnov_i_radix_sort_simple_merge_all, test_771_elem) {
   if (world.rank() == 0) {
     EXPECT_EQ(exp_out, out);
   }
-}
\ No newline at end of file
+}
+
+TEST(smirnov_i_radix_sort_simple_merge_all, sample_sort_matches_std_sort) {
+  boost::mpi::communicator world;
+  auto local_sort = [](std::span<int> piece) { std::ranges::sort(piece); };
+  for (const std::string kind : {"random", "few_values", "equal", "sorted", "reverse", "all_on_rank_0"}) {
+    std::vector<int> expected;
+    for (int r = 0; r < world.size(); r++) {
+      const auto piece = RankPiece(kind, r, world.size());
+      expected.insert(expected.end(), piece.begin(), piece.end());
+    }
+    std::ranges::sort(expected);
+
+    const auto bucket =
+        ppc::core::DistributedSampleSort(MPI_COMM_WORLD, RankPiece(kind, world.rank(), world.size()), local_sort, 3);
+    EXPECT_TRUE(std::ranges::is_sorted(bucket)) << kind;
+    // The result stays distributed: every rank holds about its share, even of duplicated values
+    EXPECT_LE(bucket.size(), (2 * expected.size() / world.size()) + 1) << kind << " rank " << world.rank();
+    const auto gathered = ppc::core::GatherSorted(MPI_COMM_WORLD, std::span<const int>(bucket));
+    if (world.rank() == 0) {
+      EXPECT_EQ(gathered, expected) << kind;
+    } else {
+      EXPECT_TRUE(gathered.empty());
+    }
+  }
+}
+
+TEST(smirnov_i_radix_sort_simple_merge_all, sample_sort_descending_records) {
+  struct Record {
+    int key;
+    int rank;
+  };
+  boost::mpi::communicator world;
+  std::vector<Record> piece(3000);
+  for (size_t i = 0; i < piece.size(); i++) {
+    piece[i] = {.key = static_cast<int>((i * 7919) % 1000), .rank = world.rank()};
+  }
+  auto descending = [](const Record &a, const Record &b) { return a.key > b.key; };
+  auto local_sort = [&](std::span<Record> values) { std::ranges::sort(values, descending); };
+  const auto bucket = ppc::core::DistributedSampleSort(MPI_COMM_WORLD, piece, local_sort, 2, descending);
+  const auto gathered = ppc::core::GatherSorted(MPI_COMM_WORLD, std::span<const Record>(bucket));
+  if (world.rank() == 0) {
+    EXPECT_EQ(gathered.size(), piece.size() * world.size());
+    EXPECT_TRUE(std::ranges::is_sorted(gathered, descending));
+  }
+}
@@ -1,15 +1,54 @@
 #include <gtest/gtest.h>
+#include <mpi.h>
 
+#include <algorithm>
 #include <boost/mpi/communicator.hpp>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <random>
+#include <span>
+#include <string>
 #include <vector>
 
 #include "all/smirnov_i_radix_sort_simple_merge/include/ops_all.hpp"
+#include "core/perf/include/call_timing.hpp"
 #include "core/perf/include/perf.hpp"
+#include "core/sort/include/mpi_sample_sort.hpp"
+#include "core/sort/include/multiway_merge.hpp"
+#include "core/sort/include/radix_sort.hpp"
 #include "core/task/include/task.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+// The approach the task used before: every rank sends its sorted piece to rank 0, which merges them
+std::vector<int> GatherAndMerge(MPI_Comm comm, std::vector<int> piece, size_t num_parts) {
+  ppc::core::RadixSort(std::span<int>(piece));
+  int size = 1;
+  MPI_Comm_size(comm, &size);
+  std::vector<int> counts(size);
+  const int count = static_cast<int>(piece.size());
+  MPI_Allgather(&count, 1, MPI_INT, counts.data(), 1, MPI_INT, comm);
+  const auto all = ppc::core::GatherSorted(comm, std::span<const int>(piece));
+  if (all.empty()) {
+    return all;
+  }
+  std::vector<std::span<const int>> runs;
+  size_t begin = 0;
+  for (int c : counts) {
+    runs.emplace_back(all.data() + begin, static_cast<size_t>(c));
+    begin += static_cast<size_t>(c);
+  }
+  std::vector<int> merged(all.size());
+  ppc::core::MultiwayMerge<int>(runs, merged, num_parts, std::less<>(), ppc::core::PoolForEach{});
+  return merged;
+}
+
+}  // namespace
 
 TEST(smirnov_i_radix_sort_simple_merge_all, test_pipeline_run) {
   constexpr int kCount = 10000000;
@@ -101,4 +140,51 @@ TEST(smirnov_i_radix_sort_simple_merge_all, test_task_run) {
   if (world.rank() == 0) {
     ASSERT_EQ(exp_out, out);
   }
-}
\ No newline at end of file
+}
+
+TEST(smirnov_i_radix_sort_simple_merge_all, test_sample_sort_rank_scaling) {
+  // Strong scaling of the sample sort over 1, 2, 4 and 8 ranks (as many as mpirun started),
+  // next to gathering the sorted pieces on rank 0 and merging them there
+  constexpr size_t kCount = 8000000;
+  boost::mpi::communicator world;
+  const auto num_parts = static_cast<size_t>(ppc::util::GetPPCNumThreads());
+  auto local_sort = [](std::span<int> piece) { ppc::core::RadixSort(piece); };
+  double one_rank = 0.0;
+  for (int ranks = 1; ranks <= std::min(8, world.size()); ranks *= 2) {
+    MPI_Comm comm = MPI_COMM_NULL;
+    MPI_Comm_split(MPI_COMM_WORLD, world.rank() < ranks ? 0 : MPI_UNDEFINED, world.rank(), &comm);
+    if (comm != MPI_COMM_NULL) {
+      std::mt19937 gen(static_cast<unsigned>(world.rank()));
+      std::vector<int> piece(kCount / ranks);
+      for (auto &value : piece) {
+        value = static_cast<int>(gen());
+      }
+      std::vector<int> bucket;
+      // Every rank waits for the slowest one, so all of them time the same interval
+      const auto barrier = [comm] { MPI_Barrier(comm); };
+      const double sample_sort_s = ppc::core::BestTaskRun(
+          kCount,
+          [&] {
+            bucket = ppc::core::DistributedSampleSort(comm, piece, local_sort, num_parts, std::less<>(),
+                                                      ppc::core::PoolForEach{});
+          },
+          barrier);
+      const double gather_merge_s =
+          ppc::core::BestTaskRun(kCount, [&] { GatherAndMerge(comm, piece, num_parts); }, barrier);
+      EXPECT_TRUE(std::ranges::is_sorted(bucket));
+      unsigned long long total = bucket.size();
+      MPI_Allreduce(MPI_IN_PLACE, &total, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm);
+      EXPECT_EQ(total, piece.size() * ranks);
+
+      one_rank = ranks == 1 ? sample_sort_s : one_rank;
+      if (world.rank() == 0) {
+        const std::string prefix = "ranks" + std::to_string(ranks);
+        ppc::core::RecordFigure(prefix + "_sample_sort_s", sample_sort_s);
+        ppc::core::RecordFigure(prefix + "_gather_merge_s", gather_merge_s);
+        ppc::core::RecordFigure(prefix + "_speedup", one_rank / sample_sort_s);
+      }
+      MPI_Comm_free(&comm);
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+  }
+}
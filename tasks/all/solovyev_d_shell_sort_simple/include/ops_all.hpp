@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
 #include "core/task/include/task.hpp"
 
 namespace solovyev_d_shell_sort_simple_all {
@@ -17,11 +18,14 @@ class TaskALL : public ppc::core::Task {
   void ShellSort(std::vector<int>& data) const;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
+  // Order of this rank's piece as the pre-pass measured it, and the path its sort took
+  [[nodiscard]] const ppc::core::PresortStats& GetPresortStats() const { return presort_stats_; }
 
  private:
   std::vector<int> input_;
   boost::mpi::communicator world_;
   int num_threads_ = 0;
+  ppc::core::PresortStats presort_stats_;
 };
 
 }  // namespace solovyev_d_shell_sort_simple_all
\ No newline at end of file
@@ -7,10 +7,14 @@
 #include <boost/mpi/communicator.hpp>
 #include <cmath>
 #include <cstddef>
+#include <functional>
+#include <span>
 #include <thread>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 bool solovyev_d_shell_sort_simple_all::TaskALL::PreProcessingImpl() {
@@ -101,7 +105,9 @@ bool solovyev_d_shell_sort_simple_all::TaskALL::RunImpl() {
   int local_size = send_counts[rank];
   std::vector<int> local_data(local_size);
   boost::mpi::scatterv(world_, input_, send_counts, displs, local_data.data(), local_size, 0);
-  solovyev_d_shell_sort_simple_all::TaskALL::ShellSort(local_data);
+  presort_stats_ = ppc::core::AdaptiveSort(
+      std::span<int>(local_data), [&](std::span<int> /*data*/) { ShellSort(local_data); },
+      static_cast<size_t>(num_threads_), std::less<>(), ppc::core::PoolForEach{});
   boost::mpi::gatherv(world_, local_data, input_.data(), send_counts, displs, 0);
   if (rank == 0) {
     FinalMerge(input_, send_counts, displs);
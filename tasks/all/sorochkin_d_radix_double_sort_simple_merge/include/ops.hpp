@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/mpi/communicator.hpp>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -19,8 +20,9 @@ class SortTask : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<double> input_, output_;
-  std::vector<double> procchunk_;
+  // Radix keys of the inputs on rank 0 and of the part this rank sorts
+  std::vector<uint64_t> input_, output_;
+  std::vector<uint64_t> procchunk_;
   boost::mpi::communicator world_;
 };
 
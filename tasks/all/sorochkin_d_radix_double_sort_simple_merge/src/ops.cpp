@@ -14,6 +14,8 @@
 #include <vector>
 
 #include "boost/mpi/collectives/broadcast.hpp"
+#include "core/sort/include/key_transform.hpp"
+#include "core/sort/include/omp_adapters.hpp"
 #include "core/util/include/util.hpp"
 
 namespace {
@@ -26,19 +28,7 @@ constexpr size_t Bits() {
   return Bytes<T>() * CHAR_BIT;
 }
 class Bitutil {
- private:
-  union du64 {
-    double d;
-    uint64_t u;
-    static constexpr uint64_t kMask = 1ULL << ((sizeof(uint64_t) * CHAR_BIT) - 1);
-  };
-
  public:
-  static constexpr uint64_t AsU64(double x) {
-    const du64 r{.d = x};
-    return ((r.u & du64::kMask) != 0U) ? ~r.u : r.u | du64::kMask;
-  }
-
   template <typename T>
     requires std::is_floating_point_v<T> or std::is_integral_v<T>
   static constexpr uint8_t ByteAt(const T &val, uint8_t idx) {
@@ -46,20 +36,20 @@ class Bitutil {
   }
 };
 
-void RadixSort(std::span<double> v) {
+// Sorts radix keys of ppc::core::ToRadixKeys, their bytes are the digits as they are
+void RadixSort(std::span<uint64_t> v) {
   constexpr size_t kBase = 1 << CHAR_BIT;
 
-  std::vector<double> aux_buf(v.size());
-  std::span<double> aux{aux_buf};
+  std::vector<uint64_t> aux_buf(v.size());
+  std::span<uint64_t> aux{aux_buf};
 
   std::array<std::size_t, kBase> count;
 
-  for (std::size_t ib = 0; ib < Bytes<double>(); ++ib) {
+  for (std::size_t ib = 0; ib < Bytes<uint64_t>(); ++ib) {
     std::ranges::fill(count, 0);
-    std::ranges::for_each(v, [&](auto el) { ++count[Bitutil::ByteAt(Bitutil::AsU64(el), ib)]; });
+    std::ranges::for_each(v, [&](auto el) { ++count[Bitutil::ByteAt(el, ib)]; });
     std::partial_sum(count.begin(), count.end(), count.begin());
-    std::ranges::for_each(std::ranges::reverse_view(v),
-                          [&](auto el) { aux[--count[Bitutil::ByteAt(Bitutil::AsU64(el), ib)]] = el; });
+    std::ranges::for_each(std::ranges::reverse_view(v), [&](auto el) { aux[--count[Bitutil::ByteAt(el, ib)]] = el; });
     std::swap(v, aux);
   }
 }
@@ -71,16 +61,18 @@ bool sorochkin_d_radix_double_sort_simple_merge_all::SortTask::ValidationImpl()
 
 bool sorochkin_d_radix_double_sort_simple_merge_all::SortTask::PreProcessingImpl() {
   if (world_.rank() == 0) {
-    std::span<double> src = {reinterpret_cast<double *>(task_data->inputs[0]), task_data->inputs_count[0]};
-    input_.assign(src.begin(), src.end());
+    const std::span<const double> src = {reinterpret_cast<double *>(task_data->inputs[0]),
+                                         task_data->inputs_count[0]};
+    input_.resize(src.size());
+    ppc::core::ToRadixKeys(src, std::span<uint64_t>(input_), ppc::core::OmpForEach{.dynamic = false});
     output_.reserve(input_.size());
   }
   return true;
 }
 
 namespace {
-std::vector<std::span<double>> Distribute(std::span<double> arr, std::size_t n) {
-  std::vector<std::span<double>> chunks(n);
+std::vector<std::span<uint64_t>> Distribute(std::span<uint64_t> arr, std::size_t n) {
+  std::vector<std::span<uint64_t>> chunks(n);
   const std::size_t delta = arr.size() / n;
   const std::size_t extra = arr.size() % n;
 
@@ -141,7 +133,7 @@ bool sorochkin_d_radix_double_sort_simple_merge_all::SortTask::RunImpl() {
   auto group = world_.split(0);
 
   if (group.rank() == 0) {
-    std::vector<std::span<double>> procchunks = Distribute(input_, numprocs);
+    std::vector<std::span<uint64_t>> procchunks = Distribute(input_, numprocs);
     procchunk_.assign(procchunks[0].begin(), procchunks[0].end());
     for (int i = 1; i < int(procchunks.size()); i++) {
       const auto &chunk = procchunks[i];
@@ -157,7 +149,7 @@ bool sorochkin_d_radix_double_sort_simple_merge_all::SortTask::RunImpl() {
   }
 
   const auto numthreads = std::min<std::size_t>(procchunk_.size(), ppc::util::GetPPCNumThreads());
-  std::vector<std::span<double>> chunks = Distribute(procchunk_, numthreads);
+  std::vector<std::span<uint64_t>> chunks = Distribute(procchunk_, numthreads);
 
 #pragma omp parallel for
   for (int i = 0; i < static_cast<int>(numthreads); i++) {
@@ -185,7 +177,9 @@ bool sorochkin_d_radix_double_sort_simple_merge_all::SortTask::RunImpl() {
 
 bool sorochkin_d_radix_double_sort_simple_merge_all::SortTask::PostProcessingImpl() {
   if (world_.rank() == 0) {
-    std::ranges::copy(procchunk_, reinterpret_cast<double *>(task_data->outputs[0]));
+    ppc::core::FromRadixKeys(std::span<const uint64_t>(procchunk_),
+                             std::span<double>(reinterpret_cast<double *>(task_data->outputs[0]), procchunk_.size()),
+                             ppc::core::OmpForEach{.dynamic = false});
   }
   return true;
 }
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
 #include "core/task/include/task.hpp"
 
 namespace sotskov_a_shell_sorting_with_simple_merging_all {
@@ -20,12 +21,15 @@ class TestTaskALL : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
+  // Order of this rank's piece as the pre-pass measured it, and the path its sort took
+  [[nodiscard]] const ppc::core::PresortStats& GetPresortStats() const { return presort_stats_; }
 
  private:
   std::vector<int> input_;
   boost::mpi::communicator world_;
   int rank_ = world_.rank();
   int size_ = world_.size();
+  ppc::core::PresortStats presort_stats_;
   void CalculateDistribution(int total, std::vector<int>& counts, std::vector<int>& displs) const;
 };
 
@@ -4,10 +4,14 @@
 #include <boost/mpi/collectives/gatherv.hpp>
 #include <boost/mpi/collectives/scatterv.hpp>
 #include <cstddef>
+#include <functional>
+#include <span>
 #include <thread>
 #include <vector>
 
 #include "boost/mpi/collectives/broadcast.hpp"
+#include "core/sort/include/presortedness.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 void sotskov_a_shell_sorting_with_simple_merging_all::TestTaskALL::CalculateDistribution(
@@ -188,6 +192,8 @@ bool sotskov_a_shell_sorting_with_simple_merging_all::TestTaskALL::ValidationImp
 }
 
 bool sotskov_a_shell_sorting_with_simple_merging_all::TestTaskALL::RunImpl() {
-  ShellSortWithSimpleMerging(input_);
+  presort_stats_ = ppc::core::AdaptiveSort(
+      std::span<int>(input_), [this](std::span<int> /*data*/) { ShellSortWithSimpleMerging(input_); },
+      static_cast<size_t>(ppc::util::GetPPCNumThreads()), std::less<>(), ppc::core::PoolForEach{});
   return true;
 }
\ No newline at end of file
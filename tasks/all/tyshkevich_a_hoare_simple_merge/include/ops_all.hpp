@@ -1,8 +1,6 @@
 #pragma once
 
-#include <oneapi/tbb/parallel_for.h>
 #include <oneapi/tbb/task_arena.h>
-#include <tbb/tbb.h>
 
 #include <algorithm>
 #include <boost/mpi/collectives/broadcast.hpp>  // NOLINT
@@ -13,6 +11,8 @@
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/parallel_quicksort.hpp"
+#include "core/sort/include/tbb_adapters.hpp"
 #include "core/task/include/task.hpp"
 #include "core/util/include/util.hpp"
 
@@ -27,8 +27,6 @@ struct ArrayPiece {
 
   operator std::span<T>() const noexcept { return std::span<T>(first, last); }
 
-  void Concat(const ArrayPiece& other) { last = other.last; }
-
   void Send(boost::mpi::communicator& comm, int dest) {
     comm.send(dest, 0, Size());
     comm.send(dest, 0, first, Size());
@@ -77,59 +75,11 @@ class HoareSortTask : public ppc::core::Task {
   }
 
   void ParallelSort(std::span<T> arr) {
-    const std::size_t concurrency = std::min(arr.size(), std::size_t(ppc::util::GetPPCNumThreads()));
-    if (concurrency == 0) {
-      return;
-    }
-    tbb::task_arena arena(concurrency);
-
-    auto pieces = ArrayPiece<T>::Partition(arr, concurrency);
-
+    const int num_threads = ppc::util::GetPPCNumThreads();
+    oneapi::tbb::task_arena arena(num_threads);
     arena.execute([&] {
-      oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<std::size_t>(0, concurrency, 1), [&](const auto& r) {
-        for (std::size_t tnum = r.begin(); tnum < r.end(); tnum++) {
-          auto& piece = pieces[tnum];
-          HoareSort(piece, 0, piece.Size() - 1);
-        }
-      });
+      ppc::core::ParallelQuickSort(arr, num_threads, cmp_, ppc::core::TbbInvoke{}, ppc::core::TbbForEach{});
     });
-
-    std::size_t leap = 1;
-    for (std::size_t reduc = concurrency; reduc > 1; reduc /= 2) {
-      const auto dl = 2 * leap;
-      const auto nextreduc = reduc / 2;
-
-      arena.execute([&] {
-        oneapi::tbb::parallel_for(
-            oneapi::tbb::blocked_range<std::size_t>(0, nextreduc,
-                                                    (pieces[0].Size() > kParallelizeThreshold)
-                                                        ? nextreduc / tbb::this_task_arena::max_concurrency()
-                                                        : nextreduc),
-            [&](const tbb::blocked_range<std::size_t>& r) {
-              for (std::size_t g = r.begin(); g < r.end(); ++g) {
-                auto& head = pieces[dl * g];
-                auto& tail = pieces[(dl * g) + leap];
-                std::inplace_merge(head.first, tail.first, tail.last, cmp_);
-                head.Concat(tail);
-              }
-            });
-      });
-      if (nextreduc % 2 != 0) {
-        ArrayPiece<T>* head = nullptr;
-        ArrayPiece<T>* tail = nullptr;
-        if (nextreduc == 1) {
-          head = &pieces.front();
-          tail = &pieces.back();
-        } else {
-          head = &pieces[dl * (nextreduc - 2)];
-          tail = &pieces[dl * (nextreduc - 1)];
-        }
-        std::inplace_merge(head->first, tail->first, tail->last, cmp_);
-        head->Concat(*tail);
-      }
-
-      leap *= 2;
-    }
   }
 
   bool RunImpl() override {
@@ -200,26 +150,6 @@ class HoareSortTask : public ppc::core::Task {
   }
 
  private:
-  void HoareSort(std::span<T> arr, int64_t low, int64_t high) {
-    const auto partition = [&cmp = this->cmp_](std::span<T> region, int64_t plo, int64_t phi) -> int64_t {
-      const auto& pivot = region[phi];
-      int64_t e = plo - 1;
-      for (int64_t j = plo; j <= phi - 1; j++) {
-        if (cmp(region[j], pivot)) {
-          std::swap(region[++e], region[j]);
-        }
-      }
-      std::swap(region[e + 1], region[phi]);
-      return e + 1;
-    };
-
-    if (low < high) {
-      int64_t p = partition(arr, low, high);
-      HoareSort(arr, low, p - 1);
-      HoareSort(arr, p + 1, high);
-    }
-  };
-
   Comparator cmp_;
 
   std::span<const T> input_;
@@ -227,8 +157,6 @@ class HoareSortTask : public ppc::core::Task {
   std::vector<T> piece_;
 
   boost::mpi::communicator world_;
-
-  static constexpr std::size_t kParallelizeThreshold = 32;
 };
 
 template <typename T, typename Comparator>
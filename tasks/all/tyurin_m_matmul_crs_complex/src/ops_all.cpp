@@ -1,47 +1,30 @@
 #include "all/tyurin_m_matmul_crs_complex/include/ops_all.hpp"
 
 #include <algorithm>
-#include <cmath>
 #include <complex>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <numeric>
 #include <ranges>
-#include <thread>
-#include <tuple>
 #include <utility>
 #include <vector>
 
-#include "core/util/include/util.hpp"
+#include "core/sparse/include/spgemm.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 #include "mpi.h"
 
 namespace {
-MatrixCRS TransposeMatrixCRS(const MatrixCRS &crs) {
-  const auto new_cols = crs.GetRows();
 
-  MatrixCRS res;
-  res.cols_count = new_cols;
-  res.rowptr.resize(crs.GetCols() + 2);
-  res.colind.resize(crs.colind.size(), 0);
-  res.data.resize(crs.data.size(), 0);
-
-  for (uint32_t i = 0; i < crs.data.size(); ++i) {
-    ++res.rowptr[crs.colind[i] + 2];
-  }
-  for (uint32_t i = 2; i < res.rowptr.size(); ++i) {
-    res.rowptr[i] += res.rowptr[i - 1];
-  }
-  for (uint32_t i = 0; i < new_cols; ++i) {
-    for (uint32_t j = crs.rowptr[i]; j < crs.rowptr[i + 1]; ++j) {
-      const auto new_index = res.rowptr[crs.colind[j] + 1]++;
-      res.data[new_index] = crs.data[j];
-      res.colind[new_index] = i;
-    }
-  }
-  res.rowptr.pop_back();
-
-  return res;
+// Rows of a CRS matrix as the lines of a compressed view
+ppc::core::CompressedView<std::complex<double>, uint32_t> RowsView(const MatrixCRS &matrix) {
+  return {.lines = matrix.GetRows(),
+          .extent = matrix.GetCols(),
+          .ptr = matrix.rowptr,
+          .idx = matrix.colind,
+          .val = matrix.data};
 }
+
 }  // namespace
 
 bool tyurin_m_matmul_crs_complex_all::TestTaskAll::ValidationImpl() {
@@ -59,7 +42,7 @@ bool tyurin_m_matmul_crs_complex_all::TestTaskAll::PreProcessingImpl() {
     return true;
   }
   global_lhs_ = *reinterpret_cast<MatrixCRS *>(task_data->inputs[0]);
-  rhs_ = TransposeMatrixCRS(*reinterpret_cast<MatrixCRS *>(task_data->inputs[1]));
+  rhs_ = *reinterpret_cast<MatrixCRS *>(task_data->inputs[1]);
   return true;
 }
 
@@ -67,62 +50,19 @@ bool tyurin_m_matmul_crs_complex_all::TestTaskAll::RunImpl() {
   int row_offset{};
   int idx_offset{};
   auto local_lhs = Scatter(row_offset, idx_offset);
+  // The received row pointers still count from the start of the global matrix
+  for (auto &ptr : local_lhs.rowptr) {
+    ptr -= static_cast<uint32_t>(idx_offset);
+  }
 
+  // C = A B row by row is the column-wise product B^T A^T, with CRS arrays read as CCS of the transposes
+  auto product = ppc::core::SpGemm(RowsView(rhs_), RowsView(local_lhs), ppc::core::PoolForEach{},
+                                   [](const std::complex<double> &value) { return value != 0.0; });
   MatrixCRS local_res{};
-  local_res.rowptr.resize(local_lhs.GetRows() + 1);
-  local_res.cols_count = rhs_.GetRows();
-
-  const auto rows = local_lhs.GetRows();
-  const auto cols = rhs_.GetRows();
-
-  std::vector<std::vector<std::tuple<std::complex<double>, uint32_t>>> buf(rows);
-
-  const std::size_t nthreads = ppc::util::GetPPCNumThreads();
-  const std::size_t avg = rows / nthreads;
-  const std::size_t nextra = rows % nthreads;
-
-  auto mulrow = [&](uint32_t i) {
-    for (uint32_t j = 0; j < cols; ++j) {
-      auto ii = local_lhs.rowptr[i - row_offset];
-      auto ij = rhs_.rowptr[j];
-      std::complex<double> summul = 0.0;
-      while (ii < local_lhs.rowptr[i + 1 - row_offset] && ij < rhs_.rowptr[j + 1]) {
-        if (local_lhs.colind[ii - idx_offset] < rhs_.colind[ij]) {
-          ++ii;
-        } else if (local_lhs.colind[ii - idx_offset] > rhs_.colind[ij]) {
-          ++ij;
-        } else {
-          summul += local_lhs.data[ii++ - idx_offset] * rhs_.data[ij++];
-        }
-      }
-      if (summul != 0.0) {
-        buf[i - row_offset].emplace_back(summul, j);
-      }
-    }
-  };
-  auto thexec = [&](uint32_t thread_rows_begin, uint32_t thread_rows_end) {
-    for (uint32_t i = row_offset + thread_rows_begin; i < row_offset + thread_rows_end; ++i) {
-      mulrow(i);
-    }
-  };
-
-  std::vector<std::thread> threads(nthreads);
-  uint32_t cur = 0;
-  for (std::size_t t = 0; t < nthreads; t++) {
-    uint32_t forthread = avg + ((t < nextra) ? 1 : 0);
-    threads[t] = std::thread(thexec, cur, cur + forthread);
-    cur += forthread;
-  }
-  std::ranges::for_each(threads, [](auto &thread) { thread.join(); });
-
-  for (uint32_t i = 0; i < rows; i++) {
-    local_res.rowptr[i + 1] = local_res.rowptr[i];
-    for (const auto &[summul, j] : buf[i]) {
-      local_res.data.push_back(summul);
-      local_res.colind.push_back(j);
-      ++local_res.rowptr[i + 1];
-    }
-  }
+  local_res.data = std::move(product.val);
+  local_res.cols_count = rhs_.GetCols();
+  local_res.rowptr = std::move(product.ptr);
+  local_res.colind = std::move(product.idx);
 
   procres_ = Gather(std::move(local_res));
 
@@ -139,7 +79,7 @@ bool tyurin_m_matmul_crs_complex_all::TestTaskAll::PostProcessingImpl() {
 
   MatrixCRS global_res{};
   global_res.rowptr.resize(global_lhs_.GetRows() + 1);
-  global_res.cols_count = rhs_.GetRows();
+  global_res.cols_count = rhs_.GetCols();
   global_res.colind.resize(size);
   global_res.data.resize(size);
 
@@ -9,8 +9,11 @@
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/request.hpp>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 namespace mpi = boost::mpi;
 
 int vavilov_v_cannon_all::CannonALL::FindOptimalGridSize(int size, int n) {
@@ -63,25 +66,19 @@ void vavilov_v_cannon_all::CannonALL::InitialShift(std::vector<double>& local_a,
   int grid_size = num_blocks_;
   int row = rank / grid_size;
   int col = rank % grid_size;
-
-  int send_rank_a = (row * grid_size) + ((col + grid_size - 1) % grid_size);
-  int recv_rank_a = (row * grid_size) + ((col + 1) % grid_size);
-
-  int send_rank_b = col + (grid_size * ((row + grid_size - 1) % grid_size));
-  int recv_rank_b = col + (grid_size * ((row + 1) % grid_size));
-
-  std::vector<double> tmp_a(block_size_ * block_size_);
-  std::vector<double> tmp_b(block_size_ * block_size_);
-  for (int i = 0; i < row; ++i) {
-    world_.send(send_rank_a, 0, local_a.data(), block_size_ * block_size_);
-    world_.recv(recv_rank_a, 0, tmp_a.data(), block_size_ * block_size_);
-    std::swap(local_a, tmp_a);
+  int count = block_size_ * block_size_;
+
+  // The skew in one hop: the A block of (row, col) goes row blocks left, the B block col blocks up.
+  // Blocks are exchanged in place, so large blocks cannot deadlock on unbuffered sends either.
+  if (row != 0) {
+    int dest = (row * grid_size) + ((col + grid_size - row) % grid_size);
+    int source = (row * grid_size) + ((col + row) % grid_size);
+    MPI_Sendrecv_replace(local_a.data(), count, MPI_DOUBLE, dest, 0, source, 0, world_, MPI_STATUS_IGNORE);
   }
-
-  for (int i = 0; i < col; ++i) {
-    world_.send(send_rank_b, 1, local_b.data(), block_size_ * block_size_);
-    world_.recv(recv_rank_b, 1, tmp_b.data(), block_size_ * block_size_);
-    std::swap(local_b, tmp_b);
+  if (col != 0) {
+    int dest = col + (grid_size * ((row + grid_size - col) % grid_size));
+    int source = col + (grid_size * ((row + col) % grid_size));
+    MPI_Sendrecv_replace(local_b.data(), count, MPI_DOUBLE, dest, 1, source, 1, world_, MPI_STATUS_IGNORE);
   }
 }
 
@@ -90,6 +87,7 @@ void vavilov_v_cannon_all::CannonALL::ShiftBlocks(std::vector<double>& local_a,
   int grid_size = num_blocks_;
   int row = rank / grid_size;
   int col = rank % grid_size;
+  int count = block_size_ * block_size_;
 
   int send_rank_a = (row * grid_size) + ((col + grid_size - 1) % grid_size);
   int recv_rank_a = (row * grid_size) + ((col + 1) % grid_size);
@@ -97,29 +95,21 @@ void vavilov_v_cannon_all::CannonALL::ShiftBlocks(std::vector<double>& local_a,
   int send_rank_b = col + (grid_size * ((row + grid_size - 1) % grid_size));
   int recv_rank_b = col + (grid_size * ((row + 1) % grid_size));
 
-  std::vector<double> tmp_a(block_size_ * block_size_);
-  std::vector<double> tmp_b(block_size_ * block_size_);
-
-  world_.send(send_rank_a, 2, local_a.data(), block_size_ * block_size_);
-  world_.recv(recv_rank_a, 2, tmp_a.data(), block_size_ * block_size_);
-  std::swap(local_a, tmp_a);
-
-  world_.send(send_rank_b, 3, local_b.data(), block_size_ * block_size_);
-  world_.recv(recv_rank_b, 3, tmp_b.data(), block_size_ * block_size_);
-  std::swap(local_b, tmp_b);
+  MPI_Sendrecv_replace(local_a.data(), count, MPI_DOUBLE, send_rank_a, 2, recv_rank_a, 2, world_, MPI_STATUS_IGNORE);
+  MPI_Sendrecv_replace(local_b.data(), count, MPI_DOUBLE, send_rank_b, 3, recv_rank_b, 3, world_, MPI_STATUS_IGNORE);
 }
 
 void vavilov_v_cannon_all::CannonALL::BlockMultiply(const std::vector<double>& local_a,
                                                     const std::vector<double>& local_b, std::vector<double>& local_c) {
+  // Threads take strips of rows of the local block, each a packed GEMM of its own
+  constexpr int kStripRows = 48;
+  const int strips = (block_size_ + kStripRows - 1) / kStripRows;
 #pragma omp parallel for
-  for (int i = 0; i < block_size_; ++i) {
-    for (int j = 0; j < block_size_; ++j) {
-      double temp = 0.0;
-      for (int k = 0; k < block_size_; ++k) {
-        temp += local_a[(i * block_size_) + k] * local_b[(k * block_size_) + j];
-      }
-      local_c[(i * block_size_) + j] += temp;
-    }
+  for (int strip = 0; strip < strips; ++strip) {
+    const int row = strip * kStripRows;
+    const size_t offset = static_cast<size_t>(row) * block_size_;
+    ppc::core::Gemm(std::min(kStripRows, block_size_ - row), block_size_, block_size_, &local_a[offset], block_size_,
+                    local_b.data(), block_size_, &local_c[offset], block_size_);
   }
 }
 
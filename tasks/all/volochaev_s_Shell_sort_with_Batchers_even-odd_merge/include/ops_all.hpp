@@ -2,6 +2,7 @@
 
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -11,7 +12,7 @@ namespace volochaev_s_shell_sort_with_batchers_even_odd_merge_all {
 
 class ShellSortAll : public ppc::core::Task {
  private:
-  std::vector<long long int> mas_, tmp_, loc_, loc_tmp_;
+  std::vector<int64_t> mas_, tmp_, loc_, loc_tmp_;
   unsigned int n_, n_input_, loc_proc_lenght_;
   bool flag_;
   int effective_num_procs_;
@@ -24,10 +25,11 @@ class ShellSortAll : public ppc::core::Task {
     };
   }
 
-  bool ShellSort(unsigned int, unsigned int);
-  static bool OddEvenMergeOMP(long long int *, long long int *, const long long int *, unsigned int);
+  // Leaf sort of loc_[start, start + size) through the vectorized sorting network
+  void SortBlock(unsigned int start, unsigned int size);
+  // SIMD bitonic merge of runs[0, len) and runs[len, 2 * len) into out
+  static void MergeRuns(const int64_t *runs, int64_t *out, unsigned int len);
   bool OddEvenMergeMPI(unsigned int);
-  bool FinalMergeOMP(unsigned int);
   bool BatcherSortOMP();
   bool PreProcessingImpl() override;
   bool ValidationImpl() override;
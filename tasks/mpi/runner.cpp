@@ -8,6 +8,8 @@
 #include <string>
 #include <utility>
 
+#include "core/trace/include/trace.hpp"
+
 class UnreadMessagesDetector : public ::testing::EmptyTestEventListener {
  public:
   UnreadMessagesDetector(boost::mpi::communicator com) : com_(std::move(com)) {}
@@ -59,6 +61,8 @@ class WorkerTestFailurePrinter : public ::testing::EmptyTestEventListener {
 int main(int argc, char** argv) {
   boost::mpi::environment env(argc, argv);
   boost::mpi::communicator world;
+  // One trace track and one trace file per process
+  ppc::core::trace::SetProcess(world.rank(), "rank " + std::to_string(world.rank()));
 
   ::testing::InitGoogleTest(&argc, argv);
 
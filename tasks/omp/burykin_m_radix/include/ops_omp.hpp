@@ -1,6 +1,5 @@
 #pragma once
 
-#include <array>
 #include <utility>
 #include <vector>
 
@@ -16,10 +15,6 @@ class RadixOMP : public ppc::core::Task {
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
-  static std::array<int, 256> ComputeFrequency(const std::vector<int>& a, int shift);
-  static std::array<int, 256> ComputeIndices(const std::array<int, 256>& count);
-  static void DistributeElements(const std::vector<int>& a, std::vector<int>& b, std::array<int, 256> index, int shift);
-
  private:
   std::vector<int> input_, output_;
 };
@@ -3,9 +3,15 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <functional>
 #include <numbers>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/omp_adapters.hpp"
+#include "core/sort/include/parallel_quicksort.hpp"
+#include "core/util/include/util.hpp"
+
 void deryabin_m_hoare_sort_simple_merge_omp::HoaraSort(std::vector<double>& a, size_t first, size_t last) {
   size_t i = first;
   size_t j = last;
@@ -114,24 +120,13 @@ bool deryabin_m_hoare_sort_simple_merge_omp::HoareSortTaskOpenMP::ValidationImpl
 }
 
 bool deryabin_m_hoare_sort_simple_merge_omp::HoareSortTaskOpenMP::RunImpl() {
-  auto chunk_count = (short)chunk_count_;
-#pragma omp parallel for
-  for (short count = 0; count < chunk_count; count++) {
-    HoaraSort(input_array_A_, count * (short)min_chunk_size_, ((count + 1) * (short)min_chunk_size_) - 1);
-  }
-#pragma omp barrier
-#pragma omp parallel for ordered
-  for (short i = 0; i < (short)(log((double)chunk_count_) / std::numbers::ln2); i++) {
-#pragma omp ordered
-    {
-      for (short j = 0; j < chunk_count; j++) {
-        MergeTwoParts(input_array_A_, j * (short)min_chunk_size_ << (i + 1),
-                      ((j + 1) * (short)min_chunk_size_ << (i + 1)) - 1, dimension_);
-        chunk_count--;
-      }
-    }
+  const int num_threads = ppc::util::GetPPCNumThreads();
+#pragma omp parallel num_threads(num_threads)
+  {
+#pragma omp single
+    ppc::core::ParallelQuickSort(std::span<double>(input_array_A_), num_threads, std::less<>(), ppc::core::OmpInvoke{},
+                                 ppc::core::OmpTaskForEach{});
   }
-#pragma omp barrier
   return true;
 }
 
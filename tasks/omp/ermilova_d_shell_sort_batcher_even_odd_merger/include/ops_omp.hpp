@@ -17,6 +17,8 @@ class OmpTask : public ppc::core::Task {
 
  private:
   std::vector<int> data_;
+  // Other buffer of the merge rounds, reused from run to run
+  std::vector<int> scratch_;
 };
 
 }  // namespace ermilova_d_shell_sort_batcher_even_odd_merger_omp
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -22,8 +24,12 @@ class TestTaskOpenmp : public ppc::core::Task {
  private:
   std::vector<int> input_, output_;
 
-  void ShellSort();
-  static void BatcherMerge(std::vector<int>& left, std::vector<int>& right, std::vector<int>& result);
+  // Leaf sort of input_[begin, begin + block_size) through the vectorized sorting network
+  void SortBlock(size_t begin, size_t block_size);
+  // Merges the runs of input_ at begin of width elements each into output_
+  void MergeRuns(size_t begin, size_t width);
+  // SIMD bitonic merge network over two sorted runs
+  static void BatcherMerge(std::span<const int> left, std::span<const int> right, std::span<int> result);
 };
 
 }  // namespace fyodorov_m_shell_sort_with_even_odd_batcher_merge_omp
\ No newline at end of file
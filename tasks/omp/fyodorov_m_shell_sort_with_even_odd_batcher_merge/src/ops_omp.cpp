@@ -1,11 +1,14 @@
 #include "omp/fyodorov_m_shell_sort_with_even_odd_batcher_merge/include/ops_omp.hpp"
 
 #include <omp.h>
-// #include <algorithm>
-#include <cmath>
+
+#include <algorithm>
 #include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/sorting_network.hpp"
+
 namespace fyodorov_m_shell_sort_with_even_odd_batcher_merge_omp {
 
 bool TestTaskOpenmp::PreProcessingImpl() {
@@ -25,13 +28,26 @@ bool TestTaskOpenmp::ValidationImpl() {
 }
 
 bool TestTaskOpenmp::RunImpl() {
-  ShellSort();
+  const size_t n = input_.size();
+  const auto threads_count = static_cast<size_t>(omp_get_max_threads());
+  const size_t block_size = std::max<size_t>(1, (n + threads_count - 1) / threads_count);
+  const auto num_blocks = static_cast<int>((n + block_size - 1) / block_size);
 
-  size_t mid = (input_.size()) / 2;
-  std::vector<int> left(input_.begin(), input_.begin() + static_cast<std::ptrdiff_t>(mid));
-  std::vector<int> right(input_.begin() + static_cast<std::ptrdiff_t>(mid), input_.end());
+#pragma omp parallel for schedule(static)
+  for (int block = 0; block < num_blocks; ++block) {
+    SortBlock(static_cast<size_t>(block) * block_size, block_size);
+  }
 
-  BatcherMerge(left, right, output_);
+  // Merge rounds write to output_ and swap it with input_, so every round reads its runs from input_
+  for (size_t width = block_size; width < n; width *= 2) {
+    const auto num_merges = static_cast<int>((n + (2 * width) - 1) / (2 * width));
+#pragma omp parallel for schedule(static)
+    for (int merge = 0; merge < num_merges; ++merge) {
+      MergeRuns(static_cast<size_t>(merge) * 2 * width, width);
+    }
+    input_.swap(output_);
+  }
+  input_.swap(output_);
 
   return true;
 }
@@ -44,51 +60,21 @@ bool TestTaskOpenmp::PostProcessingImpl() {
   return true;
 }
 
-void TestTaskOpenmp::ShellSort() {
-  int n = static_cast<int>(input_.size());
-  std::vector<int> gaps;
-
-  for (int k = 1; (1 << k) - 1 < n; ++k) {
-    gaps.push_back((1 << k) - 1);
-  }
-
-  auto& input_ref = input_;
-
-  for (auto it = gaps.rbegin(); it != gaps.rend(); ++it) {
-    int gap = *it;
+void TestTaskOpenmp::SortBlock(size_t begin, size_t block_size) {
+  ppc::core::NetworkSort(std::span<int>(input_).subspan(begin, std::min(block_size, input_.size() - begin)));
+}
 
-#pragma omp parallel for schedule(static)
-    for (int base = 0; base < gap; ++base) {
-      for (int i = base + gap; i < n; i += gap) {
-        int temp = input_ref[i];
-        int j = i;
-        while (j >= gap && input_ref[j - gap] > temp) {
-          input_ref[j] = input_ref[j - gap];
-          j -= gap;
-        }
-        input_ref[j] = temp;
-      }
-    }
-  }
+void TestTaskOpenmp::MergeRuns(size_t begin, size_t width) {
+  const size_t n = input_.size();
+  const size_t mid = std::min(begin + width, n);
+  const size_t end = std::min(begin + (2 * width), n);
+  const std::span<const int> runs(input_);
+  BatcherMerge(runs.subspan(begin, mid - begin), runs.subspan(mid, end - mid),
+               std::span<int>(output_).subspan(begin, end - begin));
 }
 
-void TestTaskOpenmp::BatcherMerge(std::vector<int>& left, std::vector<int>& right, std::vector<int>& result) {
-  size_t i = 0;
-  size_t j = 0;
-  size_t k = 0;
-  while (i < left.size() && j < right.size()) {
-    if (left[i] <= right[j]) {
-      result[k++] = left[i++];
-    } else {
-      result[k++] = right[j++];
-    }
-  }
-  while (i < left.size()) {
-    result[k++] = left[i++];
-  }
-  while (j < right.size()) {
-    result[k++] = right[j++];
-  }
+void TestTaskOpenmp::BatcherMerge(std::span<const int> left, std::span<const int> right, std::span<int> result) {
+  ppc::core::BitonicMerge<int>(left, right, result);
 }
 
 }  // namespace fyodorov_m_shell_sort_with_even_odd_batcher_merge_omp
\ No newline at end of file
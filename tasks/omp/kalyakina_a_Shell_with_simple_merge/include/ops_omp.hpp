@@ -3,6 +3,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kalyakina_a_shell_with_simple_merge_omp {
@@ -11,6 +12,7 @@ class ShellSortOpenMP : public ppc::core::Task {
   static std::vector<unsigned int> CalculationOfGapLengths(unsigned int size);
   void ShellSort(unsigned int left, unsigned int right);
   void SimpleMergeSort(unsigned int left, unsigned int middle, unsigned int right);
+  void SortAndMerge();
 
  public:
   explicit ShellSortOpenMP(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
@@ -18,11 +20,14 @@ class ShellSortOpenMP : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
+  // Order of the input as the pre-pass measured it, and the path the sort took
+  [[nodiscard]] const ppc::core::PresortStats& GetPresortStats() const { return presort_stats_; }
 
  private:
   std::vector<int> input_;
   std::vector<int> output_;
   std::vector<unsigned int> Sedgwick_sequence_;
+  ppc::core::PresortStats presort_stats_;
 };
 
 }  // namespace kalyakina_a_shell_with_simple_merge_omp
\ No newline at end of file
@@ -4,9 +4,15 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <functional>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/omp_adapters.hpp"
+#include "core/sort/include/presortedness.hpp"
+
 std::vector<unsigned int> kalyakina_a_shell_with_simple_merge_omp::ShellSortOpenMP::CalculationOfGapLengths(
     unsigned int size) {
   std::vector<unsigned int> result;
@@ -78,6 +84,13 @@ bool kalyakina_a_shell_with_simple_merge_omp::ShellSortOpenMP::ValidationImpl()
 }
 
 bool kalyakina_a_shell_with_simple_merge_omp::ShellSortOpenMP::RunImpl() {
+  presort_stats_ =
+      ppc::core::AdaptiveSort(std::span<int>(output_), [this](std::span<int> /*data*/) { SortAndMerge(); },
+                              static_cast<size_t>(omp_get_max_threads()), std::less<>(), ppc::core::OmpForEach{});
+  return true;
+}
+
+void kalyakina_a_shell_with_simple_merge_omp::ShellSortOpenMP::SortAndMerge() {
   std::vector<std::pair<unsigned int, unsigned int>> bounds;
   unsigned int num = (static_cast<unsigned int>(omp_get_max_threads()) > output_.size())
                          ? output_.size()
@@ -110,7 +123,6 @@ bool kalyakina_a_shell_with_simple_merge_omp::ShellSortOpenMP::RunImpl() {
     }
     num = std::ceil(static_cast<double>(num) / 2);
   }
-  return true;
 }
 
 bool kalyakina_a_shell_with_simple_merge_omp::ShellSortOpenMP::PostProcessingImpl() {
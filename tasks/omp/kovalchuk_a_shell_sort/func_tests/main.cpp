@@ -1,9 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <numeric>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
 #include "core/task/include/task.hpp"
 #include "omp/kovalchuk_a_shell_sort/include/ops_omp.hpp"
 
@@ -192,4 +195,25 @@ TEST(kovalchuk_a_shell_sort_omp, Test_DoubleReverseOrder) {
 
   std::vector<int> expected = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
   EXPECT_EQ(expected, output);
-}
\ No newline at end of file
+}
+
+TEST(kovalchuk_a_shell_sort_omp, Test_ReversedInputReportsPresortPath) {
+  constexpr size_t kSize = 1000;
+  std::vector<int> input(kSize);
+  std::iota(input.rbegin(), input.rend(), 0);
+  std::vector<int> output(kSize);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(input.data()));
+  task_data->inputs_count.emplace_back(input.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t*>(output.data()));
+  task_data->outputs_count.emplace_back(output.size());
+
+  kovalchuk_a_shell_sort_omp::ShellSortOMP task(task_data);
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  EXPECT_EQ(task.GetPresortStats().path, ppc::core::PresortPath::kReversed);
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kovalchuk_a_shell_sort_omp {
@@ -12,9 +13,12 @@ class ShellSortOMP : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
+  // Order of the input as the pre-pass measured it, and the path the sort took
+  [[nodiscard]] const ppc::core::PresortStats& GetPresortStats() const { return presort_stats_; }
 
  private:
   std::vector<int> input_;
+  ppc::core::PresortStats presort_stats_;
   void ShellSort();
 };
 
@@ -3,9 +3,14 @@
 #include <omp.h>
 
 #include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/omp_adapters.hpp"
+#include "core/sort/include/presortedness.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kovalchuk_a_shell_sort_omp {
@@ -24,7 +29,9 @@ bool ShellSortOMP::ValidationImpl() {
 }
 
 bool ShellSortOMP::RunImpl() {
-  ShellSort();
+  presort_stats_ =
+      ppc::core::AdaptiveSort(std::span<int>(input_), [this](std::span<int> /*data*/) { ShellSort(); },
+                              static_cast<size_t>(omp_get_max_threads()), std::less<>(), ppc::core::OmpForEach{});
   return true;
 }
 
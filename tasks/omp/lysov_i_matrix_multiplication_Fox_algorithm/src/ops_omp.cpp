@@ -7,6 +7,8 @@
 #include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 void lysov_i_matrix_multiplication_fox_algorithm_omp::ProcessBlock(const std::vector<double> &a,
                                                                    const std::vector<double> &b, std::vector<double> &c,
                                                                    std::size_t i, std::size_t j,
@@ -19,23 +21,7 @@ void lysov_i_matrix_multiplication_fox_algorithm_omp::ProcessBlock(const std::ve
   double *c_ptr = &c[((i * block_size) * n) + (j * block_size)];
   const double *a_ptr = &a[((i * block_size) * n) + (a_block_row * block_size)];
   const double *b_ptr = &b[((a_block_row * block_size) * n) + (j * block_size)];
-
-  for (std::size_t ii = 0; ii < block_h; ++ii) {
-    for (std::size_t jj = 0; jj < block_w; ++jj) {
-      double sum = 0.0;
-      const double *a_row = a_ptr + (ii * n);
-      const double *b_col = b_ptr + (jj);
-
-      for (std::size_t kk = 0; kk + 1 < block_k; kk += 2) {
-        sum += a_row[kk] * b_col[kk * n] + a_row[kk + 1] * b_col[(kk + 1) * n];
-      }
-      if (block_k % 2 != 0) {
-        sum += a_row[block_k - 1] * b_col[(block_k - 1) * n];
-      }
-
-      c_ptr[(ii * n) + jj] += sum;
-    }
-  }
+  ppc::core::Gemm(block_h, block_w, block_k, a_ptr, n, b_ptr, n, c_ptr, n);
 }
 // Init value
 bool lysov_i_matrix_multiplication_fox_algorithm_omp::TestTaskOpenMP::PreProcessingImpl() {
@@ -2,8 +2,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 bool moiseev_a_mult_mat_omp::MultMatOMP::PreProcessingImpl() {
   unsigned int input_size_a = task_data->inputs_count[0];
   unsigned int input_size_b = task_data->inputs_count[1];
@@ -37,28 +40,13 @@ bool moiseev_a_mult_mat_omp::MultMatOMP::ValidationImpl() {
 bool moiseev_a_mult_mat_omp::MultMatOMP::RunImpl() {
 #pragma omp parallel for
   for (int i_block = 0; i_block < num_blocks_; ++i_block) {
-    for (int j_block = 0; j_block < num_blocks_; ++j_block) {
-      for (int s = 0; s < num_blocks_; ++s) {
-        int a_block_j = (i_block + s) % num_blocks_;
-        int b_block_i = a_block_j;
-
-        int i_start = i_block * block_size_;
-        int j_start = j_block * block_size_;
-        int a_j_start = a_block_j * block_size_;
-        int b_i_start = b_block_i * block_size_;
-
-        for (int i = 0; i < block_size_; ++i) {
-          for (int j = 0; j < block_size_; ++j) {
-            double sum = 0.0;
-            for (int k = 0; k < block_size_; ++k) {
-              double a_val = matrix_a_[((i_start + i) * matrix_size_) + (a_j_start + k)];
-              double b_val = matrix_b_[((b_i_start + k) * matrix_size_) + (j_start + j)];
-              sum += a_val * b_val;
-            }
-            matrix_c_[((i_start + i) * matrix_size_) + (j_start + j)] += sum;
-          }
-        }
-      }
+    // One strip GEMM per step covers every block column of the row (they share the block of A)
+    for (int s = 0; s < num_blocks_; ++s) {
+      const auto row_start = static_cast<size_t>(i_block) * block_size_;
+      const auto a_col_start = static_cast<size_t>((i_block + s) % num_blocks_) * block_size_;
+      ppc::core::Gemm(block_size_, matrix_size_, block_size_, &matrix_a_[(row_start * matrix_size_) + a_col_start],
+                      matrix_size_, &matrix_b_[a_col_start * matrix_size_], matrix_size_,
+                      &matrix_c_[row_start * matrix_size_], matrix_size_);
     }
   }
   return true;
@@ -4,12 +4,14 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <random>
 #include <vector>
 
 #include "../include/ops_omp.hpp"
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/scaling.hpp"
 #include "core/task/include/task.hpp"
 
 namespace {
@@ -101,4 +103,47 @@ TEST(nikolaev_r_hoare_sort_simple_merge_omp, test_task_run) {
   std::ranges::sort(ref);
 
   EXPECT_EQ(out, ref);
-}
\ No newline at end of file
+}
+
+TEST(nikolaev_r_hoare_sort_simple_merge_omp, test_scaling) {
+  constexpr size_t kLen = 200000;
+
+  // Every created task keeps pointers into its buffers, and a deque never moves its elements
+  std::deque<std::vector<double>> inputs;
+  std::deque<std::vector<double>> outputs;
+  auto factory = [&](int input_scale) {
+    inputs.push_back(GenerateRandomVector(kLen * static_cast<size_t>(input_scale)));
+    outputs.emplace_back(inputs.back().size(), 0.0);
+
+    auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+    task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(inputs.back().data()));
+    task_data_omp->inputs_count.emplace_back(inputs.back().size());
+    task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t *>(outputs.back().data()));
+    task_data_omp->outputs_count.emplace_back(outputs.back().size());
+    return std::make_shared<nikolaev_r_hoare_sort_simple_merge_omp::HoareSortSimpleMergeOpenMP>(task_data_omp);
+  };
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 3;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  // Thread ladder 1, 2, 4, ... up to the hardware concurrency, once with a fixed and once with a growing input
+  for (auto kind : {ppc::core::ScalingAttr::kStrong, ppc::core::ScalingAttr::kWeak}) {
+    ppc::core::ScalingAttr scaling_attr;
+    scaling_attr.kind = kind;
+    const auto points = ppc::core::ScalingSweep(factory, scaling_attr).Run(perf_attr);
+    ppc::core::ScalingSweep::PrintScaling(points, kind);
+    ASSERT_FALSE(points.empty());
+    EXPECT_EQ(points.back().input_scale, kind == ppc::core::ScalingAttr::kWeak ? points.back().num_threads : 1);
+  }
+
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    std::ranges::sort(inputs[i]);
+    EXPECT_EQ(outputs[i], inputs[i]);
+  }
+}
@@ -1,6 +1,17 @@
 #include <gtest/gtest.h>
+#include <omp.h>
+
+#include "core/util/include/omp_affinity.hpp"
+#include "core/util/include/util.hpp"
 
 int main(int argc, char **argv) {
+  ppc::util::PinOpenMPThreads(omp_get_max_threads());
+  // Apply thread counts of scaling sweeps to the OpenMP runtime
+  ppc::util::AddNumThreadsHandler([](int num_threads) {
+    omp_set_num_threads(num_threads);
+    ppc::util::PinOpenMPThreads(num_threads);
+  });
+
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
 }
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
 #include "core/task/include/task.hpp"
 
 namespace shlyakov_m_shell_sort_omp {
@@ -19,9 +20,14 @@ class TestTaskOpenMP : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
+  // Order of the input as the pre-pass measured it, and the path the sort took
+  [[nodiscard]] const ppc::core::PresortStats& GetPresortStats() const { return presort_stats_; }
 
  private:
+  void SortAndMerge();
+
   std::vector<int> input_, output_;
+  ppc::core::PresortStats presort_stats_;
 };
 
 }  // namespace shlyakov_m_shell_sort_omp
\ No newline at end of file
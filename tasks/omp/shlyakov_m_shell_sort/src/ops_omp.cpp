@@ -4,8 +4,13 @@
 
 #include <cmath>
 #include <cstddef>
+#include <functional>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/omp_adapters.hpp"
+#include "core/sort/include/presortedness.hpp"
+
 bool shlyakov_m_shell_sort_omp::TestTaskOpenMP::PreProcessingImpl() {
   std::size_t input_size = task_data->inputs_count[0];
   auto* in_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
@@ -21,6 +26,14 @@ bool shlyakov_m_shell_sort_omp::TestTaskOpenMP::ValidationImpl() {
 }
 
 bool shlyakov_m_shell_sort_omp::TestTaskOpenMP::RunImpl() {
+  presort_stats_ =
+      ppc::core::AdaptiveSort(std::span<int>(input_), [this](std::span<int> /*data*/) { SortAndMerge(); },
+                              static_cast<size_t>(omp_get_max_threads()), std::less<>(), ppc::core::OmpForEach{});
+  output_ = input_;
+  return true;
+}
+
+void shlyakov_m_shell_sort_omp::TestTaskOpenMP::SortAndMerge() {
   int array_size = static_cast<int>(input_.size());
   int num_threads = omp_get_max_threads();
   int sub_arr_size = (array_size + num_threads - 1) / num_threads;
@@ -52,9 +65,6 @@ bool shlyakov_m_shell_sort_omp::TestTaskOpenMP::RunImpl() {
       }
     }
   }
-
-  output_ = input_;
-  return true;
 }
 
 namespace shlyakov_m_shell_sort_omp {
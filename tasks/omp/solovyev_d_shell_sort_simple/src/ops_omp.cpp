@@ -1,9 +1,16 @@
 #include "omp/solovyev_d_shell_sort_simple/include/ops_omp.hpp"
 
+#include <omp.h>
+
 #include <cmath>
 #include <cstddef>
+#include <functional>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/omp_adapters.hpp"
+#include "core/sort/include/presortedness.hpp"
+
 bool solovyev_d_shell_sort_simple_omp::TaskOMP::PreProcessingImpl() {
   unsigned int input_size = task_data->inputs_count[0];
   auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
@@ -17,6 +24,13 @@ bool solovyev_d_shell_sort_simple_omp::TaskOMP::ValidationImpl() {
 }
 
 bool solovyev_d_shell_sort_simple_omp::TaskOMP::RunImpl() {
+  presort_stats_ =
+      ppc::core::AdaptiveSort(std::span<int>(input_), [this](std::span<int> /*data*/) { ShellSort(); },
+                              static_cast<size_t>(omp_get_max_threads()), std::less<>(), ppc::core::OmpForEach{});
+  return true;
+}
+
+void solovyev_d_shell_sort_simple_omp::TaskOMP::ShellSort() {
   for (int gap = (int)input_.size() / 2; gap > 0; gap /= 2) {
 #pragma omp parallel for
     for (int i = 0; i < gap; i++) {
@@ -31,8 +45,8 @@ bool solovyev_d_shell_sort_simple_omp::TaskOMP::RunImpl() {
       }
     }
   }
-  return true;
 }
+
 bool solovyev_d_shell_sort_simple_omp::TaskOMP::PostProcessingImpl() {
   for (size_t i = 0; i < input_.size(); i++) {
     reinterpret_cast<int *>(task_data->outputs[0])[i] = input_[i];
@@ -12,6 +12,8 @@
 #include <span>
 #include <vector>
 
+#include "core/sort/include/key_transform.hpp"
+#include "core/sort/include/omp_adapters.hpp"
 #include "core/util/include/util.hpp"
 
 namespace {
@@ -24,19 +26,7 @@ constexpr size_t Bits() {
   return Bytes<T>() * CHAR_BIT;
 }
 class Bitutil {
- private:
-  union du64 {
-    double d;
-    uint64_t u;
-    static constexpr uint64_t kMask = 1ULL << ((sizeof(uint64_t) * CHAR_BIT) - 1);
-  };
-
  public:
-  static constexpr uint64_t AsU64(double x) {
-    const du64 r{.d = x};
-    return ((r.u & du64::kMask) != 0U) ? ~r.u : r.u | du64::kMask;
-  }
-
   template <typename T>
     requires std::is_floating_point_v<T> or std::is_integral_v<T>
   static constexpr uint8_t ByteAt(const T &val, uint8_t idx) {
@@ -44,20 +34,20 @@ class Bitutil {
   }
 };
 
-void RadixSort(std::span<double> v) {
+// Sorts radix keys of ppc::core::ToRadixKeys, their bytes are the digits as they are
+void RadixSort(std::span<uint64_t> v) {
   constexpr size_t kBase = 1 << CHAR_BIT;
 
-  std::vector<double> aux_buf(v.size());
-  std::span<double> aux{aux_buf};
+  std::vector<uint64_t> aux_buf(v.size());
+  std::span<uint64_t> aux{aux_buf};
 
   std::array<std::size_t, kBase> count;
 
-  for (std::size_t ib = 0; ib < Bytes<double>(); ++ib) {
+  for (std::size_t ib = 0; ib < Bytes<uint64_t>(); ++ib) {
     std::ranges::fill(count, 0);
-    std::ranges::for_each(v, [&](auto el) { ++count[Bitutil::ByteAt(Bitutil::AsU64(el), ib)]; });
+    std::ranges::for_each(v, [&](auto el) { ++count[Bitutil::ByteAt(el, ib)]; });
     std::partial_sum(count.begin(), count.end(), count.begin());
-    std::ranges::for_each(std::ranges::reverse_view(v),
-                          [&](auto el) { aux[--count[Bitutil::ByteAt(Bitutil::AsU64(el), ib)]] = el; });
+    std::ranges::for_each(std::ranges::reverse_view(v), [&](auto el) { aux[--count[Bitutil::ByteAt(el, ib)]] = el; });
     std::swap(v, aux);
   }
 }
@@ -68,8 +58,9 @@ bool sorochkin_d_radix_double_sort_simple_merge_omp::SortTask::ValidationImpl()
 }
 
 bool sorochkin_d_radix_double_sort_simple_merge_omp::SortTask::PreProcessingImpl() {
-  std::span<double> src = {reinterpret_cast<double *>(task_data->inputs[0]), task_data->inputs_count[0]};
-  input_.assign(src.begin(), src.end());
+  const std::span<const double> src = {reinterpret_cast<double *>(task_data->inputs[0]), task_data->inputs_count[0]};
+  input_.resize(src.size());
+  ppc::core::ToRadixKeys(src, std::span<uint64_t>(input_), ppc::core::OmpForEach{.dynamic = false});
   output_.reserve(input_.size());
   return true;
 }
@@ -90,7 +81,7 @@ bool sorochkin_d_radix_double_sort_simple_merge_omp::SortTask::RunImpl() {
     std::partial_sum(distrib.begin(), distrib.end() - 1, offsets.begin() + 1);
   }
 
-  std::vector<std::span<double>> chunks(numthreads);
+  std::vector<std::span<uint64_t>> chunks(numthreads);
   std::ranges::generate(chunks, [&, i = 0]() mutable {
     const auto j = i++;
     return std::span{output_}.subspan(offsets[j], distrib[j]);
@@ -104,7 +95,7 @@ bool sorochkin_d_radix_double_sort_simple_merge_omp::SortTask::RunImpl() {
   for (std::size_t i = 1, j = numthreads; j > 1; i *= 2, j /= 2) {
     const auto multithreaded = chunks.front().size() > 48;
     const auto jh = j / 2;
-    const auto merge = [&](std::span<double> &master, std::span<double> &slave) {
+    const auto merge = [&](std::span<uint64_t> &master, std::span<uint64_t> &slave) {
       std::inplace_merge(master.begin(), slave.begin(), slave.end());
       master = std::span{master.begin(), slave.end()};
     };
@@ -124,6 +115,8 @@ bool sorochkin_d_radix_double_sort_simple_merge_omp::SortTask::RunImpl() {
 }
 
 bool sorochkin_d_radix_double_sort_simple_merge_omp::SortTask::PostProcessingImpl() {
-  std::ranges::copy(output_, reinterpret_cast<double *>(task_data->outputs[0]));
+  ppc::core::FromRadixKeys(std::span<const uint64_t>(output_),
+                           std::span<double>(reinterpret_cast<double *>(task_data->outputs[0]), output_.size()),
+                           ppc::core::OmpForEach{.dynamic = false});
   return true;
 }
@@ -3,6 +3,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
 #include "core/task/include/task.hpp"
 
 namespace sotskov_a_shell_sorting_with_simple_merging_omp {
@@ -27,8 +28,11 @@ class TestTaskOpenMP : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
+  // Order of the input as the pre-pass measured it, and the path the sort took
+  [[nodiscard]] const ppc::core::PresortStats& GetPresortStats() const { return presort_stats_; }
 
  private:
   std::vector<int> input_, result_;
+  ppc::core::PresortStats presort_stats_;
 };
 }  // namespace sotskov_a_shell_sorting_with_simple_merging_omp
\ No newline at end of file
@@ -4,8 +4,13 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/omp_adapters.hpp"
+#include "core/sort/include/presortedness.hpp"
+
 void sotskov_a_shell_sorting_with_simple_merging_omp::ShellSort(std::vector<int>& arr, int left, int right) {
   int array_size = right - left + 1;
 
@@ -103,7 +108,9 @@ bool sotskov_a_shell_sorting_with_simple_merging_omp::TestTaskOpenMP::Validation
 }
 
 bool sotskov_a_shell_sorting_with_simple_merging_omp::TestTaskOpenMP::RunImpl() {
-  ShellSortWithSimpleMerging(input_);
+  presort_stats_ = ppc::core::AdaptiveSort(
+      std::span<int>(input_), [this](std::span<int> /*data*/) { ShellSortWithSimpleMerging(input_); },
+      static_cast<size_t>(omp_get_max_threads()), std::less<>(), ppc::core::OmpForEach{});
   return true;
 }
 
@@ -1,39 +1,26 @@
 #include "omp/tyurin_m_matmul_crs_complex/include/ops_omp.hpp"
 
-#include <cmath>
+#include <omp.h>
+
 #include <complex>
+#include <cstddef>
 #include <cstdint>
-#include <cstdio>
-#include <tuple>
-#include <vector>
-
-namespace {
-MatrixCRS TransposeMatrixCRS(const MatrixCRS &crs) {
-  const auto new_cols = crs.GetRows();
+#include <utility>
 
-  MatrixCRS res;
-  res.cols_count = new_cols;
-  res.rowptr.resize(crs.GetCols() + 2);
-  res.colind.resize(crs.colind.size(), 0);
-  res.data.resize(crs.data.size(), 0);
+#include "core/sort/include/omp_adapters.hpp"
+#include "core/sparse/include/spgemm.hpp"
 
-  for (uint32_t i = 0; i < crs.data.size(); ++i) {
-    ++res.rowptr[crs.colind[i] + 2];
-  }
-  for (uint32_t i = 2; i < res.rowptr.size(); ++i) {
-    res.rowptr[i] += res.rowptr[i - 1];
-  }
-  for (uint32_t i = 0; i < new_cols; ++i) {
-    for (uint32_t j = crs.rowptr[i]; j < crs.rowptr[i + 1]; ++j) {
-      const auto new_index = res.rowptr[crs.colind[j] + 1]++;
-      res.data[new_index] = crs.data[j];
-      res.colind[new_index] = i;
-    }
-  }
-  res.rowptr.pop_back();
+namespace {
 
-  return res;
+// Rows of a CRS matrix as the lines of a compressed view
+ppc::core::CompressedView<std::complex<double>, uint32_t> RowsView(const MatrixCRS &matrix) {
+  return {.lines = matrix.GetRows(),
+          .extent = matrix.GetCols(),
+          .ptr = matrix.rowptr,
+          .idx = matrix.colind,
+          .val = matrix.data};
 }
+
 }  // namespace
 
 bool tyurin_m_matmul_crs_complex_omp::TestTaskOpenMP::ValidationImpl() {
@@ -45,49 +32,19 @@ bool tyurin_m_matmul_crs_complex_omp::TestTaskOpenMP::ValidationImpl() {
 
 bool tyurin_m_matmul_crs_complex_omp::TestTaskOpenMP::PreProcessingImpl() {
   lhs_ = *reinterpret_cast<MatrixCRS *>(task_data->inputs[0]);
-  rhs_ = TransposeMatrixCRS(*reinterpret_cast<MatrixCRS *>(task_data->inputs[1]));
+  rhs_ = *reinterpret_cast<MatrixCRS *>(task_data->inputs[1]);
   res_ = {};
-  res_.rowptr.resize(lhs_.GetRows() + 1);
-  res_.cols_count = rhs_.GetRows();
+  res_.cols_count = rhs_.GetCols();
   return true;
 }
 
 bool tyurin_m_matmul_crs_complex_omp::TestTaskOpenMP::RunImpl() {
-  const auto rows = lhs_.GetRows();
-  const auto cols = rhs_.GetRows();
-
-  std::vector<std::vector<std::tuple<std::complex<double>, uint32_t>>> buf(rows);
-
-#pragma omp parallel for
-  for (int i = 0; i < static_cast<int>(rows); ++i) {
-    for (uint32_t j = 0; j < cols; ++j) {
-      auto ii = lhs_.rowptr[i];
-      auto ij = rhs_.rowptr[j];
-      std::complex<double> summul = 0.0;
-      while (ii < lhs_.rowptr[i + 1] && ij < rhs_.rowptr[j + 1]) {
-        if (lhs_.colind[ii] < rhs_.colind[ij]) {
-          ++ii;
-        } else if (lhs_.colind[ii] > rhs_.colind[ij]) {
-          ++ij;
-        } else {
-          summul += lhs_.data[ii++] * rhs_.data[ij++];
-        }
-      }
-      if (summul != 0.0) {
-        buf[i].emplace_back(summul, j);
-      }
-    }
-  }
-
-  for (uint32_t i = 0; i < rows; i++) {
-    res_.rowptr[i + 1] = res_.rowptr[i];
-    for (const auto &[summul, j] : buf[i]) {
-      res_.data.push_back(summul);
-      res_.colind.push_back(j);
-      ++res_.rowptr[i + 1];
-    }
-  }
-
+  // C = A B row by row is the column-wise product B^T A^T, with CRS arrays read as CCS of the transposes
+  auto product = ppc::core::SpGemm(RowsView(rhs_), RowsView(lhs_), ppc::core::OmpForEach{},
+                                   [](const std::complex<double> &value) { return value != 0.0; });
+  res_.data = std::move(product.val);
+  res_.colind = std::move(product.idx);
+  res_.rowptr = std::move(product.ptr);
   return true;
 }
 
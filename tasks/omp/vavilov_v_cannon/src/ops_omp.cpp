@@ -2,8 +2,14 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/gemm/include/cannon_grid.hpp"
+#include "core/gemm/include/gemm.hpp"
+#include "core/trace/include/trace.hpp"
+
 bool vavilov_v_cannon_omp::CannonOMP::PreProcessingImpl() {
   N_ = static_cast<int>(std::sqrt(task_data->inputs_count[0]));
   num_blocks_ = static_cast<int>(task_data->inputs_count[2]);
@@ -11,9 +17,13 @@ bool vavilov_v_cannon_omp::CannonOMP::PreProcessingImpl() {
 
   auto* a = reinterpret_cast<double*>(task_data->inputs[0]);
   auto* b = reinterpret_cast<double*>(task_data->inputs[1]);
-  A_.assign(a, a + (N_ * N_));
-  B_.assign(b, b + (N_ * N_));
-  C_.assign(N_ * N_, 0);
+  // A and B live in block-major tiles for the whole run, Cannon's shifts only remap tile indices
+  const auto size = static_cast<size_t>(N_) * N_;
+  A_.resize(size);
+  B_.resize(size);
+  ppc::core::ToBlockMajor(std::span<const double>(a, size), N_, num_blocks_, A_);
+  ppc::core::ToBlockMajor(std::span<const double>(b, size), N_, num_blocks_, B_);
+  C_.assign(size, 0);
 
   return true;
 }
@@ -29,73 +39,31 @@ bool vavilov_v_cannon_omp::CannonOMP::ValidationImpl() {
   return n % num_blocks == 0;
 }
 
-void vavilov_v_cannon_omp::CannonOMP::InitialShift() {
-  std::vector<double> a_tmp = A_;
-  std::vector<double> b_tmp = B_;
-
-#pragma omp parallel for
-  for (int bi = 0; bi < num_blocks_; ++bi) {
-    for (int bj = 0; bj < num_blocks_; ++bj) {
-      int src_row = (bi + bj) % num_blocks_;
-      int src_col = (bj + bi) % num_blocks_;
-      for (int i = 0; i < block_size_; ++i) {
-        for (int j = 0; j < block_size_; ++j) {
-          B_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              b_tmp[(((src_row * block_size_) + i) * N_) + ((bj * block_size_) + j)];
-          A_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              a_tmp[(((bi * block_size_) + i) * N_) + ((src_col * block_size_) + j)];
-        }
-      }
-    }
-  }
-}
-void vavilov_v_cannon_omp::CannonOMP::BlockMultiply() {
-#pragma omp parallel for
-  for (int bi = 0; bi < num_blocks_; ++bi) {
-    for (int bj = 0; bj < num_blocks_; ++bj) {
-      for (int i = 0; i < block_size_; ++i) {
-        for (int j = 0; j < block_size_; ++j) {
-          double temp = 0.0;
-          for (int k = 0; k < block_size_; ++k) {
-            int row = (bi * block_size_) + i;
-            int col = (bj * block_size_) + j;
-            int k_idx = (bj * block_size_) + k;
-            int k_row = (bi * block_size_) + k;
-            temp += A_[(row * N_) + k_idx] * B_[(k_row * N_) + col];
-          }
-          C_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] += temp;
-        }
-      }
-    }
-  }
-}
-
-void vavilov_v_cannon_omp::CannonOMP::ShiftBlocks() {
-  std::vector<double> a_tmp = A_;
-  std::vector<double> b_tmp = B_;
-
+void vavilov_v_cannon_omp::CannonOMP::BlockMultiply(const ppc::core::CannonGrid& grid) {
+  const size_t tile = static_cast<size_t>(block_size_) * block_size_;
 #pragma omp parallel for
   for (int bi = 0; bi < num_blocks_; ++bi) {
     for (int bj = 0; bj < num_blocks_; ++bj) {
-      int src_row = (bi + 1) % num_blocks_;
-      int src_col = (bj + 1) % num_blocks_;
-      for (int i = 0; i < block_size_; ++i) {
-        for (int j = 0; j < block_size_; ++j) {
-          B_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              b_tmp[(((src_row * block_size_) + i) * N_) + ((bj * block_size_) + j)];
-          A_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              a_tmp[(((bi * block_size_) + i) * N_) + ((src_col * block_size_) + j)];
-        }
-      }
+      const size_t c_offset = (static_cast<size_t>(bi) * block_size_ * N_) + (static_cast<size_t>(bj) * block_size_);
+      ppc::core::Gemm(block_size_, block_size_, block_size_, &A_[grid.ATile(bi, bj) * tile], block_size_,
+                      &B_[grid.BTile(bi, bj) * tile], block_size_, &C_[c_offset], N_);
     }
   }
 }
 
 bool vavilov_v_cannon_omp::CannonOMP::RunImpl() {
-  InitialShift();
+  ppc::core::CannonGrid grid(num_blocks_);
+  {
+    PPC_TRACE_SCOPE("InitialShift");
+    grid.InitialShift();
+  }
   for (int iter = 0; iter < num_blocks_; ++iter) {
-    BlockMultiply();
-    ShiftBlocks();
+    {
+      PPC_TRACE_SCOPE("BlockMultiply");
+      BlockMultiply(grid);
+    }
+    PPC_TRACE_SCOPE("ShiftBlocks");
+    grid.Shift();
   }
   return true;
 }
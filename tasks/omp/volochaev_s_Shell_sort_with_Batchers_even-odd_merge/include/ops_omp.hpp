@@ -23,10 +23,11 @@ class ShellSortOMP : public ppc::core::Task {
   std::vector<int> mass_;
 
   void ParallelShellSort();
-  void ShellSort(int start);
+  // Leaf sort of mass_[start, start + mini_batch_) through the vectorized sorting network
+  void SortBlock(int start);
   void Merge();
-  void LastMerge();
-  void MergeBlocks(int id_l, int id_r, int len);
+  // SIMD bitonic merge of mass_[begin, begin + len) and the next len values into array_
+  void MergeBlocks(int begin, int len);
   void FindThreadVariables();
 };
 
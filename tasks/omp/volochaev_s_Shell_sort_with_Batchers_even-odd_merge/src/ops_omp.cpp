@@ -6,8 +6,10 @@
 #include <cmath>
 #include <limits>
 #include <ranges>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/sorting_network.hpp"
 #include "omp/volochaev_s_Shell_sort_with_Batchers_even-odd_merge/include/ops_omp.hpp"
 
 bool volochaev_s_shell_sort_with_batchers_even_odd_merge_omp::ShellSortOMP::PreProcessingImpl() {
@@ -24,94 +26,28 @@ bool volochaev_s_shell_sort_with_batchers_even_odd_merge_omp::ShellSortOMP::Vali
   return task_data->inputs_count[0] > 0 && task_data->inputs_count[0] == task_data->outputs_count[0];
 }
 
-void volochaev_s_shell_sort_with_batchers_even_odd_merge_omp::ShellSortOMP::ShellSort(int start) {
-  int n = mini_batch_;
-
-  int gap = 1;
-  while (gap < n / 3) {
-    gap = 3 * gap + 1;
-  }
-
-  while (gap >= 1) {
-    for (int i = start + gap; i < start + mini_batch_; ++i) {
-      int temp = mass_[i];
-      int j = i;
-      while (j >= start + gap && mass_[j - gap] > temp) {
-        mass_[j] = mass_[j - gap];
-        j -= gap;
-      }
-      mass_[j] = temp;
-    }
-    gap /= 3;
-  }
+void volochaev_s_shell_sort_with_batchers_even_odd_merge_omp::ShellSortOMP::SortBlock(int start) {
+  ppc::core::NetworkSort(std::span<int>(mass_).subspan(start, mini_batch_));
 }
 
-void volochaev_s_shell_sort_with_batchers_even_odd_merge_omp::ShellSortOMP::MergeBlocks(int id_l, int id_r, int len) {
-  int left_id = 0;
-  int right_id = 0;
-  int merged_id = 0;
-
-  while (left_id < len || right_id < len) {
-    if (left_id < len && right_id < len) {
-      if (mass_[id_l + left_id] < mass_[id_r + right_id]) {
-        array_[id_l + merged_id] = mass_[id_l + left_id];
-        left_id += 2;
-      } else {
-        array_[id_l + merged_id] = mass_[id_r + right_id];
-        right_id += 2;
-      }
-    } else if (left_id < len) {
-      array_[id_l + merged_id] = mass_[id_l + left_id];
-      left_id += 2;
-    } else {
-      array_[id_l + merged_id] = mass_[id_r + right_id];
-      right_id += 2;
-    }
-    merged_id += 2;
-  }
-
-  for (int i = 0; i < merged_id; i += 2) {
-    mass_[id_l + i] = array_[id_l + i];
-  }
-}
-
-void volochaev_s_shell_sort_with_batchers_even_odd_merge_omp::ShellSortOMP::LastMerge() {
-  int even_index = 0;
-  int odd_index = 1;
-  int result_index = 0;
-
-  while (even_index < n_ || odd_index < n_) {
-    if (even_index < n_ && odd_index < n_) {
-      if (mass_[even_index] < mass_[odd_index]) {
-        array_[result_index++] = mass_[even_index];
-        even_index += 2;
-      } else {
-        array_[result_index++] = mass_[odd_index];
-        odd_index += 2;
-      }
-    } else if (even_index < n_) {
-      array_[result_index++] = mass_[even_index];
-      even_index += 2;
-    } else {
-      array_[result_index++] = mass_[odd_index];
-      odd_index += 2;
-    }
-  }
+void volochaev_s_shell_sort_with_batchers_even_odd_merge_omp::ShellSortOMP::MergeBlocks(int begin, int len) {
+  const std::span<const int> runs(mass_);
+  ppc::core::BitonicMerge<int>(runs.subspan(begin, len), runs.subspan(begin + len, len),
+                               std::span<int>(array_).subspan(begin, 2 * len));
 }
 
 void volochaev_s_shell_sort_with_batchers_even_odd_merge_omp::ShellSortOMP::Merge() {
-  for (int i = c_threads_; i > 1; i /= 2) {
-#pragma omp parallel num_threads(i)
-    {
-      int id = omp_get_thread_num() / 2;
-      int ost = omp_get_thread_num() % 2;
-      int l = mini_batch_ * (c_threads_ / i);
-
-      MergeBlocks((id * 2 * l) + ost, (id * 2 * l) + l + ost, l - ost);
+  // Rounds merge neighbouring runs of mass_ into array_ and swap the two buffers, so the sorted
+  // result ends in mass_ and is swapped into array_ at the end
+  for (int len = mini_batch_; len < n_; len *= 2) {
+    const int num_merges = n_ / (2 * len);
+#pragma omp parallel for
+    for (int i = 0; i < num_merges; ++i) {
+      MergeBlocks(i * 2 * len, len);
     }
+    mass_.swap(array_);
   }
-
-  LastMerge();
+  array_.swap(mass_);
 }
 
 void volochaev_s_shell_sort_with_batchers_even_odd_merge_omp::ShellSortOMP::ParallelShellSort() {
@@ -119,7 +55,7 @@ void volochaev_s_shell_sort_with_batchers_even_odd_merge_omp::ShellSortOMP::Para
 
 #pragma omp parallel for
   for (int i = 0; i < c_threads_; ++i) {
-    ShellSort(i * mini_batch_);
+    SortBlock(i * mini_batch_);
   }
 
   Merge();
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -18,8 +20,8 @@ class TestTaskSequential : public ppc::core::Task {
  private:
   std::vector<int> input_, output_;
 
-  void ShellSort();
-  static void BatcherMerge(std::vector<int>& left, std::vector<int>& right, std::vector<int>& result);
+  // SIMD bitonic merge network over two sorted runs
+  static void BatcherMerge(std::span<const int> left, std::span<const int> right, std::span<int> result);
 };
 
 }  // namespace fyodorov_m_shell_sort_with_even_odd_batcher_merge_seq
\ No newline at end of file
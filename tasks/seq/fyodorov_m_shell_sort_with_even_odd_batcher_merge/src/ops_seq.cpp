@@ -1,9 +1,11 @@
 #include "seq/fyodorov_m_shell_sort_with_even_odd_batcher_merge/include/ops_seq.hpp"
 
-#include <cmath>
 #include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/sorting_network.hpp"
+
 namespace fyodorov_m_shell_sort_with_even_odd_batcher_merge_seq {
 
 bool TestTaskSequential::PreProcessingImpl() {
@@ -23,13 +25,11 @@ bool TestTaskSequential::ValidationImpl() {
 }
 
 bool TestTaskSequential::RunImpl() {
-  ShellSort();
-  size_t mid = input_.size() / 2;
-  std::vector<int> left(input_.begin(), input_.begin() + static_cast<std::ptrdiff_t>(mid));
-  std::vector<int> right(input_.begin() + static_cast<std::ptrdiff_t>(mid), input_.end());
-
-  BatcherMerge(left, right, output_);
-
+  const size_t mid = input_.size() / 2;
+  const std::span<int> data(input_);
+  ppc::core::NetworkSort(data.first(mid));
+  ppc::core::NetworkSort(data.subspan(mid));
+  BatcherMerge(data.first(mid), data.subspan(mid), output_);
   return true;
 }
 
@@ -40,48 +40,8 @@ bool TestTaskSequential::PostProcessingImpl() {
   return true;
 }
 
-void TestTaskSequential::ShellSort() {
-  int n = static_cast<int>(input_.size());
-  std::vector<int> gaps;
-
-  for (int k = 1; (1 << k) - 1 < n; ++k) {
-    gaps.push_back((1 << k) - 1);
-  }
-
-  for (auto it = gaps.rbegin(); it != gaps.rend(); ++it) {
-    int gap = *it;
-    for (int i = gap; i < n; ++i) {
-      int temp = input_[i];
-      int j = i;
-      while (j >= gap && input_[j - gap] > temp) {
-        input_[j] = input_[j - gap];
-        j -= gap;
-      }
-      input_[j] = temp;
-    }
-  }
-}
-
-void TestTaskSequential::BatcherMerge(std::vector<int>& left, std::vector<int>& right, std::vector<int>& result) {
-  size_t i = 0;
-  size_t j = 0;
-  size_t k = 0;
-
-  while (i < left.size() && j < right.size()) {
-    if (left[i] <= right[j]) {
-      result[k++] = left[i++];
-    } else {
-      result[k++] = right[j++];
-    }
-  }
-
-  while (i < left.size()) {
-    result[k++] = left[i++];
-  }
-
-  while (j < right.size()) {
-    result[k++] = right[j++];
-  }
+void TestTaskSequential::BatcherMerge(std::span<const int> left, std::span<const int> right, std::span<int> result) {
+  ppc::core::BitonicMerge<int>(left, right, result);
 }
 
 }  // namespace fyodorov_m_shell_sort_with_even_odd_batcher_merge_seq
\ No newline at end of file
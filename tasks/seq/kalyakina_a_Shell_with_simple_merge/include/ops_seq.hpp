@@ -3,6 +3,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kalyakina_a_shell_with_simple_merge_seq {
@@ -18,10 +19,13 @@ class ShellSortSequential : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
+  // Order of the input as the pre-pass measured it, and the path the sort took
+  [[nodiscard]] const ppc::core::PresortStats& GetPresortStats() const { return presort_stats_; }
 
  private:
   std::vector<int> input_;
   std::vector<unsigned int> Sedgwick_sequence_;
+  ppc::core::PresortStats presort_stats_;
 };
 
 }  // namespace kalyakina_a_shell_with_simple_merge_seq
\ No newline at end of file
@@ -3,8 +3,11 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
+
 std::vector<unsigned int> kalyakina_a_shell_with_simple_merge_seq::ShellSortSequential::CalculationOfGapLengths(
     const unsigned int &size) {
   std::vector<unsigned int> result;
@@ -53,7 +56,8 @@ bool kalyakina_a_shell_with_simple_merge_seq::ShellSortSequential::ValidationImp
 }
 
 bool kalyakina_a_shell_with_simple_merge_seq::ShellSortSequential::RunImpl() {
-  ShellSort(input_);
+  presort_stats_ =
+      ppc::core::AdaptiveSort(std::span<int>(input_), [this](std::span<int> /*data*/) { ShellSort(input_); });
   return true;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -17,6 +18,7 @@ class RadixSeq : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<double> input_, output_;
+  // Inputs as radix keys, sorted in place
+  std::vector<uint64_t> keys_;
 };
 }  // namespace khovansky_d_double_radix_batcher_seq
\ No newline at end of file
@@ -4,33 +4,13 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <cstring>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/key_transform.hpp"
+
 namespace khovansky_d_double_radix_batcher_seq {
 namespace {
-uint64_t EncodeDoubleToUint64(double value) {
-  uint64_t bit_representation = 0;
-  std::memcpy(&bit_representation, &value, sizeof(value));
-
-  if ((bit_representation >> 63) != 0) {
-    return ~bit_representation;
-  }
-  return bit_representation ^ (1ULL << 63);
-}
-
-double DecodeUint64ToDouble(uint64_t encoded) {
-  if ((encoded >> 63) != 0) {
-    encoded ^= (1ULL << 63);
-  } else {
-    encoded = ~encoded;
-  }
-
-  double result = 0.0;
-  std::memcpy(&result, &encoded, sizeof(result));
-  return result;
-}
-
 void RadixSort(std::vector<uint64_t>& array) {
   const int bits_in_byte = 8;
   const int total_bits = 64;
@@ -77,19 +57,9 @@ void OddEvenMergeSort(std::vector<uint64_t>& array, int left, int right) {
   }
 }
 
-void RadixBatcherSort(std::vector<double>& data) {
-  std::vector<uint64_t> transformed_data(data.size(), 0);
-
-  for (std::size_t i = 0; i < data.size(); i++) {
-    transformed_data[i] = EncodeDoubleToUint64(data[i]);
-  }
-
-  RadixSort(transformed_data);
-  OddEvenMergeSort(transformed_data, 0, static_cast<int>(transformed_data.size()));
-
-  for (std::size_t i = 0; i < data.size(); i++) {
-    data[i] = DecodeUint64ToDouble(transformed_data[i]);
-  }
+void RadixBatcherSort(std::vector<uint64_t>& keys) {
+  RadixSort(keys);
+  OddEvenMergeSort(keys, 0, static_cast<int>(keys.size()));
 }
 }  // namespace
 }  // namespace khovansky_d_double_radix_batcher_seq
@@ -98,10 +68,9 @@ bool khovansky_d_double_radix_batcher_seq::RadixSeq::PreProcessingImpl() {
   auto* in_ptr = reinterpret_cast<double*>(task_data->inputs[0]);
 
   unsigned int input_size = task_data->inputs_count[0];
-  unsigned int output_size = task_data->outputs_count[0];
 
-  input_ = std::vector<double>(in_ptr, in_ptr + input_size);
-  output_ = std::vector<double>(output_size, 0);
+  keys_.resize(input_size);
+  ppc::core::ToRadixKeys(std::span<const double>(in_ptr, input_size), std::span<uint64_t>(keys_));
 
   return true;
 }
@@ -127,15 +96,13 @@ bool khovansky_d_double_radix_batcher_seq::RadixSeq::ValidationImpl() {
 }
 
 bool khovansky_d_double_radix_batcher_seq::RadixSeq::RunImpl() {
-  output_ = input_;
-  khovansky_d_double_radix_batcher_seq::RadixBatcherSort(output_);
+  khovansky_d_double_radix_batcher_seq::RadixBatcherSort(keys_);
   return true;
 }
 
 bool khovansky_d_double_radix_batcher_seq::RadixSeq::PostProcessingImpl() {
-  for (size_t i = 0; i < output_.size(); i++) {
-    reinterpret_cast<double*>(task_data->outputs[0])[i] = output_[i];
-  }
+  auto* out_ptr = reinterpret_cast<double*>(task_data->outputs[0]);
+  ppc::core::FromRadixKeys(std::span<const uint64_t>(keys_), std::span<double>(out_ptr, keys_.size()));
 
   return true;
 }
\ No newline at end of file
@@ -4,8 +4,11 @@
 #include <complex>
 #include <cstddef>
 #include <iostream>
+#include <utility>
 #include <vector>
 
+#include "core/sparse/include/spgemm.hpp"
+
 void kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS::AddValue(int row, Complex value, int col) {
   for (int j = rowPtr[row]; j < rowPtr[row + 1]; ++j) {
     if (colIndices[j] == col) {
@@ -128,24 +131,31 @@ bool kolodkin_g_multiplication_matrix_seq::TestTaskSequential::ValidationImpl()
   // Check equality of counts elements
   unsigned int input_size = task_data->inputs_count[0];
   auto* in_ptr = reinterpret_cast<Complex*>(task_data->inputs[0]);
+  if (input_size < 5) {
+    return false;
+  }
   std::vector<Complex> vec = std::vector<Complex>(in_ptr, in_ptr + input_size);
-  return !(vec[1] != vec[5 + (int)(vec[2].real() + vec[3].real() + vec[4].real())].real());
+  auto b_offset = 5 + (unsigned int)(vec[2].real() + vec[3].real() + vec[4].real());
+  return b_offset < input_size && vec[1] == vec[b_offset].real();
 }
 
 bool kolodkin_g_multiplication_matrix_seq::TestTaskSequential::RunImpl() {
+  // The rows of A * B are the columns of B^T A^T, so the compressed rows multiply with the operands swapped
+  const ppc::core::CompressedView<Complex> a{.lines = static_cast<size_t>(A_.numRows),
+                                             .extent = static_cast<size_t>(A_.numCols),
+                                             .ptr = A_.rowPtr,
+                                             .idx = A_.colIndices,
+                                             .val = A_.values};
+  const ppc::core::CompressedView<Complex> b{.lines = static_cast<size_t>(B_.numRows),
+                                             .extent = static_cast<size_t>(B_.numCols),
+                                             .ptr = B_.rowPtr,
+                                             .idx = B_.colIndices,
+                                             .val = B_.values};
+  auto product = ppc::core::SpGemm(b, a);
   SparseMatrixCRS c(A_.numRows, B_.numCols);
-  for (unsigned int i = 0; i < (unsigned int)A_.numRows; ++i) {
-    for (unsigned int j = A_.rowPtr[i]; j < (unsigned int)A_.rowPtr[i + 1]; ++j) {
-      unsigned int col_a = A_.colIndices[j];
-      Complex value_a = A_.values[j];
-      for (unsigned int k = B_.rowPtr[col_a]; k < (unsigned int)B_.rowPtr[col_a + 1]; ++k) {
-        unsigned int col_b = B_.colIndices[k];
-        Complex value_b = B_.values[k];
-
-        c.AddValue((int)i, value_a * value_b, (int)col_b);
-      }
-    }
-  }
+  c.values = std::move(product.val);
+  c.colIndices = std::move(product.idx);
+  c.rowPtr = std::move(product.ptr);
   output_ = ParseMatrixIntoVec(c);
   return true;
 }
@@ -155,4 +165,4 @@ bool kolodkin_g_multiplication_matrix_seq::TestTaskSequential::PostProcessingImp
     reinterpret_cast<Complex*>(task_data->outputs[0])[i] = output_[i];
   }
   return true;
-}
\ No newline at end of file
+}
\ No newline at end of file
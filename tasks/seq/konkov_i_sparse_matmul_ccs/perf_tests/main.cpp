@@ -2,46 +2,42 @@
 
 #include <chrono>
 #include <memory>
-#include <vector>
+#include <utility>
 
 #include "core/perf/include/perf.hpp"
+#include "core/sparse/include/sparse_io.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
 #include "seq/konkov_i_sparse_matmul_ccs/include/ops_seq.hpp"
 
-TEST(konkov_i_SparseMatmulPerfTest_seq, test_pipeline_run) {
-  constexpr int kSize = 5000;
+namespace {
+
+// 5000 x 5000 diagonal operands, A of 2.0 and B of 3.0, committed in the binary sparse format with
+// columns as lines, so the perf run reads them instead of building them
+void LoadInputs(konkov_i_sparse_matmul_ccs::SparseMatmulTask &task) {
+  auto a = ppc::core::ReadSparseBinary<double>(ppc::util::GetAbsolutePath("seq/konkov_i_sparse_matmul_ccs/data/a.bin"));
+  auto b = ppc::core::ReadSparseBinary<double>(ppc::util::GetAbsolutePath("seq/konkov_i_sparse_matmul_ccs/data/b.bin"));
+
+  task.A_values = std::move(a.val);
+  task.A_row_indices = std::move(a.idx);
+  task.A_col_ptr = std::move(a.ptr);
+  task.rowsA = static_cast<int>(a.extent);
+  task.colsA = static_cast<int>(a.lines);
+
+  task.B_values = std::move(b.val);
+  task.B_row_indices = std::move(b.idx);
+  task.B_col_ptr = std::move(b.ptr);
+  task.rowsB = static_cast<int>(b.extent);
+  task.colsB = static_cast<int>(b.lines);
+}
 
+}  // namespace
+
+TEST(konkov_i_SparseMatmulPerfTest_seq, test_pipeline_run) {
   ppc::core::TaskDataPtr task_data = std::make_shared<ppc::core::TaskData>();
   auto task = std::make_shared<konkov_i_sparse_matmul_ccs::SparseMatmulTask>(task_data);
 
-  std::vector<double> a_values(kSize, 2.0);
-  std::vector<int> a_row_indices(kSize);
-  std::vector<int> a_col_ptr(kSize + 1);
-
-  std::vector<double> b_values(kSize, 3.0);
-  std::vector<int> b_row_indices(kSize);
-  std::vector<int> b_col_ptr(kSize + 1);
-
-  for (int i = 0; i < kSize; i++) {
-    a_row_indices[i] = i;
-    a_col_ptr[i] = i;
-    b_row_indices[i] = i;
-    b_col_ptr[i] = i;
-  }
-  a_col_ptr[kSize] = kSize;
-  b_col_ptr[kSize] = kSize;
-
-  task->A_values = a_values;
-  task->A_row_indices = a_row_indices;
-  task->A_col_ptr = a_col_ptr;
-  task->rowsA = kSize;
-  task->colsA = kSize;
-
-  task->B_values = b_values;
-  task->B_row_indices = b_row_indices;
-  task->B_col_ptr = b_col_ptr;
-  task->rowsB = kSize;
-  task->colsB = kSize;
+  LoadInputs(*task);
 
   auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
   perf_attr->num_running = 10;
@@ -60,43 +56,14 @@ TEST(konkov_i_SparseMatmulPerfTest_seq, test_pipeline_run) {
   for (const auto& val : task->C_values) {
     ASSERT_NEAR(val, expected_value, 1e-9);
   }
-  ASSERT_EQ(task->C_col_ptr.back(), kSize);
+  ASSERT_EQ(task->C_col_ptr.back(), task->colsB);
 }
 
 TEST(konkov_i_SparseMatmulPerfTest_seq, test_task_run) {
-  constexpr int kSize = 5000;
-
   ppc::core::TaskDataPtr task_data = std::make_shared<ppc::core::TaskData>();
   auto task = std::make_shared<konkov_i_sparse_matmul_ccs::SparseMatmulTask>(task_data);
 
-  std::vector<double> a_values(kSize, 2.0);
-  std::vector<int> a_row_indices(kSize);
-  std::vector<int> a_col_ptr(kSize + 1);
-
-  std::vector<double> b_values(kSize, 3.0);
-  std::vector<int> b_row_indices(kSize);
-  std::vector<int> b_col_ptr(kSize + 1);
-
-  for (int i = 0; i < kSize; i++) {
-    a_row_indices[i] = i;
-    a_col_ptr[i] = i;
-    b_row_indices[i] = i;
-    b_col_ptr[i] = i;
-  }
-  a_col_ptr[kSize] = kSize;
-  b_col_ptr[kSize] = kSize;
-
-  task->A_values = a_values;
-  task->A_row_indices = a_row_indices;
-  task->A_col_ptr = a_col_ptr;
-  task->rowsA = kSize;
-  task->colsA = kSize;
-
-  task->B_values = b_values;
-  task->B_row_indices = b_row_indices;
-  task->B_col_ptr = b_col_ptr;
-  task->rowsB = kSize;
-  task->colsB = kSize;
+  LoadInputs(*task);
 
   auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
   perf_attr->num_running = 10;
@@ -115,5 +82,5 @@ TEST(konkov_i_SparseMatmulPerfTest_seq, test_task_run) {
   for (const auto& val : task->C_values) {
     ASSERT_NEAR(val, expected_value, 1e-9);
   }
-  ASSERT_EQ(task->C_col_ptr.back(), kSize);
+  ASSERT_EQ(task->C_col_ptr.back(), task->colsB);
 }
\ No newline at end of file
@@ -1,9 +1,12 @@
 #include "seq/korneeva_e_sparse_matrix_mult_complex_ccs/include/ops_seq.hpp"
 
-#include <cmath>
+#include <cstddef>
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/spgemm.hpp"
+#include "core/util/include/for_each.hpp"
+
 namespace korneeva_e_sparse_matrix_mult_complex_ccs_seq {
 
 bool SparseMatrixMultComplexCCS::PreProcessingImpl() {
@@ -26,61 +29,25 @@ bool SparseMatrixMultComplexCCS::ValidationImpl() {
 }
 
 bool SparseMatrixMultComplexCCS::RunImpl() {
-  std::vector<Complex> temp_values;
-  std::vector<int> temp_row_indices;
-  std::vector<int> temp_col_offsets(1, 0);
-
-  for (int j = 0; j < matrix2_->cols; j++) {
-    ComputeColumn(j, temp_values, temp_row_indices, temp_col_offsets);
-  }
-
-  result_.values = std::move(temp_values);
-  result_.row_indices = std::move(temp_row_indices);
-  result_.col_offsets = std::move(temp_col_offsets);
+  const ppc::core::CompressedView<Complex> a{.lines = static_cast<size_t>(matrix1_->cols),
+                                             .extent = static_cast<size_t>(matrix1_->rows),
+                                             .ptr = matrix1_->col_offsets,
+                                             .idx = matrix1_->row_indices,
+                                             .val = matrix1_->values};
+  const ppc::core::CompressedView<Complex> b{.lines = static_cast<size_t>(matrix2_->cols),
+                                             .extent = static_cast<size_t>(matrix2_->rows),
+                                             .ptr = matrix2_->col_offsets,
+                                             .idx = matrix2_->row_indices,
+                                             .val = matrix2_->values};
+  auto product = ppc::core::SpGemm(a, b, ppc::util::SequentialForEach{},
+                                   [](const Complex& value) { return value != Complex(0.0, 0.0); });
+  result_.values = std::move(product.val);
+  result_.row_indices = std::move(product.idx);
+  result_.col_offsets = std::move(product.ptr);
   result_.nnz = static_cast<int>(result_.values.size());
   return true;
 }
 
-void SparseMatrixMultComplexCCS::ComputeColumn(int col_idx, std::vector<Complex>& values, std::vector<int>& row_indices,
-                                               std::vector<int>& col_offsets) {
-  int col_start2 = matrix2_->col_offsets[col_idx];
-  int col_end2 = matrix2_->col_offsets[col_idx + 1];
-
-  for (int i = 0; i < matrix1_->rows; i++) {
-    Complex sum = ComputeElement(i, col_start2, col_end2);
-    if (sum != Complex(0.0, 0.0)) {
-      values.push_back(sum);
-      row_indices.push_back(i);
-    }
-  }
-  col_offsets.push_back(static_cast<int>(values.size()));
-}
-
-Complex SparseMatrixMultComplexCCS::ComputeElement(int row_idx, int col_start2, int col_end2) {
-  Complex sum(0.0, 0.0);
-  for (int k = 0; k < matrix1_->cols; k++) {
-    int col_start1 = matrix1_->col_offsets[k];
-    int col_end1 = matrix1_->col_offsets[k + 1];
-    sum += ComputeContribution(row_idx, k, col_start1, col_end1, col_start2, col_end2);
-  }
-  return sum;
-}
-
-Complex SparseMatrixMultComplexCCS::ComputeContribution(int row_idx, int k, int col_start1, int col_end1,
-                                                        int col_start2, int col_end2) {
-  Complex contribution(0.0, 0.0);
-  for (int p = col_start1; p < col_end1; p++) {
-    if (matrix1_->row_indices[p] == row_idx) {
-      for (int q = col_start2; q < col_end2; q++) {
-        if (matrix2_->row_indices[q] == k) {
-          contribution += matrix1_->values[p] * matrix2_->values[q];
-        }
-      }
-    }
-  }
-  return contribution;
-}
-
 bool SparseMatrixMultComplexCCS::PostProcessingImpl() {
   *reinterpret_cast<SparseMatrixCCS*>(task_data->outputs[0]) = result_;
   return true;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <utility>
 #include <vector>
 
@@ -9,8 +10,8 @@ namespace koshkin_n_shell_sort_batchers_even_odd_merge_seq {
 std::vector<int> GetRandomVector(int sz);
 class TestTaskSequential : public ppc::core::Task {
  public:
-  static void Swap(std::vector<int>& a, int i, int j, bool order);
-  void BatcherMerge(std::vector<int>& a, int start, int end, bool order);
+  // Merges the sorted runs a[0, mid) and a[mid, a.size()) with the SIMD bitonic merge network
+  void BatcherMerge(std::vector<int>& a, size_t mid);
   void ShellBatcherSort(std::vector<int>& arr, bool order);
   explicit TestTaskSequential(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
   bool PreProcessingImpl() override;
@@ -20,6 +21,8 @@ class TestTaskSequential : public ppc::core::Task {
 
  private:
   std::vector<int> input_, output_;
+  // Merge target, swapped with the sorted vector and reused from run to run
+  std::vector<int> scratch_;
   bool input_order_;  // порядок сортировки (1 - по возрастанию, 0 - по убыванию)"
 };
 
@@ -1,9 +1,13 @@
 #include "seq/koshkin_n_shell_sort_batchers_even_odd_merge/include/ops_seq.hpp"
 
 #include <algorithm>
+#include <cstddef>
 #include <random>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/sorting_network.hpp"
+
 std::vector<int> koshkin_n_shell_sort_batchers_even_odd_merge_seq::GetRandomVector(int sz) {
   std::random_device dev;
   std::mt19937 gen(dev());
@@ -15,71 +19,26 @@ std::vector<int> koshkin_n_shell_sort_batchers_even_odd_merge_seq::GetRandomVect
   return vec;
 }
 
-void koshkin_n_shell_sort_batchers_even_odd_merge_seq::TestTaskSequential::Swap(std::vector<int> &a, int i, int j,
-                                                                                bool order) {
-  if ((order && a[i] > a[j]) || (!order && a[i] < a[j])) {
-    std::swap(a[i], a[j]);
-  }
-}
-
-void koshkin_n_shell_sort_batchers_even_odd_merge_seq::TestTaskSequential::BatcherMerge(std::vector<int> &a, int start,
-                                                                                        int end, bool order) {
-  int distance = end - start;
-  if (distance <= 1) {
-    return;
-  }
-
-  int mid = start + (distance / 2);
-
-  BatcherMerge(a, start, mid, order);
-  BatcherMerge(a, mid, end, order);
-
-  // проверка на отсортированность
-  bool is_sorted = true;
-  for (int i = start; i < end - 1; ++i) {
-    if ((order && a[i] > a[i + 1]) || (!order && a[i] < a[i + 1])) {
-      is_sorted = false;
-      break;
-    }
-  }
-
-  if (is_sorted) {
-    return;
-  }
-
-  for (int i = start; i + 1 < end; i += 2) {
-    Swap(a, i, i + 1, order);
-  }
-  for (int i = start + 1; i + 1 < end; i += 2) {
-    Swap(a, i, i + 1, order);
-  }
+void koshkin_n_shell_sort_batchers_even_odd_merge_seq::TestTaskSequential::BatcherMerge(std::vector<int> &a,
+                                                                                        size_t mid) {
+  const std::span<const int> runs(a);
+  scratch_.resize(a.size());
+  ppc::core::BitonicMerge<int>(runs.first(mid), runs.subspan(mid), scratch_);
+  a.swap(scratch_);
 }
 
 void koshkin_n_shell_sort_batchers_even_odd_merge_seq::TestTaskSequential::ShellBatcherSort(std::vector<int> &a,
                                                                                             bool order) {
-  int n = static_cast<int>(a.size());
-  int gap = 1;
-
-  // генерация шагов Кнута
-  while (gap < n / 3) {
-    gap = 3 * gap + 1;
-  }
-
-  // шаги Шелла
-  while (gap > 0) {
-    for (int i = gap; i < n; i++) {
-      int temp = a[i];
-      int j = 0;
-      for (j = i; j >= gap && ((order && a[j - gap] > temp) || (!order && a[j - gap] < temp)); j -= gap) {
-        a[j] = a[j - gap];
-      }
-      a[j] = temp;
-    }
-    gap /= 3;
+  // Halves sorted by the vectorized sorting network, then one bitonic merge
+  const size_t mid = a.size() / 2;
+  const std::span<int> data(a);
+  ppc::core::NetworkSort(data.first(mid));
+  ppc::core::NetworkSort(data.subspan(mid));
+  BatcherMerge(a, mid);
+
+  if (!order) {
+    std::ranges::reverse(a);
   }
-
-  // четно-нечетное слияние Бэтчера
-  BatcherMerge(a, 0, n, order);
 }
 
 bool koshkin_n_shell_sort_batchers_even_odd_merge_seq::TestTaskSequential::PreProcessingImpl() {
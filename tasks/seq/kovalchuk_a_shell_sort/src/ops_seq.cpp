@@ -1,9 +1,11 @@
 #include "seq/kovalchuk_a_shell_sort/include/ops_seq.hpp"
 
 #include <algorithm>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kovalchuk_a_shell_sort {
@@ -22,7 +24,7 @@ bool ShellSortSequential::ValidationImpl() {
 }
 
 bool ShellSortSequential::RunImpl() {
-  ShellSort();
+  presort_stats_ = ppc::core::AdaptiveSort(std::span<int>(input_), [this](std::span<int> /*data*/) { ShellSort(); });
   return true;
 }
 
@@ -5,6 +5,8 @@
 #include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 void lysov_i_matrix_multiplication_fox_algorithm_seq::ProcessBlock(const std::vector<double> &a,
                                                                    const std::vector<double> &b, std::vector<double> &c,
                                                                    std::size_t i, std::size_t j,
@@ -12,25 +14,12 @@ void lysov_i_matrix_multiplication_fox_algorithm_seq::ProcessBlock(const std::ve
                                                                    std::size_t n) {
   std::size_t block_h = std::min(block_size, n - (i * block_size));
   std::size_t block_w = std::min(block_size, n - (j * block_size));
-  for (std::size_t ii = 0; ii < block_h; ++ii) {
-    for (std::size_t jj = 0; jj < block_w; ++jj) {
-      double sum = 0.0;
-      for (std::size_t kk = 0; kk < std::min(block_size, n - (a_block_row * block_size)); ++kk) {
-        std::size_t row_a = (i * block_size) + ii;
-        std::size_t col_a = (a_block_row * block_size) + kk;
-        std::size_t row_b = (a_block_row * block_size) + kk;
-        std::size_t col_b = (j * block_size) + jj;
-        if (row_a < n && col_a < n && row_b < n && col_b < n) {
-          sum += a[(row_a * n) + col_a] * b[(row_b * n) + col_b];
-        }
-      }
-      std::size_t row_c = (i * block_size) + ii;
-      std::size_t col_c = (j * block_size) + jj;
-      if (row_c < n && col_c < n) {
-        c[(row_c * n) + col_c] += sum;
-      }
-    }
-  }
+  std::size_t block_k = std::min(block_size, n - (a_block_row * block_size));
+
+  double *c_ptr = &c[((i * block_size) * n) + (j * block_size)];
+  const double *a_ptr = &a[((i * block_size) * n) + (a_block_row * block_size)];
+  const double *b_ptr = &b[((a_block_row * block_size) * n) + (j * block_size)];
+  ppc::core::Gemm(block_h, block_w, block_k, a_ptr, n, b_ptr, n, c_ptr, n);
 }
 
 bool lysov_i_matrix_multiplication_fox_algorithm_seq::TestTaskSequential::PreProcessingImpl() {
@@ -2,8 +2,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 bool moiseev_a_mult_mat_seq::MultMatSequential::PreProcessingImpl() {
   unsigned int input_size_a = task_data->inputs_count[0];
   unsigned int input_size_b = task_data->inputs_count[1];
@@ -35,31 +38,15 @@ bool moiseev_a_mult_mat_seq::MultMatSequential::ValidationImpl() {
 }
 
 bool moiseev_a_mult_mat_seq::MultMatSequential::RunImpl() {
+  // Every block column of a step uses the same block of A, so a step is one block-row strip of C:
+  // C[row strip] += A[row strip, a_block_col] * B[a_block_col strip, all columns]
   for (int block_row = 0; block_row < num_blocks_; ++block_row) {
-    for (int block_col = 0; block_col < num_blocks_; ++block_col) {
-      for (int block_step = 0; block_step < num_blocks_; ++block_step) {
-        int a_block_col = (block_row + block_step) % num_blocks_;
-        int b_block_row = a_block_col;
-
-        int block_row_start = block_row * block_size_;
-        int block_col_start = block_col * block_size_;
-        int a_col_start = a_block_col * block_size_;
-        int b_row_start = b_block_row * block_size_;
-
-        for (int row_offset = 0; row_offset < block_size_; ++row_offset) {
-          for (int col_offset = 0; col_offset < block_size_; ++col_offset) {
-            double block_result = 0.0;
-            for (int inner_dim_offset = 0; inner_dim_offset < block_size_; ++inner_dim_offset) {
-              double a_element =
-                  matrix_a_[((block_row_start + row_offset) * matrix_size_) + (a_col_start + inner_dim_offset)];
-              double b_element =
-                  matrix_b_[((b_row_start + inner_dim_offset) * matrix_size_) + (block_col_start + col_offset)];
-              block_result += a_element * b_element;
-            }
-            matrix_c_[((block_row_start + row_offset) * matrix_size_) + (block_col_start + col_offset)] += block_result;
-          }
-        }
-      }
+    for (int block_step = 0; block_step < num_blocks_; ++block_step) {
+      const auto row_start = static_cast<size_t>(block_row) * block_size_;
+      const auto a_col_start = static_cast<size_t>((block_row + block_step) % num_blocks_) * block_size_;
+      ppc::core::Gemm(block_size_, matrix_size_, block_size_, &matrix_a_[(row_start * matrix_size_) + a_col_start],
+                      matrix_size_, &matrix_b_[a_col_start * matrix_size_], matrix_size_,
+                      &matrix_c_[row_start * matrix_size_], matrix_size_);
     }
   }
   return true;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -17,8 +18,8 @@ class TestTaskSequential : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<double> in_;
-  std::vector<double> res_;
+  // Inputs as radix keys, sorted in place
+  std::vector<uint64_t> keys_;
 };
 
 }  // namespace petrov_a_radix_double_batcher_seq
\ No newline at end of file
@@ -1,10 +1,11 @@
 #pragma once
 
 #include <algorithm>
-#include <functional>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/parallel_quicksort.hpp"
 #include "core/task/include/task.hpp"
 
 namespace pikarychev_i_hoare_sort_simple_merge {
@@ -29,43 +30,20 @@ class HoareSeq : public ppc::core::Task {
   }
 
   bool RunImpl() override {
-    const auto size = input_.size();
-    std::ranges::copy_n(input_.begin(), size, res_.begin());
-
-    DoSort(res_, 0, size - 1,
-           [reverse = reverse_](const auto& a, const auto& b) { return reverse ? (a < b) : (a > b); });
-
+    std::ranges::copy_n(input_.begin(), input_.size(), res_.begin());
+    ppc::core::ParallelQuickSort(std::span<T>(res_), 1, reverse_ ? ReverseComp : StandardComp);
     return true;
   }
 
+  static bool StandardComp(const T& a, const T& b) { return a > b; }
+  static bool ReverseComp(const T& a, const T& b) { return a < b; }
+
   bool PostProcessingImpl() override {
     std::ranges::copy_n(res_.begin(), res_.size(), reinterpret_cast<T*>(task_data->outputs[0]));
     return true;
   }
 
  private:
-  static int Partition(std::vector<T>& block, int low, int high, const std::function<bool(const T&, const T&)>& comp) {
-    int e = low - 1;
-    for (int j = low; j <= high - 1; j++) {
-      if (!comp(block[j], block[high])) {
-        continue;
-      }
-
-      e++;
-      std::swap(block[e], block[j]);
-    }
-    std::swap(block[e + 1], block[high]);
-    return ++e;
-  };
-  static void DoSort(std::vector<T>& arr, int low, int high, const std::function<bool(const T&, const T&)>& comp) {
-    if (low >= high) {
-      return;
-    }
-    const auto border = Partition(arr, low, high, comp);
-    DoSort(arr, low, border - 1, comp);
-    DoSort(arr, border + 1, high, comp);
-  }
-
   bool reverse_;
   std::vector<T> input_;
   std::vector<T> res_;
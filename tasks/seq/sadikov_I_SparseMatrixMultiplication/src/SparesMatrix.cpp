@@ -4,37 +4,23 @@
 #include <cstddef>
 #include <vector>
 
+#include "core/sparse/include/sparse_matrix.hpp"
+
 namespace sadikov_i_sparse_matrix_multiplication_task_seq {
 SparesMatrix SparesMatrix::Transpose(const SparesMatrix& matrix) {
-  std::vector<double> val;
-  std::vector<int> rows;
-  std::vector<int> elem_sum;
-  auto max_size = std::max(matrix.GetRowsCount(), matrix.GetColumnsCount());
-  std::vector<std::vector<double>> intermediate_values(max_size);
-  std::vector<std::vector<int>> intermediate_indexes(max_size);
-  int counter = 0;
-  for (int i = 0; i < static_cast<int>(matrix.GetElementsSum().size()); ++i) {
-    auto limit = i == 0 ? matrix.GetElementsSum()[0] : matrix.GetElementsSum()[i] - matrix.GetElementsSum()[i - 1];
-    for (int j = 0; j < limit; ++j) {
-      intermediate_values[matrix.GetRows()[counter]].emplace_back(matrix.GetValues()[counter]);
-      intermediate_indexes[matrix.GetRows()[counter]].emplace_back(i);
-      counter++;
-    }
-  }
-  for (auto i = 0; i < static_cast<int>(intermediate_values.size()); ++i) {
-    for (auto j = 0; j < static_cast<int>(intermediate_values[i].size()); ++j) {
-      val.emplace_back(intermediate_values[i][j]);
-      rows.emplace_back(intermediate_indexes[i][j]);
-    }
-    if (i > 0) {
-      elem_sum.emplace_back(intermediate_values[i].size() + elem_sum[i - 1]);
-    } else {
-      elem_sum.emplace_back(intermediate_values[i].size());
-    }
-  }
-  return SparesMatrix(matrix.GetColumnsCount(), matrix.GetRowsCount(), val, rows, elem_sum);
+  // The element sums are the column pointers without their leading zero
+  const auto& elements_sum = matrix.GetElementsSum();
+  std::vector<int> ptr(elements_sum.size() + 1, 0);
+  std::ranges::copy(elements_sum, ptr.begin() + 1);
+  const ppc::core::CompressedView<double> columns{.lines = elements_sum.size(),
+                                                  .extent = static_cast<size_t>(matrix.GetRowsCount()),
+                                                  .ptr = ptr,
+                                                  .idx = matrix.GetRows(),
+                                                  .val = matrix.GetValues()};
+  auto rows = ppc::core::Transpose(columns);
+  rows.ptr.erase(rows.ptr.begin());
+  return SparesMatrix(matrix.GetColumnsCount(), matrix.GetRowsCount(), rows.val, rows.idx, rows.ptr);
 }
-
 SparesMatrix SparesMatrix::operator*(const SparesMatrix& smatrix) const {
   std::vector<double> values;
   std::vector<int> rows;
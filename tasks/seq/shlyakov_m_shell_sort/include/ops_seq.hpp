@@ -3,6 +3,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
 #include "core/task/include/task.hpp"
 
 namespace shlyakov_m_shell_sort_seq {
@@ -15,9 +16,14 @@ class TestTaskSequential : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
+  // Order of the input as the pre-pass measured it, and the path the sort took
+  [[nodiscard]] const ppc::core::PresortStats& GetPresortStats() const { return presort_stats_; }
 
  private:
+  void ShellSort();
+
   std::vector<int> input_, output_;
+  ppc::core::PresortStats presort_stats_;
 };
 
 }  // namespace shlyakov_m_shell_sort_seq
\ No newline at end of file
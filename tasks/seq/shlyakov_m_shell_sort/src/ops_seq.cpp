@@ -2,8 +2,11 @@
 
 #include <cmath>
 #include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
+
 bool shlyakov_m_shell_sort_seq::TestTaskSequential::PreProcessingImpl() {
   std::size_t input_size = task_data->inputs_count[0];
   auto* in_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
@@ -19,6 +22,11 @@ bool shlyakov_m_shell_sort_seq::TestTaskSequential::ValidationImpl() {
 }
 
 bool shlyakov_m_shell_sort_seq::TestTaskSequential::RunImpl() {
+  presort_stats_ = ppc::core::AdaptiveSort(std::span<int>(output_), [this](std::span<int> /*data*/) { ShellSort(); });
+  return true;
+}
+
+void shlyakov_m_shell_sort_seq::TestTaskSequential::ShellSort() {
   int n = static_cast<int>(input_.size());
 
   std::vector<int> gaps;
@@ -43,7 +51,6 @@ bool shlyakov_m_shell_sort_seq::TestTaskSequential::RunImpl() {
       }
     }
   }
-  return true;
 }
 
 bool shlyakov_m_shell_sort_seq::TestTaskSequential::PostProcessingImpl() {
@@ -20,9 +20,6 @@ class TestTaskSequential : public ppc::core::Task {
  private:
   std::vector<int> input_;
   std::vector<int> output_;
-
-  void QuickSort(std::vector<int>& arr, int low, int high);
-  static void Merge(std::vector<int>& arr, int low, int mid, int high);
 };
 
 }  // namespace shuravina_o_hoare_simple_merger
\ No newline at end of file
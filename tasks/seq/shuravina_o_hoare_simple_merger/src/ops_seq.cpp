@@ -1,57 +1,12 @@
 #include "seq/shuravina_o_hoare_simple_merger/include/ops_seq.hpp"
 
-#include <algorithm>
 #include <cstddef>
+#include <span>
 #include <vector>
 
-namespace shuravina_o_hoare_simple_merger {
-
-void TestTaskSequential::QuickSort(std::vector<int>& arr, int low, int high) {
-  if (low < high) {
-    int pivot = arr[high];
-    int i = low - 1;
-
-    for (int j = low; j < high; ++j) {
-      if (arr[j] <= pivot) {
-        ++i;
-        std::swap(arr[i], arr[j]);
-      }
-    }
-    std::swap(arr[i + 1], arr[high]);
+#include "core/sort/include/parallel_quicksort.hpp"
 
-    int pi = i + 1;
-
-    QuickSort(arr, low, pi - 1);
-    QuickSort(arr, pi + 1, high);
-  }
-}
-
-void TestTaskSequential::Merge(std::vector<int>& arr, int low, int mid, int high) {
-  std::vector<int> temp(high - low + 1);
-  int i = low;
-  int j = mid + 1;
-  int k = 0;
-
-  while (i <= mid && j <= high) {
-    if (arr[i] <= arr[j]) {
-      temp[k++] = arr[i++];
-    } else {
-      temp[k++] = arr[j++];
-    }
-  }
-
-  while (i <= mid) {
-    temp[k++] = arr[i++];
-  }
-
-  while (j <= high) {
-    temp[k++] = arr[j++];
-  }
-
-  for (i = low, k = 0; i <= high; ++i, ++k) {
-    arr[i] = temp[k];
-  }
-}
+namespace shuravina_o_hoare_simple_merger {
 
 bool TestTaskSequential::PreProcessingImpl() {
   auto* in_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
@@ -67,9 +22,7 @@ bool TestTaskSequential::PreProcessingImpl() {
 bool TestTaskSequential::ValidationImpl() { return task_data->inputs_count[0] == task_data->outputs_count[0]; }
 
 bool TestTaskSequential::RunImpl() {
-  auto size = input_.size();
-  QuickSort(input_, 0, static_cast<int>(size) - 1);
-  Merge(input_, 0, static_cast<int>(size / 2) - 1, static_cast<int>(size) - 1);
+  ppc::core::ParallelQuickSort(std::span<int>(input_));
   output_ = input_;
   return true;
 }
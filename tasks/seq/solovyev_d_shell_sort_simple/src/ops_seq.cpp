@@ -2,8 +2,11 @@
 
 #include <cmath>
 #include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
+
 bool solovyev_d_shell_sort_simple_seq::TaskSequential::PreProcessingImpl() {
   unsigned int input_size = task_data->inputs_count[0];
   auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
@@ -19,6 +22,11 @@ bool solovyev_d_shell_sort_simple_seq::TaskSequential::ValidationImpl() {
 }
 
 bool solovyev_d_shell_sort_simple_seq::TaskSequential::RunImpl() {
+  presort_stats_ = ppc::core::AdaptiveSort(std::span<int>(input_), [this](std::span<int> /*data*/) { ShellSort(); });
+  return true;
+}
+
+void solovyev_d_shell_sort_simple_seq::TaskSequential::ShellSort() {
   unsigned int gap = input_.size() / 2;
   while (gap > 0) {
     for (size_t i = gap; i < input_.size(); i++) {
@@ -32,7 +40,6 @@ bool solovyev_d_shell_sort_simple_seq::TaskSequential::RunImpl() {
     }
     gap = gap / 2;
   }
-  return true;
 }
 
 bool solovyev_d_shell_sort_simple_seq::TaskSequential::PostProcessingImpl() {
@@ -3,8 +3,11 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
+
 void sotskov_a_shell_sorting_with_simple_merging_seq::ShellSortWithSimpleMerging(std::vector<int>& arr) {
   int array_size = static_cast<int>(arr.size());
 
@@ -44,7 +47,8 @@ bool sotskov_a_shell_sorting_with_simple_merging_seq::TestTaskSequential::Valida
 }
 
 bool sotskov_a_shell_sorting_with_simple_merging_seq::TestTaskSequential::RunImpl() {
-  ShellSortWithSimpleMerging(input_);
+  presort_stats_ = ppc::core::AdaptiveSort(std::span<int>(input_),
+                                           [this](std::span<int> /*data*/) { ShellSortWithSimpleMerging(input_); });
   return true;
 }
 
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/gemm/include/cannon_grid.hpp"
 #include "core/task/include/task.hpp"
 
 namespace vavilov_v_cannon_seq {
@@ -25,8 +26,6 @@ class CannonSequential : public ppc::core::Task {
   std::vector<double> B_;
   std::vector<double> C_;
 
-  void InitialShift();
-  void BlockMultiply();
-  void ShiftBlocks();
+  void BlockMultiply(const ppc::core::CannonGrid& grid);
 };
 }  // namespace vavilov_v_cannon_seq
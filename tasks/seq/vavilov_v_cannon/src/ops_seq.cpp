@@ -2,8 +2,13 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/gemm/include/cannon_grid.hpp"
+#include "core/gemm/include/gemm.hpp"
+
 bool vavilov_v_cannon_seq::CannonSequential::PreProcessingImpl() {
   N_ = static_cast<unsigned int>(std::sqrt(task_data->inputs_count[0]));
   num_blocks_ = static_cast<unsigned int>(task_data->inputs_count[2]);
@@ -11,8 +16,11 @@ bool vavilov_v_cannon_seq::CannonSequential::PreProcessingImpl() {
 
   auto* a = reinterpret_cast<double*>(task_data->inputs[0]);
   auto* b = reinterpret_cast<double*>(task_data->inputs[1]);
-  A_.assign(a, a + (N_ * N_));
-  B_.assign(b, b + (N_ * N_));
+  // A and B live in block-major tiles for the whole run, Cannon's shifts only remap tile indices
+  A_.resize(N_ * N_);
+  B_.resize(N_ * N_);
+  ppc::core::ToBlockMajor(std::span<const double>(a, N_ * N_), N_, num_blocks_, A_);
+  ppc::core::ToBlockMajor(std::span<const double>(b, N_ * N_), N_, num_blocks_, B_);
   C_.assign(N_ * N_, 0);
 
   return true;
@@ -29,73 +37,24 @@ bool vavilov_v_cannon_seq::CannonSequential::ValidationImpl() {
   return n % num_blocks == 0;
 }
 
-void vavilov_v_cannon_seq::CannonSequential::InitialShift() {
-  std::vector<double> a_tmp = A_;
-  std::vector<double> b_tmp = B_;
-
-  for (unsigned int bi = 0; bi < num_blocks_; ++bi) {
-    for (unsigned int bj = 0; bj < num_blocks_; ++bj) {
-      unsigned int src_row = (bi + bj) % num_blocks_;
-      unsigned int src_col = (bj + bi) % num_blocks_;
-      for (unsigned int i = 0; i < block_size_; ++i) {
-        for (unsigned int j = 0; j < block_size_; ++j) {
-          B_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              b_tmp[(((src_row * block_size_) + i) * N_) + ((bj * block_size_) + j)];
-          A_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              a_tmp[(((bi * block_size_) + i) * N_) + ((src_col * block_size_) + j)];
-        }
-      }
-    }
-  }
-}
-
-void vavilov_v_cannon_seq::CannonSequential::BlockMultiply() {
-  for (unsigned int bi = 0; bi < N_; bi += block_size_) {
-    for (unsigned int bj = 0; bj < N_; bj += block_size_) {
-      for (unsigned int i = bi; i < bi + block_size_; i++) {
-        for (unsigned int j = bj; j < bj + block_size_; j++) {
-          double temp = 0.0;
-          for (unsigned int k = 0; k < block_size_; k++) {
-            unsigned int row_a = bi + (i - bi);
-            unsigned int col_a = bj + k;
-            unsigned int row_b = bi + k;
-            unsigned int col_b = bj + (j - bj);
-
-            temp += A_[(row_a * N_) + col_a] * B_[(row_b * N_) + col_b];
-          }
-
-          C_[(i * N_) + j] += temp;
-        }
-      }
-    }
-  }
-}
-
-void vavilov_v_cannon_seq::CannonSequential::ShiftBlocks() {
-  std::vector<double> a_tmp = A_;
-  std::vector<double> b_tmp = B_;
-
-  for (unsigned int bi = 0; bi < num_blocks_; ++bi) {
-    for (unsigned int bj = 0; bj < num_blocks_; ++bj) {
-      unsigned int src_row = (bi + 1) % num_blocks_;
-      unsigned int src_col = (bj + 1) % num_blocks_;
-      for (unsigned int i = 0; i < block_size_; ++i) {
-        for (unsigned int j = 0; j < block_size_; ++j) {
-          B_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              b_tmp[(((src_row * block_size_) + i) * N_) + ((bj * block_size_) + j)];
-          A_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              a_tmp[(((bi * block_size_) + i) * N_) + ((src_col * block_size_) + j)];
-        }
-      }
+void vavilov_v_cannon_seq::CannonSequential::BlockMultiply(const ppc::core::CannonGrid& grid) {
+  // Block (bi, bj) of C accumulates the product of the tiles of A and B now at (bi, bj)
+  const size_t tile = static_cast<size_t>(block_size_) * block_size_;
+  for (unsigned int bi = 0; bi < num_blocks_; bi++) {
+    for (unsigned int bj = 0; bj < num_blocks_; bj++) {
+      const size_t c_offset = (static_cast<size_t>(bi) * block_size_ * N_) + (static_cast<size_t>(bj) * block_size_);
+      ppc::core::Gemm(block_size_, block_size_, block_size_, &A_[grid.ATile(bi, bj) * tile], block_size_,
+                      &B_[grid.BTile(bi, bj) * tile], block_size_, &C_[c_offset], N_);
     }
   }
 }
 
 bool vavilov_v_cannon_seq::CannonSequential::RunImpl() {
-  InitialShift();
+  ppc::core::CannonGrid grid(num_blocks_);
+  grid.InitialShift();
   for (unsigned int iter = 0; iter < num_blocks_; ++iter) {
-    BlockMultiply();
-    ShiftBlocks();
+    BlockMultiply(grid);
+    grid.Shift();
   }
   return true;
 }
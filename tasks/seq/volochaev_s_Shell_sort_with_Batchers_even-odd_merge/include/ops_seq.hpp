@@ -16,7 +16,9 @@ class ShellSortSequential : public ppc::core::Task {
 
  private:
   std::vector<int> array_;
-  static void ShellSort(std::vector<int>& arr);
+  // Merge target, swapped with array_ and reused from run to run
+  std::vector<int> scratch_;
+  void ShellSortWithBatcherMerge();
 };
 
 }  // namespace volochaev_s_shell_sort_with_batchers_even_odd_merge_seq
\ No newline at end of file
@@ -1,9 +1,11 @@
 #include "seq/volochaev_s_Shell_sort_with_Batchers_even-odd_merge/include/ops_seq.hpp"
 
-#include <cmath>
 #include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/sorting_network.hpp"
+
 bool volochaev_s_shell_sort_with_batchers_even_odd_merge_seq::ShellSortSequential::PreProcessingImpl() {
   // Init value for input and output
   unsigned int size = task_data->inputs_count[0];
@@ -19,27 +21,20 @@ bool volochaev_s_shell_sort_with_batchers_even_odd_merge_seq::ShellSortSequentia
 }
 
 bool volochaev_s_shell_sort_with_batchers_even_odd_merge_seq::ShellSortSequential::RunImpl() {
-  ShellSort(array_);
+  ShellSortWithBatcherMerge();
 
   return true;
 }
 
-void volochaev_s_shell_sort_with_batchers_even_odd_merge_seq::ShellSortSequential::ShellSort(std::vector<int>& arr) {
-  int n = static_cast<int>(arr.size());
-  int gap = n / 2;
-
-  while (gap > 0) {
-    for (int i = gap; i < n; ++i) {
-      int temp = arr[i];
-      int j = i;
-      while (j >= gap && arr[j - gap] > temp) {
-        arr[j] = arr[j - gap];
-        j -= gap;
-      }
-      arr[j] = temp;
-    }
-    gap /= 2;
-  }
+void volochaev_s_shell_sort_with_batchers_even_odd_merge_seq::ShellSortSequential::ShellSortWithBatcherMerge() {
+  // Halves sorted by the vectorized sorting network, then one bitonic merge into scratch_
+  const size_t mid = array_.size() / 2;
+  const std::span<int> data(array_);
+  ppc::core::NetworkSort(data.first(mid));
+  ppc::core::NetworkSort(data.subspan(mid));
+  scratch_.resize(array_.size());
+  ppc::core::BitonicMerge<int>(data.first(mid), data.subspan(mid), scratch_);
+  array_.swap(scratch_);
 }
 
 bool volochaev_s_shell_sort_with_batchers_even_odd_merge_seq::ShellSortSequential::PostProcessingImpl() {
@@ -3,11 +3,16 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
 #include <memory>
 #include <random>
+#include <span>
+#include <string>
 #include <vector>
 
+#include "core/sort/include/external_sort.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/file_io.hpp"
 #include "stl/burykin_m_radix/include/ops_stl.hpp"
 
 namespace {
@@ -150,3 +155,48 @@ TEST(burykin_m_radix_stl, EmptyVector) {
 
   EXPECT_EQ(output, expected);
 }
+
+TEST(burykin_m_radix_stl, ExternalSortOfFile) {
+  ppc::util::ScratchDirectory directory;
+  std::string input_path = directory.NewFile().string();
+  std::string output_path = directory.NewFile().string();
+  std::vector<int> input = GenerateRandomVector(200000);
+  ppc::util::FileWriter writer(input_path);
+  writer.Write(std::as_bytes(std::span(input)));
+  writer.Close();
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.push_back(reinterpret_cast<uint8_t*>(input_path.data()));
+  task_data->inputs_count.push_back(static_cast<std::uint32_t>(input_path.size()));
+  task_data->outputs.push_back(reinterpret_cast<uint8_t*>(output_path.data()));
+  task_data->outputs_count.push_back(static_cast<std::uint32_t>(output_path.size()));
+
+  // Runs of 32768 values, merged two at a time
+  burykin_m_radix_stl::RadixExternalSTL task(task_data, {.memory_budget = size_t{256} << 10,
+                                                         .temp_dir = directory.Path()});
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  std::ranges::sort(input);
+  const ppc::util::MappedFile output(output_path);
+  const auto* sorted = reinterpret_cast<const int*>(output.Bytes().data());
+  ASSERT_EQ(output.Size(), input.size() * sizeof(int));
+  EXPECT_TRUE(std::equal(input.begin(), input.end(), sorted));
+  EXPECT_EQ(task.GetStats().runs, 7U);
+  EXPECT_EQ(task.GetStats().merge_passes, 3U);
+}
+
+TEST(burykin_m_radix_stl, ExternalSortRejectsMissingFile) {
+  std::string input_path = "no/such/file.bin";
+  std::string output_path = "sorted.bin";
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.push_back(reinterpret_cast<uint8_t*>(input_path.data()));
+  task_data->inputs_count.push_back(static_cast<std::uint32_t>(input_path.size()));
+  task_data->outputs.push_back(reinterpret_cast<uint8_t*>(output_path.data()));
+  task_data->outputs_count.push_back(static_cast<std::uint32_t>(output_path.size()));
+
+  burykin_m_radix_stl::RadixExternalSTL task(task_data);
+  EXPECT_FALSE(task.Validation());
+}
@@ -1,10 +1,10 @@
 #pragma once
 
-#include <array>
-#include <cstddef>
+#include <filesystem>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/external_sort.hpp"
 #include "core/task/include/task.hpp"
 
 namespace burykin_m_radix_stl {
@@ -17,20 +17,28 @@ class RadixSTL : public ppc::core::Task {
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
-  static std::array<int, 256> ComputeFrequency(const std::vector<int>& a, int shift);
-  static std::array<int, 256> ComputeFrequencyParallel(const std::vector<int>& a, int shift, int num_threads);
-  static std::array<int, 256> ComputeIndices(const std::array<int, 256>& count);
-  static void DistributeElements(const std::vector<int>& a, std::vector<int>& b, std::array<int, 256> index, int shift);
-  static void DistributeElementsParallel(const std::vector<int>& a, std::vector<int>& b,
-                                         const std::array<int, 256>& global_index, int shift, int num_threads);
-  static void ComputeThreadCounts(const std::vector<int>& a, std::vector<std::array<int, 256>>& thread_counts,
-                                  int shift, int num_threads, size_t chunk_size);
-  static void ComputeThreadIndices(std::vector<std::array<int, 256>>& thread_indices,
-                                   const std::vector<std::array<int, 256>>& thread_counts,
-                                   const std::array<int, 256>& global_index, int num_threads);
-
  private:
   std::vector<int> input_, output_;
 };
 
+// External-memory mode for inputs larger than RAM: inputs[0] and outputs[0] hold the paths of
+// a binary file of ints and of the sorted file to write (inputs_count[0] and outputs_count[0]
+// characters long), and the sort stays within options.memory_budget bytes
+class RadixExternalSTL : public ppc::core::Task {
+ public:
+  explicit RadixExternalSTL(ppc::core::TaskDataPtr task_data, ppc::core::ExternalSortOptions options = {})
+      : Task(std::move(task_data)), options_(std::move(options)) {}
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  [[nodiscard]] const ppc::core::ExternalSortStats& GetStats() const { return stats_; }
+
+ private:
+  std::filesystem::path input_path_, output_path_;
+  ppc::core::ExternalSortOptions options_;
+  ppc::core::ExternalSortStats stats_;
+};
+
 }  // namespace burykin_m_radix_stl
\ No newline at end of file
@@ -6,10 +6,15 @@
 #include <cstdint>
 #include <memory>
 #include <random>
+#include <span>
+#include <string>
 #include <vector>
 
+#include "core/perf/include/call_timing.hpp"
 #include "core/perf/include/perf.hpp"
+#include "core/sort/include/external_sort.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/file_io.hpp"
 #include "stl/burykin_m_radix/include/ops_stl.hpp"
 
 namespace {
@@ -96,3 +101,63 @@ TEST(burykin_m_radix_stl, test_task_run) {
 
   EXPECT_EQ(output, expected);
 }
+
+TEST(burykin_m_radix_stl, test_external_task_run) {
+  // The file is four times the budget, runs and merge blocks go to the local temp directory
+  constexpr size_t kMemoryBudget = size_t{32} << 20;
+  constexpr size_t kNumElements = 4 * kMemoryBudget / sizeof(int);
+  constexpr size_t kBlock = size_t{1} << 20;
+
+  ppc::util::ScratchDirectory directory;
+  std::string input_path = directory.NewFile().string();
+  std::string output_path = directory.NewFile().string();
+  int64_t input_sum = 0;
+  {
+    ppc::util::FileWriter writer(input_path);
+    for (size_t written = 0; written < kNumElements; written += kBlock) {
+      const auto block = GenerateRandomVector(kBlock);
+      for (const int value : block) {
+        input_sum += value;
+      }
+      writer.Write(std::as_bytes(std::span(block)));
+    }
+    writer.Close();
+  }
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(input_path.data()));
+  task_data->inputs_count.emplace_back(static_cast<std::uint32_t>(input_path.size()));
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(output_path.data()));
+  task_data->outputs_count.emplace_back(static_cast<std::uint32_t>(output_path.size()));
+
+  auto task = std::make_shared<burykin_m_radix_stl::RadixExternalSTL>(
+      task_data, ppc::core::ExternalSortOptions{.memory_budget = kMemoryBudget, .temp_dir = directory.Path()});
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 3;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [t0]() {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(task);
+  perf_analyzer->TaskRun(perf_attr, perf_results);
+
+  // Kept out of the task_run output, which belongs to test_task_run
+  ppc::core::RecordFigure("external_s", perf_results->time_sec);
+
+  EXPECT_EQ(task->GetStats().runs, 8U);
+  const ppc::util::MappedFile output(output_path);
+  ASSERT_EQ(output.Size(), kNumElements * sizeof(int));
+  const std::span<const int> sorted(reinterpret_cast<const int *>(output.Bytes().data()), kNumElements);
+  EXPECT_TRUE(std::ranges::is_sorted(sorted));
+  int64_t output_sum = 0;
+  for (const int value : sorted) {
+    output_sum += value;
+  }
+  EXPECT_EQ(output_sum, input_sum);
+}
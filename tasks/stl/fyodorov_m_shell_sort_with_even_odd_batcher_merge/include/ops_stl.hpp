@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <cstddef>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -20,9 +21,11 @@ class TestTaskSTL : public ppc::core::Task {
  private:
   std::vector<int> input_, output_;
 
-  void ShellSort();
-  static void BatcherMerge(std::vector<int>& left, std::vector<int>& right, std::vector<int>& result);
-  void LaunchTasksForGroups(int gap, int n, size_t num_groups, size_t threads_to_use, const std::vector<int>& groups);
-  static void ProcessGroup(int gap, int n, std::vector<int>& input_ref, int group);
+  // Leaf sort of input_[begin, begin + block_size) through the vectorized sorting network
+  void SortBlock(size_t begin, size_t block_size);
+  // Merges the runs of input_ at begin of width elements each into output_
+  void MergeRuns(size_t begin, size_t width);
+  // SIMD bitonic merge network over two sorted runs
+  static void BatcherMerge(std::span<const int> left, std::span<const int> right, std::span<int> result);
 };
 }  // namespace fyodorov_m_shell_sort_with_even_odd_batcher_merge_stl
\ No newline at end of file
@@ -1,13 +1,14 @@
 #include "stl/fyodorov_m_shell_sort_with_even_odd_batcher_merge/include/ops_stl.hpp"
 
 #include <algorithm>
-#include <cmath>
 #include <cstddef>
 #include <future>
-#include <numeric>
-#include <thread>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/sorting_network.hpp"
+#include "core/util/include/util.hpp"
+
 namespace fyodorov_m_shell_sort_with_even_odd_batcher_merge_stl {
 
 bool TestTaskSTL::PreProcessingImpl() {
@@ -27,12 +28,30 @@ bool TestTaskSTL::ValidationImpl() {
 }
 
 bool TestTaskSTL::RunImpl() {
-  ShellSort();
-  size_t mid = input_.size() / 2;
-  std::vector<int> left(input_.begin(), input_.begin() + static_cast<std::ptrdiff_t>(mid));
-  std::vector<int> right(input_.begin() + static_cast<std::ptrdiff_t>(mid), input_.end());
+  const size_t n = input_.size();
+  const auto threads_count = static_cast<size_t>(ppc::util::GetPPCNumThreads());
+  const size_t block_size = std::max<size_t>(1, (n + threads_count - 1) / threads_count);
 
-  BatcherMerge(left, right, output_);
+  std::vector<std::future<void>> futures;
+  for (size_t begin = 0; begin < n; begin += block_size) {
+    futures.push_back(std::async(std::launch::async, [this, begin, block_size] { SortBlock(begin, block_size); }));
+  }
+  for (auto& future : futures) {
+    future.get();
+  }
+
+  // Merge rounds write to output_ and swap it with input_, so every round reads its runs from input_
+  for (size_t width = block_size; width < n; width *= 2) {
+    futures.clear();
+    for (size_t begin = 0; begin < n; begin += 2 * width) {
+      futures.push_back(std::async(std::launch::async, [this, begin, width] { MergeRuns(begin, width); }));
+    }
+    for (auto& future : futures) {
+      future.get();
+    }
+    input_.swap(output_);
+  }
+  input_.swap(output_);
 
   return true;
 }
@@ -44,87 +63,21 @@ bool TestTaskSTL::PostProcessingImpl() {
   return true;
 }
 
-void TestTaskSTL::ProcessGroup(int gap, int n, std::vector<int>& input_ref, int group) {
-  for (int i = group + gap; i < n; i += gap) {
-    int temp = input_ref[i];
-    int j = i;
-    while (j >= gap && input_ref[j - gap] > temp) {
-      input_ref[j] = input_ref[j - gap];
-      j -= gap;
-    }
-    input_ref[j] = temp;
-  }
+void TestTaskSTL::SortBlock(size_t begin, size_t block_size) {
+  ppc::core::NetworkSort(std::span<int>(input_).subspan(begin, std::min(block_size, input_.size() - begin)));
 }
 
-void TestTaskSTL::LaunchTasksForGroups(int gap, int n, size_t num_groups, size_t threads_to_use,
-                                       const std::vector<int>& groups) {
-  std::vector<std::future<void>> futures;
-  futures.reserve(threads_to_use);
-
-  for (size_t t = 0; t < threads_to_use; ++t) {
-    futures.push_back(std::async(std::launch::async, [t, threads_to_use, num_groups, gap, n, this, &groups]() {
-      size_t groups_per_thread = num_groups / threads_to_use;
-      size_t extra = num_groups % threads_to_use;
-      size_t start = (t * groups_per_thread) + std::min(t, extra);
-      size_t end = start + groups_per_thread + (t < extra ? 1 : 0);
-      for (size_t g = start; g < end; ++g) {
-        TestTaskSTL::ProcessGroup(gap, n, input_, groups[g]);
-      }
-    }));
-  }
-
-  for (auto& future : futures) {
-    future.wait();
-  }
+void TestTaskSTL::MergeRuns(size_t begin, size_t width) {
+  const size_t n = input_.size();
+  const size_t mid = std::min(begin + width, n);
+  const size_t end = std::min(begin + (2 * width), n);
+  const std::span<const int> runs(input_);
+  BatcherMerge(runs.subspan(begin, mid - begin), runs.subspan(mid, end - mid),
+               std::span<int>(output_).subspan(begin, end - begin));
 }
 
-void TestTaskSTL::ShellSort() {
-  int n = static_cast<int>(input_.size());
-  std::vector<int> gaps;
-
-  for (int k = 1; (1 << k) - 1 < n; ++k) {
-    gaps.push_back((1 << k) - 1);
-  }
-
-  unsigned int num_threads = std::thread::hardware_concurrency();
-  if (num_threads == 0) {
-    num_threads = 1;
-  }
-
-  for (auto it = gaps.rbegin(); it != gaps.rend(); ++it) {
-    int gap = *it;
-    if (gap == 0) {
-      continue;
-    }
-    std::vector<int> groups(gap);
-    std::iota(groups.begin(), groups.end(), 0);
-    size_t num_groups = groups.size();
-    size_t threads_to_use = std::min(num_groups, static_cast<size_t>(num_threads));
-
-    LaunchTasksForGroups(gap, n, num_groups, threads_to_use, groups);
-  }
-}
-
-void TestTaskSTL::BatcherMerge(std::vector<int>& left, std::vector<int>& right, std::vector<int>& result) {
-  size_t i = 0;
-  size_t j = 0;
-  size_t k = 0;
-
-  while (i < left.size() && j < right.size()) {
-    if (left[i] <= right[j]) {
-      result[k++] = left[i++];
-    } else {
-      result[k++] = right[j++];
-    }
-  }
-
-  while (i < left.size()) {
-    result[k++] = left[i++];
-  }
-
-  while (j < right.size()) {
-    result[k++] = right[j++];
-  }
+void TestTaskSTL::BatcherMerge(std::span<const int> left, std::span<const int> right, std::span<int> result) {
+  ppc::core::BitonicMerge<int>(left, right, result);
 }
 
 }  // namespace fyodorov_m_shell_sort_with_even_odd_batcher_merge_stl
\ No newline at end of file
@@ -2,10 +2,15 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <functional>
+#include <span>
 #include <thread>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 std::vector<unsigned int> kalyakina_a_shell_with_simple_merge_stl::ShellSortSTL::CalculationOfGapLengths(
@@ -81,6 +86,13 @@ bool kalyakina_a_shell_with_simple_merge_stl::ShellSortSTL::ValidationImpl() {
 }
 
 bool kalyakina_a_shell_with_simple_merge_stl::ShellSortSTL::RunImpl() {
+  presort_stats_ = ppc::core::AdaptiveSort(
+      std::span<int>(output_), [this](std::span<int> /*data*/) { SortAndMerge(); },
+      static_cast<size_t>(ppc::util::GetPPCNumThreads()), std::less<>(), ppc::core::PoolForEach{});
+  return true;
+}
+
+void kalyakina_a_shell_with_simple_merge_stl::ShellSortSTL::SortAndMerge() {
   std::vector<std::pair<unsigned int, unsigned int>> bounds;
   unsigned int num = (static_cast<unsigned int>(ppc::util::GetPPCNumThreads()) > output_.size())
                          ? output_.size()
@@ -118,8 +130,6 @@ bool kalyakina_a_shell_with_simple_merge_stl::ShellSortSTL::RunImpl() {
     }
     num = std::ceil(static_cast<double>(num) / 2);
   }
-
-  return true;
 }
 
 bool kalyakina_a_shell_with_simple_merge_stl::ShellSortSTL::PostProcessingImpl() {
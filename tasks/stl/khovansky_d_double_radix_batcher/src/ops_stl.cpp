@@ -4,36 +4,16 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <cstring>
+#include <span>
 #include <thread>
 #include <vector>
 
+#include "core/sort/include/key_transform.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 namespace khovansky_d_double_radix_batcher_stl {
 namespace {
-uint64_t EncodeDoubleToUint64(double value) {
-  uint64_t bit_representation = 0;
-  std::memcpy(&bit_representation, &value, sizeof(value));
-
-  if ((bit_representation >> 63) != 0) {
-    return ~bit_representation;
-  }
-  return bit_representation ^ (1ULL << 63);
-}
-
-double DecodeUint64ToDouble(uint64_t encoded) {
-  if ((encoded >> 63) != 0) {
-    encoded ^= (1ULL << 63);
-  } else {
-    encoded = ~encoded;
-  }
-
-  double result = 0.0;
-  std::memcpy(&result, &encoded, sizeof(result));
-  return result;
-}
-
 void RadixSort(std::vector<uint64_t>& array, int thread_count) {
   const int bits_in_byte = 8;
   const int total_bits = 64;
@@ -115,44 +95,10 @@ void BatcherOddEvenMerge(std::vector<uint64_t>& array, int left, int right, int
   }
 }
 
-void RadixBatcherSort(std::vector<double>& data) {
-  std::vector<uint64_t> transformed_data(data.size());
-  size_t n = data.size();
-  const int thread_count = std::max(1, std::min(static_cast<int>(n), ppc::util::GetPPCNumThreads()));
-  size_t block_size = (n + thread_count - 1) / thread_count;
-  std::vector<std::thread> threads(thread_count);
-
-  for (int t = 0; t < thread_count; ++t) {
-    threads[t] = std::thread([&data, &transformed_data, t, block_size, n]() {
-      size_t begin = t * block_size;
-      size_t end = std::min(begin + block_size, n);
-      for (size_t i = begin; i < end; ++i) {
-        transformed_data[i] = EncodeDoubleToUint64(data[i]);
-      }
-    });
-  }
-  for (auto& th : threads) {
-    th.join();
-  }
-
-  RadixSort(transformed_data, thread_count);
-  BatcherOddEvenMerge(transformed_data, 0, static_cast<int>(n), thread_count);
-
-  threads.clear();
-  threads.resize(thread_count);
-
-  for (int t = 0; t < thread_count; ++t) {
-    threads[t] = std::thread([&data, &transformed_data, t, block_size, n]() {
-      size_t begin = t * block_size;
-      size_t end = std::min(begin + block_size, n);
-      for (size_t i = begin; i < end; ++i) {
-        data[i] = DecodeUint64ToDouble(transformed_data[i]);
-      }
-    });
-  }
-  for (auto& th : threads) {
-    th.join();
-  }
+void RadixBatcherSort(std::vector<uint64_t>& keys) {
+  const int thread_count = std::max(1, std::min(static_cast<int>(keys.size()), ppc::util::GetPPCNumThreads()));
+  RadixSort(keys, thread_count);
+  BatcherOddEvenMerge(keys, 0, static_cast<int>(keys.size()), thread_count);
 }
 }  // namespace
 }  // namespace khovansky_d_double_radix_batcher_stl
@@ -161,10 +107,10 @@ bool khovansky_d_double_radix_batcher_stl::RadixSTL::PreProcessingImpl() {
   auto* in_ptr = reinterpret_cast<double*>(task_data->inputs[0]);
 
   unsigned int input_size = task_data->inputs_count[0];
-  unsigned int output_size = task_data->outputs_count[0];
 
-  input_ = std::vector<double>(in_ptr, in_ptr + input_size);
-  output_ = std::vector<double>(output_size, 0);
+  keys_.resize(input_size);
+  ppc::core::ToRadixKeys(std::span<const double>(in_ptr, input_size), std::span<uint64_t>(keys_),
+                         ppc::core::PoolForEach{});
 
   return true;
 }
@@ -190,14 +136,13 @@ bool khovansky_d_double_radix_batcher_stl::RadixSTL::ValidationImpl() {
 }
 
 bool khovansky_d_double_radix_batcher_stl::RadixSTL::RunImpl() {
-  output_ = input_;
-  khovansky_d_double_radix_batcher_stl::RadixBatcherSort(output_);
+  khovansky_d_double_radix_batcher_stl::RadixBatcherSort(keys_);
   return true;
 }
 
 bool khovansky_d_double_radix_batcher_stl::RadixSTL::PostProcessingImpl() {
-  for (size_t i = 0; i < output_.size(); i++) {
-    reinterpret_cast<double*>(task_data->outputs[0])[i] = output_[i];
-  }
+  auto* out_ptr = reinterpret_cast<double*>(task_data->outputs[0]);
+  ppc::core::FromRadixKeys(std::span<const uint64_t>(keys_), std::span<double>(out_ptr, keys_.size()),
+                           ppc::core::PoolForEach{});
   return true;
 }
@@ -2,12 +2,14 @@
 
 #include <cmath>
 #include <complex>
-#include <core/util/include/util.hpp>
 #include <cstddef>
 #include <iostream>
-#include <thread>
+#include <utility>
 #include <vector>
 
+#include "core/sparse/include/spgemm.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
 void kolodkin_g_multiplication_matrix_stl::SparseMatrixCRS::AddValue(int row, Complex value, int col) {
   for (int j = rowPtr[row]; j < rowPtr[row + 1]; ++j) {
     if (colIndices[j] == col) {
@@ -131,52 +133,31 @@ bool kolodkin_g_multiplication_matrix_stl::TestTaskSTL::ValidationImpl() {
   // Check equality of counts elements
   unsigned int input_size = task_data->inputs_count[0];
   auto* in_ptr = reinterpret_cast<Complex*>(task_data->inputs[0]);
+  if (input_size < 5) {
+    return false;
+  }
   std::vector<Complex> vec = std::vector<Complex>(in_ptr, in_ptr + input_size);
-  return !(vec[1] != vec[5 + (int)(vec[2].real() + vec[3].real() + vec[4].real())].real());
+  auto b_offset = 5 + (unsigned int)(vec[2].real() + vec[3].real() + vec[4].real());
+  return b_offset < input_size && vec[1] == vec[b_offset].real();
 }
 
 bool kolodkin_g_multiplication_matrix_stl::TestTaskSTL::RunImpl() {
+  // The rows of A * B are the columns of B^T A^T, so the compressed rows multiply with the operands swapped
+  const ppc::core::CompressedView<Complex> a{.lines = static_cast<size_t>(A_.numRows),
+                                             .extent = static_cast<size_t>(A_.numCols),
+                                             .ptr = A_.rowPtr,
+                                             .idx = A_.colIndices,
+                                             .val = A_.values};
+  const ppc::core::CompressedView<Complex> b{.lines = static_cast<size_t>(B_.numRows),
+                                             .extent = static_cast<size_t>(B_.numCols),
+                                             .ptr = B_.rowPtr,
+                                             .idx = B_.colIndices,
+                                             .val = B_.values};
+  auto product = ppc::core::SpGemm(b, a, ppc::core::PoolForEach{});
   SparseMatrixCRS c(A_.numRows, B_.numCols);
-  const int num_threads = ppc::util::GetPPCNumThreads();
-  std::vector<std::thread> threads(num_threads);
-  std::vector<SparseMatrixCRS> local_results(num_threads, SparseMatrixCRS(A_.numRows, B_.numCols));
-
-  auto worker = [&](unsigned int start_row, unsigned int end_row, int thread_index) {
-    SparseMatrixCRS local_c(A_.numRows, B_.numCols);
-    for (unsigned int i = start_row; i < end_row; ++i) {
-      for (unsigned int j = A_.rowPtr[i]; j < (unsigned int)A_.rowPtr[i + 1]; ++j) {
-        unsigned int col_a = A_.colIndices[j];
-        Complex value_a = A_.values[j];
-        for (unsigned int k = B_.rowPtr[col_a]; k < (unsigned int)B_.rowPtr[col_a + 1]; ++k) {
-          unsigned int col_b = B_.colIndices[k];
-          Complex value_b = B_.values[k];
-
-          local_c.AddValue((int)i, value_a * value_b, (int)col_b);
-        }
-      }
-    }
-    local_results[thread_index] = local_c;
-  };
-
-  unsigned int rows_per_thread = A_.numRows / num_threads;
-  for (int t = 0; t < num_threads; ++t) {
-    unsigned int start_row = t * rows_per_thread;
-    unsigned int end_row = (t == num_threads - 1) ? A_.numRows : start_row + rows_per_thread;
-    threads[t] = std::thread(worker, start_row, end_row, t);
-  }
-
-  for (auto& thread : threads) {
-    thread.join();
-  }
-
-  for (const auto& local_c : local_results) {
-    for (unsigned int i = 0; i < (unsigned int)local_c.numRows; ++i) {
-      for (unsigned int j = local_c.rowPtr[i]; j < (unsigned int)local_c.rowPtr[i + 1]; ++j) {
-        c.AddValue((int)i, local_c.values[j], local_c.colIndices[j]);
-      }
-    }
-  }
-
+  c.values = std::move(product.val);
+  c.colIndices = std::move(product.idx);
+  c.rowPtr = std::move(product.ptr);
   output_ = ParseMatrixIntoVec(c);
   return true;
 }
@@ -23,12 +23,6 @@ struct CCSMatrix {
   CCSMatrix() : rows(0), cols(0) {}
   CCSMatrix(std::pair<int, int> sizes) : rows(sizes.first), cols(sizes.second) { col_ptrs.resize(cols + 1, 0); }
   CCSMatrix operator*(const CCSMatrix& other) const;
-
- private:
-  [[nodiscard]] std::vector<std::vector<std::pair<int, std::complex<double>>>> ComputeColumns(
-      const CCSMatrix& other) const;
-  static void FillResultFromTempCols(const std::vector<std::vector<std::pair<int, std::complex<double>>>>& temp_cols,
-                                     int cols, CCSMatrix& result);
 };
 
 class TestTaskSTL : public ppc::core::Task {
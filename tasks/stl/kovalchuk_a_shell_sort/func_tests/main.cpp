@@ -1,11 +1,14 @@
 #include <gtest/gtest.h>
 
 #include <climits>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
+#include <numeric>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
 #include "core/task/include/task.hpp"
 #include "stl/kovalchuk_a_shell_sort/include/ops_stl.hpp"
 
@@ -173,3 +176,24 @@ TEST(kovalchuk_a_shell_sort_stl, Test_RandomData) {
   std::vector<int> expected = {1, 2, 3, 4, 7, 9};
   EXPECT_EQ(expected, output);
 }
+
+TEST(kovalchuk_a_shell_sort_stl, Test_ReversedInputReportsPresortPath) {
+  constexpr size_t kSize = 1000;
+  std::vector<int> input(kSize);
+  std::iota(input.rbegin(), input.rend(), 0);
+  std::vector<int> output(kSize);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(input.data()));
+  task_data->inputs_count.emplace_back(input.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t*>(output.data()));
+  task_data->outputs_count.emplace_back(output.size());
+
+  kovalchuk_a_shell_sort_stl::ShellSortSTL task(task_data);
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  EXPECT_EQ(task.GetPresortStats().path, ppc::core::PresortPath::kReversed);
+}
@@ -1,12 +1,17 @@
 #include "stl/kovalchuk_a_shell_sort/include/ops_stl.hpp"
 
 #include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <span>
 #include <thread>
 #include <utility>
 #include <vector>
 
 #include "../modules/core/util/include/util.hpp"
+#include "core/sort/include/presortedness.hpp"
 #include "core/task/include/task.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 
 namespace kovalchuk_a_shell_sort_stl {
 
@@ -24,7 +29,9 @@ bool ShellSortSTL::ValidationImpl() {
 }
 
 bool ShellSortSTL::RunImpl() {
-  ShellSort();
+  presort_stats_ = ppc::core::AdaptiveSort(
+      std::span<int>(input_), [this](std::span<int> /*data*/) { ShellSort(); },
+      static_cast<size_t>(ppc::util::GetPPCNumThreads()), std::less<>(), ppc::core::PoolForEach{});
   return true;
 }
 
@@ -18,11 +18,11 @@ class MultMatSTL : public ppc::core::Task {
  private:
   struct BlockDesc {
     int row;
-    int col;
     int step;
   };
 
-  void MultiplyBlock(const BlockDesc &desc);
+  // C[block row] += A[block row, step block] * B[step block row]
+  void MultiplyBlockRow(const BlockDesc &desc);
   std::vector<double> matrix_a_, matrix_b_, matrix_c_;
   int matrix_size_{};
   int num_blocks_{};
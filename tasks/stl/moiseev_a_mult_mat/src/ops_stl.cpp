@@ -6,6 +6,7 @@
 #include <thread>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
 #include "core/util/include/util.hpp"
 
 bool moiseev_a_mult_mat_stl::MultMatSTL::PreProcessingImpl() {
@@ -36,30 +37,13 @@ bool moiseev_a_mult_mat_stl::MultMatSTL::ValidationImpl() {
          (task_data->inputs_count[0] == task_data->outputs_count[0]);
 }
 
-void moiseev_a_mult_mat_stl::MultMatSTL::MultiplyBlock(const BlockDesc &desc) {
-  int block_row = desc.row;
-  int block_col = desc.col;
-  int block_step = desc.step;
-
-  int a_block_col = (block_row + block_step) % num_blocks_;
-  int b_block_row = a_block_col;
-
-  int row_base = block_row * block_size_;
-  int col_base = block_col * block_size_;
-  int a_col_base = a_block_col * block_size_;
-  int b_row_base = b_block_row * block_size_;
-
-  for (int i = 0; i < block_size_; ++i) {
-    for (int j = 0; j < block_size_; ++j) {
-      double sum = 0.0;
-      for (int k = 0; k < block_size_; ++k) {
-        double a = matrix_a_[((row_base + i) * matrix_size_) + (a_col_base + k)];
-        double b = matrix_b_[((b_row_base + k) * matrix_size_) + (col_base + j)];
-        sum += a * b;
-      }
-      matrix_c_[((row_base + i) * matrix_size_) + (col_base + j)] += sum;
-    }
-  }
+void moiseev_a_mult_mat_stl::MultMatSTL::MultiplyBlockRow(const BlockDesc &desc) {
+  // Every block column of the row uses the same block of A in a step, so they form one strip GEMM
+  const auto row_start = static_cast<size_t>(desc.row) * block_size_;
+  const auto a_col_start = static_cast<size_t>((desc.row + desc.step) % num_blocks_) * block_size_;
+  ppc::core::Gemm(block_size_, matrix_size_, block_size_, &matrix_a_[(row_start * matrix_size_) + a_col_start],
+                  matrix_size_, &matrix_b_[a_col_start * matrix_size_], matrix_size_,
+                  &matrix_c_[row_start * matrix_size_], matrix_size_);
 }
 
 bool moiseev_a_mult_mat_stl::MultMatSTL::RunImpl() {
@@ -75,10 +59,8 @@ bool moiseev_a_mult_mat_stl::MultMatSTL::RunImpl() {
     std::size_t end = start + count;
 
     for (int br = static_cast<int>(start); br < static_cast<int>(end); ++br) {
-      for (int bc = 0; bc < num_blocks_; ++bc) {
-        for (int bs = 0; bs < num_blocks_; ++bs) {
-          MultiplyBlock({.row = br, .col = bc, .step = bs});
-        }
+      for (int bs = 0; bs < num_blocks_; ++bs) {
+        MultiplyBlockRow({.row = br, .step = bs});
       }
     }
   };
@@ -16,13 +16,9 @@ class HoareSortSimpleMergeSTL : public ppc::core::Task {
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
-  void QuickSort(size_t low, size_t high);
-
  private:
   std::vector<double> vect_;
   size_t vect_size_{};
-
-  size_t Partition(size_t low, size_t high);
 };
 
 }  // namespace nikolaev_r_hoare_sort_simple_merge_stl
@@ -6,28 +6,24 @@
 #include <cstdint>
 #include <functional>
 #include <thread>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/key_transform.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 namespace {
-auto Translate(double e, std::size_t i) {
-  const uint64_t mask = 1ULL << ((sizeof(uint64_t) * 8) - 1);
-  const union {
-    double dbl;
-    uint64_t uint64;
-  } uni{.dbl = e};
-  const uint64_t u = ((uni.uint64 & mask) == 0U) ? (uni.uint64 | mask) : (~uni.uint64);
-  return (u >> (i * 8)) & 0xFF;
-}
+// Keys come from ppc::core::ToRadixKeys, so a byte of the key is a radix digit as it is
+auto Translate(uint64_t e, std::size_t i) { return (e >> (i * 8)) & 0xFF; }
 
-void Radix(double *p, int len) {
-  std::vector<double> tmpb(len);
-  double *tmp = tmpb.data();
+void Radix(uint64_t *p, int len) {
+  std::vector<uint64_t> tmpb(len);
+  uint64_t *tmp = tmpb.data();
   std::vector<std::size_t> cnt(1 << 8, 0);
 
-  for (std::size_t i = 0; i < sizeof(double); ++i) {
+  for (std::size_t i = 0; i < sizeof(uint64_t); ++i) {
     for (auto &c : cnt) {
       c = 0;
     }
@@ -46,12 +42,12 @@ void Radix(double *p, int len) {
   }
 }
 
-void OddEvenBatcherMergeBlocksStep(std::pair<double *, int> &left, std::pair<double *, int> &right) {
+void OddEvenBatcherMergeBlocksStep(std::pair<uint64_t *, int> &left, std::pair<uint64_t *, int> &right) {
   std::inplace_merge(left.first, right.first, right.first + right.second);
   left.second += right.second;
 }
 
-void ParallelOddEvenBatcherMerge(int bsz, std::vector<std::pair<double *, int>> &vb, int par_if_greater) {
+void ParallelOddEvenBatcherMerge(int bsz, std::vector<std::pair<uint64_t *, int>> &vb, int par_if_greater) {
   const int thr = ppc::util::GetPPCNumThreads();
   std::vector<std::thread> thds(thr);
   for (int step = 1, pack = int(vb.size()); pack > 1; step *= 2, pack /= 2) {
@@ -82,34 +78,32 @@ bool petrov_a_radix_double_batcher_stl::TestTaskParallelStl::ValidationImpl() {
 }
 
 bool petrov_a_radix_double_batcher_stl::TestTaskParallelStl::PreProcessingImpl() {
-  in_.assign(reinterpret_cast<double *>(task_data->inputs[0]),
-             reinterpret_cast<double *>(task_data->inputs[0]) + task_data->inputs_count[0]);
+  const std::span<const double> in(reinterpret_cast<double *>(task_data->inputs[0]), task_data->inputs_count[0]);
+  keys_.resize(in.size());
+  ppc::core::ToRadixKeys(in, std::span<uint64_t>(keys_), ppc::core::PoolForEach{});
   return true;
 }
 
 bool petrov_a_radix_double_batcher_stl::TestTaskParallelStl::RunImpl() {
-  const int sz = int(in_.size());
+  const int sz = int(keys_.size());
   const int thr = std::min(sz, ppc::util::GetPPCNumThreads());
   if (0 == sz) {
     return true;
   }
 
-  res_.resize(in_.size());
-  std::ranges::copy(in_, res_.begin());
-
   const int bsz = sz / thr;
   const int bex = sz % thr;
 
-  std::vector<std::pair<double *, int>> vb(thr);
+  std::vector<std::pair<uint64_t *, int>> vb(thr);
   for (int i = 0; i < thr; i++) {
-    vb[i] = std::make_pair(res_.data() + (i * bsz), bsz);  // NOLINT(*narrow*)
+    vb[i] = std::make_pair(keys_.data() + (i * bsz), bsz);  // NOLINT(*narrow*)
   }
   vb[vb.size() - 1].second += bex;
 
   std::vector<std::thread> thds(thr);
   for (int i = 0; i < thr; i++) {
     thds[i] = std::thread(
-        [&](std::pair<double *, int> &blck) {
+        [&](std::pair<uint64_t *, int> &blck) {
           const auto &[p, l] = blck;
           Radix(p, l);
         },
@@ -126,6 +120,8 @@ bool petrov_a_radix_double_batcher_stl::TestTaskParallelStl::RunImpl() {
 }
 
 bool petrov_a_radix_double_batcher_stl::TestTaskParallelStl::PostProcessingImpl() {
-  std::ranges::copy(res_, reinterpret_cast<double *>(task_data->outputs[0]));
+  ppc::core::FromRadixKeys(std::span<const uint64_t>(keys_),
+                           std::span<double>(reinterpret_cast<double *>(task_data->outputs[0]), keys_.size()),
+                           ppc::core::PoolForEach{});
   return true;
 }
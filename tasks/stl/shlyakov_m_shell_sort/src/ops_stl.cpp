@@ -2,9 +2,13 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
+#include <span>
 #include <thread>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 namespace shlyakov_m_shell_sort_stl {
@@ -21,9 +25,17 @@ bool TestTaskSTL::PreProcessingImpl() {
 bool TestTaskSTL::ValidationImpl() { return task_data->inputs_count[0] == task_data->outputs_count[0]; }
 
 bool TestTaskSTL::RunImpl() {
+  presort_stats_ = ppc::core::AdaptiveSort(
+      std::span<int>(input_), [this](std::span<int> /*data*/) { SortAndMerge(); },
+      static_cast<size_t>(ppc::util::GetPPCNumThreads()), std::less<>(), ppc::core::PoolForEach{});
+  output_ = input_;
+  return true;
+}
+
+void TestTaskSTL::SortAndMerge() {
   int array_size = static_cast<int>(input_.size());
   if (array_size < 2) {
-    return true;
+    return;
   }
 
   unsigned int hardware_threads = ppc::util::GetPPCNumThreads();
@@ -75,9 +87,6 @@ bool TestTaskSTL::RunImpl() {
     sub_arr_size *= 2;
     num_threads = new_num_threads;
   }
-
-  output_ = input_;
-  return true;
 }
 
 void Merge(int left, int mid, int right, std::vector<int>& arr, std::vector<int>& buffer) {
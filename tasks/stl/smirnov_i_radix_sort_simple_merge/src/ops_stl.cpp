@@ -1,17 +1,15 @@
 #include "stl/smirnov_i_radix_sort_simple_merge/include/ops_stl.hpp"
 
 #include <algorithm>
-#include <cmath>
 #include <cstddef>
 #include <deque>
-#include <functional>
-#include <future>
 #include <mutex>
-#include <numeric>
-#include <thread>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/radix_sort.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 std::vector<int> smirnov_i_radix_sort_simple_merge_stl::TestTaskSTL::Merge(std::vector<int> &mas1,
@@ -45,26 +43,7 @@ std::vector<int> smirnov_i_radix_sort_simple_merge_stl::TestTaskSTL::Merge(std::
   return res;
 }
 void smirnov_i_radix_sort_simple_merge_stl::TestTaskSTL::RadixSort(std::vector<int> &mas) {
-  if (mas.empty()) {
-    return;
-  }
-  int longest = *std::ranges::max_element(mas.begin(), mas.end());
-  int len = std::ceil(std::log10(longest + 1));
-  std::vector<int> sorting(mas.size());
-  int base = 1;
-  for (int j = 0; j < len; j++, base *= 10) {
-    std::vector<int> counting(10, 0);
-    for (size_t i = 0; i < mas.size(); i++) {
-      counting[mas[i] / base % 10]++;
-    }
-    std::partial_sum(counting.begin(), counting.end(), counting.begin());
-    for (int i = static_cast<int>(mas.size() - 1); i >= 0; i--) {
-      int pos = counting[mas[i] / base % 10] - 1;
-      sorting[pos] = mas[i];
-      counting[mas[i] / base % 10]--;
-    }
-    std::swap(mas, sorting);
-  }
+  ppc::core::RadixSort(std::span<int>(mas));
 }
 std::vector<int> smirnov_i_radix_sort_simple_merge_stl::TestTaskSTL::Sorting(int id, std::vector<int> &mas,
                                                                              int max_th) {
@@ -117,35 +96,25 @@ bool smirnov_i_radix_sort_simple_merge_stl::TestTaskSTL::RunImpl() {
   const int min_chunk_size = 20;
   max_th = std::min(max_th, static_cast<int>(mas_.size() / min_chunk_size) + 1);
   max_th = std::max(1, max_th);
-  std::mutex mtxfirstdq;
   std::mutex mtx;
-  std::vector<std::future<std::vector<int>>> ths(max_th);
-  for (int i = 0; i < max_th; i++) {
-    ths[i] = std::async(std::launch::async, &smirnov_i_radix_sort_simple_merge_stl::TestTaskSTL::Sorting, i,
-                        std::ref(mas_), max_th);
-  }
+  std::vector<std::vector<int>> sorted_parts(max_th);
+  ppc::core::ParallelFor(0, max_th, [&](int i) { sorted_parts[i] = Sorting(i, mas_, max_th); });
   std::deque<std::vector<int>> firstdq;
   std::deque<std::vector<int>> seconddq;
-  for (int i = 0; i < max_th; i++) {
-    std::vector<int> local_mas = ths[i].get();
+  for (auto &local_mas : sorted_parts) {
     if (!local_mas.empty()) {
-      std::lock_guard<std::mutex> lock(mtxfirstdq);
       firstdq.push_back(std::move(local_mas));
     }
   }
   bool flag = static_cast<int>(firstdq.size()) != 1;
-  std::vector<std::thread> threads{};
   while (flag) {
     int pairs = (static_cast<int>(firstdq.size()) + 1) / 2;
-    threads.clear();
-    threads.reserve(pairs);
+    // Pairs of one round are merged by the shared pool instead of freshly spawned threads
+    ppc::core::TaskGroup round;
     for (int i = 0; i < pairs; i++) {
-      threads.emplace_back(&smirnov_i_radix_sort_simple_merge_stl::TestTaskSTL::Merging, std::ref(firstdq),
-                           std::ref(seconddq), std::ref(mtx));
-    }
-    for (auto &th : threads) {
-      th.join();
+      round.Run([&] { Merging(firstdq, seconddq, mtx); });
     }
+    round.Wait();
     if (static_cast<int>(firstdq.size()) == 1) {
       seconddq.push_back(std::move(firstdq.front()));
       firstdq.pop_front();
@@ -3,6 +3,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
 #include "core/task/include/task.hpp"
 
 namespace solovyev_d_shell_sort_simple_stl {
@@ -14,10 +15,15 @@ class TaskSTL : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
+  // Order of the input as the pre-pass measured it, and the path the sort took
+  [[nodiscard]] const ppc::core::PresortStats &GetPresortStats() const { return presort_stats_; }
 
  private:
+  void ShellSort();
+
   std::vector<int> input_;
+  ppc::core::PresortStats presort_stats_;
   int num_threads_ = 0;
 };
 
-}  // namespace solovyev_d_shell_sort_simple_stl
\ No newline at end of file
+}  // namespace solovyev_d_shell_sort_simple_stl
\ No newline at end of file
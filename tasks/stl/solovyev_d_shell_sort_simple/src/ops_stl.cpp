@@ -4,9 +4,13 @@
 #include <barrier>
 #include <cmath>
 #include <cstddef>
+#include <functional>
+#include <span>
 #include <thread>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 bool solovyev_d_shell_sort_simple_stl::TaskSTL::PreProcessingImpl() {
@@ -22,6 +26,14 @@ bool solovyev_d_shell_sort_simple_stl::TaskSTL::ValidationImpl() {
 }
 
 bool solovyev_d_shell_sort_simple_stl::TaskSTL::RunImpl() {
+  num_threads_ = std::max(1, ppc::util::GetPPCNumThreads());
+  presort_stats_ =
+      ppc::core::AdaptiveSort(std::span<int>(input_), [this](std::span<int> /*data*/) { ShellSort(); },
+                              static_cast<size_t>(num_threads_), std::less<>(), ppc::core::PoolForEach{});
+  return true;
+}
+
+void solovyev_d_shell_sort_simple_stl::TaskSTL::ShellSort() {
   num_threads_ = std::max(1, ppc::util::GetPPCNumThreads());
   std::barrier sync_point(num_threads_);
 
@@ -49,7 +61,6 @@ bool solovyev_d_shell_sort_simple_stl::TaskSTL::RunImpl() {
       th.join();
     }
   }
-  return true;
 }
 
 bool solovyev_d_shell_sort_simple_stl::TaskSTL::PostProcessingImpl() {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -17,7 +18,8 @@ class SortTask : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<double> input_, output_;
+  // Radix keys of the inputs and of the sorted outputs
+  std::vector<uint64_t> input_, output_;
 };
 
 }  // namespace sorochkin_d_radix_double_sort_simple_merge_stl
\ No newline at end of file
@@ -3,9 +3,12 @@
 #include <algorithm>
 #include <cstddef>
 #include <functional>
+#include <span>
 #include <thread>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 void sotskov_a_shell_sorting_with_simple_merging_stl::ShellSort(std::vector<int>& arr, int left, int right) {
@@ -104,7 +107,9 @@ bool sotskov_a_shell_sorting_with_simple_merging_stl::TestTaskSTL::ValidationImp
 }
 
 bool sotskov_a_shell_sorting_with_simple_merging_stl::TestTaskSTL::RunImpl() {
-  ShellSortWithSimpleMerging(input_);
+  presort_stats_ = ppc::core::AdaptiveSort(
+      std::span<int>(input_), [this](std::span<int> /*data*/) { ShellSortWithSimpleMerging(input_); },
+      static_cast<size_t>(ppc::util::GetPPCNumThreads()), std::less<>(), ppc::core::PoolForEach{});
   return true;
 }
 
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/gemm/include/cannon_grid.hpp"
 #include "core/task/include/task.hpp"
 
 namespace vavilov_v_cannon_stl {
@@ -25,10 +26,7 @@ class CannonSTL : public ppc::core::Task {
   std::vector<double> B_;
   std::vector<double> C_;
 
-  void InitialShift(int num_threads, int blocks_per_thread);
-  void BlockMultiply(int num_threads, int blocks_per_thread);
-  void ShiftBlocks(int num_threads, int blocks_per_thread);
-  void ProcessSingleBlock(int bi, int bj, int bi_start, std::vector<double>& local);
-  void MergeResults(int num_threads, int bi_range, const std::vector<std::vector<double>>& local_c);
+  void BlockMultiply(const ppc::core::CannonGrid& grid, int num_threads, int blocks_per_thread);
+  void ProcessSingleBlock(const ppc::core::CannonGrid& grid, int bi, int bj);
 };
 }  // namespace vavilov_v_cannon_stl
@@ -2,9 +2,13 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <span>
 #include <thread>
 #include <vector>
 
+#include "core/gemm/include/cannon_grid.hpp"
+#include "core/gemm/include/gemm.hpp"
 #include "core/util/include/util.hpp"
 
 bool vavilov_v_cannon_stl::CannonSTL::PreProcessingImpl() {
@@ -14,9 +18,13 @@ bool vavilov_v_cannon_stl::CannonSTL::PreProcessingImpl() {
 
   auto *a = reinterpret_cast<double *>(task_data->inputs[0]);
   auto *b = reinterpret_cast<double *>(task_data->inputs[1]);
-  A_.assign(a, a + (N_ * N_));
-  B_.assign(b, b + (N_ * N_));
-  C_.assign(N_ * N_, 0);
+  // A and B live in block-major tiles for the whole run, Cannon's shifts only remap tile indices
+  const auto size = static_cast<size_t>(N_) * N_;
+  A_.resize(size);
+  B_.resize(size);
+  ppc::core::ToBlockMajor(std::span<const double>(a, size), N_, num_blocks_, A_);
+  ppc::core::ToBlockMajor(std::span<const double>(b, size), N_, num_blocks_, B_);
+  C_.assign(size, 0);
 
   return true;
 }
@@ -32,129 +40,30 @@ bool vavilov_v_cannon_stl::CannonSTL::ValidationImpl() {
   return n % num_blocks == 0;
 }
 
-void vavilov_v_cannon_stl::CannonSTL::InitialShift(int num_threads, int blocks_per_thread) {
-  std::vector<double> a_tmp = A_;
-  std::vector<double> b_tmp = B_;
-  std::vector<std::thread> threads;
-
-  auto shift_work = [&](int bi_start, int bi_end) {
-    for (int bi = bi_start; bi < bi_end; ++bi) {
-      for (int bj = 0; bj < num_blocks_; ++bj) {
-        int src_row = (bi + bj) % num_blocks_;
-        int src_col = (bj + bi) % num_blocks_;
-        for (int i = 0; i < block_size_; ++i) {
-          for (int j = 0; j < block_size_; ++j) {
-            B_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-                b_tmp[(((src_row * block_size_) + i) * N_) + ((bj * block_size_) + j)];
-            A_[((bi * block_size_ + i) * N_) + ((bj * block_size_) + j)] =
-                a_tmp[(((bi * block_size_) + i) * N_) + ((src_col * block_size_) + j)];
-          }
-        }
-      }
-    }
-  };
-
-  for (int t = 0; t < num_threads; ++t) {
-    int start = t * blocks_per_thread;
-    int end = std::min(start + blocks_per_thread, num_blocks_);
-    if (start < end) {
-      threads.emplace_back(shift_work, start, end);
-    }
-  }
-  for (auto &thread : threads) {
-    thread.join();
-  }
+void vavilov_v_cannon_stl::CannonSTL::ProcessSingleBlock(const ppc::core::CannonGrid &grid, int bi, int bj) {
+  const size_t tile = static_cast<size_t>(block_size_) * block_size_;
+  const size_t c_offset = (static_cast<size_t>(bi) * block_size_ * N_) + (static_cast<size_t>(bj) * block_size_);
+  ppc::core::Gemm(block_size_, block_size_, block_size_, &A_[grid.ATile(bi, bj) * tile], block_size_,
+                  &B_[grid.BTile(bi, bj) * tile], block_size_, &C_[c_offset], N_);
 }
 
-void vavilov_v_cannon_stl::CannonSTL::ProcessSingleBlock(int bi, int bj, int bi_start, std::vector<double> &local) {
-  for (int i = bi; i < bi + block_size_; i++) {
-    for (int j = bj; j < bj + block_size_; j++) {
-      double temp = 0.0;
-      for (int k = 0; k < block_size_; k++) {
-        const int row_a = bi + (i - bi);
-        const int col_a = bj + k;
-        const int row_b = bi + k;
-        const int col_b = bj + (j - bj);
-        temp += A_[(row_a * N_) + col_a] * B_[(row_b * N_) + col_b];
-      }
-      local[((i - bi_start) * N_) + j] += temp;
-    }
-  }
-}
-
-void vavilov_v_cannon_stl::CannonSTL::MergeResults(int num_threads, int bi_range,
-                                                   const std::vector<std::vector<double>> &local_c) {
-  for (int t = 0; t < num_threads; ++t) {
-    const int bi_start = t * bi_range;
-    const int bi_end = std::min(bi_start + bi_range, N_);
-    if (bi_start < N_) {
-      const std::vector<double> &local = local_c[t];
-      for (int i = bi_start; i < bi_end; ++i) {
-        for (int j = 0; j < N_; ++j) {
-          C_[(i * N_) + j] += local[((i - bi_start) * N_) + j];
-        }
-      }
-    }
-  }
-}
-
-void vavilov_v_cannon_stl::CannonSTL::BlockMultiply(int num_threads, int blocks_per_thread) {
-  std::vector<std::vector<double>> local_c(num_threads);
-  const int bi_range = blocks_per_thread * block_size_;
+void vavilov_v_cannon_stl::CannonSTL::BlockMultiply(const ppc::core::CannonGrid &grid, int num_threads,
+                                                    int blocks_per_thread) {
+  // Threads own disjoint block rows of C and accumulate into it directly
   std::vector<std::thread> threads;
-
-  auto process_block_range = [&](int bi_start, int bi_end, int thread_id) {
-    std::vector<double> &local = local_c[thread_id];
-    local.resize((bi_end - bi_start) * N_, 0.0);
-
-    for (int bi = bi_start; bi < bi_end; bi += block_size_) {
-      for (int bj = 0; bj < N_; bj += block_size_) {
-        ProcessSingleBlock(bi, bj, bi_start, local);
-      }
-    }
-  };
-
-  for (int t = 0; t < num_threads; ++t) {
-    const int bi_start = t * bi_range;
-    const int bi_end = std::min(bi_start + bi_range, N_);
-    if (bi_start < N_) {
-      threads.emplace_back(process_block_range, bi_start, bi_end, t);
-    }
-  }
-  for (auto &thread : threads) {
-    thread.join();
-  }
-
-  MergeResults(num_threads, bi_range, local_c);
-}
-
-void vavilov_v_cannon_stl::CannonSTL::ShiftBlocks(int num_threads, int blocks_per_thread) {
-  std::vector<double> a_tmp = A_;
-  std::vector<double> b_tmp = B_;
-  std::vector<std::thread> threads;
-
-  auto shift_work = [&](int bi_start, int bi_end) {
+  auto process_block_rows = [&](int bi_start, int bi_end) {
     for (int bi = bi_start; bi < bi_end; ++bi) {
       for (int bj = 0; bj < num_blocks_; ++bj) {
-        int src_row = (bi + 1) % num_blocks_;
-        int src_col = (bj + 1) % num_blocks_;
-        for (int i = 0; i < block_size_; ++i) {
-          for (int j = 0; j < block_size_; ++j) {
-            B_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-                b_tmp[(((src_row * block_size_) + i) * N_) + ((bj * block_size_) + j)];
-            A_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-                a_tmp[(((bi * block_size_) + i) * N_) + ((src_col * block_size_) + j)];
-          }
-        }
+        ProcessSingleBlock(grid, bi, bj);
       }
     }
   };
 
   for (int t = 0; t < num_threads; ++t) {
-    int start = t * blocks_per_thread;
-    int end = std::min(start + blocks_per_thread, num_blocks_);
+    const int start = t * blocks_per_thread;
+    const int end = std::min(start + blocks_per_thread, num_blocks_);
     if (start < end) {
-      threads.emplace_back(shift_work, start, end);
+      threads.emplace_back(process_block_rows, start, end);
     }
   }
   for (auto &thread : threads) {
@@ -165,10 +74,11 @@ void vavilov_v_cannon_stl::CannonSTL::ShiftBlocks(int num_threads, int blocks_pe
 bool vavilov_v_cannon_stl::CannonSTL::RunImpl() {
   int num_threads = std::min(ppc::util::GetPPCNumThreads(), num_blocks_);
   int blocks_per_thread = (num_blocks_ + num_threads - 1) / num_threads;
-  InitialShift(num_threads, blocks_per_thread);
+  ppc::core::CannonGrid grid(num_blocks_);
+  grid.InitialShift();
   for (int iter = 0; iter < num_blocks_; ++iter) {
-    BlockMultiply(num_threads, blocks_per_thread);
-    ShiftBlocks(num_threads, blocks_per_thread);
+    BlockMultiply(grid, num_threads, blocks_per_thread);
+    grid.Shift();
   }
   return true;
 }
@@ -5,9 +5,11 @@
 #include <future>
 #include <limits>
 #include <ranges>
+#include <span>
 #include <thread>
 #include <vector>
 
+#include "core/sort/include/sorting_network.hpp"
 #include "core/util/include/util.hpp"
 
 bool volochaev_s_shell_sort_with_batchers_even_odd_merge_stl::ShellSortSTL::PreProcessingImpl() {
@@ -24,104 +26,31 @@ bool volochaev_s_shell_sort_with_batchers_even_odd_merge_stl::ShellSortSTL::Vali
   return task_data->inputs_count[0] > 0 && task_data->inputs_count[0] == task_data->outputs_count[0];
 }
 
-void volochaev_s_shell_sort_with_batchers_even_odd_merge_stl::ShellSortSTL::ShellSort(int start) {
-  int n = mini_batch_;
-
-  int gap = 1;
-  while (gap < n / 3) {
-    gap = 3 * gap + 1;
-  }
-
-  while (gap >= 1) {
-    for (int i = start + gap; i < start + mini_batch_; ++i) {
-      int temp = mass_[i];
-      int j = i;
-      while (j >= start + gap && mass_[j - gap] > temp) {
-        mass_[j] = mass_[j - gap];
-        j -= gap;
-      }
-      mass_[j] = temp;
-    }
-    gap /= 3;
-  }
-}
-
-void volochaev_s_shell_sort_with_batchers_even_odd_merge_stl::ShellSortSTL::MergeBlocks(int id_l, int id_r, int len) {
-  int left_id = 0;
-  int right_id = 0;
-  int merged_id = 0;
-
-  while (left_id < len || right_id < len) {
-    if (left_id < len && right_id < len) {
-      if (mass_[id_l + left_id] < mass_[id_r + right_id]) {
-        array_[id_l + merged_id] = mass_[id_l + left_id];
-        left_id += 2;
-      } else {
-        array_[id_l + merged_id] = mass_[id_r + right_id];
-        right_id += 2;
-      }
-    } else if (left_id < len) {
-      array_[id_l + merged_id] = mass_[id_l + left_id];
-      left_id += 2;
-    } else {
-      array_[id_l + merged_id] = mass_[id_r + right_id];
-      right_id += 2;
-    }
-    merged_id += 2;
-  }
-
-  for (int i = 0; i < merged_id; i += 2) {
-    mass_[id_l + i] = array_[id_l + i];
-  }
+void volochaev_s_shell_sort_with_batchers_even_odd_merge_stl::ShellSortSTL::SortBlock(int start) {
+  ppc::core::NetworkSort(std::span<int>(mass_).subspan(start, mini_batch_));
 }
 
-void volochaev_s_shell_sort_with_batchers_even_odd_merge_stl::ShellSortSTL::LastMerge() {
-  int even_index = 0;
-  int odd_index = 1;
-  int result_index = 0;
-
-  while (even_index < n_ || odd_index < n_) {
-    if (even_index < n_ && odd_index < n_) {
-      if (mass_[even_index] < mass_[odd_index]) {
-        array_[result_index++] = mass_[even_index];
-        even_index += 2;
-      } else {
-        array_[result_index++] = mass_[odd_index];
-        odd_index += 2;
-      }
-    } else if (even_index < n_) {
-      array_[result_index++] = mass_[even_index];
-      even_index += 2;
-    } else {
-      array_[result_index++] = mass_[odd_index];
-      odd_index += 2;
-    }
-  }
+void volochaev_s_shell_sort_with_batchers_even_odd_merge_stl::ShellSortSTL::MergeBlocks(int begin, int len) {
+  const std::span<const int> runs(mass_);
+  ppc::core::BitonicMerge<int>(runs.subspan(begin, len), runs.subspan(begin + len, len),
+                               std::span<int>(array_).subspan(begin, 2 * len));
 }
 
 void volochaev_s_shell_sort_with_batchers_even_odd_merge_stl::ShellSortSTL::Merge() {
-  int current_threads = c_threads_;
-
-  while (current_threads > 1) {
+  // Rounds merge neighbouring runs of mass_ into array_ and swap the two buffers, so the sorted
+  // result ends in mass_ and is swapped into array_ at the end
+  for (int len = mini_batch_; len < n_; len *= 2) {
     std::vector<std::future<void>> futures;
-    int l = mini_batch_ * (c_threads_ / current_threads);
-
-    for (int i = 0; i < current_threads / 2; ++i) {
-      futures.emplace_back(
-          std::async(std::launch::async, [this, i, l]() { MergeBlocks((i * 2 * l), (i * 2 * l) + l, l); }));
-
-      futures.emplace_back(
-          std::async(std::launch::async, [this, i, l]() { MergeBlocks((i * 2 * l) + 1, (i * 2 * l) + l + 1, l - 1); }));
+    for (int begin = 0; begin < n_; begin += 2 * len) {
+      futures.emplace_back(std::async(std::launch::async, [this, begin, len]() { MergeBlocks(begin, len); }));
     }
 
     for (auto& future : futures) {
       future.get();
     }
-
-    current_threads /= 2;
+    mass_.swap(array_);
   }
-
-  LastMerge();
+  array_.swap(mass_);
 }
 
 void volochaev_s_shell_sort_with_batchers_even_odd_merge_stl::ShellSortSTL::ParallelShellSort() {
@@ -131,7 +60,7 @@ void volochaev_s_shell_sort_with_batchers_even_odd_merge_stl::ShellSortSTL::Para
   futures.reserve(c_threads_);
 
   for (int i = 0; i < c_threads_; ++i) {
-    futures.emplace_back(std::async(std::launch::async, [this, i]() { ShellSort(i * mini_batch_); }));
+    futures.emplace_back(std::async(std::launch::async, [this, i]() { SortBlock(i * mini_batch_); }));
   }
 
   for (auto& future : futures) {
@@ -2,10 +2,9 @@
 
 #include <algorithm>
 #include <cmath>
-#include <thread>
 #include <vector>
 
-#include "core/util/include/util.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 
 bool zaytsev_d_sobel_stl::TestTaskSTL::PreProcessingImpl() {
   auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
@@ -35,9 +34,6 @@ bool zaytsev_d_sobel_stl::TestTaskSTL::RunImpl() {
   int cols = width_ - 2;
   int total = rows * cols;
 
-  const int num_threads = ppc::util::GetPPCNumThreads();
-  std::vector<std::thread> threads;
-  threads.reserve(num_threads);
   auto worker = [&](int start, int end) {
     for (int idx = start; idx < end; ++idx) {
       int i = 1 + (idx / cols);
@@ -62,21 +58,8 @@ bool zaytsev_d_sobel_stl::TestTaskSTL::RunImpl() {
     }
   };
 
-  int base = total / num_threads;
-  int rem = total % num_threads;
-  int offset = 0;
-
-  for (int t = 0; t < num_threads; ++t) {
-    int chunk = base + (t < rem ? 1 : 0);
-    int start = offset;
-    int end = offset + chunk;
-    threads.emplace_back(worker, start, end);
-    offset += chunk;
-  }
-
-  for (auto &th : threads) {
-    th.join();
-  }
+  // About four pixel ranges per pool thread, each at least one row long; the pool keeps its threads between runs
+  ppc::core::ParallelForRange(0, total, worker, cols);
 
   return true;
 }
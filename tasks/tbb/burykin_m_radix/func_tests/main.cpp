@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <numeric>
 #include <random>
 #include <vector>
 
@@ -128,3 +129,116 @@ TEST(burykin_m_radix_tbb, EmptyVector) {
 
   EXPECT_EQ(output, expected);
 }
+
+TEST(burykin_m_radix_tbb, KeyValuePayloadFollowsKeys) {
+  std::vector<int> input = GenerateRandomVector(100000);
+  std::vector<uint64_t> payload(input.size());
+  for (size_t i = 0; i < input.size(); ++i) {
+    payload[i] = (static_cast<uint64_t>(static_cast<uint32_t>(input[i])) << 32) | i;
+  }
+  std::vector<int> output(input.size());
+  std::vector<uint64_t> payload_out(input.size());
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(input.data(), {input.size()});
+  task_data->AddInput(payload.data(), {payload.size()});
+  task_data->AddOutput(output.data(), {output.size()});
+  task_data->AddOutput(payload_out.data(), {payload_out.size()});
+
+  burykin_m_radix_tbb::RadixTBB task(task_data);
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  EXPECT_EQ(task.GetMode(), burykin_m_radix_tbb::RadixTBB::Mode::kKeyValue);
+  task.Run();
+  task.PostProcessing();
+
+  EXPECT_TRUE(std::ranges::is_sorted(output));
+  for (size_t i = 0; i < output.size(); ++i) {
+    ASSERT_EQ(static_cast<int>(static_cast<uint32_t>(payload_out[i] >> 32)), output[i]);
+    // Stable: equal keys keep their input order
+    if (i > 0 && output[i - 1] == output[i]) {
+      ASSERT_LT(payload_out[i - 1] & 0xFFFFFFFFU, payload_out[i] & 0xFFFFFFFFU);
+    }
+  }
+}
+
+TEST(burykin_m_radix_tbb, ArgSortReturnsStablePermutation) {
+  std::vector<int> input = GenerateRandomVector(50000, -50, 50);
+  std::vector<uint32_t> expected(input.size());
+  std::iota(expected.begin(), expected.end(), 0U);
+  std::ranges::stable_sort(expected, [&](uint32_t a, uint32_t b) { return input[a] < input[b]; });
+  std::vector<int> output(input.size());
+  std::vector<uint32_t> indices(input.size());
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(input.data(), {input.size()});
+  task_data->AddOutput(output.data(), {output.size()});
+  task_data->AddOutput(indices.data(), {indices.size()});
+
+  burykin_m_radix_tbb::RadixTBB task(task_data);
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  EXPECT_EQ(task.GetMode(), burykin_m_radix_tbb::RadixTBB::Mode::kArgSort);
+  task.Run();
+  task.PostProcessing();
+
+  EXPECT_EQ(indices, expected);
+  EXPECT_TRUE(std::ranges::is_sorted(output));
+}
+
+TEST(burykin_m_radix_tbb, ArgSortWith64BitIndices) {
+  std::vector<int> input = {5, -1, 5, 0};
+  std::vector<int> output(input.size());
+  std::vector<uint64_t> indices(input.size());
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(input.data(), {input.size()});
+  task_data->AddOutput(output.data(), {output.size()});
+  task_data->AddOutput(indices.data(), {indices.size()});
+
+  burykin_m_radix_tbb::RadixTBB task(task_data);
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  EXPECT_EQ(indices, (std::vector<uint64_t>{1, 3, 0, 2}));
+  EXPECT_EQ(output, (std::vector<int>{-1, 0, 5, 5}));
+}
+
+TEST(burykin_m_radix_tbb, RejectsWideOrMismatchedPayload) {
+  struct Wide {
+    uint64_t a;
+    uint64_t b;
+  };
+  std::vector<int> input(8);
+  std::vector<int> output(8);
+  std::vector<Wide> wide(8);
+  std::vector<uint32_t> short_payload(7);
+
+  auto wide_data = std::make_shared<ppc::core::TaskData>();
+  wide_data->AddInput(input.data(), {input.size()});
+  wide_data->AddInput(wide.data(), {wide.size()});
+  wide_data->AddOutput(output.data(), {output.size()});
+  wide_data->AddOutput(wide.data(), {wide.size()});
+  burykin_m_radix_tbb::RadixTBB wide_task(wide_data);
+  EXPECT_FALSE(wide_task.Validation());
+
+  auto short_data = std::make_shared<ppc::core::TaskData>();
+  short_data->AddInput(input.data(), {input.size()});
+  short_data->AddInput(short_payload.data(), {short_payload.size()});
+  short_data->AddOutput(output.data(), {output.size()});
+  short_data->AddOutput(short_payload.data(), {short_payload.size()});
+  burykin_m_radix_tbb::RadixTBB short_task(short_data);
+  EXPECT_FALSE(short_task.Validation());
+
+  std::vector<uint64_t> long_payload(8);
+  std::vector<uint32_t> narrow_out(8);
+  auto narrow_data = std::make_shared<ppc::core::TaskData>();
+  narrow_data->AddInput(input.data(), {input.size()});
+  narrow_data->AddInput(long_payload.data(), {long_payload.size()});
+  narrow_data->AddOutput(output.data(), {output.size()});
+  narrow_data->AddOutput(narrow_out.data(), {narrow_out.size()});
+  burykin_m_radix_tbb::RadixTBB narrow_task(narrow_data);
+  EXPECT_FALSE(narrow_task.Validation());
+}
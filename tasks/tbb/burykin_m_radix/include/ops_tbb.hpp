@@ -1,28 +1,47 @@
 #pragma once
 
-#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
+#include "core/task/include/data_view.hpp"
 #include "core/task/include/task.hpp"
 
 namespace burykin_m_radix_tbb {
 
+// inputs[0] are the keys and outputs[0] receives them sorted. An optional second buffer picks the mode:
+//   inputs[1] and outputs[1]: payload of 4 or 8 bytes per key, moved with the keys (key-value sort)
+//   outputs[1] only: uint32_t or uint64_t indices of the stable sorting permutation (argsort)
+// Both extra buffers have to be registered with AddInput/AddOutput, their element size selects the width.
 class RadixTBB : public ppc::core::Task {
  public:
+  enum class Mode : uint8_t { kValues, kKeyValue, kArgSort };
+
   explicit RadixTBB(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
   bool PreProcessingImpl() override;
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
-  static std::array<int, 256> ComputeFrequencyParallel(const std::vector<int>& a, int shift);
-  static std::array<int, 256> ComputeIndices(const std::array<int, 256>& count);
-  static void DistributeElementsParallel(const std::vector<int>& a, std::vector<int>& b,
-                                         const std::array<int, 256>& index, int shift);
+  // Byte of value at shift, the top byte has its sign bit flipped so negatives sort first
+  static size_t Digit(int value, int shift);
+
+  [[nodiscard]] Mode GetMode() const { return mode_; }
 
  private:
-  std::vector<int> input_, output_;
+  // Sorting happens in place in the caller's output buffer, scratch_ holds the odd passes
+  ppc::core::DataView<const int> input_;
+  ppc::core::DataView<int> output_;
+  std::vector<int> scratch_;
+  Mode mode_ = Mode::kValues;
+  // Bytes per payload value or index of the second buffer
+  size_t extra_width_ = 0;
+
+  // Mode picked by the buffers registered in task_data
+  [[nodiscard]] Mode RequestedMode() const;
+  template <class Extra>
+  void SortWithExtra(int num_threads);
 };
 
 }  // namespace burykin_m_radix_tbb
\ No newline at end of file
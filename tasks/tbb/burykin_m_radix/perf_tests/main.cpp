@@ -1,15 +1,26 @@
 #include <gtest/gtest.h>
+#include <oneapi/tbb/task_arena.h>
 
 #include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <random>
+#include <span>
+#include <string>
+#include <type_traits>
 #include <vector>
 
+#include "core/perf/include/call_timing.hpp"
 #include "core/perf/include/perf.hpp"
+#include "core/sort/include/key_value_sort.hpp"
+#include "core/sort/include/radix_scatter.hpp"
+#include "core/sort/include/radix_sort.hpp"
+#include "core/sort/include/tbb_adapters.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
 #include "tbb/burykin_m_radix/include/ops_tbb.hpp"
 
 namespace {
@@ -25,6 +36,69 @@ std::vector<int> GenerateRandomVector(size_t size, int min_val = -10000, int max
   return vec;
 }
 
+// Record payload of kBytes bytes that remembers the position of its key
+template <size_t kBytes>
+struct Payload {
+  uint64_t index;
+  uint64_t rest[(kBytes / 8) - 1];
+};
+
+template <class V>
+V MakePayload(size_t index) {
+  if constexpr (std::is_integral_v<V>) {
+    return static_cast<V>(index);
+  } else {
+    return V{.index = index, .rest = {}};
+  }
+}
+
+template <class V>
+size_t PayloadIndex(const V &payload) {
+  if constexpr (std::is_integral_v<V>) {
+    return static_cast<size_t>(payload);
+  } else {
+    return static_cast<size_t>(payload.index);
+  }
+}
+
+// Best time of sort(keys, payloads) over a fresh copy of keys, checking that the payloads followed
+template <class V, class Sort>
+double TimeKeyValueSort(const std::vector<int> &keys, oneapi::tbb::task_arena &arena, const Sort &sort) {
+  std::vector<int> sorted;
+  std::vector<V> payload(keys.size());
+  const double time = ppc::core::BestTaskRun(keys.size(), [&] {
+    sorted = keys;
+    for (size_t i = 0; i < keys.size(); ++i) {
+      payload[i] = MakePayload<V>(i);
+    }
+    arena.execute([&] { sort(std::span<int>(sorted), std::span<V>(payload)); });
+  });
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (i > 0 && sorted[i - 1] > sorted[i]) {
+      ADD_FAILURE() << "keys out of order at " << i;
+      break;
+    }
+    if (sorted[i] != keys[PayloadIndex(payload[i])]) {
+      ADD_FAILURE() << "payload lost its key at " << i;
+      break;
+    }
+  }
+  return time;
+}
+
+// Times a kBytes payload both moved with its keys and through the index path, records the two
+// figures and returns the moved time
+template <size_t kBytes, class Moved, class ByIndex>
+double TimePayloadLayouts(const std::vector<int> &keys, oneapi::tbb::task_arena &arena, const Moved &moved,
+                          const ByIndex &by_index) {
+  const double moved_time = TimeKeyValueSort<Payload<kBytes>>(keys, arena, moved);
+  const double index_time = TimeKeyValueSort<Payload<kBytes>>(keys, arena, by_index);
+  const std::string name = "payload" + std::to_string(kBytes);
+  ppc::core::RecordFigure(name + "_s", moved_time);
+  ppc::core::RecordFigure(name + "_index_s", index_time);
+  return moved_time;
+}
+
 }  // namespace
 
 TEST(burykin_m_radix_tbb, test_pipeline_run) {
@@ -96,3 +170,72 @@ TEST(burykin_m_radix_tbb, test_task_run) {
 
   EXPECT_EQ(output, expected);
 }
+
+// One scatter pass over 10^8 keys next to memcpy of the same bytes, the bound for any pass that
+// reads and writes every element once
+TEST(burykin_m_radix_tbb, test_scatter_bandwidth) {
+  constexpr size_t kNumElements = 100000000;
+
+  const std::vector<int> input = GenerateRandomVector(kNumElements, 0, 0x7FFFFFFF);
+  std::vector<int> output(kNumElements);
+  const double bytes = 2.0 * static_cast<double>(kNumElements * sizeof(int));
+
+  const double memcpy_time =
+      ppc::core::BestTaskRun(kNumElements, [&] { std::memcpy(output.data(), input.data(), kNumElements * sizeof(int)); });
+
+  const int num_threads = ppc::util::GetPPCNumThreads();
+  oneapi::tbb::task_arena arena(num_threads);
+  const double scatter_time = ppc::core::BestTaskRun(kNumElements, [&] {
+    arena.execute([&] {
+      ppc::core::ParallelRadixScatter<int>(
+          input, output, 256, [](int value) { return static_cast<size_t>(value & 0xFF); }, num_threads,
+          ppc::core::TbbForEach{});
+    });
+  });
+
+  ppc::core::RecordFigure("memcpy_s", memcpy_time);
+  ppc::core::RecordFigure("scatter_s", scatter_time);
+  ppc::core::RecordFigure("memcpy_gbps", bytes / memcpy_time * 1e-9);
+  ppc::core::RecordFigure("scatter_gbps", bytes / scatter_time * 1e-9);
+  ppc::core::RecordFigure("scatter_to_memcpy", memcpy_time / scatter_time);
+
+  for (size_t i = 1; i < kNumElements; ++i) {
+    ASSERT_LE(output[i - 1] & 0xFF, output[i] & 0xFF);
+  }
+  EXPECT_LT(scatter_time, ppc::core::PerfResults::kMaxTime);
+}
+
+// Key + payload sort of 10^7 keys with 4 to 64-byte payloads next to sorting the keys alone. From
+// 16 bytes on both layouts are timed: moving the payload with the keys and the index path (32-bit
+// indices sorted, the payload gathered once), which brackets kRadixMovedPayloadBytes.
+TEST(burykin_m_radix_tbb, test_key_value_payload_sizes) {
+  constexpr size_t kNumElements = 10000000;
+  const std::vector<int> keys = GenerateRandomVector(kNumElements, -1000000000, 1000000000);
+
+  const int num_threads = ppc::util::GetPPCNumThreads();
+  oneapi::tbb::task_arena arena(num_threads);
+  auto moved = [&](auto key_span, auto payload_span) {
+    ppc::core::RadixSortPairs(key_span, payload_span, ppc::core::TbbForEach{});
+  };
+  auto by_index = [&](auto key_span, auto payload_span) {
+    ppc::core::RadixSortByIndex(key_span, payload_span, ppc::core::TbbForEach{});
+  };
+
+  std::vector<int> keys_only;
+  const double keys_only_time = ppc::core::BestTaskRun(kNumElements, [&] {
+    keys_only = keys;
+    arena.execute([&] { ppc::core::RadixSort(std::span<int>(keys_only), ppc::core::TbbForEach{}); });
+  });
+  const double payload4_time = TimeKeyValueSort<uint32_t>(keys, arena, moved);
+  const double payload8_time = TimeKeyValueSort<uint64_t>(keys, arena, moved);
+  ppc::core::RecordFigure("keys_only_s", keys_only_time);
+  ppc::core::RecordFigure("payload4_s", payload4_time);
+  ppc::core::RecordFigure("payload8_s", payload8_time);
+
+  const double payload16_time = TimePayloadLayouts<16>(keys, arena, moved, by_index);
+  TimePayloadLayouts<24>(keys, arena, moved, by_index);
+  TimePayloadLayouts<32>(keys, arena, moved, by_index);
+  TimePayloadLayouts<48>(keys, arena, moved, by_index);
+  TimePayloadLayouts<64>(keys, arena, moved, by_index);
+  EXPECT_LT(payload16_time, ppc::core::PerfResults::kMaxTime);
+}
@@ -1,147 +1,121 @@
 #include "tbb/burykin_m_radix/include/ops_tbb.hpp"
 
-#include <oneapi/tbb/blocked_range.h>
-#include <oneapi/tbb/parallel_for.h>
 #include <oneapi/tbb/task_arena.h>
 
 #include <algorithm>
-#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <span>
 #include <utility>
-#include <vector>
 
+#include "core/sort/include/key_value_sort.hpp"
+#include "core/sort/include/radix_scatter.hpp"
+#include "core/sort/include/tbb_adapters.hpp"
 #include "core/util/include/util.hpp"
 
-std::array<int, 256> burykin_m_radix_tbb::RadixTBB::ComputeFrequencyParallel(const std::vector<int>& a,
-                                                                             const int shift) {
-  const size_t num_threads = ppc::util::GetPPCNumThreads();
-  std::vector<std::array<int, 256>> local_counts(num_threads);
-  const size_t array_size = a.size();
-
-  tbb::parallel_for(tbb::blocked_range<size_t>(0, array_size), [&](const tbb::blocked_range<size_t>& range) {
-    size_t thread_id = tbb::this_task_arena::current_thread_index();
-    thread_id = thread_id % num_threads;
-
-    for (size_t i = range.begin(); i < range.end(); ++i) {
-      unsigned int key = ((static_cast<unsigned int>(a[i]) >> shift) & 0xFFU);
-      if (shift == 24) {
-        key ^= 0x80;
-      }
-      ++local_counts[thread_id][key];
-    }
-  });
-
-  std::array<int, 256> global_count = {};
-  for (size_t t = 0; t < num_threads; ++t) {
-    for (int i = 0; i < 256; ++i) {
-      global_count[i] += local_counts[t][i];
-    }
+size_t burykin_m_radix_tbb::RadixTBB::Digit(int value, int shift) {
+  unsigned int key = ((static_cast<unsigned int>(value) >> shift) & 0xFFU);
+  if (shift == 24) {
+    key ^= 0x80;
   }
-
-  return global_count;
+  return key;
 }
 
-std::array<int, 256> burykin_m_radix_tbb::RadixTBB::ComputeIndices(const std::array<int, 256>& count) {
-  std::array<int, 256> index = {0};
-  for (int i = 1; i < 256; ++i) {
-    index[i] = index[i - 1] + count[i - 1];
+burykin_m_radix_tbb::RadixTBB::Mode burykin_m_radix_tbb::RadixTBB::RequestedMode() const {
+  if (task_data->outputs.size() < 2) {
+    return Mode::kValues;
   }
-  return index;
-}
-
-void burykin_m_radix_tbb::RadixTBB::DistributeElementsParallel(const std::vector<int>& a, std::vector<int>& b,
-                                                               const std::array<int, 256>& index, const int shift) {
-  const size_t num_threads = ppc::util::GetPPCNumThreads();
-
-  const size_t items_per_thread = (a.size() + num_threads - 1) / num_threads;
-
-  std::vector<std::array<int, 256>> thread_counts(num_threads);
-
-  tbb::parallel_for(tbb::blocked_range<size_t>(0, num_threads), [&](const tbb::blocked_range<size_t>& thread_range) {
-    for (size_t t = thread_range.begin(); t < thread_range.end(); ++t) {
-      thread_counts[t].fill(0);
-
-      size_t start = t * items_per_thread;
-      size_t end = std::min(start + items_per_thread, a.size());
-
-      for (size_t i = start; i < end; ++i) {
-        unsigned int key = ((static_cast<unsigned int>(a[i]) >> shift) & 0xFFU);
-        if (shift == 24) {
-          key ^= 0x80;
-        }
-        ++thread_counts[t][key];
-      }
-    }
-  });
-
-  std::vector<std::array<int, 256>> thread_offsets(num_threads);
-  for (size_t t = 0; t < num_threads; ++t) {
-    for (int j = 0; j < 256; ++j) {
-      thread_offsets[t][j] = index[j];
-      for (size_t prev_t = 0; prev_t < t; ++prev_t) {
-        thread_offsets[t][j] += thread_counts[prev_t][j];
-      }
-    }
-  }
-
-  tbb::parallel_for(tbb::blocked_range<size_t>(0, num_threads), [&](const tbb::blocked_range<size_t>& thread_range) {
-    for (size_t t = thread_range.begin(); t < thread_range.end(); ++t) {
-      size_t start = t * items_per_thread;
-      size_t end = std::min(start + items_per_thread, a.size());
-
-      std::array<int, 256> local_offsets = thread_offsets[t];
-
-      for (size_t i = start; i < end; ++i) {
-        unsigned int key = ((static_cast<unsigned int>(a[i]) >> shift) & 0xFFU);
-        if (shift == 24) {
-          key ^= 0x80;
-        }
-        b[local_offsets[key]++] = a[i];
-      }
-    }
-  });
+  return task_data->inputs.size() > 1 ? Mode::kKeyValue : Mode::kArgSort;
 }
 
 bool burykin_m_radix_tbb::RadixTBB::PreProcessingImpl() {
-  const unsigned int input_size = task_data->inputs_count[0];
-  auto* in_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
-  input_ = std::vector<int>(in_ptr, in_ptr + input_size);
-
-  output_.resize(input_size);
+  input_ = task_data->InputView<const int>(0);
+  output_ = task_data->OutputView<int>(0);
+  mode_ = RequestedMode();
+  extra_width_ = 0;
+  if (mode_ == Mode::kKeyValue) {
+    extra_width_ = task_data->inputs_desc[1].element_size;
+  } else if (mode_ == Mode::kArgSort) {
+    extra_width_ = task_data->outputs_desc[1].element_size;
+  }
+  if (mode_ == Mode::kValues) {
+    scratch_.resize(input_.Size());
+  }
   return true;
 }
 
 bool burykin_m_radix_tbb::RadixTBB::ValidationImpl() {
-  return task_data->inputs_count[0] == task_data->outputs_count[0];
+  if (task_data->inputs_count[0] != task_data->outputs_count[0]) {
+    return false;
+  }
+  const Mode mode = RequestedMode();
+  if (mode == Mode::kValues) {
+    return task_data->inputs.size() < 2;
+  }
+  const auto& descs = mode == Mode::kKeyValue ? task_data->inputs_desc : task_data->outputs_desc;
+  if (descs.size() < 2 || descs[1].type == nullptr) {
+    return false;
+  }
+  const size_t width = descs[1].element_size;
+  // The payload is sorted in place in outputs[1], so it must hold values of the input width
+  if (mode == Mode::kKeyValue &&
+      (task_data->outputs_desc.size() < 2 || task_data->outputs_desc[1].element_size != width)) {
+    return false;
+  }
+  const bool sizes_match = task_data->outputs_count[1] == task_data->inputs_count[0] &&
+                           (mode == Mode::kArgSort || task_data->inputs_count[1] == task_data->inputs_count[0]);
+  return sizes_match && (width == sizeof(uint32_t) || width == sizeof(uint64_t));
+}
+
+template <class Extra>
+void burykin_m_radix_tbb::RadixTBB::SortWithExtra(int num_threads) {
+  auto* extra_out = reinterpret_cast<Extra*>(task_data->outputs[1]);
+  const std::span<Extra> extra(extra_out, input_.Size());
+  oneapi::tbb::task_arena arena(num_threads);
+  arena.execute([&] {
+    if (mode_ == Mode::kArgSort) {
+      ppc::core::RadixArgSort(input_.Span(), extra, ppc::core::TbbForEach{});
+      ppc::core::ApplyPermutation(std::span<const Extra>(extra), input_.Span(), output_.Span(),
+                                  ppc::core::TbbForEach{});
+      return;
+    }
+    const auto* payload = reinterpret_cast<const Extra*>(task_data->inputs[1]);
+    std::copy(payload, payload + input_.Size(), extra.begin());
+    std::ranges::copy(input_, output_.Span().begin());
+    ppc::core::RadixSortPairs(output_.Span(), extra, ppc::core::TbbForEach{});
+  });
 }
 
 bool burykin_m_radix_tbb::RadixTBB::RunImpl() {
-  if (input_.empty()) {
+  if (input_.Empty()) {
     return true;
   }
 
-  oneapi::tbb::task_arena arena(ppc::util::GetPPCNumThreads());
+  const int num_threads = ppc::util::GetPPCNumThreads();
+  if (mode_ != Mode::kValues) {
+    if (extra_width_ == sizeof(uint32_t)) {
+      SortWithExtra<uint32_t>(num_threads);
+    } else {
+      SortWithExtra<uint64_t>(num_threads);
+    }
+    return true;
+  }
+  oneapi::tbb::task_arena arena(num_threads);
 
   arena.execute([&] {
-    std::vector<int> a = std::move(input_);
-    std::vector<int> b(a.size());
+    std::span<int> a = output_.Span();
+    std::span<int> b(scratch_);
+    std::ranges::copy(input_, a.begin());
 
+    // Even number of passes, so the sorted data ends up in the output buffer
     for (int shift = 0; shift < 32; shift += 8) {
-      auto count = ComputeFrequencyParallel(a, shift);
-      const auto index = ComputeIndices(count);
-      DistributeElementsParallel(a, b, index, shift);
-      a.swap(b);
+      ppc::core::ParallelRadixScatter<int>(
+          a, b, 256, [shift](int value) { return Digit(value, shift); }, num_threads, ppc::core::TbbForEach{});
+      std::swap(a, b);
     }
-
-    output_ = std::move(a);
   });
 
   return true;
 }
 
-bool burykin_m_radix_tbb::RadixTBB::PostProcessingImpl() {
-  for (size_t i = 0; i < output_.size(); ++i) {
-    reinterpret_cast<int*>(task_data->outputs[0])[i] = output_[i];
-  }
-  return true;
-}
+bool burykin_m_radix_tbb::RadixTBB::PostProcessingImpl() { return true; }
@@ -5,10 +5,15 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <functional>
 #include <numbers>
+#include <span>
 #include <vector>
 
-#include "oneapi/tbb/parallel_for.h"
+#include "core/sort/include/parallel_quicksort.hpp"
+#include "core/sort/include/tbb_adapters.hpp"
+#include "core/util/include/util.hpp"
+#include "oneapi/tbb/task_arena.h"
 
 void deryabin_m_hoare_sort_simple_merge_tbb::HoaraSort(std::vector<double>& a, size_t first, size_t last) {
   if (first >= last) {
@@ -117,15 +122,12 @@ bool deryabin_m_hoare_sort_simple_merge_tbb::HoareSortTaskTBB::ValidationImpl()
 }
 
 bool deryabin_m_hoare_sort_simple_merge_tbb::HoareSortTaskTBB::RunImpl() {
-  oneapi::tbb::parallel_for(0, (int)chunk_count_, 1, [=, this](int count) {
-    HoaraSort(input_array_A_, count * min_chunk_size_, ((count + 1) * min_chunk_size_) - 1);
+  const int num_threads = ppc::util::GetPPCNumThreads();
+  oneapi::tbb::task_arena arena(num_threads);
+  arena.execute([&] {
+    ppc::core::ParallelQuickSort(std::span<double>(input_array_A_), num_threads, std::less<>(), ppc::core::TbbInvoke{},
+                                 ppc::core::TbbForEach{});
   });
-  for (size_t i = 0; i < (size_t)(log((double)chunk_count_) / std::numbers::ln2); i++) {
-    oneapi::tbb::parallel_for(0, (int)chunk_count_ >> (i + 1), 1, [=, this](int j) {
-      MergeTwoParts(input_array_A_, (size_t)j * min_chunk_size_ << (i + 1),
-                    (((size_t)j + 1) * min_chunk_size_ << (i + 1)) - 1, dimension_);
-    });
-  }
   return true;
 }
 
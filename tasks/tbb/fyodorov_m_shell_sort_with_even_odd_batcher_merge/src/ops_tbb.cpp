@@ -1,15 +1,15 @@
 #include "tbb/fyodorov_m_shell_sort_with_even_odd_batcher_merge/include/ops_tbb.hpp"
 
 #include <oneapi/tbb/parallel_for.h>
-#include <tbb/blocked_range.h>
-#include <tbb/parallel_for.h>
-#include <tbb/parallel_invoke.h>
-#include <tbb/tbb.h>
+#include <oneapi/tbb/task_arena.h>
 
-#include <cmath>
+#include <algorithm>
 #include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/sorting_network.hpp"
+
 namespace fyodorov_m_shell_sort_with_even_odd_batcher_merge_tbb {
 
 bool TestTaskTBB::PreProcessingImpl() {
@@ -29,12 +29,20 @@ bool TestTaskTBB::ValidationImpl() {
 }
 
 bool TestTaskTBB::RunImpl() {
-  ShellSort();
-  size_t mid = input_.size() / 2;
-  std::vector<int> left(input_.begin(), input_.begin() + static_cast<std::ptrdiff_t>(mid));
-  std::vector<int> right(input_.begin() + static_cast<std::ptrdiff_t>(mid), input_.end());
-
-  BatcherMerge(left, right, output_);
+  const size_t n = input_.size();
+  const auto threads_count = static_cast<size_t>(oneapi::tbb::this_task_arena::max_concurrency());
+  const size_t block_size = std::max<size_t>(1, (n + threads_count - 1) / threads_count);
+
+  oneapi::tbb::parallel_for(size_t{0}, (n + block_size - 1) / block_size,
+                            [&](size_t block) { SortBlock(block * block_size, block_size); });
+
+  // Merge rounds write to output_ and swap it with input_, so every round reads its runs from input_
+  for (size_t width = block_size; width < n; width *= 2) {
+    oneapi::tbb::parallel_for(size_t{0}, (n + (2 * width) - 1) / (2 * width),
+                              [&](size_t merge) { MergeRuns(merge * 2 * width, width); });
+    input_.swap(output_);
+  }
+  input_.swap(output_);
 
   return true;
 }
@@ -46,55 +54,21 @@ bool TestTaskTBB::PostProcessingImpl() {
   return true;
 }
 
-void TestTaskTBB::ShellSort() {
-  int n = static_cast<int>(input_.size());
-  std::vector<int> gaps;
-
-  for (int k = 1; (1 << k) - 1 < n; ++k) {
-    gaps.push_back((1 << k) - 1);
-  }
-
-  auto& input_ref = input_;
-
-  for (auto it = gaps.rbegin(); it != gaps.rend(); ++it) {
-    int gap = *it;
-
-    tbb::parallel_for(tbb::blocked_range<int>(0, gap), [&](const tbb::blocked_range<int>& range) {
-      for (int base = range.begin(); base < range.end(); ++base) {
-        for (int i = base + gap; i < n; i += gap) {
-          int temp = input_ref[i];
-          int j = i;
-          while (j >= gap && input_ref[j - gap] > temp) {
-            input_ref[j] = input_ref[j - gap];
-            j -= gap;
-          }
-          input_ref[j] = temp;
-        }
-      }
-    });
-  }
+void TestTaskTBB::SortBlock(size_t begin, size_t block_size) {
+  ppc::core::NetworkSort(std::span<int>(input_).subspan(begin, std::min(block_size, input_.size() - begin)));
 }
 
-void TestTaskTBB::BatcherMerge(std::vector<int>& left, std::vector<int>& right, std::vector<int>& result) {
-  size_t i = 0;
-  size_t j = 0;
-  size_t k = 0;
-
-  while (i < left.size() && j < right.size()) {
-    if (left[i] <= right[j]) {
-      result[k++] = left[i++];
-    } else {
-      result[k++] = right[j++];
-    }
-  }
-
-  while (i < left.size()) {
-    result[k++] = left[i++];
-  }
+void TestTaskTBB::MergeRuns(size_t begin, size_t width) {
+  const size_t n = input_.size();
+  const size_t mid = std::min(begin + width, n);
+  const size_t end = std::min(begin + (2 * width), n);
+  const std::span<const int> runs(input_);
+  BatcherMerge(runs.subspan(begin, mid - begin), runs.subspan(mid, end - mid),
+               std::span<int>(output_).subspan(begin, end - begin));
+}
 
-  while (j < right.size()) {
-    result[k++] = right[j++];
-  }
+void TestTaskTBB::BatcherMerge(std::span<const int> left, std::span<const int> right, std::span<int> result) {
+  ppc::core::BitonicMerge<int>(left, right, result);
 }
 
 }  // namespace fyodorov_m_shell_sort_with_even_odd_batcher_merge_tbb
\ No newline at end of file
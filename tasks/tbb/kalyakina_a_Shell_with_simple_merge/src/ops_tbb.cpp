@@ -5,9 +5,14 @@
 #include <algorithm>
 #include <cmath>
 #include <core/util/include/util.hpp>
+#include <cstddef>
+#include <functional>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
+#include "core/sort/include/tbb_adapters.hpp"
 #include "oneapi/tbb/parallel_for.h"
 #include "oneapi/tbb/task_arena.h"
 
@@ -84,6 +89,13 @@ bool kalyakina_a_shell_with_simple_merge_tbb::ShellSortTBB::ValidationImpl() {
 }
 
 bool kalyakina_a_shell_with_simple_merge_tbb::ShellSortTBB::RunImpl() {
+  presort_stats_ = ppc::core::AdaptiveSort(
+      std::span<int>(output_), [this](std::span<int> /*data*/) { SortAndMerge(); },
+      static_cast<size_t>(ppc::util::GetPPCNumThreads()), std::less<>(), ppc::core::TbbForEach{});
+  return true;
+}
+
+void kalyakina_a_shell_with_simple_merge_tbb::ShellSortTBB::SortAndMerge() {
   std::vector<std::pair<unsigned int, unsigned int>> bounds;
   unsigned int num = (static_cast<unsigned int>(ppc::util::GetPPCNumThreads()) > output_.size())
                          ? output_.size()
@@ -125,7 +137,6 @@ bool kalyakina_a_shell_with_simple_merge_tbb::ShellSortTBB::RunImpl() {
     });
     num = std::ceil(static_cast<double>(num) / 2);
   }
-  return true;
 }
 
 bool kalyakina_a_shell_with_simple_merge_tbb::ShellSortTBB::PostProcessingImpl() {
@@ -10,33 +10,14 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <cstring>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/key_transform.hpp"
+#include "core/sort/include/tbb_adapters.hpp"
+
 namespace khovansky_d_double_radix_batcher_tbb {
 namespace {
-uint64_t EncodeDoubleToUint64(double value) {
-  uint64_t bit_representation = 0;
-  std::memcpy(&bit_representation, &value, sizeof(value));
-
-  if ((bit_representation >> 63) != 0) {
-    return ~bit_representation;
-  }
-  return bit_representation ^ (1ULL << 63);
-}
-
-double DecodeUint64ToDouble(uint64_t encoded) {
-  if ((encoded >> 63) != 0) {
-    encoded ^= (1ULL << 63);
-  } else {
-    encoded = ~encoded;
-  }
-
-  double result = 0.0;
-  std::memcpy(&result, &encoded, sizeof(result));
-  return result;
-}
-
 void RadixSort(std::vector<uint64_t>& array) {
   const int bits_in_byte = 8;
   const int total_bits = 64;
@@ -98,17 +79,11 @@ void BatcherOddEvenMerge(std::vector<uint64_t>& array, int left, int right, int
   }
 }
 
-void RadixBatcherSort(std::vector<double>& data) {
-  std::vector<uint64_t> transformed_data(data.size(), 0);
-
-  int max_parallel_depth = int(std::log2(data.size()) + 1);
+void RadixBatcherSort(std::vector<uint64_t>& keys) {
+  int max_parallel_depth = int(std::log2(keys.size()) + 1);
 
-  tbb::parallel_for(size_t(0), data.size(), [&](size_t i) { transformed_data[i] = EncodeDoubleToUint64(data[i]); });
-
-  RadixSort(transformed_data);
-  BatcherOddEvenMerge(transformed_data, 0, static_cast<int>(transformed_data.size()), max_parallel_depth);
-
-  tbb::parallel_for(size_t(0), data.size(), [&](size_t i) { data[i] = DecodeUint64ToDouble(transformed_data[i]); });
+  RadixSort(keys);
+  BatcherOddEvenMerge(keys, 0, static_cast<int>(keys.size()), max_parallel_depth);
 }
 }  // namespace
 }  // namespace khovansky_d_double_radix_batcher_tbb
@@ -117,10 +92,10 @@ bool khovansky_d_double_radix_batcher_tbb::RadixTBB::PreProcessingImpl() {
   auto* in_ptr = reinterpret_cast<double*>(task_data->inputs[0]);
 
   unsigned int input_size = task_data->inputs_count[0];
-  unsigned int output_size = task_data->outputs_count[0];
 
-  input_ = std::vector<double>(in_ptr, in_ptr + input_size);
-  output_ = std::vector<double>(output_size, 0);
+  keys_.resize(input_size);
+  ppc::core::ToRadixKeys(std::span<const double>(in_ptr, input_size), std::span<uint64_t>(keys_),
+                         ppc::core::TbbForEach{});
 
   return true;
 }
@@ -146,15 +121,14 @@ bool khovansky_d_double_radix_batcher_tbb::RadixTBB::ValidationImpl() {
 }
 
 bool khovansky_d_double_radix_batcher_tbb::RadixTBB::RunImpl() {
-  output_ = input_;
-  khovansky_d_double_radix_batcher_tbb::RadixBatcherSort(output_);
+  khovansky_d_double_radix_batcher_tbb::RadixBatcherSort(keys_);
   return true;
 }
 
 bool khovansky_d_double_radix_batcher_tbb::RadixTBB::PostProcessingImpl() {
-  for (size_t i = 0; i < output_.size(); i++) {
-    reinterpret_cast<double*>(task_data->outputs[0])[i] = output_[i];
-  }
+  auto* out_ptr = reinterpret_cast<double*>(task_data->outputs[0]);
+  ppc::core::FromRadixKeys(std::span<const uint64_t>(keys_), std::span<double>(out_ptr, keys_.size()),
+                           ppc::core::TbbForEach{});
 
   return true;
 }
@@ -1,6 +1,5 @@
 #include "tbb/kolodkin_g_multiplication_matrix_CRS/include/ops_tbb.hpp"
 
-#include <oneapi/tbb/parallel_for.h>
 #include <tbb/tbb.h>
 
 #include <cmath>
@@ -10,6 +9,9 @@
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/tbb_adapters.hpp"
+#include "core/sparse/include/spgemm.hpp"
+
 void kolodkin_g_multiplication_matrix_tbb::SparseMatrixCRS::AddValue(int row, Complex value, int col) {
   bool found = false;
   for (int j = rowPtr[row]; j < rowPtr[row + 1]; j++) {
@@ -137,38 +139,32 @@ bool kolodkin_g_multiplication_matrix_tbb::TestTaskTBB::PreProcessingImpl() {
 bool kolodkin_g_multiplication_matrix_tbb::TestTaskTBB::ValidationImpl() {
   unsigned int input_size = task_data->inputs_count[0];
   auto* in_ptr = reinterpret_cast<Complex*>(task_data->inputs[0]);
+  if (input_size < 5) {
+    return false;
+  }
   std::vector<Complex> vec = std::vector<Complex>(in_ptr, in_ptr + input_size);
-  return !(vec[1] != vec[5 + (int)(vec[2].real() + vec[3].real() + vec[4].real())].real());
+  auto b_offset = 5 + (unsigned int)(vec[2].real() + vec[3].real() + vec[4].real());
+  return b_offset < input_size && vec[1] == vec[b_offset].real();
 }
 
 bool kolodkin_g_multiplication_matrix_tbb::TestTaskTBB::RunImpl() {
+  // The rows of A * B are the columns of B^T A^T, so the compressed rows multiply with the operands swapped
+  const ppc::core::CompressedView<Complex> a{.lines = static_cast<size_t>(A_.numRows),
+                                             .extent = static_cast<size_t>(A_.numCols),
+                                             .ptr = A_.rowPtr,
+                                             .idx = A_.colIndices,
+                                             .val = A_.values};
+  const ppc::core::CompressedView<Complex> b{.lines = static_cast<size_t>(B_.numRows),
+                                             .extent = static_cast<size_t>(B_.numCols),
+                                             .ptr = B_.rowPtr,
+                                             .idx = B_.colIndices,
+                                             .val = B_.values};
+  auto product = ppc::core::SpGemm(b, a, ppc::core::TbbForEach{});
   SparseMatrixCRS c(A_.numRows, B_.numCols);
-
-  std::vector<std::vector<std::pair<int, Complex>>> local_results(A_.numRows);
-
-  tbb::parallel_for(tbb::blocked_range<unsigned int>(0, A_.numRows), [&](const tbb::blocked_range<unsigned int>& r) {
-    for (unsigned int i = r.begin(); i < r.end(); ++i) {
-      for (unsigned int j = A_.rowPtr[i]; j < (unsigned int)A_.rowPtr[i + 1]; ++j) {
-        unsigned int col_a = A_.colIndices[j];
-        Complex value_a = A_.values[j];
-
-        for (unsigned int k = B_.rowPtr[col_a]; k < (unsigned int)B_.rowPtr[col_a + 1]; ++k) {
-          unsigned int col_b = B_.colIndices[k];
-          Complex value_b = B_.values[k];
-          local_results[i].emplace_back(col_b, value_a * value_b);
-        }
-      }
-    }
-  });
-
-  for (size_t row_index = 0; row_index < local_results.size(); ++row_index) {
-    for (const auto& [col_index, value] : local_results[row_index]) {
-      c.AddValue(static_cast<int>(row_index), value, col_index);
-    }
-  }
-
+  c.values = std::move(product.val);
+  c.colIndices = std::move(product.idx);
+  c.rowPtr = std::move(product.ptr);
   output_ = ParseMatrixIntoVec(c);
-
   return true;
 }
 
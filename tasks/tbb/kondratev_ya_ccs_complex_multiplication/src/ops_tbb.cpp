@@ -1,14 +1,14 @@
 #include "tbb/kondratev_ya_ccs_complex_multiplication/include/ops_tbb.hpp"
 
-#include <oneapi/tbb/parallel_for.h>
-
-#include <algorithm>
 #include <cmath>
 #include <complex>
-#include <numeric>
+#include <cstddef>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/tbb_adapters.hpp"
+#include "core/sparse/include/spgemm.hpp"
+
 bool kondratev_ya_ccs_complex_multiplication_tbb::IsZero(const std::complex<double> &value) {
   return std::norm(value) < kEpsilonForZero;
 }
@@ -50,56 +50,22 @@ bool kondratev_ya_ccs_complex_multiplication_tbb::TestTaskTBB::PostProcessingImp
 
 kondratev_ya_ccs_complex_multiplication_tbb::CCSMatrix
 kondratev_ya_ccs_complex_multiplication_tbb::CCSMatrix::operator*(const CCSMatrix &other) const {
-  CCSMatrix result({rows, other.cols});
-  result.values.reserve(std::min(rows * other.cols, static_cast<int>(values.size() * other.values.size())));
-  result.row_index.reserve(result.values.capacity());
-  result.col_ptrs.resize(other.cols + 1, 0);
-
-  std::vector<std::vector<std::pair<int, std::complex<double>>>> temp_cols(other.cols);
-
-  tbb::parallel_for(0, other.cols, [&](int result_col) {
-    std::vector<std::complex<double>> local_temp_col(rows, std::complex<double>(0.0, 0.0));
-
-    for (int k = other.col_ptrs[result_col]; k < other.col_ptrs[result_col + 1]; k++) {
-      int row_other = other.row_index[k];
-      std::complex<double> val_other = other.values[k];
-
-      for (int i = col_ptrs[row_other]; i < col_ptrs[row_other + 1]; i++) {
-        int row_this = row_index[i];
-        local_temp_col[row_this] += values[i] * val_other;
-      }
-    }
-
-    for (int i = 0; i < rows; i++) {
-      if (!IsZero(local_temp_col[i])) {
-        temp_cols[result_col].emplace_back(i, local_temp_col[i]);
-      }
-    }
-  });
-
-  std::vector<int> col_sizes(other.cols);
-  std::ranges::transform(temp_cols, col_sizes.begin(), [](const auto &col) { return static_cast<int>(col.size()); });
-
-  std::vector<int> col_offsets(other.cols + 1, 0);
-  std::partial_sum(col_sizes.begin(), col_sizes.end(), col_offsets.begin() + 1);
-
-  int total_nonzero = col_offsets[other.cols];
-  result.values.resize(total_nonzero);
-  result.row_index.resize(total_nonzero);
-
-  for (int i = 0; i <= other.cols; i++) {
-    result.col_ptrs[i] = col_offsets[i];
-  }
-
-  tbb::parallel_for(0, other.cols, [&](int col) {
-    int offset = col_offsets[col];
-
-    for (const auto &[row, value] : temp_cols[col]) {
-      result.row_index[offset] = row;
-      result.values[offset] = value;
-      offset++;
-    }
-  });
+  const ppc::core::CompressedView<std::complex<double>> a{.lines = static_cast<size_t>(cols),
+                                                          .extent = static_cast<size_t>(rows),
+                                                          .ptr = col_ptrs,
+                                                          .idx = row_index,
+                                                          .val = values};
+  const ppc::core::CompressedView<std::complex<double>> b{.lines = static_cast<size_t>(other.cols),
+                                                          .extent = static_cast<size_t>(other.rows),
+                                                          .ptr = other.col_ptrs,
+                                                          .idx = other.row_index,
+                                                          .val = other.values};
+  auto product = ppc::core::SpGemm(a, b, ppc::core::TbbForEach{},
+                                   [](const std::complex<double> &value) { return !IsZero(value); });
 
+  CCSMatrix result({rows, other.cols});
+  result.values = std::move(product.val);
+  result.row_index = std::move(product.idx);
+  result.col_ptrs = std::move(product.ptr);
   return result;
 }
\ No newline at end of file
@@ -1,10 +1,7 @@
 #pragma once
-#include <tbb/tbb.h>
-
 #include <vector>
 
 #include "core/task/include/task.hpp"
-#include "oneapi/tbb/concurrent_unordered_map.h"
 
 namespace konkov_i_sparse_matmul_ccs {
 
@@ -15,8 +12,6 @@ class SparseMatmulTask : public ppc::core::Task {
   bool ValidationImpl() override;
   bool PreProcessingImpl() override;
   bool RunImpl() override;
-  void MultiplySparseMatrices(std::vector<tbb::concurrent_unordered_map<int, double>>& column_map);
-  void BuildResultMatrix(const std::vector<tbb::concurrent_unordered_map<int, double>>& column_map);
   bool PostProcessingImpl() override;
 
   std::vector<double> A_values, B_values, C_values;
@@ -40,10 +40,6 @@ class SparseMatrixMultComplexCCS : public ppc::core::Task {
   SparseMatrixCCS* matrix1_;
   SparseMatrixCCS* matrix2_;
   SparseMatrixCCS result_;
-
-  void ComputeColumn(int col_idx, std::vector<std::pair<Complex, int>>& column_data);
-  Complex ComputeElement(int row_idx, int col_start2, int col_end2);
-  Complex ComputeContribution(int row_idx, int k, int col_start1, int col_end1, int col_start2, int col_end2);
 };
 
 }  // namespace korneeva_e_sparse_matrix_mult_complex_ccs_tbb
\ No newline at end of file
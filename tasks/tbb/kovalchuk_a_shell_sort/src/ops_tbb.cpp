@@ -3,10 +3,16 @@
 #include <tbb/parallel_for.h>
 
 #include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
+#include "core/sort/include/tbb_adapters.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
 #include "oneapi/tbb/parallel_for.h"
 
 namespace kovalchuk_a_shell_sort_tbb {
@@ -25,7 +31,9 @@ bool ShellSortTBB::ValidationImpl() {
 }
 
 bool ShellSortTBB::RunImpl() {
-  ShellSort();
+  presort_stats_ = ppc::core::AdaptiveSort(
+      std::span<int>(input_), [this](std::span<int> /*data*/) { ShellSort(); },
+      static_cast<size_t>(ppc::util::GetPPCNumThreads()), std::less<>(), ppc::core::TbbForEach{});
   return true;
 }
 
@@ -2,8 +2,10 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
 #include "core/util/include/util.hpp"
 #include "oneapi/tbb/parallel_for.h"
 #include "oneapi/tbb/task_arena.h"
@@ -41,31 +43,13 @@ bool moiseev_a_mult_mat_tbb::MultMatTBB::RunImpl() {
   oneapi::tbb::task_arena arena(ppc::util::GetPPCNumThreads());
   arena.execute([&] {
     oneapi::tbb::parallel_for(0, num_blocks_, [&](int block_row) {
-      for (int block_col = 0; block_col < num_blocks_; ++block_col) {
-        for (int block_step = 0; block_step < num_blocks_; ++block_step) {
-          int a_block_col = (block_row + block_step) % num_blocks_;
-          int b_block_row = a_block_col;
-
-          int block_row_start = block_row * block_size_;
-          int block_col_start = block_col * block_size_;
-          int a_col_start = a_block_col * block_size_;
-          int b_row_start = b_block_row * block_size_;
-
-          for (int row_offset = 0; row_offset < block_size_; ++row_offset) {
-            for (int col_offset = 0; col_offset < block_size_; ++col_offset) {
-              double block_result = 0.0;
-              for (int inner_dim_offset = 0; inner_dim_offset < block_size_; ++inner_dim_offset) {
-                double a_element =
-                    matrix_a_[((block_row_start + row_offset) * matrix_size_) + (a_col_start + inner_dim_offset)];
-                double b_element =
-                    matrix_b_[((b_row_start + inner_dim_offset) * matrix_size_) + (block_col_start + col_offset)];
-                block_result += a_element * b_element;
-              }
-              matrix_c_[((block_row_start + row_offset) * matrix_size_) + (block_col_start + col_offset)] +=
-                  block_result;
-            }
-          }
-        }
+      // One strip GEMM per step covers every block column of the row (they share the block of A)
+      for (int block_step = 0; block_step < num_blocks_; ++block_step) {
+        const auto row_start = static_cast<size_t>(block_row) * block_size_;
+        const auto a_col_start = static_cast<size_t>((block_row + block_step) % num_blocks_) * block_size_;
+        ppc::core::Gemm(block_size_, matrix_size_, block_size_, &matrix_a_[(row_start * matrix_size_) + a_col_start],
+                        matrix_size_, &matrix_b_[a_col_start * matrix_size_], matrix_size_,
+                        &matrix_c_[row_start * matrix_size_], matrix_size_);
       }
     });
   });
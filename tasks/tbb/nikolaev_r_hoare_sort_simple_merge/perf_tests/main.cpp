@@ -1,15 +1,27 @@
 #include <gtest/gtest.h>
+#include <tbb/tbb.h>
 
 #include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <random>
+#include <span>
+#include <string>
+#include <utility>
 #include <vector>
 
+#include "core/perf/include/call_timing.hpp"
 #include "core/perf/include/perf.hpp"
+#include "core/sort/include/multiway_merge.hpp"
+#include "core/sort/include/parallel_quicksort.hpp"
+#include "core/sort/include/tbb_adapters.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
+#include "oneapi/tbb/task_arena.h"
+#include "oneapi/tbb/task_group.h"
 #include "tbb/nikolaev_r_hoare_sort_simple_merge/include/ops_tbb.hpp"
 
 namespace {
@@ -27,6 +39,25 @@ std::vector<double> GenerateRandomVector(size_t len, double min_val = -1000.0, d
   return vect;
 }
 
+// The approach the task used before: one segment per thread sorted on its own, then one merge
+// of all segments into a second buffer
+void SegmentSortAndMerge(std::vector<double> &data, int num_segments) {
+  std::vector<std::span<const double>> runs;
+  oneapi::tbb::task_group group;
+  for (int i = 0; i < num_segments; ++i) {
+    const size_t begin = data.size() * i / num_segments;
+    const size_t end = data.size() * (i + 1) / num_segments;
+    runs.emplace_back(data.data() + begin, end - begin);
+    group.run([&data, begin, end] {
+      std::sort(data.begin() + static_cast<std::ptrdiff_t>(begin), data.begin() + static_cast<std::ptrdiff_t>(end));
+    });
+  }
+  group.wait();
+  std::vector<double> merged(data.size());
+  ppc::core::MultiwayMerge<double>(runs, merged, num_segments, std::less<>(), ppc::core::TbbForEach{});
+  data = std::move(merged);
+}
+
 }  // namespace
 
 TEST(nikolaev_r_hoare_sort_simple_merge_tbb, test_pipeline_run) {
@@ -101,4 +132,44 @@ TEST(nikolaev_r_hoare_sort_simple_merge_tbb, test_task_run) {
   std::ranges::sort(ref);
 
   EXPECT_EQ(out, ref);
-}
\ No newline at end of file
+}
+
+TEST(nikolaev_r_hoare_sort_simple_merge_tbb, test_quicksort_against_segment_merge) {
+  constexpr size_t kLen = 4000000;
+
+  std::vector<std::pair<std::string, std::vector<double>>> inputs;
+  auto random = GenerateRandomVector(kLen);
+  inputs.emplace_back("random", random);
+  std::ranges::sort(random);
+  inputs.emplace_back("sorted", random);
+  std::ranges::reverse(random);
+  inputs.emplace_back("reverse", random);
+  std::mt19937 gen(1);
+  for (auto &value : random) {
+    value = static_cast<double>(gen() % 16);
+  }
+  inputs.emplace_back("duplicates", random);
+
+  const int num_threads = ppc::util::GetPPCNumThreads();
+  oneapi::tbb::task_arena arena(num_threads);
+  for (const auto &[name, input] : inputs) {
+    std::vector<double> merged;
+    const double merge_time = ppc::core::BestTaskRun(kLen, [&] {
+      merged = input;
+      arena.execute([&] { SegmentSortAndMerge(merged, num_threads); });
+    });
+    std::vector<double> sorted;
+    const double quicksort_time = ppc::core::BestTaskRun(kLen, [&] {
+      sorted = input;
+      arena.execute([&] {
+        ppc::core::ParallelQuickSort(std::span<double>(sorted), num_threads, std::less<>(), ppc::core::TbbInvoke{},
+                                     ppc::core::TbbForEach{});
+      });
+    });
+
+    ppc::core::RecordFigure(name + "_segment_merge_s", merge_time);
+    ppc::core::RecordFigure(name + "_quicksort_s", quicksort_time);
+    ppc::core::RecordFigure(name + "_speedup", merge_time / quicksort_time);
+    EXPECT_EQ(sorted, merged) << name;
+  }
+}
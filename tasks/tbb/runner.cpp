@@ -1,12 +1,23 @@
 #include <gtest/gtest.h>
 #include <tbb/global_control.h>
 
+#include <memory>
+
+#include "core/util/include/tbb_affinity.hpp"
 #include "core/util/include/util.hpp"
 #include "oneapi/tbb/global_control.h"
 
 int main(int argc, char** argv) {
+  const auto affinity = ppc::util::MakeTbbAffinityObserver();
+
   // Limit the number of threads in TBB
-  tbb::global_control control(tbb::global_control::max_allowed_parallelism, ppc::util::GetPPCNumThreads());
+  auto control = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism,
+                                                       ppc::util::GetPPCNumThreads());
+  ppc::util::AddNumThreadsHandler([&control](int num_threads) {
+    // The most restrictive active control wins, so the previous one is released first
+    control.reset();
+    control = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism, num_threads);
+  });
 
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
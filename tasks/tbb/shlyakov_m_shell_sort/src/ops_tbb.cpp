@@ -6,9 +6,14 @@
 #include <algorithm>
 #include <core/util/include/util.hpp>
 #include <cstddef>
+#include <functional>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
+#include "core/sort/include/tbb_adapters.hpp"
+
 namespace shlyakov_m_shell_sort_tbb {
 
 bool TestTaskTBB::PreProcessingImpl() {
@@ -23,9 +28,17 @@ bool TestTaskTBB::PreProcessingImpl() {
 bool TestTaskTBB::ValidationImpl() { return task_data->inputs_count[0] == task_data->outputs_count[0]; }
 
 bool TestTaskTBB::RunImpl() {
+  presort_stats_ = ppc::core::AdaptiveSort(
+      std::span<int>(input_), [this](std::span<int> /*data*/) { SortAndMerge(); },
+      static_cast<size_t>(ppc::util::GetPPCNumThreads()), std::less<>(), ppc::core::TbbForEach{});
+  output_ = input_;
+  return true;
+}
+
+void TestTaskTBB::SortAndMerge() {
   const int n = static_cast<int>(input_.size());
   if (n < 2) {
-    return true;
+    return;
   }
 
   const int max_threads = ppc::util::GetPPCNumThreads();
@@ -58,9 +71,6 @@ bool TestTaskTBB::RunImpl() {
     Merge(0, end, r, input_, buf);
     end = r;
   }
-
-  output_ = input_;
-  return true;
 }
 
 void ShellSort(int left, int right, std::vector<int>& arr) {
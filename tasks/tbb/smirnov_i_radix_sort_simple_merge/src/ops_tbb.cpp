@@ -3,13 +3,14 @@
 #include <tbb/tbb.h>
 
 #include <algorithm>
-#include <cmath>
 #include <cstddef>
 #include <deque>
-#include <numeric>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/radix_sort.hpp"
+
 #include "oneapi/tbb/mutex.h"
 #include "oneapi/tbb/task_arena.h"
 #include "oneapi/tbb/task_group.h"
@@ -45,26 +46,7 @@ std::vector<int> smirnov_i_radix_sort_simple_merge_tbb::TestTaskTBB::Merge(std::
   return res;
 }
 void smirnov_i_radix_sort_simple_merge_tbb::TestTaskTBB::RadixSort(std::vector<int>& mas) {
-  if (mas.empty()) {
-    return;
-  }
-  int longest = *std::ranges::max_element(mas.begin(), mas.end());
-  int len = std::ceil(std::log10(longest + 1));
-  std::vector<int> sorting(mas.size());
-  int base = 1;
-  for (int j = 0; j < len; j++, base *= 10) {
-    std::vector<int> counting(10, 0);
-    for (size_t i = 0; i < mas.size(); i++) {
-      counting[mas[i] / base % 10]++;
-    }
-    std::partial_sum(counting.begin(), counting.end(), counting.begin());
-    for (int i = static_cast<int>(mas.size() - 1); i >= 0; i--) {
-      int pos = counting[mas[i] / base % 10] - 1;
-      sorting[pos] = mas[i];
-      counting[mas[i] / base % 10]--;
-    }
-    std::swap(mas, sorting);
-  }
+  ppc::core::RadixSort(std::span<int>(mas));
 }
 void smirnov_i_radix_sort_simple_merge_tbb::TestTaskTBB::SortChunk(int i, int size, int nth, int& start,
                                                                    tbb::mutex& mtx_start, tbb::mutex& mtx_firstdq,
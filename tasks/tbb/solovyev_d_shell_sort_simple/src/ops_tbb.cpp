@@ -4,8 +4,14 @@
 
 #include <cmath>
 #include <cstddef>
+#include <functional>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
+#include "core/sort/include/tbb_adapters.hpp"
+#include "core/util/include/util.hpp"
+
 bool solovyev_d_shell_sort_simple_tbb::TaskTBB::PreProcessingImpl() {
   size_t input_size = task_data->inputs_count[0];
   auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
@@ -19,6 +25,13 @@ bool solovyev_d_shell_sort_simple_tbb::TaskTBB::ValidationImpl() {
 }
 
 bool solovyev_d_shell_sort_simple_tbb::TaskTBB::RunImpl() {
+  presort_stats_ = ppc::core::AdaptiveSort(
+      std::span<int>(input_), [this](std::span<int> /*data*/) { ShellSort(); },
+      static_cast<size_t>(ppc::util::GetPPCNumThreads()), std::less<>(), ppc::core::TbbForEach{});
+  return true;
+}
+
+void solovyev_d_shell_sort_simple_tbb::TaskTBB::ShellSort() {
   for (int gap = static_cast<int>(input_.size()) / 2; gap > 0; gap /= 2) {
     tbb::parallel_for(0, gap, [this, gap](int i) {
       for (size_t f = gap + i; f < input_.size(); f += gap) {
@@ -32,7 +45,6 @@ bool solovyev_d_shell_sort_simple_tbb::TaskTBB::RunImpl() {
       }
     });
   }
-  return true;
 }
 
 bool solovyev_d_shell_sort_simple_tbb::TaskTBB::PostProcessingImpl() {
@@ -5,8 +5,12 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/presortedness.hpp"
+#include "core/sort/include/tbb_adapters.hpp"
 #include "core/util/include/util.hpp"
 
 void sotskov_a_shell_sorting_with_simple_merging_tbb::ShellSort(std::vector<int>& arr, int left, int right) {
@@ -102,7 +106,11 @@ bool sotskov_a_shell_sorting_with_simple_merging_tbb::TestTaskTBB::ValidationImp
 bool sotskov_a_shell_sorting_with_simple_merging_tbb::TestTaskTBB::RunImpl() {
   int num_threads = ppc::util::GetPPCNumThreads();
   oneapi::tbb::task_arena arena(num_threads);
-  arena.execute([&] { ShellSortWithSimpleMerging(input_); });
+  arena.execute([&] {
+    presort_stats_ = ppc::core::AdaptiveSort(
+        std::span<int>(input_), [this](std::span<int> /*data*/) { ShellSortWithSimpleMerging(input_); },
+        static_cast<size_t>(num_threads), std::less<>(), ppc::core::TbbForEach{});
+  });
   return true;
 }
 
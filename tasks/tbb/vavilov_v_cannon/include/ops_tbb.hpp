@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/gemm/include/cannon_grid.hpp"
 #include "core/task/include/task.hpp"
 
 namespace vavilov_v_cannon_tbb {
@@ -25,10 +26,6 @@ class CannonTBB : public ppc::core::Task {
   std::vector<double> B_;
   std::vector<double> C_;
 
-  void InitialShift();
-  void BlockMultiply();
-  void ShiftBlocks();
-  void CopyBlocksToLocal(std::vector<double>& a_block, std::vector<double>& b_block, int base_row, int base_col);
-  void ComputeBlock(const std::vector<double>& a_block, const std::vector<double>& b_block, int base_row, int base_col);
+  void BlockMultiply(const ppc::core::CannonGrid& grid);
 };
 }  // namespace vavilov_v_cannon_tbb
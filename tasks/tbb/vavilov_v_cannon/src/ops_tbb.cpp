@@ -6,8 +6,12 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/gemm/include/cannon_grid.hpp"
+#include "core/gemm/include/gemm.hpp"
 #include "core/util/include/util.hpp"
 #include "oneapi/tbb/task_arena.h"
 
@@ -18,9 +22,13 @@ bool vavilov_v_cannon_tbb::CannonTBB::PreProcessingImpl() {
 
   auto* a = reinterpret_cast<double*>(task_data->inputs[0]);
   auto* b = reinterpret_cast<double*>(task_data->inputs[1]);
-  A_.assign(a, a + (N_ * N_));
-  B_.assign(b, b + (N_ * N_));
-  C_.assign(N_ * N_, 0);
+  // A and B live in block-major tiles for the whole run, Cannon's shifts only remap tile indices
+  const auto size = static_cast<size_t>(N_) * N_;
+  A_.resize(size);
+  B_.resize(size);
+  ppc::core::ToBlockMajor(std::span<const double>(a, size), N_, num_blocks_, A_);
+  ppc::core::ToBlockMajor(std::span<const double>(b, size), N_, num_blocks_, B_);
+  C_.assign(size, 0);
 
   return true;
 }
@@ -36,110 +44,31 @@ bool vavilov_v_cannon_tbb::CannonTBB::ValidationImpl() {
   return n % num_blocks == 0;
 }
 
-void vavilov_v_cannon_tbb::CannonTBB::InitialShift() {
-  std::vector<double> a_tmp = A_;
-  std::vector<double> b_tmp = B_;
-  tbb::parallel_for(tbb::blocked_range2d<int>(0, num_blocks_, 0, num_blocks_), [&](const tbb::blocked_range2d<int>& r) {
-    for (int bi = r.rows().begin(); bi != r.rows().end(); ++bi) {
-      for (int bj = r.cols().begin(); bj != r.cols().end(); ++bj) {
-        int src_row = (bi + bj) % num_blocks_;
-        int src_col = (bj + bi) % num_blocks_;
-        for (int i = 0; i < block_size_; ++i) {
-          for (int j = 0; j < block_size_; ++j) {
-            B_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-                b_tmp[(((src_row * block_size_) + i) * N_) + ((bj * block_size_) + j)];
-            A_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-                a_tmp[(((bi * block_size_) + i) * N_) + ((src_col * block_size_) + j)];
-          }
-        }
-      }
-    }
-  });
-}
-
-void vavilov_v_cannon_tbb::CannonTBB::CopyBlocksToLocal(std::vector<double>& a_block, std::vector<double>& b_block,
-                                                        int base_row, int base_col) {
-  for (int i = 0; i < block_size_ && base_row + i < N_; ++i) {
-    for (int k = 0; k < block_size_ && base_col + k < N_; ++k) {
-      a_block[(i * block_size_) + k] = A_[((base_row + i) * N_) + (base_col + k)];
-      b_block[(k * block_size_) + i] = B_[((base_row + k) * N_) + (base_col + i)];
-    }
-  }
-}
-
-void vavilov_v_cannon_tbb::CannonTBB::ComputeBlock(const std::vector<double>& a_block,
-                                                   const std::vector<double>& b_block, int base_row, int base_col) {
-  for (int i = 0; i < block_size_ && base_row + i < N_; ++i) {
-    int row = base_row + i;
-    for (int j = 0; j < block_size_ && base_col + j < N_; ++j) {
-      int col = base_col + j;
-      double temp = 0.0;
-      int k = 0;
-
-      for (; k <= block_size_ - 4; k += 4) {
-        temp += a_block[(i * block_size_) + k] * b_block[(k * block_size_) + j] +
-                a_block[(i * block_size_) + k + 1] * b_block[((k + 1) * block_size_) + j] +
-                a_block[(i * block_size_) + k + 2] * b_block[((k + 2) * block_size_) + j] +
-                a_block[(i * block_size_) + k + 3] * b_block[((k + 3) * block_size_) + j];
-      }
-
-      for (; k < block_size_ && base_row + k < N_; ++k) {
-        temp += a_block[(i * block_size_) + k] * b_block[(k * block_size_) + j];
-      }
-
-      C_[(row * N_) + col] += temp;
-    }
-  }
-}
-
-void vavilov_v_cannon_tbb::CannonTBB::BlockMultiply() {
+void vavilov_v_cannon_tbb::CannonTBB::BlockMultiply(const ppc::core::CannonGrid& grid) {
+  const size_t tile = static_cast<size_t>(block_size_) * block_size_;
   oneapi::tbb::parallel_for(
       oneapi::tbb::blocked_range2d<int>(0, num_blocks_, 0, num_blocks_),
       [&](const oneapi::tbb::blocked_range2d<int>& r) {
-        std::vector<double> a_block(block_size_ * block_size_);
-        std::vector<double> b_block(block_size_ * block_size_);
-
         for (int bi = r.rows().begin(); bi != r.rows().end(); ++bi) {
           for (int bj = r.cols().begin(); bj != r.cols().end(); ++bj) {
-            int base_row = bi * block_size_;
-            int base_col = bj * block_size_;
-
-            CopyBlocksToLocal(a_block, b_block, base_row, base_col);
-            ComputeBlock(a_block, b_block, base_row, base_col);
+            const size_t c_offset =
+                (static_cast<size_t>(bi) * block_size_ * N_) + (static_cast<size_t>(bj) * block_size_);
+            ppc::core::Gemm(block_size_, block_size_, block_size_, &A_[grid.ATile(bi, bj) * tile], block_size_,
+                            &B_[grid.BTile(bi, bj) * tile], block_size_, &C_[c_offset], N_);
           }
         }
       },
       oneapi::tbb::auto_partitioner());
 }
 
-void vavilov_v_cannon_tbb::CannonTBB::ShiftBlocks() {
-  std::vector<double> a_tmp = A_;
-  std::vector<double> b_tmp = B_;
-  tbb::parallel_for(tbb::blocked_range2d<int>(0, num_blocks_, 0, num_blocks_), [&](const tbb::blocked_range2d<int>& r) {
-    for (int bi = r.rows().begin(); bi != r.rows().end(); ++bi) {
-      for (int bj = r.cols().begin(); bj != r.cols().end(); ++bj) {
-        int src_row = (bi + 1) % num_blocks_;
-        int src_col = (bj + 1) % num_blocks_;
-        for (int i = 0; i < block_size_; ++i) {
-          for (int j = 0; j < block_size_; ++j) {
-            B_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-                b_tmp[(((src_row * block_size_) + i) * N_) + ((bj * block_size_) + j)];
-            A_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-                a_tmp[(((bi * block_size_) + i) * N_) + ((src_col * block_size_) + j)];
-          }
-        }
-      }
-    }
-  });
-}
-
 bool vavilov_v_cannon_tbb::CannonTBB::RunImpl() {
   oneapi::tbb::task_arena arena(ppc::util::GetPPCNumThreads());
   arena.execute([&]() {
-    InitialShift();
+    ppc::core::CannonGrid grid(num_blocks_);
+    grid.InitialShift();
     for (int iter = 0; iter < num_blocks_; ++iter) {
-      BlockMultiply();
-      ShiftBlocks();
+      BlockMultiply(grid);
+      grid.Shift();
     }
   });
   return true;
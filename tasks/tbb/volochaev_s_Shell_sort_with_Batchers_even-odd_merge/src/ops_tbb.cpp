@@ -4,8 +4,10 @@
 #include <cmath>
 #include <limits>
 #include <ranges>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/sorting_network.hpp"
 #include "oneapi/tbb/parallel_for.h"
 #include "oneapi/tbb/task_arena.h"
 
@@ -23,103 +25,33 @@ bool volochaev_s_shell_sort_with_batchers_even_odd_merge_tbb::ShellSortTBB::Vali
   return task_data->inputs_count[0] > 0 && task_data->inputs_count[0] == task_data->outputs_count[0];
 }
 
-void volochaev_s_shell_sort_with_batchers_even_odd_merge_tbb::ShellSortTBB::ShellSort(int start) {
-  int n = mini_batch_;
-
-  int gap = 1;
-  while (gap < n / 3) {
-    gap = 3 * gap + 1;
-  }
-
-  while (gap >= 1) {
-    for (int i = start + gap; i < start + mini_batch_; ++i) {
-      int temp = mass_[i];
-      int j = i;
-      while (j >= start + gap && mass_[j - gap] > temp) {
-        mass_[j] = mass_[j - gap];
-        j -= gap;
-      }
-      mass_[j] = temp;
-    }
-    gap /= 3;
-  }
+void volochaev_s_shell_sort_with_batchers_even_odd_merge_tbb::ShellSortTBB::SortBlock(int start) {
+  ppc::core::NetworkSort(std::span<int>(mass_).subspan(start, mini_batch_));
 }
 
-void volochaev_s_shell_sort_with_batchers_even_odd_merge_tbb::ShellSortTBB::MergeBlocks(int id_l, int id_r, int len) {
-  int left_id = 0;
-  int right_id = 0;
-  int merged_id = 0;
-
-  while (left_id < len || right_id < len) {
-    if (left_id < len && right_id < len) {
-      if (mass_[id_l + left_id] < mass_[id_r + right_id]) {
-        array_[id_l + merged_id] = mass_[id_l + left_id];
-        left_id += 2;
-      } else {
-        array_[id_l + merged_id] = mass_[id_r + right_id];
-        right_id += 2;
-      }
-    } else if (left_id < len) {
-      array_[id_l + merged_id] = mass_[id_l + left_id];
-      left_id += 2;
-    } else {
-      array_[id_l + merged_id] = mass_[id_r + right_id];
-      right_id += 2;
-    }
-    merged_id += 2;
-  }
-
-  for (int i = 0; i < merged_id; i += 2) {
-    mass_[id_l + i] = array_[id_l + i];
-  }
-}
-
-void volochaev_s_shell_sort_with_batchers_even_odd_merge_tbb::ShellSortTBB::LastMerge() {
-  int even_index = 0;
-  int odd_index = 1;
-  int result_index = 0;
-
-  while (even_index < n_ || odd_index < n_) {
-    if (even_index < n_ && odd_index < n_) {
-      if (mass_[even_index] < mass_[odd_index]) {
-        array_[result_index++] = mass_[even_index];
-        even_index += 2;
-      } else {
-        array_[result_index++] = mass_[odd_index];
-        odd_index += 2;
-      }
-    } else if (even_index < n_) {
-      array_[result_index++] = mass_[even_index];
-      even_index += 2;
-    } else {
-      array_[result_index++] = mass_[odd_index];
-      odd_index += 2;
-    }
-  }
+void volochaev_s_shell_sort_with_batchers_even_odd_merge_tbb::ShellSortTBB::MergeBlocks(int begin, int len) {
+  const std::span<const int> runs(mass_);
+  ppc::core::BitonicMerge<int>(runs.subspan(begin, len), runs.subspan(begin + len, len),
+                               std::span<int>(array_).subspan(begin, 2 * len));
 }
 
 void volochaev_s_shell_sort_with_batchers_even_odd_merge_tbb::ShellSortTBB::Merge() {
   tbb::task_arena arena(c_threads_);
 
-  for (int i = c_threads_; i > 1; i /= 2) {
-    arena.execute([&] {
-      tbb::parallel_for(0, i / 2, [&](int id) {
-        int l = mini_batch_ * (c_threads_ / i);
-        for (int ost = 0; ost < 2; ++ost) {
-          MergeBlocks((id * 2 * l) + ost, (id * 2 * l) + l + ost, l - ost);
-        }
-      });
-    });
+  // Rounds merge neighbouring runs of mass_ into array_ and swap the two buffers, so the sorted
+  // result ends in mass_ and is swapped into array_ at the end
+  for (int len = mini_batch_; len < n_; len *= 2) {
+    arena.execute([&] { tbb::parallel_for(0, n_ / (2 * len), [&](int id) { MergeBlocks(id * 2 * len, len); }); });
+    mass_.swap(array_);
   }
-
-  LastMerge();
+  array_.swap(mass_);
 }
 
 void volochaev_s_shell_sort_with_batchers_even_odd_merge_tbb::ShellSortTBB::ParallelShellSort() {
   FindThreadVariables();
 
   tbb::task_arena arena(c_threads_);
-  arena.execute([&] { tbb::parallel_for(0, c_threads_, [&](int i) { ShellSort(i * mini_batch_); }); });
+  arena.execute([&] { tbb::parallel_for(0, c_threads_, [&](int i) { SortBlock(i * mini_batch_); }); });
 
   Merge();
 }